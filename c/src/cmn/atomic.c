@@ -28,6 +28,10 @@ DD-MMM-YYYY INIT.    SIR    Modification Description
  * ͷļ
  */
 
+#if defined(__LINUX__) || defined(__HPUX__) 
+#include <sched.h>
+#endif
+
 #include "atomic.h"
 
 
@@ -47,11 +51,48 @@ DD-MMM-YYYY INIT.    SIR    Modification Description
  */
 BOOL EpsAtomicIntCompareAndExchange (volatile int *atomic, int oldVal, int newVal)
 {  
-    int result;   
+    return __atomic_compare_exchange_n(atomic, &oldVal, newVal, FALSE,
+            __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+}
+
+/**
+ * 64λԭӲȽϲ滻
+ *
+ * @param   atomic          in  - Ƚֵ
+ *                          out - ȽϺֵ
+ * @param   oldVal          in  - ȽϾֵ
+ * @param   newVal          in  - Ƚֵ
+ *
+ * @return  atomicֵȷTRUE, 򷵻FALSE
+ */
+BOOL EpsAtomicInt64CompareAndExchange (volatile int64 *atomic, int64 oldVal, int64 newVal)
+{  
+    return __atomic_compare_exchange_n(atomic, &oldVal, newVal, FALSE,
+            __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+}
+
+/**
+ * ȴǰEPS_SPIN_PAUSE_COUNTæȣ֮ÿóCPU
+ *
+ * @param   pSpinCount      in  - ״εǰ0
+ *                          out - ۼӺ
+ */
+void EpsSpinWait(uint32* pSpinCount)
+{
+    if (*pSpinCount < EPS_SPIN_PAUSE_COUNT)
+    {
+        EpsCpuRelax();
+    }
+    else
+    {
+#if defined(__WINDOWS__)
+        SwitchToThread();
+#endif
 
-    __asm__ __volatile__ ("lock; cmpxchgl %2, %1"
-        : "=a" (result), "=m" (*atomic)         
-        : "r" (newVal), "m" (*atomic), "0" (oldVal));   
+#if defined(__LINUX__) || defined(__HPUX__) 
+        sched_yield();
+#endif
+    }
 
-    return result == oldVal;
+    (*pSpinCount)++;
 }
@@ -39,6 +39,72 @@ extern "C" {
 #include "common.h"
 
 
+/**
+ * 궨
+ */
+
+#define EPS_CACHELINE_SIZE          64      /* CPUг */
+#define EPS_CACHELINE_ALIGNED       __attribute__((aligned(EPS_CACHELINE_SIZE)))
+
+#define EPS_SPIN_PAUSE_COUNT        64      /* ȴʱóCPUǰæȴ */
+
+/*
+ * ԭӶдGCC __atomicڽx86ARM64
+ *
+ * ̷߳״̬ʱдʹEpsAtomicStore(release)ʹEpsAtomicLoad(acquire)
+ * д˺ѵͳƼʹRelaxed汾
+ */
+#define EpsAtomicLoad(ptr)                  __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+#define EpsAtomicStore(ptr, val)            __atomic_store_n((ptr), (val), __ATOMIC_RELEASE)
+#define EpsAtomicLoadRelaxed(ptr)           __atomic_load_n((ptr), __ATOMIC_RELAXED)
+#define EpsAtomicStoreRelaxed(ptr, val)     __atomic_store_n((ptr), (val), __ATOMIC_RELAXED)
+
+/*
+ * ԭӼӷؼӷǰֵ
+ */
+#define EpsAtomicFetchAdd(ptr, val)         __atomic_fetch_add((ptr), (val), __ATOMIC_ACQ_REL)
+
+/*
+ * ԭӽؽǰֵ
+ */
+#define EpsAtomicExchange(ptr, val)         __atomic_exchange_n((ptr), (val), __ATOMIC_ACQ_REL)
+
+/*
+ * д߼ۼӣʹôǰ׺ĶдָEpsAtomicLoadRelaxedȡ
+ */
+#define EpsAtomicCounterAdd(ptr, val)       \
+    __atomic_store_n((ptr), __atomic_load_n((ptr), __ATOMIC_RELAXED) + (val), __ATOMIC_RELAXED)
+
+/*
+ * ԭӱȽϲ滻ɹTRUEʧܷFALSEǰֵд*pExpected
+ */
+#define EpsAtomicCompareAndExchange(ptr, pExpected, desired)    \
+    __atomic_compare_exchange_n((ptr), (pExpected), (desired), FALSE, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)
+
+/*
+ * ȫڴϣǰдϺĶţ̸߳дһٶԷǵ
+ */
+#define EpsAtomicFence()                    __atomic_thread_fence(__ATOMIC_SEQ_CST)
+
+/*
+ * ȡ/ͷϣ: дźͷϸд룬
+ * ߸ݺԻȡϸŵٴζȡ
+ */
+#define EpsAtomicFenceAcquire()             __atomic_thread_fence(__ATOMIC_ACQUIRE)
+#define EpsAtomicFenceRelease()             __atomic_thread_fence(__ATOMIC_RELEASE)
+
+/*
+ * æʾԳ̼߳ĵӰ
+ */
+#if defined(__x86_64__) || defined(__i386__)
+#define EpsCpuRelax()                       __builtin_ia32_pause()
+#elif defined(__aarch64__) || defined(__arm__)
+#define EpsCpuRelax()                       __asm__ __volatile__ ("yield" ::: "memory")
+#else
+#define EpsCpuRelax()                       __asm__ __volatile__ ("" ::: "memory")
+#endif
+
+
 /**
  * ӿں
  */
@@ -48,6 +114,16 @@ extern "C" {
  */
 BOOL EpsAtomicIntCompareAndExchange (volatile int *atomic, int oldVal, int newVal);
 
+/*
+ * 64λԭӲȽϲ滻
+ */
+BOOL EpsAtomicInt64CompareAndExchange (volatile int64 *atomic, int64 oldVal, int64 newVal);
+
+/*
+ * ȴ
+ */
+void EpsSpinWait(uint32* pSpinCount);
+
 #ifdef __cplusplus
 }
 #endif
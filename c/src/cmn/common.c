@@ -31,6 +31,10 @@
 
 #include "common.h"
 
+#if defined(__LINUX__)
+#include <sys/epoll.h>
+#endif
+
 
 /**
  * ȫֶ
@@ -81,3 +85,177 @@ const char* EpsGetSystemError(int errCode)
 	snprintf(__defErrDscr, sizeof(__defErrDscr), "Unknown error code(%d)", errCode);
 	return __defErrDscr;
 }
+
+/**
+ * ȡǰʱں˽ʱʹͬһʱ(CLOCK_REALTIME)֮Ϊפʱ
+ *
+ * @return  1970-01-01 00:00:00 UTC
+ */
+uint64 EpsGetTimestamp()
+{
+#if defined(__WINDOWS__)
+    FILETIME ft;
+    GetSystemTimeAsFileTime(&ft);
+
+    /* FILETIMEΪ1601-01-01100 */
+    uint64 ticks = ((uint64)ft.dwHighDateTime << 32) | ft.dwLowDateTime;
+    return (ticks - 116444736000000000ULL) * 100;
+#endif
+
+#if defined(__LINUX__) || defined(__HPUX__) 
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    return (uint64)ts.tv_sec * 1000000000ULL + (uint64)ts.tv_nsec;
+#endif
+}
+
+/**
+ * ׽ģʽ
+ *
+ * @param   fd                  in  - ׽
+ * @param   isBlocking          in  - Ƿ
+ *
+ * @return  ɹ0򷵻SOCKET_ERROR
+ */
+int EpsSetSocketBlocking(SOCKET fd, BOOL isBlocking)
+{
+#if defined(__WINDOWS__)
+    u_long mode = isBlocking ? 0 : 1;
+    return ioctlsocket(fd, FIONBIO, &mode);
+#endif
+
+#if defined(__LINUX__) || defined(__HPUX__) 
+    int flags = fcntl(fd, F_GETFL, 0);
+    if (flags == -1)
+    {
+        return SOCKET_ERROR;
+    }
+
+    flags = isBlocking ? (flags & ~O_NONBLOCK) : (flags | O_NONBLOCK);
+    return fcntl(fd, F_SETFL, flags);
+#endif
+}
+
+#if defined(__LINUX__)
+
+/**
+ * ׽ں˽ʱ(SO_TIMESTAMPNS)
+ *
+ * @param   fd                  in  - ׽
+ *
+ * @return  ɹ0򷵻SOCKET_ERROR
+ */
+int EpsEnableRecvTimestamp(SOCKET fd)
+{
+    int enable = 1;
+    return setsockopt(fd, SOL_SOCKET, SO_TIMESTAMPNS, (const char*)&enable, sizeof(enable));
+}
+
+/**
+ * ӽϢĿϢлȡں˽ʱ
+ *
+ * @param   pMsg                in  - recvmsg/recvmmsgصϢͷ
+ *
+ * @return  1970-01-01 00:00:00 UTCʱʱ0
+ */
+uint64 EpsGetRecvTimestamp(struct msghdr* pMsg)
+{
+    struct cmsghdr* pCmsg = NULL;
+    for (pCmsg = CMSG_FIRSTHDR(pMsg); pCmsg != NULL; pCmsg = CMSG_NXTHDR(pMsg, pCmsg))
+    {
+        if (pCmsg->cmsg_level == SOL_SOCKET && pCmsg->cmsg_type == SCM_TIMESTAMPNS)
+        {
+            struct timespec ts;
+            memcpy(&ts, CMSG_DATA(pCmsg), sizeof(ts));
+            return (uint64)ts.tv_sec * 1000000000ULL + (uint64)ts.tv_nsec;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * Ӧ߳ģʽµȴ׽ֵepoll
+ *
+ * @return  ɹepoll򷵻-1
+ */
+int EpsCreatePollFd()
+{
+    return epoll_create1(EPOLL_CLOEXEC);
+}
+
+/**
+ * ׽ּepoll׽ֹرʱںԶƳ
+ *
+ * @param   pollFd              in  - epoll
+ * @param   fd                  in  - ׽
+ *
+ * @return  ɹ0򷵻SOCKET_ERROR
+ */
+int EpsAddPollSocket(int pollFd, SOCKET fd)
+{
+    struct epoll_event event;
+    memset(&event, 0x00, sizeof(event));
+    event.events = EPOLLIN;
+    event.data.fd = fd;
+    return epoll_ctl(pollFd, EPOLL_CTL_ADD, fd, &event);
+}
+
+/**
+ * ڽзӵ׽ּepollӽ(д)ʧʱ
+ *
+ * @param   pollFd              in  - epoll
+ * @param   fd                  in  - ׽
+ *
+ * @return  ɹ0򷵻SOCKET_ERROR
+ */
+int EpsAddPollConnectSocket(int pollFd, SOCKET fd)
+{
+    struct epoll_event event;
+    memset(&event, 0x00, sizeof(event));
+    event.events = EPOLLOUT;
+    event.data.fd = fd;
+    return epoll_ctl(pollFd, EPOLL_CTL_ADD, fd, &event);
+}
+
+/**
+ * ׽Ƴepoll
+ *
+ * @param   pollFd              in  - epoll
+ * @param   fd                  in  - ׽
+ *
+ * @return  ɹ0򷵻SOCKET_ERROR
+ */
+int EpsDelPollSocket(int pollFd, SOCKET fd)
+{
+    struct epoll_event event;
+    memset(&event, 0x00, sizeof(event));
+    return epoll_ctl(pollFd, EPOLL_CTL_DEL, fd, &event);
+}
+
+/**
+ * ȴepollϵ׽ֿɶ
+ *
+ * @param   pollFd              in  - epoll
+ * @param   timeout             in  - ȴʱ()1Ĳȡ0ʾȴ
+ *
+ * @return  ɶ׽ָʱ0-1
+ */
+int EpsWaitPollFd(int pollFd, uint64 timeout)
+{
+    struct epoll_event events[EPS_POLL_EVENT_MAX_NUM];
+    uint64 timeoutMs = (timeout + 999999) / 1000000;
+    if (timeoutMs > 0x7fffffff)
+    {
+        timeoutMs = 0x7fffffff;
+    }
+
+    int result = epoll_wait(pollFd, events, EPS_POLL_EVENT_MAX_NUM, (int)timeoutMs);
+    if (result < 0 && errno == EINTR)
+    {
+        result = 0;
+    }
+    return result;
+}
+
+#endif
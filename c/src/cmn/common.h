@@ -77,6 +77,7 @@
 #include <pthread.h>
 #include <sys/socket.h>
 #include <arpa/inet.h>
+#include <time.h>
 #endif
 
 #if defined(__WINDOWS__)
@@ -85,6 +86,8 @@
 #include <ws2tcpip.h>
 #endif
 
+#include "epsTypes.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -126,6 +129,8 @@ extern "C" {
 #define INVALID_SOCKET  (-1)
 #define SOCKET_ERROR	(-1)
 
+#define NET_EINPROGRESS EINPROGRESS
+
 typedef int         SOCKET;
 
 #endif
@@ -136,6 +141,7 @@ typedef int         SOCKET;
 #define SYS_ERRNO   GetLastError()
 
 #define SHUT_RDWR   2
+#define NET_EINPROGRESS WSAEWOULDBLOCK
 typedef int 		socklen_t;
 #endif
 
@@ -144,10 +150,14 @@ typedef int 		socklen_t;
 
 #define EPS_SOCKET_RECVBUFFER_LEN           (4096*1024) /* ׽ֽջСλ: ֽ */
 #define EPS_SOCKET_RECV_TIMEOUT             (1*1000)    /* ׽ֽճʱλ:  */
+#define EPS_SOCKET_SEND_TIMEOUT             (5*1000)    /* ׽ַͳʱλ:  */
 
-#define EPS_CHANNEL_RECONNECT_INTL          (1*1000)    /* ͨʱλ:  */
+#define EPS_CHANNEL_RECONNECT_INTL          (1*1000)    /* ͨʱ(TCPͨΪ˱)λ:  */
+#define EPS_CHANNEL_RECONNECT_MIN_INTL      (10)        /* TCPͨ˱ޣλ:  */
 #define EPS_CHANNEL_IDLE_INTL               (500)       /* ͨʱλ:  */
 
+#define EPS_POLL_EVENT_MAX_NUM              (16)        /* Ӧ߳ģʽεȴȡصľ׽ */
+
 #define EPS_DRIVER_KEEPALIVE_TIME           (35*1000)   /* Ծʱ䷧ֵλ:  */
 
 
@@ -160,6 +170,53 @@ typedef int 		socklen_t;
  */
 const char* EpsGetSystemError(int errCode);
 
+/*
+ * ȡǰʱ()
+ */
+uint64 EpsGetTimestamp();
+
+/*
+ * ׽ģʽ
+ */
+int EpsSetSocketBlocking(SOCKET fd, BOOL isBlocking);
+
+#if defined(__LINUX__)
+/*
+ * ׽ں˽ʱ
+ */
+int EpsEnableRecvTimestamp(SOCKET fd);
+
+/*
+ * ӽϢĿϢлȡں˽ʱ()
+ */
+uint64 EpsGetRecvTimestamp(struct msghdr* pMsg);
+
+/*
+ * Ӧ߳ģʽµȴ׽ֵepoll
+ */
+int EpsCreatePollFd();
+
+/*
+ * ׽ּepoll
+ */
+int EpsAddPollSocket(int pollFd, SOCKET fd);
+
+/*
+ * ӵ׽ּepoll
+ */
+int EpsAddPollConnectSocket(int pollFd, SOCKET fd);
+
+/*
+ * ׽Ƴepoll
+ */
+int EpsDelPollSocket(int pollFd, SOCKET fd);
+
+/*
+ * ȴepollϵ׽ֿɶ
+ */
+int EpsWaitPollFd(int pollFd, uint64 timeout);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,1083 @@
+/*
+ * Copyright (C) 2013, 2014 Shanghai Stock Exchange (SSE), Shanghai, China
+ * All Rights Reserved.
+ */
+
+/**
+ * @file    dispatcher.c
+ *
+ * ַ߳ʵļ
+ *
+ * @version $Id
+ * @since   2026/10/18
+ */
+
+/**
+MODIFICATION HISTORY:
+<pre>
+================================================================================
+DD-MMM-YYYY INIT.    SIR    Modification Description
+----------- -------- ------ ----------------------------------------------------
+18-OCT-2026                 
+================================================================================
+</pre>
+*/
+
+/**
+ * ͷļ
+ */
+
+#include <stddef.h>
+
+#include "common.h"
+#include "epsTypes.h"
+#include "errlib.h"
+#include "errcode.h"
+#include "atomic.h"
+#include "mktDatabase.h"
+
+#include "dispatcher.h"
+
+
+/**
+ * 궨
+ */
+
+#define EPS_DISPATCHER_IDLE_SPIN_COUNT  1024    /* ַ߳̿ʱǰ */
+#define EPS_DISPATCHER_IDLE_INTL        100     /* ַ߳̿ʱ䣬λ: ΢ */
+
+
+/**
+ * ڲ
+ */
+
+static void* DispatchTask(void* arg);
+static uint32 DrainWorker(EpsDispatcherT* pDispatcher, EpsDispatchWorkerT* pWorker);
+static void DeliverWorker(EpsDispatcherT* pDispatcher, EpsDispatchWorkerT* pWorker, uint32 count);
+static ResCodeT EnqueueMktData(EpsDispatcherT* pDispatcher, EpsDispatchWorkerT* pWorker,
+        EpsDispatchSlotT* pSlot, const EpsMktDataT* pMktData, const EpsMdEntryT* pMdEntry);
+static void ConflateEntry(EpsDispatchWorkerT* pWorker, EpsDispatchSlotT* pSlot,
+        const EpsMktDataT* pMktData, const EpsMdEntryT* pMdEntry);
+static BOOL WaitWorkerSpace(EpsDispatcherT* pDispatcher, EpsDispatchWorkerT* pWorker, uint64 header);
+static EpsDispatchSlotT* FindSecuritySlot(EpsDispatcherT* pDispatcher, EpsDispatchWorkerT* pWorker,
+        const char* securityID, uint32 hash);
+static ResCodeT AllocBuffers(EpsDispatcherT* pDispatcher);
+static void FreeBuffers(EpsDispatcherT* pDispatcher);
+static BOOL IsWorkerRunning(EpsDispatcherT* pDispatcher);
+static uint32 GetDispatchKey(EpsMktTypeT mktType);
+static void CopyMktData(EpsMktDataT* pDst, const EpsMktDataT* pSrc, const EpsMdEntryT* pMdEntry);
+
+
+/**
+ * ӿںʵ
+ */
+
+/**
+ * ʼַ
+ *
+ * @param   pDispatcher         in  - ַ
+ * @param   pSpi                in  - ûصڷַʹڼ䱣Ч
+ * @param   pBatch              in  - Ͷѡַ̰߳Ͷ
+ * @param   pFilter             in  - ֤ȯĹ̰ͨ߳
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT InitDispatcher(EpsDispatcherT* pDispatcher, const EpsClientSpiT* pSpi,
+        EpsMktBatchT* pBatch, EpsSecFilterT* pFilter)
+{
+    TRY
+    {
+        pDispatcher->workerCount = 0;
+        pDispatcher->highWater = EPS_DISPATCHER_HIGHWATER_DEFAULT;
+        pDispatcher->policy = EPS_DISPATCH_POLICY_BLOCK;
+        pDispatcher->mode = EPS_DISPATCH_MODE_MKTTYPE;
+        pDispatcher->size = 0;
+        pDispatcher->mask = 0;
+        pDispatcher->slotCount = 0;
+        pDispatcher->securitySlotMask = 0;
+
+        pDispatcher->hid = 0;
+        pDispatcher->pSpi = pSpi;
+        pDispatcher->pBatch = pBatch;
+        pDispatcher->pFilter = pFilter;
+        pDispatcher->pScratch = NULL;
+        pDispatcher->canStop = TRUE;
+
+        memset(pDispatcher->workers, 0x00, sizeof(pDispatcher->workers));
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ʼַ
+ *
+ * @param   pDispatcher         in  - ַ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT UninitDispatcher(EpsDispatcherT* pDispatcher)
+{
+    TRY
+    {
+        ShutdownDispatcher(pDispatcher);
+        JoinDispatcher(pDispatcher);
+
+        FreeBuffers(pDispatcher);
+        pDispatcher->workerCount = 0;
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ÷ַѡ
+ *
+ * @param   pDispatcher         in  - ַ
+ * @param   option              in  - EPS_OPTION_DISPATCH_THREADSEPS_OPTION_DISPATCH_HIGH_WATER
+ *                                    EPS_OPTION_DISPATCH_POLICYEPS_OPTION_DISPATCH_MODE
+ * @param   value               in  - ѡֵ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ *
+ * memo: ȷֹͨͣѷĶͷź´ʱ²·
+ */
+ResCodeT SetDispatcherOption(EpsDispatcherT* pDispatcher, EpsOptionT option, int32 value)
+{
+    TRY
+    {
+        if (IsWorkerRunning(pDispatcher))
+        {
+            THROW_ERROR(ERCD_EPS_DUPLICATE_CONNECT);
+        }
+
+        switch (option)
+        {
+            case EPS_OPTION_DISPATCH_THREADS:
+            {
+                if (value < 0 || value > EPS_DISPATCHER_WORKER_MAX_NUM)
+                {
+                    THROW_ERROR(ERCD_EPS_INVALID_PARM, "value");
+                }
+                FreeBuffers(pDispatcher);
+                pDispatcher->workerCount = (uint32)value;
+                break;
+            }
+            case EPS_OPTION_DISPATCH_HIGH_WATER:
+            {
+                if (value < 1 || value > EPS_DISPATCHER_HIGHWATER_MAX)
+                {
+                    THROW_ERROR(ERCD_EPS_INVALID_PARM, "value");
+                }
+                FreeBuffers(pDispatcher);
+                pDispatcher->highWater = (uint32)value;
+                break;
+            }
+            case EPS_OPTION_DISPATCH_POLICY:
+            {
+                if (value < EPS_DISPATCH_POLICY_BLOCK || value > EPS_DISPATCH_POLICY_CONFLATE)
+                {
+                    THROW_ERROR(ERCD_EPS_INVALID_PARM, "value");
+                }
+                FreeBuffers(pDispatcher);
+                pDispatcher->policy = (EpsDispatchPolicyT)value;
+                break;
+            }
+            case EPS_OPTION_DISPATCH_MODE:
+            {
+                if (value < EPS_DISPATCH_MODE_MKTTYPE || value > EPS_DISPATCH_MODE_SECURITY)
+                {
+                    THROW_ERROR(ERCD_EPS_INVALID_PARM, "value");
+                }
+                FreeBuffers(pDispatcher);
+                pDispatcher->mode = (EpsDispatchModeT)value;
+                break;
+            }
+            default:
+            {
+                THROW_ERROR(ERCD_EPS_INVALID_PARM, "option");
+            }
+        }
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ַ̣߳δ÷ַ߳ʱֱӷ
+ *
+ * @param   pDispatcher         in  - ַ
+ * @param   hid                 in  - IDصʱû
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT StartupDispatcher(EpsDispatcherT* pDispatcher, uint32 hid)
+{
+    TRY
+    {
+        if (pDispatcher->workerCount == 0)
+        {
+            THROW_RESCODE(NO_ERR);
+        }
+
+        if (pDispatcher->pScratch == NULL)
+        {
+            THROW_ERROR(AllocBuffers(pDispatcher));
+        }
+
+        pDispatcher->hid = hid;
+        EpsAtomicStore(&pDispatcher->canStop, FALSE);
+
+        uint32 i = 0;
+        for (i = 0; i < pDispatcher->workerCount; i++)
+        {
+            EpsDispatchWorkerT* pWorker = &pDispatcher->workers[i];
+            if (pWorker->tid != 0)
+            {
+                continue;
+            }
+
+#if defined(__WINDOWS__)
+            DWORD tid = 0;
+            HANDLE thread = CreateThread(NULL, 0, (LPTHREAD_START_ROUTINE)DispatchTask,
+                (LPVOID)pWorker, 0, (LPDWORD)&tid);
+            if (tid == 0)
+            {
+                int lstErrno = SYS_ERRNO;
+                THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, EpsGetSystemError(lstErrno));
+            }
+            pWorker->thread = thread;
+            pWorker->tid = tid;
+#endif
+
+#if defined(__LINUX__) || defined(__HPUX__)
+            pthread_t tid;
+            int result = pthread_create(&tid, NULL, DispatchTask, (void*)pWorker);
+            if (result != 0)
+            {
+                THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, EpsGetSystemError(result));
+            }
+            pWorker->tid = tid;
+#endif
+        }
+    }
+    CATCH
+    {
+        ShutdownDispatcher(pDispatcher);
+        JoinDispatcher(pDispatcher);
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ַַֹ֪ͨ߳ͣ߳ȡе˳
+ *
+ * @param   pDispatcher         in  - ַ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ *
+ * memo: ֹͣͨǰãʹȴпռ̷ͨ߳ȴ
+ */
+ResCodeT ShutdownDispatcher(EpsDispatcherT* pDispatcher)
+{
+    TRY
+    {
+        EpsAtomicStore(&pDispatcher->canStop, TRUE);
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ȴַ߳̽ڷַ߳еʱ
+ *
+ * @param   pDispatcher         in  - ַ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT JoinDispatcher(EpsDispatcherT* pDispatcher)
+{
+    TRY
+    {
+        uint32 i = 0;
+        for (i = 0; i < EPS_DISPATCHER_WORKER_MAX_NUM; i++)
+        {
+            EpsDispatchWorkerT* pWorker = &pDispatcher->workers[i];
+
+#if defined(__WINDOWS__)
+            if (pWorker->tid != 0 && pWorker->tid != GetCurrentThreadId())
+            {
+                int result = WaitForSingleObject(pWorker->thread, INFINITE);
+                if (result != WAIT_OBJECT_0)
+                {
+                    int lstErrno = SYS_ERRNO;
+                    THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, EpsGetSystemError(lstErrno));
+                }
+
+                pWorker->thread = NULL;
+                pWorker->tid = 0;
+            }
+#endif
+
+#if defined(__LINUX__) || defined(__HPUX__)
+            if (pWorker->tid != 0 && pWorker->tid != pthread_self())
+            {
+                int result = pthread_join(pWorker->tid, NULL);
+                if (result != 0)
+                {
+                    THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, EpsGetSystemError(result));
+                }
+
+                pWorker->tid = 0;
+            }
+#endif
+        }
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ַ(ͨ߳)
+ *
+ * ֤ȯַעʱ鰴Ŀֳɵ֤ȯ飬
+ * ֤ȯɢеַ̣߳δ֤ȯĿӣ0ĿЧʱ
+ * гַжͨ
+ * гַʱ˳δ֤ȯĿûж֤ȯ鲻
+ *
+ * @param   pDispatcher         in  - ַ
+ * @param   pMsg                in  - STEPʽ
+ * @param   recvTime            in  - ʱ()
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT PushDispatcher(EpsDispatcherT* pDispatcher, const StepMessageT* pMsg, uint64 recvTime)
+{
+    TRY
+    {
+        EpsMktDataT* pMktData = pDispatcher->pScratch;
+        THROW_ERROR(ConvertMktData(pMsg, pMktData));
+        pMktData->recvTime = recvTime;
+
+        EpsSecFilterT* pFilter = pDispatcher->pFilter;
+        if (pDispatcher->mode == EPS_DISPATCH_MODE_SECURITY)
+        {
+            /* δעЧʱ0ͬ޷ָ飬ֱӰгַ */
+            uint32 count = ParseMdEntries(pFilter, pDispatcher->hid, pMktData, pFilter->mdEntries);
+
+            uint32 matched = 0;
+            uint32 i = 0;
+            for (i = 0; i < count; i++)
+            {
+                const EpsMdEntryT* pMdEntry = &pFilter->mdEntries[i];
+                uint32 hash = HashSecurityID(pMdEntry->securityID);
+                if (! MatchSecFilter(pFilter, pMdEntry->securityID, hash))
+                {
+                    continue;
+                }
+                matched++;
+
+                EpsDispatchWorkerT* pWorker = &pDispatcher->workers[hash % pDispatcher->workerCount];
+
+                EpsDispatchSlotT* pSlot = NULL;
+                if (pDispatcher->policy == EPS_DISPATCH_POLICY_CONFLATE)
+                {
+                    pSlot = FindSecuritySlot(pDispatcher, pWorker, pMdEntry->securityID, hash);
+                }
+
+                THROW_ERROR(EnqueueMktData(pDispatcher, pWorker, pSlot, pMktData, pMdEntry));
+                EpsAtomicCounterAdd(&pWorker->producerStat.splitCount, 1);
+            }
+
+            if (count > 0)
+            {
+                CountSecFilter(pFilter, count - matched, (matched == 0));
+                THROW_RESCODE(NO_ERR);
+            }
+        }
+        else if (! FilterMktData(pFilter, pDispatcher->hid, pMktData))
+        {
+            THROW_RESCODE(NO_ERR);
+        }
+
+        uint32 key = GetDispatchKey(pMktData->mktType);
+        EpsDispatchWorkerT* pWorker = &pDispatcher->workers[key % pDispatcher->workerCount];
+        THROW_ERROR(EnqueueMktData(pDispatcher, pWorker, &pWorker->slots[key], pMktData, NULL));
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ȡַͳϢۼӸ̵ַ߳ͳ
+ *
+ * @param   pDispatcher         in  - ַ
+ * @param   pStat               out - ͳϢ
+ */
+void GetDispatcherStatistics(EpsDispatcherT* pDispatcher, EpsStatisticsT* pStat)
+{
+    pStat->dispatchedCount      = 0;
+    pStat->dispatchDropped      = 0;
+    pStat->dispatchConflated    = 0;
+    pStat->dispatchBlocked      = 0;
+    pStat->dispatchMaxDepth     = 0;
+    pStat->dispatchTotalLatency = 0;
+    pStat->dispatchMaxLatency   = 0;
+    pStat->dispatchSplitCount   = 0;
+    pStat->dispatchConflateOverflow = 0;
+
+    uint32 i = 0;
+    for (i = 0; i < EPS_DISPATCHER_WORKER_MAX_NUM; i++)
+    {
+        const EpsDispatchProducerStatT* pProducerStat = &pDispatcher->workers[i].producerStat;
+        const EpsDispatchConsumerStatT* pConsumerStat = &pDispatcher->workers[i].consumerStat;
+
+        pStat->dispatchedCount      += EpsAtomicLoadRelaxed(&pConsumerStat->dispatchedCount);
+        pStat->dispatchDropped      += EpsAtomicLoadRelaxed(&pProducerStat->droppedCount);
+        pStat->dispatchConflated    += EpsAtomicLoadRelaxed(&pProducerStat->conflatedCount);
+        pStat->dispatchBlocked      += EpsAtomicLoadRelaxed(&pProducerStat->blockedCount);
+        pStat->dispatchTotalLatency += EpsAtomicLoadRelaxed(&pConsumerStat->totalLatency);
+        pStat->dispatchSplitCount   += EpsAtomicLoadRelaxed(&pProducerStat->splitCount);
+        pStat->dispatchConflateOverflow += EpsAtomicLoadRelaxed(&pProducerStat->overflowCount);
+
+        uint32 maxDepth = EpsAtomicLoadRelaxed(&pProducerStat->maxDepth);
+        if (maxDepth > pStat->dispatchMaxDepth)
+        {
+            pStat->dispatchMaxDepth = maxDepth;
+        }
+
+        uint64 maxLatency = EpsAtomicLoadRelaxed(&pConsumerStat->maxLatency);
+        if (maxLatency > pStat->dispatchMaxLatency)
+        {
+            pStat->dispatchMaxLatency = maxLatency;
+        }
+    }
+}
+
+/**
+ * жǷ÷ַ߳
+ *
+ * @param   pDispatcher         in  - ַ
+ *
+ * @return  ÷TRUE򷵻FALSE
+ */
+BOOL IsDispatcherEnabled(EpsDispatcherT* pDispatcher)
+{
+    return (pDispatcher->workerCount > 0);
+}
+
+
+/**
+ * ڲʵ
+ */
+
+/**
+ * ַ̺߳
+ *
+ * @param   arg                 in  - ̲߳(̶ַ߳)
+ */
+static void* DispatchTask(void* arg)
+{
+    EpsDispatchWorkerT* pWorker = (EpsDispatchWorkerT*)arg;
+    EpsDispatcherT* pDispatcher = pWorker->pDispatcher;
+    uint32 spinCount = 0;
+
+    for (;;)
+    {
+        if (DrainWorker(pDispatcher, pWorker) > 0)
+        {
+            spinCount = 0;
+            continue;
+        }
+
+        if (EpsAtomicLoad(&pDispatcher->canStop))
+        {
+            break;
+        }
+
+        if (spinCount < EPS_DISPATCHER_IDLE_SPIN_COUNT)
+        {
+            EpsSpinWait(&spinCount);
+        }
+        else
+        {
+#if defined(__WINDOWS__)
+            Sleep(1);
+#endif
+
+#if defined(__LINUX__) || defined(__HPUX__)
+            usleep(EPS_DISPATCHER_IDLE_INTL);
+#endif
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * Ӷмϲλȡ鲢Ͷ
+ *
+ * @param   pDispatcher         in  - ַ
+ * @param   pWorker             in  - ַ߳
+ *
+ * @return  Ͷݵ
+ */
+static uint32 DrainWorker(EpsDispatcherT* pDispatcher, EpsDispatchWorkerT* pWorker)
+{
+    uint32 maxCount = EPS_MKTBATCH_SIZE_MAX;
+    if (EpsAtomicLoad(&pDispatcher->pSpi->mktDataBatchArrivedNotify) != NULL)
+    {
+        maxCount = EpsAtomicLoadRelaxed(&pDispatcher->pBatch->maxSize);
+    }
+
+    uint32 count = 0;
+    uint64 tailer = EpsAtomicLoad(&pWorker->tailer);
+    uint64 header = EpsAtomicLoad(&pWorker->header);
+    while (count < maxCount && tailer < header)
+    {
+        const EpsDispatchEntryT* pEntry = &pWorker->entries[tailer & pDispatcher->mask];
+        uint64 seq = EpsAtomicLoad(&pEntry->seq);
+        if (seq == tailer + 1)
+        {
+            CopyMktData(&pWorker->items[count], &pEntry->mktData, NULL);
+            pWorker->items[count].notifyTime = pEntry->enqueueTime;
+
+            /* ڼдδ˵ȡ
+               ƽʧ˵ѱ̶ͨ߳tailerѸΪǰλ */
+            EpsAtomicFenceAcquire();
+            if (EpsAtomicLoadRelaxed(&pEntry->seq) != seq)
+            {
+                tailer = EpsAtomicLoad(&pWorker->tailer);
+                continue;
+            }
+
+            if (EpsAtomicCompareAndExchange(&pWorker->tailer, &tailer, tailer + 1))
+            {
+                tailer++;
+                count++;
+            }
+            continue;
+        }
+
+        /* ѱ̶ͨ߳()д룬ͨ߳ƽλ */
+        tailer = EpsAtomicLoad(&pWorker->tailer);
+    }
+
+    /* ںϲλӵȡȡϲλе飬
+       ϴֹͣɨ裬⿿ĲλͶ޶ڵòͶ */
+    uint32 pendingSlots = EpsAtomicLoad(&pWorker->pendingSlots);
+    if (pendingSlots > 0)
+    {
+        uint32 slotCount = pDispatcher->slotCount;
+        uint32 key = pWorker->slotCursor;
+        uint32 i = 0;
+        for (i = 0; i < slotCount && pendingSlots > 0 && count < maxCount; i++, key++)
+        {
+            if (key >= slotCount)
+            {
+                key = 0;
+            }
+
+            EpsDispatchSlotT* pSlot = &pWorker->slots[key];
+            EpsDispatchSlotStatusT status = EpsAtomicLoad(&pSlot->status);
+            if (status != EPS_DISPATCH_SLOT_READY)
+            {
+                continue;
+            }
+
+            pendingSlots--;
+            if (pSlot->barrier > tailer)
+            {
+                continue;
+            }
+
+            if (! EpsAtomicCompareAndExchange(&pSlot->status, &status, EPS_DISPATCH_SLOT_READING))
+            {
+                continue;
+            }
+
+            CopyMktData(&pWorker->items[count], &pSlot->entry.mktData, NULL);
+            pWorker->items[count].notifyTime = pSlot->entry.enqueueTime;
+            count++;
+
+            EpsAtomicStore(&pSlot->status, EPS_DISPATCH_SLOT_EMPTY);
+            EpsAtomicFetchAdd(&pWorker->pendingSlots, (uint32)-1);
+        }
+        pWorker->slotCursor = (key < slotCount) ? key : 0;
+    }
+
+    if (count > 0)
+    {
+        DeliverWorker(pDispatcher, pWorker, count);
+    }
+    return count;
+}
+
+/**
+ * ûصͶȡ
+ *
+ * @param   pDispatcher         in  - ַ
+ * @param   pWorker             in  - ַ̣߳ͶݻnotifyTimeݴʱ
+ * @param   count               in  - 
+ */
+static void DeliverWorker(EpsDispatcherT* pDispatcher, EpsDispatchWorkerT* pWorker, uint32 count)
+{
+    EpsDispatchConsumerStatT* pStat = &pWorker->consumerStat;
+    const EpsClientSpiT* pSpi = pDispatcher->pSpi;
+    uint64 notifyTime = EpsGetTimestamp();
+    uint64 totalLatency = 0;
+    uint64 maxLatency = pStat->maxLatency;
+
+    uint32 i = 0;
+    for (i = 0; i < count; i++)
+    {
+        uint64 latency = notifyTime - pWorker->items[i].notifyTime;
+        totalLatency += latency;
+        if (latency > maxLatency)
+        {
+            maxLatency = latency;
+        }
+        pWorker->items[i].notifyTime = notifyTime;
+    }
+
+    EpsAtomicCounterAdd(&pStat->dispatchedCount, count);
+    EpsAtomicCounterAdd(&pStat->totalLatency, totalLatency);
+    EpsAtomicStoreRelaxed(&pStat->maxLatency, maxLatency);
+
+    EpsMktDataBatchArrivedCallback batchNotify = EpsAtomicLoad(&pSpi->mktDataBatchArrivedNotify);
+    if (batchNotify != NULL)
+    {
+        batchNotify(pDispatcher->hid, pWorker->pItems, count);
+    }
+    else if (pSpi->mktDataViewArrivedNotify != NULL)
+    {
+        for (i = 0; i < count; i++)
+        {
+            const EpsMktDataT* pMktData = &pWorker->items[i];
+
+            EpsMktDataViewT mktDataView;
+            GetMktDataView(pMktData, &mktDataView);
+            pSpi->mktDataViewArrivedNotify(pDispatcher->hid, &mktDataView);
+        }
+    }
+    else
+    {
+        for (i = 0; i < count; i++)
+        {
+            pSpi->mktDataArrivedNotify(pDispatcher->hid, &pWorker->items[i]);
+        }
+    }
+}
+
+/**
+ * ̶ַ߳(ͨ߳)ﵽˮλʱԴ
+ *
+ * @param   pDispatcher         in  - ַ
+ * @param   pWorker             in  - ַ߳
+ * @param   pSlot               in  - г(֤ȯ)ĺϲλδϲԻ֤ȯλʱΪNULL
+ * @param   pMktData            in  - ѽ
+ * @param   pMdEntry            in  - ֤ȯĿNULLʾ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+static ResCodeT EnqueueMktData(EpsDispatcherT* pDispatcher, EpsDispatchWorkerT* pWorker,
+        EpsDispatchSlotT* pSlot, const EpsMktDataT* pMktData, const EpsMdEntryT* pMdEntry)
+{
+    TRY
+    {
+        EpsDispatchProducerStatT* pStat = &pWorker->producerStat;
+
+        uint64 header = pWorker->header;
+        uint64 tailer = EpsAtomicLoad(&pWorker->tailer);
+        uint32 depth = (uint32)(header - tailer);
+        if (depth > pStat->maxDepth)
+        {
+            EpsAtomicStoreRelaxed(&pStat->maxDepth, depth);
+        }
+
+        switch (pDispatcher->policy)
+        {
+            case EPS_DISPATCH_POLICY_BLOCK:
+            {
+                if (depth < pDispatcher->highWater)
+                {
+                    break;
+                }
+
+                EpsAtomicCounterAdd(&pStat->blockedCount, 1);
+                if (! WaitWorkerSpace(pDispatcher, pWorker, header))
+                {
+                    EpsAtomicCounterAdd(&pStat->droppedCount, 1);
+                    THROW_RESCODE(NO_ERR);
+                }
+                break;
+            }
+            case EPS_DISPATCH_POLICY_DROP_OLDEST:
+            {
+                while (header - tailer >= pDispatcher->highWater)
+                {
+                    if (EpsAtomicCompareAndExchange(&pWorker->tailer, &tailer, tailer + 1))
+                    {
+                        EpsAtomicCounterAdd(&pStat->droppedCount, 1);
+                        break;
+                    }
+                }
+                break;
+            }
+            case EPS_DISPATCH_POLICY_CONFLATE:
+            {
+                if (pSlot != NULL && (depth >= pDispatcher->highWater ||
+                    EpsAtomicLoad(&pSlot->status) == EPS_DISPATCH_SLOT_READY))
+                {
+                    ConflateEntry(pWorker, pSlot, pMktData, pMdEntry);
+                    THROW_RESCODE(NO_ERR);
+                }
+
+                /* ֤ȯϲλ֤ȯֻܵȴ */
+                if (pSlot == NULL && depth >= pDispatcher->highWater)
+                {
+                    EpsAtomicCounterAdd(&pStat->overflowCount, 1);
+                    if (! WaitWorkerSpace(pDispatcher, pWorker, header))
+                    {
+                        EpsAtomicCounterAdd(&pStat->droppedCount, 1);
+                        THROW_RESCODE(NO_ERR);
+                    }
+                }
+                break;
+            }
+            default:
+            {
+                break;
+            }
+        }
+
+        /* дĶ̸ַ߳ƣдűʶд̣
+           ̸ַ߳ƺУдţǵ */
+        EpsDispatchEntryT* pEntry = &pWorker->entries[header & pDispatcher->mask];
+        EpsAtomicStoreRelaxed(&pEntry->seq, 0);
+        EpsAtomicFenceRelease();
+
+        CopyMktData(&pEntry->mktData, pMktData, pMdEntry);
+        pEntry->enqueueTime = EpsGetTimestamp();
+
+        EpsAtomicStore(&pEntry->seq, header + 1);
+        EpsAtomicStore(&pWorker->header, header + 1);
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * 鸲дϲλ(ͨ߳)
+ *
+ * @param   pWorker             in  - ַ߳
+ * @param   pSlot               in  - ϲλ
+ * @param   pMktData            in  - ѽ
+ * @param   pMdEntry            in  - ֤ȯĿNULLʾ
+ */
+static void ConflateEntry(EpsDispatchWorkerT* pWorker, EpsDispatchSlotT* pSlot,
+        const EpsMktDataT* pMktData, const EpsMdEntryT* pMdEntry)
+{
+    uint32 spinCount = 0;
+    EpsDispatchSlotStatusT status = EpsAtomicLoad(&pSlot->status);
+    for (;;)
+    {
+        /* ַ߳ڸƲλݣȴ */
+        if (status == EPS_DISPATCH_SLOT_READING)
+        {
+            EpsSpinWait(&spinCount);
+            status = EpsAtomicLoad(&pSlot->status);
+            continue;
+        }
+
+        if (EpsAtomicCompareAndExchange(&pSlot->status, &status, EPS_DISPATCH_SLOT_WRITING))
+        {
+            break;
+        }
+    }
+
+    if (status == EPS_DISPATCH_SLOT_READY)
+    {
+        EpsAtomicCounterAdd(&pWorker->producerStat.conflatedCount, 1);
+    }
+    else
+    {
+        pSlot->barrier = pWorker->header;
+        EpsAtomicFetchAdd(&pWorker->pendingSlots, 1);
+    }
+
+    CopyMktData(&pSlot->entry.mktData, pMktData, pMdEntry);
+    pSlot->entry.enqueueTime = EpsGetTimestamp();
+    EpsAtomicStore(&pSlot->status, EPS_DISPATCH_SLOT_READY);
+}
+
+/**
+ * ȴ̶ַ߳ڳռ(ͨ߳)
+ *
+ * @param   pDispatcher         in  - ַ
+ * @param   pWorker             in  - ַ߳
+ * @param   header              in  - ǰλ
+ *
+ * @return  пռ䷵TRUEڶϿӷFALSE
+ */
+static BOOL WaitWorkerSpace(EpsDispatcherT* pDispatcher, EpsDispatchWorkerT* pWorker, uint64 header)
+{
+    uint32 spinCount = 0;
+    while (header - EpsAtomicLoad(&pWorker->tailer) >= pDispatcher->highWater)
+    {
+        /* ڶϿӣַ߳̿˳ */
+        if (EpsAtomicLoad(&pDispatcher->canStop))
+        {
+            return FALSE;
+        }
+        EpsSpinWait(&spinCount);
+    }
+    return TRUE;
+}
+
+/**
+ * ֤ȯĺϲλ(ͨ߳)֤ȯδ󶨲λʱһвλ
+ *
+ * @param   pDispatcher         in  - ַ
+ * @param   pWorker             in  - ֤ȯڵķַ߳
+ * @param   securityID          in  - ֤ȯ
+ * @param   hash                in  - ֤ȯɢֵ
+ *
+ * @return  ϲλ֤ȯΪջ̽ⷶΧûпòλʱNULL
+ */
+static EpsDispatchSlotT* FindSecuritySlot(EpsDispatcherT* pDispatcher, EpsDispatchWorkerT* pWorker,
+        const char* securityID, uint32 hash)
+{
+    if (pDispatcher->securitySlotMask == 0 || securityID[0] == 0x00)
+    {
+        return NULL;
+    }
+
+    /* λѡַ̣߳ͬһַ߳ڵ֤ȯȡλ */
+    uint32 index = hash / pDispatcher->workerCount;
+
+    uint32 i = 0;
+    for (i = 0; i < EPS_DISPATCHER_SLOT_PROBE_MAX; i++)
+    {
+        EpsDispatchSlotT* pSlot = &pWorker->slots[EPS_DISPATCHER_CONFLATE_KEY_NUM +
+            ((index + i) & pDispatcher->securitySlotMask)];
+
+        if (pSlot->securityID[0] == 0x00)
+        {
+            strcpy(pSlot->securityID, securityID);
+            return pSlot;
+        }
+        if (strcmp(pSlot->securityID, securityID) == 0)
+        {
+            return pSlot;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * ͨ߳̽뻺̵ַ߳ĶСϲλͶݻ
+ *
+ * @param   pDispatcher         in  - ַ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+static ResCodeT AllocBuffers(EpsDispatcherT* pDispatcher)
+{
+    TRY
+    {
+        pDispatcher->pScratch = (EpsMktDataT*)malloc(sizeof(EpsMktDataT));
+        if (pDispatcher->pScratch == NULL)
+        {
+            int lstErrno = SYS_ERRNO;
+            THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, EpsGetSystemError(lstErrno));
+        }
+
+        uint32 size = 1;
+        while (size < pDispatcher->highWater)
+        {
+            size <<= 1;
+        }
+        pDispatcher->size = size;
+        pDispatcher->mask = size - 1;
+
+        /* ֤ȯϲʱÿַ߳дС֤ȯλδõĲλռڴ */
+        pDispatcher->slotCount = EPS_DISPATCHER_CONFLATE_KEY_NUM;
+        pDispatcher->securitySlotMask = 0;
+        if (pDispatcher->mode == EPS_DISPATCH_MODE_SECURITY && pDispatcher->policy == EPS_DISPATCH_POLICY_CONFLATE)
+        {
+            pDispatcher->slotCount += size * 2;
+            pDispatcher->securitySlotMask = size * 2 - 1;
+        }
+
+        uint32 i = 0;
+        for (i = 0; i < pDispatcher->workerCount; i++)
+        {
+            EpsDispatchWorkerT* pWorker = &pDispatcher->workers[i];
+            pWorker->pDispatcher = pDispatcher;
+            pWorker->index = i;
+
+            pWorker->entries = (EpsDispatchEntryT*)malloc(size * sizeof(EpsDispatchEntryT));
+            pWorker->slots = (EpsDispatchSlotT*)calloc(pDispatcher->slotCount, sizeof(EpsDispatchSlotT));
+            pWorker->items = (EpsMktDataT*)malloc(EPS_MKTBATCH_SIZE_MAX * sizeof(EpsMktDataT));
+            if (pWorker->entries == NULL || pWorker->slots == NULL || pWorker->items == NULL)
+            {
+                int lstErrno = SYS_ERRNO;
+                THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, EpsGetSystemError(lstErrno));
+            }
+
+            uint32 j = 0;
+            for (j = 0; j < EPS_MKTBATCH_SIZE_MAX; j++)
+            {
+                pWorker->pItems[j] = &pWorker->items[j];
+            }
+        }
+    }
+    CATCH
+    {
+        FreeBuffers(pDispatcher);
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ͷͨ߳̽뻺̵ַ߳ĶСϲλͶݻͳ
+ *
+ * @param   pDispatcher         in  - ַַ߳ѽ
+ */
+static void FreeBuffers(EpsDispatcherT* pDispatcher)
+{
+    free(pDispatcher->pScratch);
+    pDispatcher->pScratch = NULL;
+
+    uint32 i = 0;
+    for (i = 0; i < EPS_DISPATCHER_WORKER_MAX_NUM; i++)
+    {
+        EpsDispatchWorkerT* pWorker = &pDispatcher->workers[i];
+        free(pWorker->entries);
+        free(pWorker->slots);
+        free(pWorker->items);
+    }
+
+    memset(pDispatcher->workers, 0x00, sizeof(pDispatcher->workers));
+    pDispatcher->size = 0;
+    pDispatcher->mask = 0;
+    pDispatcher->slotCount = 0;
+    pDispatcher->securitySlotMask = 0;
+}
+
+/**
+ * жǷзַ߳δ
+ *
+ * @param   pDispatcher         in  - ַ
+ *
+ * @return  зַ߳δTRUE򷵻FALSE
+ */
+static BOOL IsWorkerRunning(EpsDispatcherT* pDispatcher)
+{
+    uint32 i = 0;
+    for (i = 0; i < EPS_DISPATCHER_WORKER_MAX_NUM; i++)
+    {
+        if (pDispatcher->workers[i].tid != 0)
+        {
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+/**
+ * ȡķַ(г)ͬһַͬһַ̰߳Ͷ
+ *
+ * @param   mktType             in  - г
+ *
+ * @return  ַСEPS_DISPATCHER_CONFLATE_KEY_NUM
+ */
+static uint32 GetDispatchKey(EpsMktTypeT mktType)
+{
+    int key = (int)mktType;
+    if (key < 0 || key >= EPS_DISPATCHER_CONFLATE_KEY_NUM)
+    {
+        key = EPS_MKTTYPE_ALL;
+    }
+    return (uint32)key;
+}
+
+/**
+ * 飬ֻЧ
+ *
+ * @param   pDst                out - Ŀ
+ * @param   pSrc                in  - Դ飬̸ͨ߳ǣȰ޽ض
+ * @param   pMdEntry            in  - ĿNULLʱֻƸĿӦ
+ */
+static void CopyMktData(EpsMktDataT* pDst, const EpsMktDataT* pSrc, const EpsMdEntryT* pMdEntry)
+{
+    if (pMdEntry != NULL)
+    {
+        memcpy(pDst, pSrc, offsetof(EpsMktDataT, mdData));
+        memcpy(pDst->mdData, pSrc->mdData + pMdEntry->offset, pMdEntry->length);
+        if (pMdEntry->length < EPS_MKTDATA_MAX_LEN)
+        {
+            pDst->mdData[pMdEntry->length] = 0x00;
+        }
+        pDst->mdCount = 1;
+        pDst->mdDataLen = pMdEntry->length;
+        pDst->recvTime = pSrc->recvTime;
+        return;
+    }
+
+    uint32 mdDataLen = pSrc->mdDataLen;
+    if (mdDataLen > EPS_MKTDATA_MAX_LEN)
+    {
+        mdDataLen = EPS_MKTDATA_MAX_LEN;
+    }
+
+    memcpy(pDst, pSrc, offsetof(EpsMktDataT, mdData) + mdDataLen);
+    if (mdDataLen < EPS_MKTDATA_MAX_LEN)
+    {
+        pDst->mdData[mdDataLen] = 0x00;
+    }
+    pDst->mdDataLen = mdDataLen;
+    pDst->recvTime = pSrc->recvTime;
+}
@@ -0,0 +1,261 @@
+/*
+ * Copyright (C) 2013, 2014 Shanghai Stock Exchange (SSE), Shanghai, China
+ * All Rights Reserved.
+ */
+
+/**
+ * @file    dispatcher.h
+ *
+ * ̶ַ߳ͷļ
+ *
+ * @version $Id
+ * @since   2026/10/18
+ */
+
+/**
+MODIFICATION HISTORY:
+<pre>
+================================================================================
+DD-MMM-YYYY INIT.    SIR    Modification Description
+----------- -------- ------ ----------------------------------------------------
+18-OCT-2026                 
+================================================================================
+</pre>
+*/
+
+#ifndef EPS_DISPATCHER_H
+#define EPS_DISPATCHER_H
+
+/**
+ * ͷļ
+ */
+
+#include "common.h"
+#include "epsTypes.h"
+#include "epsData.h"
+#include "atomic.h"
+#include "mktBatch.h"
+#include "secFilter.h"
+#include "stepMessage.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**
+ * 궨
+ */
+
+#define EPS_DISPATCHER_WORKER_MAX_NUM       8       /* ַ߳ */
+#define EPS_DISPATCHER_HIGHWATER_DEFAULT    1024    /* Ĭϸˮλ(лѹ) */
+#define EPS_DISPATCHER_HIGHWATER_MAX        65536   /* ˮλ */
+#define EPS_DISPATCHER_CONFLATE_KEY_NUM     (EPS_MKTTYPE_NUM+1) /* ϲλ(г) */
+#define EPS_DISPATCHER_SLOT_PROBE_MAX       32      /* ֤ȯϲλ̽ */
+
+
+/**
+ * Ͷ
+ */
+
+/*
+ * ַдﵽˮλʱĴ
+ */
+typedef enum EpsDispatchPolicyTag
+{
+    EPS_DISPATCH_POLICY_BLOCK       = 0,    /* ̵ͨ߳ȴַ߳ڳռ */
+    EPS_DISPATCH_POLICY_DROP_OLDEST = 1,    /* ɵ */
+    EPS_DISPATCH_POLICY_CONFLATE    = 2,    /* ͬһг(֤ȯʱΪͬһ֤ȯ)ֻµһͶ */
+} EpsDispatchPolicyT;
+
+/*
+ * ַ߳ѡʽ
+ */
+typedef enum EpsDispatchModeTag
+{
+    EPS_DISPATCH_MODE_MKTTYPE       = 0,    /* гѡַ߳ */
+    EPS_DISPATCH_MODE_SECURITY      = 1,    /* ûֳ֤ȯѡַ߳ */
+} EpsDispatchModeT;
+
+/*
+ * ϲλ״̬
+ */
+typedef enum EpsDispatchSlotStatusTag
+{
+    EPS_DISPATCH_SLOT_EMPTY         = 0,    /*  */
+    EPS_DISPATCH_SLOT_WRITING       = 1,    /* ͨ߳д */
+    EPS_DISPATCH_SLOT_READY         = 2,    /* Ͷ */
+    EPS_DISPATCH_SLOT_READING       = 3,    /* ַ߳ȡ */
+} EpsDispatchSlotStatusT;
+
+/*
+ * ַ
+ */
+typedef struct EpsDispatchEntryTag
+{
+    uint64          seq;                    /* д: дΪ0дΪλƼ1ʹ */
+    EpsMktDataT     mktData;                /*  */
+    uint64          enqueueTime;            /* ʱ() */
+} EpsDispatchEntryT;
+
+/*
+ * ϲλ
+ *
+ * λͶڼͬһг(֤ȯ)дλٽУ
+ * λеȶӵͶݺͶݣԱͬһг(֤ȯ)˳
+ * ֤ȯλ״ʹʱ֤ȯ룬ͶݺԱ󶨣ֱַͷ
+ */
+typedef struct EpsDispatchSlotTag
+{
+    EpsDispatchSlotStatusT status;          /* λ״̬ */
+    uint64          barrier;                /* λ״дʱλ */
+    char            securityID[EPS_SECURITYID_MAX_LEN+1];   /* 󶨵֤ȯ룬̷ͨ߳ */
+    EpsDispatchEntryT entry;                /* Ͷ */
+} EpsDispatchSlotT;
+
+/*
+ * ַͳ()
+ */
+typedef struct EpsDispatchProducerStatTag
+{
+    uint64          droppedCount;           /*  */
+    uint64          conflatedCount;         /* ϲǵ */
+    uint64          blockedCount;           /* ȴĴ */
+    uint64          splitCount;             /* ֤ȯֺӵĿ */
+    uint64          overflowCount;          /* ֤ȯϲλΪȴӵĿ */
+    uint32          maxDepth;               /* ѹ */
+} EpsDispatchProducerStatT;
+
+/*
+ * ַͳ()
+ */
+typedef struct EpsDispatchConsumerStatTag
+{
+    uint64          dispatchedCount;        /* Ͷݵ */
+    uint64          totalLatency;           /* ۼŶʱ() */
+    uint64          maxLatency;             /* Ŷʱ() */
+} EpsDispatchConsumerStatT;
+
+struct EpsDispatcherTag;
+
+/*
+ * ַ߳
+ *
+ * ͨ߳ΪΨһߣַ߳ΪΨһߣDROP_OLDESTҲƽλƣ
+ * ߸ƳԱȽϲ滻ƽλƣʧ˵ѱܱǣ
+ * 
+ */
+typedef struct EpsDispatchWorkerTag
+{
+    struct EpsDispatcherTag* pDispatcher;   /* ַ */
+    uint32          index;                  /* ַ߳ */
+
+#if defined(__WINDOWS__)
+    HANDLE          thread;                 /* ̶߳ */
+    DWORD           tid;                    /* ߳id */
+#endif
+
+#if defined(__LINUX__) || defined(__HPUX__)
+    pthread_t       tid;                    /* ߳id */
+#endif
+
+    EpsDispatchEntryT* entries;             /*  */
+    EpsDispatchSlotT*  slots;               /* ϲλгλǰ֤ȯλ(ɢб)ں */
+    uint32          pendingSlots;           /* Ͷݵĺϲλ */
+    uint32          slotCursor;             /* ´ɨϲλ㣬̷ַ߳ */
+
+    EpsMktDataT*    items;                  /* ͶݻEPS_MKTBATCH_SIZE_MAX */
+    const EpsMktDataT* pItems[EPS_MKTBATCH_SIZE_MAX];   /* Ͷݸûָ */
+
+    EpsDispatchProducerStatT producerStat;  /* ַͳ() */
+    EpsDispatchConsumerStatT consumerStat EPS_CACHELINE_ALIGNED;   /* ַͳ() */
+
+    uint64          header EPS_CACHELINE_ALIGNED;   /* λ */
+    uint64          tailer EPS_CACHELINE_ALIGNED;   /* λ */
+} EpsDispatchWorkerT;
+
+/*
+ * ַ
+ *
+ * ú̵ַֻͨ߳߳ĶУɷ̵ַ߳ûص
+ * ͬһг(֤ȯʱΪͬһ֤ȯ)̶ͬһַ̰߳Ͷݣصͨ߳е
+ */
+typedef struct EpsDispatcherTag
+{
+    uint32          workerCount;            /* ַ߳0ʾֱͨ߳ӻص */
+    uint32          highWater;              /* ˮλ */
+    EpsDispatchPolicyT policy;              /* ˮλ */
+    EpsDispatchModeT mode;                  /* ַ߳ѡʽ */
+    uint32          size;                   /* дС(2ݣСڸˮλ) */
+    uint32          mask;                   /*  */
+    uint32          slotCount;              /* ÿ̵ַ߳ĺϲλ */
+    uint32          securitySlotMask;       /* ֤ȯλɢб룬δ֤ȯϲʱΪ0 */
+
+    uint32          hid;                    /* ID */
+    const EpsClientSpiT* pSpi;              /* ûص */
+    EpsMktBatchT*   pBatch;                 /* Ͷѡ */
+    EpsSecFilterT*  pFilter;                /* ֤ȯĹû */
+
+    EpsMktDataT*    pScratch;               /* ͨ߳̽뻺 */
+
+    BOOL            canStop;                /* ֹͣ߳б */
+    EpsDispatchWorkerT workers[EPS_DISPATCHER_WORKER_MAX_NUM];  /* ַ߳ */
+} EpsDispatcherT;
+
+
+/**
+ * 
+ */
+
+/*
+ * ʼַ
+ */
+ResCodeT InitDispatcher(EpsDispatcherT* pDispatcher, const EpsClientSpiT* pSpi,
+        EpsMktBatchT* pBatch, EpsSecFilterT* pFilter);
+
+/*
+ * ʼַ
+ */
+ResCodeT UninitDispatcher(EpsDispatcherT* pDispatcher);
+
+/*
+ * ÷ַѡ
+ */
+ResCodeT SetDispatcherOption(EpsDispatcherT* pDispatcher, EpsOptionT option, int32 value);
+
+/*
+ * ַ߳
+ */
+ResCodeT StartupDispatcher(EpsDispatcherT* pDispatcher, uint32 hid);
+
+/*
+ * ַֹ֪ͨ߳ͣ
+ */
+ResCodeT ShutdownDispatcher(EpsDispatcherT* pDispatcher);
+
+/*
+ * ȴַ߳̽
+ */
+ResCodeT JoinDispatcher(EpsDispatcherT* pDispatcher);
+
+/*
+ * ַ
+ */
+ResCodeT PushDispatcher(EpsDispatcherT* pDispatcher, const StepMessageT* pMsg, uint64 recvTime);
+
+/*
+ * ȡַͳϢ
+ */
+void GetDispatcherStatistics(EpsDispatcherT* pDispatcher, EpsStatisticsT* pStat);
+
+/*
+ * жǷ÷ַ߳
+ */
+BOOL IsDispatcherEnabled(EpsDispatcherT* pDispatcher);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* EPS_DISPATCHER_H */
@@ -59,6 +59,14 @@ extern "C" {
 #define ERCD_EPS_CHECK_KEEPALIVE_TIMEOUT        0x20010015   
 #define ERCD_EPS_HID_COUNT_BEYOND_LIMIT         0x20010016
 #define ERCD_EPS_MKTSTATUS_UNCHANGED            0x20010017           
+#define ERCD_EPS_UNSUPPORTED_OPTION             0x20010018
+#define ERCD_EPS_MKTDATA_GAP                    0x20010019
+#define ERCD_EPS_SESSION_GAP                    0x2001001a
+#define ERCD_EPS_SESSION_FAILOVER               0x2001001b
+#define ERCD_EPS_QUEUE_FULL                     0x2001001c
+#define ERCD_EPS_SUBSCRIBER_COUNT_BEYOND_LIMIT  0x2001001d
+#define ERCD_EPS_INVALID_SHMBUS                 0x2001001e
+#define ERCD_EPS_SHMBUS_CLOSED                  0x2001001f
 
 
 /* STEPЭ */
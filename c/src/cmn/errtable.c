@@ -67,6 +67,14 @@ const ErrorInfoT  g_errorTable[] =
     {ERCD_EPS_CHECK_KEEPALIVE_TIMEOUT, "check keepalive timeout"},
     {ERCD_EPS_HID_COUNT_BEYOND_LIMIT, "handle count beycound limit(%d)"},
     {ERCD_EPS_MKTSTATUS_UNCHANGED, "market status unchanged"},
+    {ERCD_EPS_UNSUPPORTED_OPTION, "unsupported option, %s"},
+    {ERCD_EPS_MKTDATA_GAP, "market data sequence gap"},
+    {ERCD_EPS_SESSION_GAP, "session message gap, expected(%llu), received(%llu)"},
+    {ERCD_EPS_SESSION_FAILOVER, "session failover, %s"},
+    {ERCD_EPS_QUEUE_FULL, "queue is full, %s"},
+    {ERCD_EPS_SUBSCRIBER_COUNT_BEYOND_LIMIT, "subscriber count beyond limit(%d)"},
+    {ERCD_EPS_INVALID_SHMBUS, "invalid shared memory bus(%s), %s"},
+    {ERCD_EPS_SHMBUS_CLOSED, "shared memory bus publisher closed"},
     
     {ERCD_STEP_INVALID_FLDVALUE, "Invalid field value(%d=%.*s), %s"},
     {ERCD_STEP_BUFFER_OVERFLOW, "Step message buffer overflow"},
@@ -0,0 +1,575 @@
+/*
+ * Copyright (C) 2013, 2014 Shanghai Stock Exchange (SSE), Shanghai, China
+ * All Rights Reserved.
+ */
+
+/**
+ * @file    ioUring.c
+ *
+ * io_uring I/Oʵļֱӻϵͳʵ֣liburing
+ *
+ * @version $Id
+ * @since   2026/10/18
+ */
+
+/**
+MODIFICATION HISTORY:
+<pre>
+================================================================================
+DD-MMM-YYYY INIT.    SIR    Modification Description
+----------- -------- ------ ----------------------------------------------------
+18-OCT-2026                 
+================================================================================
+</pre>
+*/
+
+/**
+ * ͷļ
+ */
+
+#include "common.h"
+#include "epsTypes.h"
+#include "errlib.h"
+#include "errcode.h"
+
+#include "ioUring.h"
+
+#if defined(EPS_IOENGINE_URING)
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+
+
+/**
+ * ڲ
+ */
+
+static struct io_uring_sqe* GetSqe(EpsIoUringT* pRing);
+
+
+/**
+ * ʵ
+ */
+
+/**
+ * ʼio_uring
+ *
+ * @param   pRing               in  - io_uring
+ * @param   entries             in  - ύг
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT InitIoUring(EpsIoUringT* pRing, uint32 entries)
+{
+    TRY
+    {
+        memset(pRing, 0x00, sizeof(EpsIoUringT));
+        pRing->ringFd = -1;
+
+        struct io_uring_params params;
+        memset(&params, 0x00, sizeof(params));
+        params.flags = IORING_SETUP_SINGLE_ISSUER | IORING_SETUP_COOP_TASKRUN;
+
+        int fd = (int)syscall(__NR_io_uring_setup, entries, &params);
+        if (fd < 0 && errno == EINVAL)
+        {
+            /* Ͱ汾ں˲֧־˻ΪĬģʽ */
+            memset(&params, 0x00, sizeof(params));
+            fd = (int)syscall(__NR_io_uring_setup, entries, &params);
+        }
+        if (fd < 0)
+        {
+            THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, EpsGetSystemError(SYS_ERRNO));
+        }
+        pRing->ringFd = fd;
+
+        pRing->sqSize = params.sq_off.array + params.sq_entries * sizeof(uint32);
+        pRing->cqSize = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+        if (params.features & IORING_FEAT_SINGLE_MMAP)
+        {
+            if (pRing->cqSize > pRing->sqSize)
+            {
+                pRing->sqSize = pRing->cqSize;
+            }
+            pRing->cqSize = pRing->sqSize;
+        }
+
+        pRing->sqPtr = mmap(NULL, pRing->sqSize, PROT_READ | PROT_WRITE,
+                MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+        if (pRing->sqPtr == MAP_FAILED)
+        {
+            pRing->sqPtr = NULL;
+            THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, EpsGetSystemError(SYS_ERRNO));
+        }
+
+        if (params.features & IORING_FEAT_SINGLE_MMAP)
+        {
+            pRing->cqPtr = pRing->sqPtr;
+        }
+        else
+        {
+            pRing->cqPtr = mmap(NULL, pRing->cqSize, PROT_READ | PROT_WRITE,
+                    MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+            if (pRing->cqPtr == MAP_FAILED)
+            {
+                pRing->cqPtr = NULL;
+                THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, EpsGetSystemError(SYS_ERRNO));
+            }
+        }
+
+        pRing->sqesSize = params.sq_entries * sizeof(struct io_uring_sqe);
+        pRing->sqes = (struct io_uring_sqe*)mmap(NULL, pRing->sqesSize, PROT_READ | PROT_WRITE,
+                MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+        if (pRing->sqes == MAP_FAILED)
+        {
+            pRing->sqes = NULL;
+            THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, EpsGetSystemError(SYS_ERRNO));
+        }
+
+        char* sq = (char*)pRing->sqPtr;
+        pRing->sqHead    = (uint32*)(sq + params.sq_off.head);
+        pRing->sqTail    = (uint32*)(sq + params.sq_off.tail);
+        pRing->sqArray   = (uint32*)(sq + params.sq_off.array);
+        pRing->sqMask    = *(uint32*)(sq + params.sq_off.ring_mask);
+        pRing->sqEntries = params.sq_entries;
+        pRing->sqPending = 0;
+
+        char* cq = (char*)pRing->cqPtr;
+        pRing->cqHead = (uint32*)(cq + params.cq_off.head);
+        pRing->cqTail = (uint32*)(cq + params.cq_off.tail);
+        pRing->cqMask = *(uint32*)(cq + params.cq_off.ring_mask);
+        pRing->cqes   = (struct io_uring_cqe*)(cq + params.cq_off.cqes);
+
+        /* SQEһһӦ */
+        uint32 i = 0;
+        for (i = 0; i < pRing->sqEntries; i++)
+        {
+            pRing->sqArray[i] = i;
+        }
+    }
+    CATCH
+    {
+        UninitIoUring(pRing);
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ʼio_uringرպں˻ȡδɵ
+ *
+ * @param   pRing               in  - io_uring
+ */
+void UninitIoUring(EpsIoUringT* pRing)
+{
+    if (pRing->pBufRing != NULL)
+    {
+        munmap(pRing->pBufRing, pRing->bufRingSize);
+        pRing->pBufRing = NULL;
+    }
+
+    if (pRing->sqes != NULL)
+    {
+        munmap(pRing->sqes, pRing->sqesSize);
+        pRing->sqes = NULL;
+    }
+
+    if (pRing->cqPtr != NULL && pRing->cqPtr != pRing->sqPtr)
+    {
+        munmap(pRing->cqPtr, pRing->cqSize);
+    }
+    pRing->cqPtr = NULL;
+
+    if (pRing->sqPtr != NULL)
+    {
+        munmap(pRing->sqPtr, pRing->sqSize);
+        pRing->sqPtr = NULL;
+    }
+
+    if (pRing->ringFd >= 0)
+    {
+        close(pRing->ringFd);
+        pRing->ringFd = -1;
+    }
+}
+
+/**
+ * עṩbufSizeȷ֣ںڽʱѡ
+ *
+ * @param   pRing               in  - io_uring
+ * @param   bufGroup            in  - ID
+ * @param   bufBase             in  - ʼַ
+ * @param   bufSize             in  - 
+ * @param   bufCount            in  - 2
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT RegisterIoUringBufRing(EpsIoUringT* pRing, uint16 bufGroup,
+        char* bufBase, uint32 bufSize, uint16 bufCount)
+{
+    TRY
+    {
+        if (bufCount == 0 || (bufCount & (bufCount - 1)) != 0)
+        {
+            THROW_ERROR(ERCD_EPS_INVALID_PARM, "bufCount");
+        }
+
+        pRing->bufRingSize = bufCount * sizeof(struct io_uring_buf);
+        void* ptr = mmap(NULL, pRing->bufRingSize, PROT_READ | PROT_WRITE,
+                MAP_ANONYMOUS | MAP_PRIVATE, -1, 0);
+        if (ptr == MAP_FAILED)
+        {
+            THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, EpsGetSystemError(SYS_ERRNO));
+        }
+        pRing->pBufRing = (struct io_uring_buf_ring*)ptr;
+
+        struct io_uring_buf_reg reg;
+        memset(&reg, 0x00, sizeof(reg));
+        reg.ring_addr    = (uint64)(unsigned long)ptr;
+        reg.ring_entries = bufCount;
+        reg.bgid         = bufGroup;
+
+        int result = (int)syscall(__NR_io_uring_register, pRing->ringFd,
+                IORING_REGISTER_PBUF_RING, &reg, 1);
+        if (result < 0)
+        {
+            int lstErrno = SYS_ERRNO;
+            munmap(pRing->pBufRing, pRing->bufRingSize);
+            pRing->pBufRing = NULL;
+            THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, EpsGetSystemError(lstErrno));
+        }
+
+        pRing->bufBase  = bufBase;
+        pRing->bufSize  = bufSize;
+        pRing->bufCount = bufCount;
+        pRing->bufGroup = bufGroup;
+        pRing->bufTail  = 0;
+
+        uint16 i = 0;
+        for (i = 0; i < bufCount; i++)
+        {
+            RecycleIoUringBuf(pRing, i);
+        }
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * 黹ṩںٴʹ
+ *
+ * @param   pRing               in  - io_uring
+ * @param   bufId               in  - ID
+ */
+void RecycleIoUringBuf(EpsIoUringT* pRing, uint16 bufId)
+{
+    struct io_uring_buf* pBuf = &pRing->pBufRing->bufs[pRing->bufTail & (pRing->bufCount - 1)];
+    pBuf->addr = (uint64)(unsigned long)(pRing->bufBase + (uint32)bufId * pRing->bufSize);
+    pBuf->len  = pRing->bufSize;
+    pBuf->bid  = bufId;
+
+    pRing->bufTail++;
+    __atomic_store_n(&pRing->pBufRing->tail, pRing->bufTail, __ATOMIC_RELEASE);
+}
+
+/**
+ * ȡṩַ
+ *
+ * @param   pRing               in  - io_uring
+ * @param   bufId               in  - ID
+ *
+ * @return  ַ
+ */
+char* GetIoUringBuf(EpsIoUringT* pRing, uint16 bufId)
+{
+    return pRing->bufBase + (uint32)bufId * pRing->bufSize;
+}
+
+/**
+ * ע̶Ϊ0Ź̶WRITE_FIXEDʹ
+ *
+ * @param   pRing               in  - io_uring
+ * @param   buf                 in  - ַ
+ * @param   bufLen              in  - 
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT RegisterIoUringBuffer(EpsIoUringT* pRing, void* buf, uint32 bufLen)
+{
+    TRY
+    {
+        struct iovec iov;
+        iov.iov_base = buf;
+        iov.iov_len  = bufLen;
+
+        int result = (int)syscall(__NR_io_uring_register, pRing->ringFd,
+                IORING_REGISTER_BUFFERS, &iov, 1);
+        if (result < 0)
+        {
+            THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, EpsGetSystemError(SYS_ERRNO));
+        }
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ׼ν󣬽дṩеĻ
+ *
+ * @param   pRing               in  - io_uring
+ * @param   fd                  in  - ׽
+ * @param   userData            in  - ʶ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT PrepIoUringRecvMultishot(EpsIoUringT* pRing, int fd, uint64 userData)
+{
+    TRY
+    {
+        struct io_uring_sqe* sqe = GetSqe(pRing);
+        if (sqe == NULL)
+        {
+            THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, "io_uring submission queue full");
+        }
+
+        sqe->opcode    = IORING_OP_RECV;
+        sqe->fd        = fd;
+        sqe->ioprio    = IORING_RECV_MULTISHOT;
+        sqe->flags     = IOSQE_BUFFER_SELECT;
+        sqe->buf_group = pRing->bufGroup;
+        sqe->user_data = userData;
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ׼ʱ󣬳ʱcount
+ *
+ * @param   pRing               in  - io_uring
+ * @param   timeoutMs           in  - ʱʱ䣬λ: 
+ * @param   count               in  - ɼ0ʾڳʱʱ
+ * @param   userData            in  - ʶ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT PrepIoUringTimeout(EpsIoUringT* pRing, uint32 timeoutMs, uint32 count, uint64 userData)
+{
+    TRY
+    {
+        struct io_uring_sqe* sqe = GetSqe(pRing);
+        if (sqe == NULL)
+        {
+            THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, "io_uring submission queue full");
+        }
+
+        pRing->timeoutSpec.tv_sec  = timeoutMs / 1000;
+        pRing->timeoutSpec.tv_nsec = (timeoutMs % 1000) * 1000000LL;
+
+        sqe->opcode    = IORING_OP_TIMEOUT;
+        sqe->fd        = -1;
+        sqe->addr      = (uint64)(unsigned long)&pRing->timeoutSpec;
+        sqe->len       = 1;
+        sqe->off       = count;
+        sqe->user_data = userData;
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ׼̶д
+ *
+ * @param   pRing               in  - io_uring
+ * @param   fd                  in  - ׽
+ * @param   data                in  - д(λڹ̶)
+ * @param   dataLen             in  - дݳ
+ * @param   bufIndex            in  - ̶
+ * @param   userData            in  - ʶ
+ * @param   isLinked            in  - ǷӺ(ӳʱ)
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT PrepIoUringWriteFixed(EpsIoUringT* pRing, int fd, const char* data, uint32 dataLen,
+        uint16 bufIndex, uint64 userData, BOOL isLinked)
+{
+    TRY
+    {
+        struct io_uring_sqe* sqe = GetSqe(pRing);
+        if (sqe == NULL)
+        {
+            THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, "io_uring submission queue full");
+        }
+
+        sqe->opcode    = IORING_OP_WRITE_FIXED;
+        sqe->fd        = fd;
+        sqe->addr      = (uint64)(unsigned long)data;
+        sqe->len       = dataLen;
+        sqe->off       = 0;
+        sqe->buf_index = bufIndex;
+        sqe->flags     = isLinked ? IOSQE_IO_LINK : 0;
+        sqe->user_data = userData;
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ׼ӳʱ޶ǰһʱ
+ *
+ * @param   pRing               in  - io_uring
+ * @param   timeoutMs           in  - ʱʱ䣬λ: 
+ * @param   userData            in  - ʶ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT PrepIoUringLinkTimeout(EpsIoUringT* pRing, uint32 timeoutMs, uint64 userData)
+{
+    TRY
+    {
+        struct io_uring_sqe* sqe = GetSqe(pRing);
+        if (sqe == NULL)
+        {
+            THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, "io_uring submission queue full");
+        }
+
+        pRing->linkTimeoutSpec.tv_sec  = timeoutMs / 1000;
+        pRing->linkTimeoutSpec.tv_nsec = (timeoutMs % 1000) * 1000000LL;
+
+        sqe->opcode    = IORING_OP_LINK_TIMEOUT;
+        sqe->fd        = -1;
+        sqe->addr      = (uint64)(unsigned long)&pRing->linkTimeoutSpec;
+        sqe->len       = 1;
+        sqe->user_data = userData;
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ύ󲢵ȴ¼
+ *
+ * @param   pRing               in  - io_uring
+ * @param   waitCount           in  - ȴ¼0ʾȴ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT SubmitIoUring(EpsIoUringT* pRing, uint32 waitCount)
+{
+    TRY
+    {
+        uint32 submitCount = pRing->sqPending;
+        if (submitCount > 0)
+        {
+            __atomic_store_n(pRing->sqTail, *pRing->sqTail + submitCount, __ATOMIC_RELEASE);
+            pRing->sqPending = 0;
+        }
+
+        if (submitCount == 0 && waitCount == 0)
+        {
+            THROW_RESCODE(NO_ERR);
+        }
+
+        uint32 flags = (waitCount > 0) ? IORING_ENTER_GETEVENTS : 0;
+        int result = (int)syscall(__NR_io_uring_enter, pRing->ringFd,
+                submitCount, waitCount, flags, NULL, 0);
+        if (result < 0 && errno != EINTR)
+        {
+            THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, EpsGetSystemError(SYS_ERRNO));
+        }
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ȡ¼
+ *
+ * @param   pRing               in  - io_uring
+ *
+ * @return  ¼ʱ¼ַ򷵻NULL
+ */
+struct io_uring_cqe* PeekIoUringCqe(EpsIoUringT* pRing)
+{
+    uint32 head = *pRing->cqHead;
+    uint32 tail = __atomic_load_n(pRing->cqTail, __ATOMIC_ACQUIRE);
+    if (head == tail)
+    {
+        return NULL;
+    }
+
+    return &pRing->cqes[head & pRing->cqMask];
+}
+
+/**
+ * ȷ¼ͷɶпռ
+ *
+ * @param   pRing               in  - io_uring
+ */
+void AdvanceIoUringCq(EpsIoUringT* pRing)
+{
+    __atomic_store_n(pRing->cqHead, *pRing->cqHead + 1, __ATOMIC_RELEASE);
+}
+
+/**
+ * ȡеSQE
+ *
+ * @param   pRing               in  - io_uring
+ *
+ * @return  ύδʱSQEַ򷵻NULL
+ */
+static struct io_uring_sqe* GetSqe(EpsIoUringT* pRing)
+{
+    uint32 head = __atomic_load_n(pRing->sqHead, __ATOMIC_ACQUIRE);
+    uint32 tail = *pRing->sqTail + pRing->sqPending;
+    if (tail - head >= pRing->sqEntries)
+    {
+        return NULL;
+    }
+
+    struct io_uring_sqe* sqe = &pRing->sqes[tail & pRing->sqMask];
+    memset(sqe, 0x00, sizeof(struct io_uring_sqe));
+    pRing->sqPending++;
+
+    return sqe;
+}
+
+#endif /* EPS_IOENGINE_URING */
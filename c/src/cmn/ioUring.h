@@ -0,0 +1,172 @@
+/*
+ * Copyright (C) 2013, 2014 Shanghai Stock Exchange (SSE), Shanghai, China
+ * All Rights Reserved.
+ */
+
+/**
+ * @file    ioUring.h
+ *
+ * io_uring I/O涨ͷļ
+ *
+ * @version $Id
+ * @since   2026/10/18
+ */
+
+/**
+MODIFICATION HISTORY:
+<pre>
+================================================================================
+DD-MMM-YYYY INIT.    SIR    Modification Description
+----------- -------- ------ ----------------------------------------------------
+18-OCT-2026                 
+================================================================================
+</pre>
+*/
+
+#ifndef EPS_IOURING_H
+#define EPS_IOURING_H
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * ͷļ
+ */
+
+#include "common.h"
+#include "epsTypes.h"
+
+/*
+ * ڱʱָ IO_ENGINE=uring ( EPS_IOENGINE_URING) ʱ
+ */
+#if defined(EPS_IOENGINE_URING)
+
+#if ! defined(__LINUX__)
+#error "io_uring I/O engine requires Linux"
+#endif
+
+#include <linux/io_uring.h>
+
+
+/**
+ * Ͷ
+ */
+
+/*
+ * io_uring ṹ
+ */
+typedef struct EpsIoUringTag
+{
+    int         ringFd;                     /* io_uring ļ */
+
+    void*       sqPtr;                      /* ύӳַ */
+    size_t      sqSize;                     /* ύӳ䳤 */
+    uint32*     sqHead;                     /* ύͷָ */
+    uint32*     sqTail;                     /* ύβָ */
+    uint32*     sqArray;                    /* ύ */
+    uint32      sqMask;                     /* ύ */
+    uint32      sqEntries;                  /* ύг */
+    uint32      sqPending;                  /* ύSQE */
+    struct io_uring_sqe* sqes;              /* SQE */
+    size_t      sqesSize;                   /* SQEӳ䳤 */
+
+    void*       cqPtr;                      /* ɶӳַ */
+    size_t      cqSize;                     /* ɶӳ䳤 */
+    uint32*     cqHead;                     /* ɶͷָ */
+    uint32*     cqTail;                     /* ɶβָ */
+    uint32      cqMask;                     /* ɶ */
+    struct io_uring_cqe* cqes;              /* CQE */
+
+    struct io_uring_buf_ring* pBufRing;     /* ṩ */
+    size_t      bufRingSize;                /* ṩӳ䳤 */
+    char*       bufBase;                    /* ṩʼַ */
+    uint32      bufSize;                    /* ṩ */
+    uint16      bufCount;                   /* ṩ(2) */
+    uint16      bufGroup;                   /* ṩID */
+    uint16      bufTail;                    /* ṩβָ */
+
+    struct __kernel_timespec timeoutSpec;   /* ʱʱ */
+    struct __kernel_timespec linkTimeoutSpec;/* ӳʱʱ */
+} EpsIoUringT;
+
+
+/**
+ * 
+ */
+
+/*
+ * ʼio_uring
+ */
+ResCodeT InitIoUring(EpsIoUringT* pRing, uint32 entries);
+
+/*
+ * ʼio_uring
+ */
+void UninitIoUring(EpsIoUringT* pRing);
+
+/*
+ * עṩ
+ */
+ResCodeT RegisterIoUringBufRing(EpsIoUringT* pRing, uint16 bufGroup,
+        char* bufBase, uint32 bufSize, uint16 bufCount);
+
+/*
+ * 黹ṩ
+ */
+void RecycleIoUringBuf(EpsIoUringT* pRing, uint16 bufId);
+
+/*
+ * ȡṩַ
+ */
+char* GetIoUringBuf(EpsIoUringT* pRing, uint16 bufId);
+
+/*
+ * ע̶
+ */
+ResCodeT RegisterIoUringBuffer(EpsIoUringT* pRing, void* buf, uint32 bufLen);
+
+/*
+ * ׼ν
+ */
+ResCodeT PrepIoUringRecvMultishot(EpsIoUringT* pRing, int fd, uint64 userData);
+
+/*
+ * ׼ʱ
+ */
+ResCodeT PrepIoUringTimeout(EpsIoUringT* pRing, uint32 timeoutMs, uint32 count, uint64 userData);
+
+/*
+ * ׼̶д
+ */
+ResCodeT PrepIoUringWriteFixed(EpsIoUringT* pRing, int fd, const char* data, uint32 dataLen,
+        uint16 bufIndex, uint64 userData, BOOL isLinked);
+
+/*
+ * ׼ӳʱ
+ */
+ResCodeT PrepIoUringLinkTimeout(EpsIoUringT* pRing, uint32 timeoutMs, uint64 userData);
+
+/*
+ * ύ󲢵ȴ¼
+ */
+ResCodeT SubmitIoUring(EpsIoUringT* pRing, uint32 waitCount);
+
+/*
+ * ȡ¼
+ */
+struct io_uring_cqe* PeekIoUringCqe(EpsIoUringT* pRing);
+
+/*
+ * ȷ¼
+ */
+void AdvanceIoUringCq(EpsIoUringT* pRing);
+
+#endif /* EPS_IOENGINE_URING */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* EPS_IOURING_H */
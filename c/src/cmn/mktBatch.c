@@ -0,0 +1,242 @@
+/*
+ * Copyright (C) 2013, 2014 Shanghai Stock Exchange (SSE), Shanghai, China
+ * All Rights Reserved.
+ */
+
+/**
+ * @file    mktBatch.c
+ *
+ * Ͷʵļ
+ *
+ * @version $Id
+ * @since   2026/10/18
+ */
+
+/**
+MODIFICATION HISTORY:
+<pre>
+================================================================================
+DD-MMM-YYYY INIT.    SIR    Modification Description
+----------- -------- ------ ----------------------------------------------------
+18-OCT-2026                 
+================================================================================
+</pre>
+*/
+
+/**
+ * ͷļ
+ */
+
+#include "common.h"
+#include "epsTypes.h"
+#include "errlib.h"
+#include "errcode.h"
+#include "atomic.h"
+
+#include "mktBatch.h"
+
+
+/**
+ * ӿںʵ
+ */
+
+/**
+ * ʼ黺
+ *
+ * @param   pBatch          in  - 黺
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT InitMktBatch(EpsMktBatchT* pBatch)
+{
+    TRY
+    {
+        pBatch->items = NULL;
+        pBatch->count = 0;
+        pBatch->firstRecvTime = 0;
+        pBatch->maxSize = EPS_MKTBATCH_SIZE_DEFAULT;
+        pBatch->maxDelay = EPS_MKTBATCH_DELAY_DEFAULT;
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ʼ黺
+ *
+ * @param   pBatch          in  - 黺
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT UninitMktBatch(EpsMktBatchT* pBatch)
+{
+    TRY
+    {
+        if (pBatch->items != NULL)
+        {
+            free(pBatch->items);
+            pBatch->items = NULL;
+        }
+        pBatch->count = 0;
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * 黺ѷʱֱӷ
+ *
+ * @param   pBatch          in  - 黺
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT AllocMktBatch(EpsMktBatchT* pBatch)
+{
+    TRY
+    {
+        if (pBatch->items == NULL)
+        {
+            pBatch->items = (EpsMktDataT*)calloc(EPS_MKTBATCH_SIZE_MAX, sizeof(EpsMktDataT));
+            if (pBatch->items == NULL)
+            {
+                int lstErrno = SYS_ERRNO;
+                THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, EpsGetSystemError(lstErrno));
+            }
+
+            uint32 i = 0;
+            for (i = 0; i < EPS_MKTBATCH_SIZE_MAX; i++)
+            {
+                pBatch->pItems[i] = &pBatch->items[i];
+            }
+        }
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * Ͷѡ
+ *
+ * @param   pBatch          in  - 黺
+ * @param   option          in  - EPS_OPTION_MKTDATA_BATCH_SIZEEPS_OPTION_MKTDATA_BATCH_DELAY
+ * @param   value           in  - ѡֵ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT SetMktBatchOption(EpsMktBatchT* pBatch, EpsOptionT option, int32 value)
+{
+    TRY
+    {
+        switch (option)
+        {
+            case EPS_OPTION_MKTDATA_BATCH_SIZE:
+            {
+                if (value < 1 || value > EPS_MKTBATCH_SIZE_MAX)
+                {
+                    THROW_ERROR(ERCD_EPS_INVALID_PARM, "value");
+                }
+                EpsAtomicStoreRelaxed(&pBatch->maxSize, (uint32)value);
+                break;
+            }
+            case EPS_OPTION_MKTDATA_BATCH_DELAY:
+            {
+                if (value < 0)
+                {
+                    THROW_ERROR(ERCD_EPS_INVALID_PARM, "value");
+                }
+                EpsAtomicStoreRelaxed(&pBatch->maxDelay, (uint32)value);
+                break;
+            }
+            default:
+            {
+                THROW_ERROR(ERCD_EPS_INVALID_PARM, "option");
+            }
+        }
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ȡһд
+ *
+ * @param   pBatch          in  - 黺ȷѷδ
+ *
+ * @return  д
+ */
+EpsMktDataT* NextMktBatchItem(EpsMktBatchT* pBatch)
+{
+    return &pBatch->items[pBatch->count];
+}
+
+/**
+ * ύд
+ *
+ * @param   pBatch          in  - 黺
+ * @param   recvTime        in  - ʱ()
+ *
+ * @return  ﵽȴʱޡͶʱTRUE
+ */
+BOOL CommitMktBatchItem(EpsMktBatchT* pBatch, uint64 recvTime)
+{
+    if (pBatch->count == 0)
+    {
+        pBatch->firstRecvTime = recvTime;
+    }
+    pBatch->count++;
+
+    if (pBatch->count >= EpsAtomicLoadRelaxed(&pBatch->maxSize))
+    {
+        return TRUE;
+    }
+
+    uint32 maxDelay = EpsAtomicLoadRelaxed(&pBatch->maxDelay);
+    return (maxDelay > 0 &&
+            EpsGetTimestamp() - pBatch->firstRecvTime >= (uint64)maxDelay * 1000);
+}
+
+/**
+ * Ͷۻ飬ۻʱûص
+ *
+ * @param   pBatch          in  - 黺
+ * @param   hid             in  - ID
+ * @param   batchNotify     in  - ûص
+ */
+void FlushMktBatch(EpsMktBatchT* pBatch, uint32 hid, EpsMktDataBatchArrivedCallback batchNotify)
+{
+    if (pBatch->count == 0)
+    {
+        return;
+    }
+
+    uint64 notifyTime = EpsGetTimestamp();
+    uint32 i = 0;
+    for (i = 0; i < pBatch->count; i++)
+    {
+        pBatch->items[i].notifyTime = notifyTime;
+    }
+
+    uint32 count = pBatch->count;
+    pBatch->count = 0;
+    batchNotify(hid, pBatch->pItems, count);
+}
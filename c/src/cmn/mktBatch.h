@@ -0,0 +1,117 @@
+/*
+ * Copyright (C) 2013, 2014 Shanghai Stock Exchange (SSE), Shanghai, China
+ * All Rights Reserved.
+ */
+
+/**
+ * @file    mktBatch.h
+ *
+ * Ͷݶͷļ
+ *
+ * @version $Id
+ * @since   2026/10/18
+ */
+
+/**
+MODIFICATION HISTORY:
+<pre>
+================================================================================
+DD-MMM-YYYY INIT.    SIR    Modification Description
+----------- -------- ------ ----------------------------------------------------
+18-OCT-2026                 
+================================================================================
+</pre>
+*/
+
+#ifndef EPS_MKTBATCH_H
+#define EPS_MKTBATCH_H
+
+/**
+ * ͷļ
+ */
+
+#include "common.h"
+#include "epsTypes.h"
+#include "epsData.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**
+ * 궨
+ */
+
+#define EPS_MKTBATCH_SIZE_DEFAULT   16      /* Ĭ */
+#define EPS_MKTBATCH_SIZE_MAX       64      /*  */
+#define EPS_MKTBATCH_DELAY_DEFAULT  100     /* Ĭȴʱ䣬λ: ΢ */
+
+
+/**
+ * Ͷ
+ */
+
+/*
+ * 黺
+ *
+ * ͨ߳һνմۻ飬մﵽ
+ * ȴʱʱһͶݣעصʱ䣬
+ * ʱ޿û߳ʱ޸ģ´ۻʱЧ
+ */
+typedef struct EpsMktBatchTag
+{
+    EpsMktDataT*        items;              /* 黺EPS_MKTBATCH_SIZE_MAX */
+    const EpsMktDataT*  pItems[EPS_MKTBATCH_SIZE_MAX];  /* Ͷݸûָ */
+    uint32              count;              /* ۻ */
+    uint64              firstRecvTime;      /* Ľʱ() */
+    uint32              maxSize;            /*  */
+    uint32              maxDelay;           /* ʱ(΢)0ʾڽմʱͶ */
+} EpsMktBatchT;
+
+
+/**
+ * 
+ */
+
+/*
+ * ʼ黺
+ */
+ResCodeT InitMktBatch(EpsMktBatchT* pBatch);
+
+/*
+ * ʼ黺
+ */
+ResCodeT UninitMktBatch(EpsMktBatchT* pBatch);
+
+/*
+ * 黺
+ */
+ResCodeT AllocMktBatch(EpsMktBatchT* pBatch);
+
+/*
+ * Ͷѡ
+ */
+ResCodeT SetMktBatchOption(EpsMktBatchT* pBatch, EpsOptionT option, int32 value);
+
+/*
+ * ȡһд
+ */
+EpsMktDataT* NextMktBatchItem(EpsMktBatchT* pBatch);
+
+/*
+ * ύд
+ */
+BOOL CommitMktBatchItem(EpsMktBatchT* pBatch, uint64 recvTime);
+
+/*
+ * Ͷۻ
+ */
+void FlushMktBatch(EpsMktBatchT* pBatch, uint32 hid, EpsMktDataBatchArrivedCallback batchNotify);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* EPS_MKTBATCH_H */
@@ -29,10 +29,19 @@ DD-MMM-YYYY INIT.    SIR    Modification Description
  */
 
 #include "common.h"
+#include "atomic.h"
 
 #include "mktDatabase.h"
 
 
+/**
+ * ڲ
+ */
+
+static void AddMktGap(EpsMktGapListT* pList, uint64 beginSeqNum, uint64 endSeqNum);
+static BOOL FillMktGap(EpsMktGapListT* pList, uint64 seqNum);
+
+
 /**
  * ӿںʵ
  */
@@ -163,12 +172,16 @@ ResCodeT UnsubscribeAllMktData(EpsMktDatabaseT* pDatabase)
 /**
  * жǷܸ
  *
+ * ͬһԴԾʱ¼ȱڲERCD_EPS_MKTDATA_GAP(Ա)
+ * ٵδȱͬܣΪ
+ *
  * @param   pDatabase           in  - ݿ
  * @param   pMsg                in  - STEPϢ
+ * @param   pGap                out - ⵽ȱ(ERCD_EPS_MKTDATA_GAPʱЧ)
  *
- * @return  ܷTRUE򷵻FALSE
+ * @return  ܷNO_ERRERCD_EPS_MKTDATA_GAP򷵻ش
  */
-ResCodeT AcceptMktData(EpsMktDatabaseT* pDatabase, const StepMessageT* pMsg)
+ResCodeT AcceptMktData(EpsMktDatabaseT* pDatabase, const StepMessageT* pMsg, EpsMktGapT* pGap)
 {
     TRY
     {
@@ -184,9 +197,31 @@ ResCodeT AcceptMktData(EpsMktDatabaseT* pDatabase, const StepMessageT* pMsg)
         {
             if (pRecord->applID == pDatabase->applID)
             {
-                if (pRecord->applSeqNum > pDatabase->applSeqNum[mktType])
+                uint64 lastSeqNum = pDatabase->applSeqNum[mktType];
+                if (pRecord->applSeqNum > lastSeqNum)
                 {
                     pDatabase->applSeqNum[mktType] = pRecord->applSeqNum;
+
+                    if (lastSeqNum != 0 && pRecord->applSeqNum > lastSeqNum + 1)
+                    {
+                        pGap->mktType     = mktType;
+                        pGap->applID      = pRecord->applID;
+                        pGap->beginSeqNum = lastSeqNum + 1;
+                        pGap->endSeqNum   = pRecord->applSeqNum - 1;
+
+                        AddMktGap(&pDatabase->gapList[mktType], pGap->beginSeqNum, pGap->endSeqNum);
+                        EpsAtomicCounterAdd(&pDatabase->stat.gapCount, 1);
+                        EpsAtomicCounterAdd(&pDatabase->stat.gapSeqNums, 
+                                pGap->endSeqNum - pGap->beginSeqNum + 1);
+
+                        THROW_RESCODE(ERCD_EPS_MKTDATA_GAP);
+                    }
+
+                    THROW_RESCODE(NO_ERR);
+                }
+                else if (FillMktGap(&pDatabase->gapList[mktType], pRecord->applSeqNum))
+                {
+                    EpsAtomicCounterAdd(&pDatabase->stat.gapFilledSeqNums, 1);
                     THROW_RESCODE(NO_ERR);
                 }
                 else
@@ -202,6 +237,7 @@ ResCodeT AcceptMktData(EpsMktDatabaseT* pDatabase, const StepMessageT* pMsg)
                 for (mktType1 = EPS_MKTTYPE_ALL + 1; mktType1 <= EPS_MKTTYPE_NUM; mktType1++)
                 {
                     pDatabase->applSeqNum[mktType1] = 0;
+                    pDatabase->gapList[mktType1].count = 0;
                 }
                 
                 pDatabase->applID = pRecord->applID;
@@ -227,6 +263,108 @@ ResCodeT AcceptMktData(EpsMktDatabaseT* pDatabase, const StepMessageT* pMsg)
     }
 }
 
+/**
+ * жǷǰ(ͬһԴŴѽżһ)
+ *
+ * @param   pDatabase           in  - ݿ
+ * @param   pMsg                in  - STEPϢ
+ * @param   pIsAhead            out - ǰTRUE򷵻FALSE
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT CheckMktDataOrder(EpsMktDatabaseT* pDatabase, const StepMessageT* pMsg, BOOL* pIsAhead)
+{
+    TRY
+    {
+        MDSnapshotFullRefreshRecordT* pRecord = (MDSnapshotFullRefreshRecordT*)pMsg->body;
+
+        *pIsAhead = FALSE;
+
+        EpsMktTypeT mktType = (EpsMktTypeT)(atoi(pRecord->securityType));
+        if (mktType == EPS_MKTTYPE_ALL || mktType > EPS_MKTTYPE_NUM)
+        {
+            THROW_RESCODE(NO_ERR);
+        }
+
+        uint64 lastSeqNum = pDatabase->applSeqNum[mktType];
+        if (pDatabase->isSubscribed[mktType] && 
+            pRecord->applID == pDatabase->applID &&
+            lastSeqNum != 0 && pRecord->applSeqNum > lastSeqNum + 1)
+        {
+            *pIsAhead = TRUE;
+        }
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * 벻ָŵȱڣڿջָɺ޷ٲȱ
+ *
+ * @param   pDatabase           in  - ݿ
+ * @param   mktType             in  - г
+ * @param   seqNum              in  - ֹ()
+ * @param   pResolvedSeqNums    out - 
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT ResolveMktGap(EpsMktDatabaseT* pDatabase, EpsMktTypeT mktType, 
+        uint64 seqNum, uint64* pResolvedSeqNums)
+{
+    TRY
+    {
+        if (mktType == EPS_MKTTYPE_ALL || mktType > EPS_MKTTYPE_NUM)
+        {
+            THROW_ERROR(ERCD_EPS_INVALID_MKTTYPE);
+        }
+
+        EpsMktGapListT* pList = &pDatabase->gapList[mktType];
+        uint64 resolvedSeqNums = 0;
+        uint32 count = 0;
+        uint32 i = 0;
+
+        for (i = 0; i < pList->count; i++)
+        {
+            EpsMktGapRangeT* pRange = &pList->ranges[i];
+            if (pRange->beginSeqNum > seqNum)
+            {
+                break;
+            }
+
+            if (pRange->endSeqNum > seqNum)
+            {
+                resolvedSeqNums += seqNum - pRange->beginSeqNum + 1;
+                pRange->beginSeqNum = seqNum + 1;
+                break;
+            }
+
+            resolvedSeqNums += pRange->endSeqNum - pRange->beginSeqNum + 1;
+            count++;
+        }
+
+        if (count > 0)
+        {
+            memmove(&pList->ranges[0], &pList->ranges[count], 
+                (pList->count - count) * sizeof(EpsMktGapRangeT));
+            pList->count -= count;
+        }
+
+        *pResolvedSeqNums = resolvedSeqNums;
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
 /**
  * жǷܸг״̬
  *
@@ -284,18 +422,26 @@ ResCodeT ConvertMktData(const StepMessageT* pMsg, EpsMktDataT* pData)
     {
         MDSnapshotFullRefreshRecordT* pRecord = (MDSnapshotFullRefreshRecordT*)pMsg->body;
 
-        memset(pData, 0x00, sizeof(EpsMktDataT));
-
+        /* ֻЧݣṹ */
         memcpy(pData->mktTime, pRecord->lastUpdateTime, EPS_TIME_LEN);
+        pData->mktTime[EPS_TIME_LEN] = 0x00;
         pData->mktType = (EpsMktTypeT)(atoi(pRecord->securityType));
         pData->tradSesMode = (EpsTrdSesModeT)pRecord->tradSesMode;
         pData->applID = pRecord->applID;
         pData->applSeqNum = pRecord->applSeqNum;
         memcpy(pData->tradeDate, pRecord->tradeDate, EPS_DATE_LEN);
+        pData->tradeDate[EPS_DATE_LEN] = 0x00;
         memcpy(pData->mdUpdateType, pRecord->mdUpdateType, EPS_UPDATETYPE_LEN);
+        pData->mdUpdateType[EPS_UPDATETYPE_LEN] = 0x00;
         pData->mdCount = pRecord->mdCount;
-        pData->mdDataLen = pRecord->mdDataLen;
-        memcpy(pData->mdData, pRecord->mdData, EPS_MKTDATA_MAX_LEN);
+        pData->mdDataLen = (pRecord->mdDataLen < EPS_MKTDATA_MAX_LEN) ? pRecord->mdDataLen : EPS_MKTDATA_MAX_LEN;
+        memcpy(pData->mdData, pRecord->mdData, pData->mdDataLen);
+        if (pData->mdDataLen < EPS_MKTDATA_MAX_LEN)
+        {
+            pData->mdData[pData->mdDataLen] = 0x00;
+        }
+        pData->recvTime = 0;
+        pData->notifyTime = 0;
     }
     CATCH
     {
@@ -306,6 +452,64 @@ ResCodeT ConvertMktData(const StepMessageT* pMsg, EpsMktDataT* pData)
     }
 }
 
+/**
+ * ϢSTEPʽתͼͼָϢݣ
+ *
+ * @param   pMsg                in  - STEPʽ飬ͼʹڼ䱣Ч
+ * @param   pView               out - ͼ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT ConvertMktDataView(const StepMessageT* pMsg, EpsMktDataViewT* pView)
+{
+    TRY
+    {
+        const MDSnapshotFullRefreshRecordT* pRecord = (const MDSnapshotFullRefreshRecordT*)pMsg->body;
+
+        pView->mktTime = pRecord->lastUpdateTime;
+        pView->mktType = (EpsMktTypeT)(atoi(pRecord->securityType));
+        pView->tradSesMode = (EpsTrdSesModeT)pRecord->tradSesMode;
+        pView->applID = pRecord->applID;
+        pView->applSeqNum = pRecord->applSeqNum;
+        pView->tradeDate = pRecord->tradeDate;
+        pView->mdUpdateType = pRecord->mdUpdateType;
+        pView->mdCount = pRecord->mdCount;
+        pView->mdDataLen = pRecord->mdDataLen;
+        pView->mdData = pRecord->mdData;
+        pView->recvTime = 0;
+        pView->notifyTime = 0;
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ȡѽͼͼָݣ
+ *
+ * @param   pData               in  - ѽ飬ͼʹڼ䱣Ч
+ * @param   pView               out - ͼ
+ */
+void GetMktDataView(const EpsMktDataT* pData, EpsMktDataViewT* pView)
+{
+    pView->mktTime = pData->mktTime;
+    pView->mktType = pData->mktType;
+    pView->tradSesMode = pData->tradSesMode;
+    pView->applID = pData->applID;
+    pView->applSeqNum = pData->applSeqNum;
+    pView->tradeDate = pData->tradeDate;
+    pView->mdUpdateType = pData->mdUpdateType;
+    pView->mdCount = pData->mdCount;
+    pView->mdDataLen = pData->mdDataLen;
+    pView->mdData = pData->mdData;
+    pView->recvTime = pData->recvTime;
+    pView->notifyTime = pData->notifyTime;
+}
+
 /**
  * ϢSTEPʽתг״̬ṹ
  *
@@ -336,3 +540,86 @@ ResCodeT ConvertMktStatus(const StepMessageT* pMsg, EpsMktStatusT* pStatus)
     }
 }
 
+/**
+ * ׷ȱڣȱǴȱڣбʱȱ
+ *
+ * @param   pList               in  - ȱб
+ * @param   beginSeqNum         in  - ȱʧʼ
+ * @param   endSeqNum           in  - ȱʧ
+ */
+static void AddMktGap(EpsMktGapListT* pList, uint64 beginSeqNum, uint64 endSeqNum)
+{
+    if (pList->count == EPS_MKTDB_GAP_MAX_NUM)
+    {
+        memmove(&pList->ranges[0], &pList->ranges[1], 
+            (EPS_MKTDB_GAP_MAX_NUM - 1) * sizeof(EpsMktGapRangeT));
+        pList->count--;
+    }
+
+    pList->ranges[pList->count].beginSeqNum = beginSeqNum;
+    pList->ranges[pList->count].endSeqNum = endSeqNum;
+    pList->count++;
+}
+
+/**
+ * Գٵ鲹ȱ
+ *
+ * @param   pList               in  - ȱб
+ * @param   seqNum              in  - ٵ
+ *
+ * @return  δȱڷTRUE򷵻FALSE
+ */
+static BOOL FillMktGap(EpsMktGapListT* pList, uint64 seqNum)
+{
+    uint32 i = 0;
+    for (i = 0; i < pList->count; i++)
+    {
+        EpsMktGapRangeT* pRange = &pList->ranges[i];
+        if (seqNum < pRange->beginSeqNum || seqNum > pRange->endSeqNum)
+        {
+            continue;
+        }
+
+        if (pRange->beginSeqNum == pRange->endSeqNum)
+        {
+            memmove(&pList->ranges[i], &pList->ranges[i+1], 
+                (pList->count - i - 1) * sizeof(EpsMktGapRangeT));
+            pList->count--;
+        }
+        else if (seqNum == pRange->beginSeqNum)
+        {
+            pRange->beginSeqNum++;
+        }
+        else if (seqNum == pRange->endSeqNum)
+        {
+            pRange->endSeqNum--;
+        }
+        else
+        {
+            /* ȱڣбʱȱ */
+            EpsMktGapRangeT upper = { seqNum + 1, pRange->endSeqNum };
+            pRange->endSeqNum = seqNum - 1;
+
+            if (pList->count == EPS_MKTDB_GAP_MAX_NUM)
+            {
+                if (i == 0)
+                {
+                    *pRange = upper;
+                    return TRUE;
+                }
+                memmove(&pList->ranges[0], &pList->ranges[1], i * sizeof(EpsMktGapRangeT));
+                pList->count--;
+                i--;
+            }
+
+            memmove(&pList->ranges[i+2], &pList->ranges[i+1], 
+                (pList->count - i - 1) * sizeof(EpsMktGapRangeT));
+            pList->ranges[i+1] = upper;
+            pList->count++;
+        }
+
+        return TRUE;
+    }
+
+    return FALSE;
+}
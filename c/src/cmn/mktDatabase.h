@@ -44,9 +44,44 @@ extern "C" {
 #include "stepMessage.h"
 
 
+/**
+ * 궨
+ */
+
+#define EPS_MKTDB_GAP_MAX_NUM       64      /* ÿгδȱ */
+
+
 /**
  * Ͷ
  */
+
+/*
+ * ȱ
+ */
+typedef struct EpsMktGapRangeTag
+{
+    uint64          beginSeqNum;            /* ȱʧʼ */
+    uint64          endSeqNum;              /* ȱʧ() */
+} EpsMktGapRangeT;
+
+/*
+ * δȱбУʱȱ
+ */
+typedef struct EpsMktGapListTag
+{
+    EpsMktGapRangeT ranges[EPS_MKTDB_GAP_MAX_NUM];
+    uint32          count;
+} EpsMktGapListT;
+
+/*
+ * ͳ
+ */
+typedef struct EpsMktDatabaseStatTag
+{
+    uint64          gapCount;               /* ⵽ȱ */
+    uint64          gapSeqNums;             /* ȱʧ */
+    uint64          gapFilledSeqNums;       /* ٵ */
+} EpsMktDatabaseStatT;
  
 /* 
  * ݿⶨṹ 
@@ -57,6 +92,8 @@ typedef struct EpsMktDatabaseTag
     uint32          applID;
     uint64          applSeqNum[EPS_MKTTYPE_NUM + 1];
     char            mktStatus[EPS_MKTTYPE_NUM + 1][EPS_MKTSTATUS_LEN];
+    EpsMktGapListT  gapList[EPS_MKTTYPE_NUM + 1];
+    EpsMktDatabaseStatT stat;
 } EpsMktDatabaseT;
 
 
@@ -87,7 +124,18 @@ ResCodeT UnsubscribeAllMktData(EpsMktDatabaseT* pDatabase);
 /*
  * жǷܸ
  */
-ResCodeT AcceptMktData(EpsMktDatabaseT* pDatabase, const StepMessageT* pMsg);
+ResCodeT AcceptMktData(EpsMktDatabaseT* pDatabase, const StepMessageT* pMsg, EpsMktGapT* pGap);
+
+/*
+ * жǷǰ
+ */
+ResCodeT CheckMktDataOrder(EpsMktDatabaseT* pDatabase, const StepMessageT* pMsg, BOOL* pIsAhead);
+
+/*
+ * 벻ָŵȱ
+ */
+ResCodeT ResolveMktGap(EpsMktDatabaseT* pDatabase, EpsMktTypeT mktType, 
+        uint64 seqNum, uint64* pResolvedSeqNums);
 
 /*
  * жǷܸ
@@ -99,6 +147,16 @@ ResCodeT AcceptMktStatus(EpsMktDatabaseT* pDatabase, const StepMessageT* pMsg);
  */
 ResCodeT ConvertMktData(const StepMessageT* pMsg, EpsMktDataT* pData);
 
+/*
+ * ϢSTEPʽתͼ
+ */
+ResCodeT ConvertMktDataView(const StepMessageT* pMsg, EpsMktDataViewT* pView);
+
+/*
+ * ȡѽͼ
+ */
+void GetMktDataView(const EpsMktDataT* pData, EpsMktDataViewT* pView);
+
 /*
  * תг״̬ʽ
  */
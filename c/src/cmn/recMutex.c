@@ -102,6 +102,29 @@ void LockRecMutex(EpsRecMutexT* pMutex)
 #endif 
 }
 
+/**
+ * ԶԵݹ黥̳߳ʱ
+ *
+ * @param   pMutex                  in  - ݹ黥
+ *
+ * @return  ɹTRUE򷵻FALSE
+ */
+BOOL TryLockRecMutex(EpsRecMutexT* pMutex)
+{
+    if (pMutex == NULL)
+    {
+        return FALSE;
+    }
+
+#if defined(__WINDOWS__)  
+	return (WaitForSingleObject(pMutex->mutex, 0) == WAIT_OBJECT_0) ? TRUE : FALSE;
+#endif  
+  
+#if defined(__LINUX__) || defined(__HPUX__) 
+    return (pthread_mutex_trylock(&pMutex->mutex) == 0) ? TRUE : FALSE;
+#endif 
+}
+
 /**
  * Եݹ黥
  *
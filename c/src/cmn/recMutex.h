@@ -77,6 +77,11 @@ void UninitRecMutex(EpsRecMutexT* pMutex);
  */
 void LockRecMutex(EpsRecMutexT* pMutex);
 
+/*
+ * ԶԵݹ黥
+ */
+BOOL TryLockRecMutex(EpsRecMutexT* pMutex);
+
 /**
  * Եݹ黥
  */
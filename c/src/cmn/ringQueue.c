@@ -0,0 +1,351 @@
+/*
+ * Copyright (C) 2013, 2014 Shanghai Stock Exchange (SSE), Shanghai, China
+ * All Rights Reserved.
+ */
+
+/**
+ * @file    ringQueue.c
+ *
+ * ζʵļ
+ *
+ * @version $Id
+ * @since   2026/10/18
+ */
+
+/**
+MODIFICATION HISTORY:
+<pre>
+================================================================================
+DD-MMM-YYYY INIT.    SIR    Modification Description
+----------- -------- ------ ----------------------------------------------------
+18-OCT-2026                 
+================================================================================
+</pre>
+*/
+
+/**
+ * ͷļ
+ */
+
+#include "common.h"
+#include "epsTypes.h"
+#include "errlib.h"
+#include "errcode.h"
+
+#include "ringQueue.h"
+
+
+/**
+ * ӿںʵ
+ */
+
+/**
+ * ʼζ
+ *
+ * @param   pQueue          in  - ζж
+ * @param   type            in  - 
+ * @param   size            in  - дСΪ2
+ * @param   itemSize        in  - 
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT InitRingQueue(EpsRingQueueT* pQueue, EpsRingQueueTypeT type, uint32 size, uint32 itemSize)
+{
+    TRY
+    {
+        if (pQueue == NULL)
+        {
+            THROW_ERROR(ERCD_EPS_INVALID_PARM, "pQueue");
+        }
+
+        if (size == 0 || (size & (size - 1)) != 0)
+        {
+            THROW_ERROR(ERCD_EPS_INVALID_PARM, "size");
+        }
+
+        if (itemSize == 0)
+        {
+            THROW_ERROR(ERCD_EPS_INVALID_PARM, "itemSize");
+        }
+
+        if (pQueue->container != NULL)
+        {
+            THROW_ERROR(ERCD_EPS_DUPLICATE_INITED, "RingQueue");
+        }
+
+        pQueue->sequences = (uint32*)calloc(size, sizeof(uint32));
+        pQueue->container = (char*)calloc(size, (itemSize + 7) & ~7);
+        if (pQueue->sequences == NULL || pQueue->container == NULL)
+        {
+            int lstErrno = SYS_ERRNO;
+            UninitRingQueue(pQueue);
+            THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, EpsGetSystemError(lstErrno));
+        }
+
+        uint32 i = 0;
+        for (i = 0; i < size; i++)
+        {
+            pQueue->sequences[i] = i;
+        }
+
+        pQueue->type = type;
+        pQueue->size = size;
+        pQueue->mask = size - 1;
+        pQueue->itemSize = itemSize;
+        pQueue->slotSize = (itemSize + 7) & ~7;
+        pQueue->header = 0;
+        pQueue->tailer = 0;
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ʼζ
+ *
+ * @param   pQueue          in  - ζж
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT UninitRingQueue(EpsRingQueueT* pQueue)
+{
+    TRY
+    {
+        if (pQueue == NULL)
+        {
+            THROW_ERROR(ERCD_EPS_INVALID_PARM, "pQueue");
+        }
+
+        if (pQueue->container != NULL)
+        {
+            free(pQueue->container);
+            pQueue->container = NULL;
+        }
+
+        if (pQueue->sequences != NULL)
+        {
+            free(pQueue->sequences);
+            pQueue->sequences = NULL;
+        }
+
+        pQueue->size = 0;
+        pQueue->mask = 0;
+        pQueue->header = 0;
+        pQueue->tailer = 0;
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ԤζβλдCommitRingQueue()ύ
+ *
+ * @param   pQueue          in  - ζж
+ * @param   ppSlot          out - ԤĲλ
+ *
+ * @return  ɹNO_ERRERCD_EPS_QUEUE_FULL
+ */
+ResCodeT ReserveRingQueue(EpsRingQueueT* pQueue, void** ppSlot)
+{
+    TRY
+    {
+        if (pQueue->container == NULL)
+        {
+            THROW_ERROR(ERCD_EPS_UNINITED, "RingQueue");
+        }
+
+        uint32 pos = EpsAtomicLoadRelaxed(&pQueue->header);
+        while (TRUE)
+        {
+            uint32 seq = EpsAtomicLoad(&pQueue->sequences[pos & pQueue->mask]);
+            int32 diff = (int32)(seq - pos);
+
+            if (diff < 0)
+            {
+                THROW_ERROR(ERCD_EPS_QUEUE_FULL, "RingQueue");
+            }
+
+            if (diff > 0)
+            {
+                /* ռøòλ */
+                pos = EpsAtomicLoadRelaxed(&pQueue->header);
+                continue;
+            }
+
+            if (pQueue->type == EPS_RINGQUEUE_TYPE_SPSC)
+            {
+                EpsAtomicStoreRelaxed(&pQueue->header, pos + 1);
+                break;
+            }
+
+            if (EpsAtomicCompareAndExchange(&pQueue->header, &pos, pos + 1))
+            {
+                break;
+            }
+        }
+
+        *ppSlot = pQueue->container + (size_t)(pos & pQueue->mask) * pQueue->slotSize;
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ύԤĲλ߿ɼ
+ *
+ * @param   pQueue          in  - ζж
+ * @param   pSlot           in  - ReserveRingQueue()صĲλ
+ */
+void CommitRingQueue(EpsRingQueueT* pQueue, void* pSlot)
+{
+    uint32 index = (uint32)(((char*)pSlot - pQueue->container) / pQueue->slotSize);
+
+    /* ԤύǰλűΪԤʱλ */
+    uint32 pos = pQueue->sequences[index];
+    EpsAtomicStore(&pQueue->sequences[index], pos + 1);
+}
+
+/**
+ * ζβ
+ *
+ * @param   pQueue          in  - ζж
+ * @param   pItem           in  - itemSizeֽ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT PushRingQueue(EpsRingQueueT* pQueue, const void* pItem)
+{
+    TRY
+    {
+        void* pSlot = NULL;
+        THROW_ERROR(ReserveRingQueue(pQueue, &pSlot));
+
+        memcpy(pSlot, pItem, pQueue->itemSize);
+        CommitRingQueue(pQueue, pSlot);
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * 鿴ζͷύϺReleaseRingQueue()ͷ
+ *
+ * صаslotSizeţԽĩβ
+ *
+ * @param   pQueue          in  - ζж
+ * @param   maxCount        in  - 鿴
+ * @param   ppItems         out - ׸ΪʱΪNULL
+ *
+ * @return  õ
+ */
+uint32 PeekRingQueue(EpsRingQueueT* pQueue, uint32 maxCount, void** ppItems)
+{
+    uint32 pos = pQueue->tailer;
+    uint32 index = pos & pQueue->mask;
+    uint32 count = 0;
+
+    if (maxCount > pQueue->size - index)
+    {
+        maxCount = pQueue->size - index;
+    }
+
+    while (count < maxCount &&
+           EpsAtomicLoad(&pQueue->sequences[index + count]) == pos + count + 1)
+    {
+        count++;
+    }
+
+    *ppItems = (count > 0) ? pQueue->container + (size_t)index * pQueue->slotSize : NULL;
+    return count;
+}
+
+/**
+ * ͷŻζͷѲ鿴λ¹ʹ
+ *
+ * @param   pQueue          in  - ζж
+ * @param   count           in  - ͷŵ
+ */
+void ReleaseRingQueue(EpsRingQueueT* pQueue, uint32 count)
+{
+    uint32 pos = pQueue->tailer;
+    uint32 i = 0;
+
+    for (i = 0; i < count; i++)
+    {
+        EpsAtomicStore(&pQueue->sequences[(pos + i) & pQueue->mask], pos + i + pQueue->size);
+    }
+
+    pQueue->tailer = pos + count;
+}
+
+/**
+ * ӻζͷȡ
+ *
+ * @param   pQueue          in  - ζж
+ * @param   pItems          out - 飬maxCount*itemSizeֽ
+ * @param   maxCount        in  - ȡ
+ *
+ * @return  ȡΪʱΪ0
+ */
+uint32 PopRingQueue(EpsRingQueueT* pQueue, void* pItems, uint32 maxCount)
+{
+    uint32 total = 0;
+
+    while (total < maxCount)
+    {
+        void* pFirst = NULL;
+        uint32 count = PeekRingQueue(pQueue, maxCount - total, &pFirst);
+        if (count == 0)
+        {
+            break;
+        }
+
+        uint32 i = 0;
+        for (i = 0; i < count; i++)
+        {
+            memcpy((char*)pItems + (size_t)(total + i) * pQueue->itemSize,
+                   (char*)pFirst + (size_t)i * pQueue->slotSize, pQueue->itemSize);
+        }
+        ReleaseRingQueue(pQueue, count);
+        total += count;
+    }
+
+    return total;
+}
+
+/**
+ * жϻζǷѾʼ
+ *
+ * @param   pQueue          in  - ζж
+ *
+ * @return  ѾʼTRUE򷵻FALSE
+ */
+BOOL IsRingQueueInited(EpsRingQueueT* pQueue)
+{
+    if (pQueue == NULL)
+    {
+        return FALSE;
+    }
+
+    return (pQueue->container != NULL);
+}
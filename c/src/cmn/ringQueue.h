@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2013, 2014 Shanghai Stock Exchange (SSE), Shanghai, China
+ * All Rights Reserved.
+ */
+
+/**
+ * @file    ringQueue.h
+ *
+ * ζжͷļ
+ *
+ * @version $Id
+ * @since   2026/10/18
+ */
+
+/**
+MODIFICATION HISTORY:
+<pre>
+================================================================================
+DD-MMM-YYYY INIT.    SIR    Modification Description
+----------- -------- ------ ----------------------------------------------------
+18-OCT-2026                 
+================================================================================
+</pre>
+*/
+
+#ifndef EPS_RINGQUEUE_H
+#define EPS_RINGQUEUE_H
+
+/**
+ * ͷļ
+ */
+
+#include "common.h"
+#include "epsTypes.h"
+#include "atomic.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**
+ * Ͷ
+ */
+
+/*
+ * ζö
+ */
+typedef enum EpsRingQueueTypeTag
+{
+    EPS_RINGQUEUE_TYPE_SPSC     = 0,    /* ߵ */
+    EPS_RINGQUEUE_TYPE_MPSC     = 1,    /* ߵ */
+} EpsRingQueueTypeT;
+
+/*
+ * ζнṹ
+ *
+ * ̶ǶڶУÿλţ
+ * ŵλƱʾλУλ+1ʾύ
+ * releaseдŷacquireȡź
+ * λλƷִͬУ߼α
+ */
+typedef struct EpsRingQueueTag
+{
+    EpsRingQueueTypeT type;             /*  */
+    uint32      size;                   /* дС(2) */
+    uint32      mask;                   /*  */
+    uint32      itemSize;               /*  */
+    uint32      slotSize;               /* λ(Ȱ8ֽڶ) */
+    char*       container;              /*  */
+    uint32*     sequences;              /* λ */
+
+    uint32      header EPS_CACHELINE_ALIGNED;   /* λ */
+    uint32      tailer EPS_CACHELINE_ALIGNED;   /* λ */
+} EpsRingQueueT;
+
+
+/**
+ * ӿں
+ */
+
+/*
+ * ʼζ
+ */
+ResCodeT InitRingQueue(EpsRingQueueT* pQueue, EpsRingQueueTypeT type, uint32 size, uint32 itemSize);
+
+/*
+ * ʼζ
+ */
+ResCodeT UninitRingQueue(EpsRingQueueT* pQueue);
+
+/*
+ * Ԥζβλ()
+ */
+ResCodeT ReserveRingQueue(EpsRingQueueT* pQueue, void** ppSlot);
+
+/*
+ * ύԤĲλ()
+ */
+void CommitRingQueue(EpsRingQueueT* pQueue, void* pSlot);
+
+/*
+ * ζβ()
+ */
+ResCodeT PushRingQueue(EpsRingQueueT* pQueue, const void* pItem);
+
+/*
+ * 鿴ζͷύ()
+ */
+uint32 PeekRingQueue(EpsRingQueueT* pQueue, uint32 maxCount, void** ppItems);
+
+/*
+ * ͷŻζͷѲ鿴()
+ */
+void ReleaseRingQueue(EpsRingQueueT* pQueue, uint32 count);
+
+/*
+ * ӻζͷȡ()
+ */
+uint32 PopRingQueue(EpsRingQueueT* pQueue, void* pItems, uint32 maxCount);
+
+/*
+ * жϻζǷѾʼ
+ */
+BOOL IsRingQueueInited(EpsRingQueueT* pQueue);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* EPS_RINGQUEUE_H */
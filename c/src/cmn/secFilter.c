@@ -0,0 +1,527 @@
+/*
+ * Copyright (C) 2013, 2014 Shanghai Stock Exchange (SSE), Shanghai, China
+ * All Rights Reserved.
+ */
+
+/**
+ * @file    secFilter.c
+ *
+ * ֤ȯĹʵļ
+ *
+ * @version $Id
+ * @since   2026/10/18
+ */
+
+/**
+MODIFICATION HISTORY:
+<pre>
+================================================================================
+DD-MMM-YYYY INIT.    SIR    Modification Description
+----------- -------- ------ ----------------------------------------------------
+18-OCT-2026                 
+================================================================================
+</pre>
+*/
+
+/**
+ * ͷļ
+ */
+
+#include "common.h"
+#include "epsTypes.h"
+#include "errlib.h"
+#include "errcode.h"
+#include "atomic.h"
+
+#include "secFilter.h"
+
+
+/**
+ * 궨
+ */
+
+#define EPS_SECFILTER_SLOT_MIN_NUM      16      /* ɢбСλ */
+#define EPS_SECFILTER_BLOOM_MIN_BITS    1024    /* ¡Сλ */
+#define EPS_SECFILTER_BLOOM_BITS_PER_ID 16      /* ¡ÿֻ֤ȯռõλ */
+
+
+/**
+ * ڲ
+ */
+
+static ResCodeT AllocSecSet(uint32 count, EpsSecSetT** ppSet);
+static void FreeSecSet(EpsSecSetT* pSet);
+static void AddSecSet(EpsSecSetT* pSet, const char* securityID);
+static uint32 GetBloomIndex2(uint32 hash);
+
+
+/**
+ * ӿںʵ
+ */
+
+/**
+ * ʼ֤ȯĹ
+ *
+ * @param   pFilter         in  - ֤ȯĹ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT InitSecFilter(EpsSecFilterT* pFilter)
+{
+    TRY
+    {
+        pFilter->parser = NULL;
+        pFilter->pSet = NULL;
+        pFilter->pPendingSet = NULL;
+        pFilter->filteredMktData = 0;
+        pFilter->filteredMdEntries = 0;
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ʼ֤ȯĹ
+ *
+ * @param   pFilter         in  - ֤ȯĹֹͨ߳ͣ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT UninitSecFilter(EpsSecFilterT* pFilter)
+{
+    TRY
+    {
+        FreeSecSet(EpsAtomicExchange(&pFilter->pPendingSet, NULL));
+        FreeSecSet(pFilter->pSet);
+        pFilter->pSet = NULL;
+        pFilter->parser = NULL;
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * û̴ͨ߳һʱЧ
+ *
+ * @param   pFilter         in  - ֤ȯĹ
+ * @param   parser          in  - ûNULLʾ
+ */
+void SetSecFilterParser(EpsSecFilterT* pFilter, EpsMdDataParseCallback parser)
+{
+    EpsAtomicStore(&pFilter->parser, parser);
+}
+
+/**
+ * ö֤ȯ(û߳)̴ͨ߳һʱЧ
+ *
+ * @param   pFilter         in  - ֤ȯĹ
+ * @param   securityIDs     in  - ֤ȯ
+ * @param   count           in  - ֤ȯ0ʾȡ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT SetSecFilterSecurities(EpsSecFilterT* pFilter, const char* securityIDs[], uint32 count)
+{
+    EpsSecSetT* pSet = NULL;
+
+    TRY
+    {
+        if (count > EPS_SECFILTER_SECURITY_MAX_NUM)
+        {
+            THROW_ERROR(ERCD_EPS_INVALID_PARM, "count");
+        }
+        if (count > 0 && securityIDs == NULL)
+        {
+            THROW_ERROR(ERCD_EPS_INVALID_PARM, "securityIDs");
+        }
+
+        uint32 i = 0;
+        for (i = 0; i < count; i++)
+        {
+            if (securityIDs[i] == NULL || securityIDs[i][0] == 0x00 ||
+                strlen(securityIDs[i]) > EPS_SECURITYID_MAX_LEN)
+            {
+                THROW_ERROR(ERCD_EPS_INVALID_PARM, "securityID");
+            }
+        }
+
+        THROW_ERROR(AllocSecSet(count, &pSet));
+        for (i = 0; i < count; i++)
+        {
+            AddSecSet(pSet, securityIDs[i]);
+        }
+
+        /* ϴõļδͨ߳ȡʱɱ߳ͷ */
+        FreeSecSet(EpsAtomicExchange(&pFilter->pPendingSet, pSet));
+        pSet = NULL;
+    }
+    CATCH
+    {
+        FreeSecSet(pSet);
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ȡôЧĶ֤ȯ(ͨ߳)
+ *
+ * @param   pFilter         in  - ֤ȯĹ
+ */
+void ApplySecFilter(EpsSecFilterT* pFilter)
+{
+    if (EpsAtomicLoadRelaxed(&pFilter->pPendingSet) == NULL)
+    {
+        return;
+    }
+
+    EpsSecSetT* pSet = EpsAtomicExchange(&pFilter->pPendingSet, NULL);
+    if (pSet == NULL)
+    {
+        return;
+    }
+
+    FreeSecSet(pFilter->pSet);
+    pFilter->pSet = NULL;
+    if (pSet->count > 0)
+    {
+        pFilter->pSet = pSet;
+    }
+    else
+    {
+        FreeSecSet(pSet);
+    }
+}
+
+/**
+ * жǷ֤ȯ(ͨ߳)
+ *
+ * @param   pFilter         in  - ֤ȯĹ
+ *
+ * @return  ö֤ȯTRUE򷵻FALSE
+ */
+BOOL IsSecFilterEnabled(EpsSecFilterT* pFilter)
+{
+    return (pFilter->pSet != NULL);
+}
+
+/**
+ * ж֤ȯǷѶ(ͨ߳)
+ *
+ * @param   pFilter         in  - ֤ȯĹ
+ * @param   securityID      in  - ֤ȯ
+ * @param   hash            in  - ֤ȯɢֵ
+ *
+ * @return  ѶĻδö֤ȯTRUE򷵻FALSE
+ */
+BOOL MatchSecFilter(EpsSecFilterT* pFilter, const char* securityID, uint32 hash)
+{
+    const EpsSecSetT* pSet = pFilter->pSet;
+    if (pSet == NULL)
+    {
+        return TRUE;
+    }
+
+    /* ¡ųδĵ֤ȯ */
+    uint32 bit1 = hash & pSet->bloomMask;
+    uint32 bit2 = GetBloomIndex2(hash) & pSet->bloomMask;
+    if ((pSet->bloom[bit1 >> 6] & ((uint64)1 << (bit1 & 63))) == 0 ||
+        (pSet->bloom[bit2 >> 6] & ((uint64)1 << (bit2 & 63))) == 0)
+    {
+        return FALSE;
+    }
+
+    uint32 index = hash & pSet->slotMask;
+    while (pSet->slots[index][0] != 0x00)
+    {
+        if (strcmp(pSet->slots[index], securityID) == 0)
+        {
+            return TRUE;
+        }
+        index = (index + 1) & pSet->slotMask;
+    }
+    return FALSE;
+}
+
+/**
+ * ˳δ֤ȯĿ(ͨ߳)
+ *
+ * ûֳĿ谴ƫƵһص֤ȯĿǰƣ
+ * ˺mdDataֻ֤ȯĿδö֤ȯδע
+ * ʧʱ鱣ֲ
+ *
+ * @param   pFilter         in  - ֤ȯĹ
+ * @param   hid             in  - ID
+ * @param   pMktData        in  - ѽ
+ *                          out - ˺
+ *
+ * @return  ҪͶݷTRUEûж֤ȯĿʱFALSE
+ */
+BOOL FilterMktData(EpsSecFilterT* pFilter, uint32 hid, EpsMktDataT* pMktData)
+{
+    if (pFilter->pSet == NULL)
+    {
+        return TRUE;
+    }
+
+    uint32 count = ParseMdEntries(pFilter, hid, pMktData, pFilter->mdEntries);
+    if (count == 0)
+    {
+        return TRUE;
+    }
+
+    uint32 kept = 0;
+    uint32 len = 0;
+    uint32 i = 0;
+    for (i = 0; i < count; i++)
+    {
+        const EpsMdEntryT* pMdEntry = &pFilter->mdEntries[i];
+        if (! MatchSecFilter(pFilter, pMdEntry->securityID, HashSecurityID(pMdEntry->securityID)))
+        {
+            continue;
+        }
+
+        if (pMdEntry->offset != len)
+        {
+            memmove(pMktData->mdData + len, pMktData->mdData + pMdEntry->offset, pMdEntry->length);
+        }
+        len += pMdEntry->length;
+        kept++;
+    }
+
+    CountSecFilter(pFilter, count - kept, (kept == 0));
+    if (kept == 0)
+    {
+        return FALSE;
+    }
+
+    if (kept < count)
+    {
+        pMktData->mdCount = kept;
+        pMktData->mdDataLen = len;
+        if (len < EPS_MKTDATA_MAX_LEN)
+        {
+            pMktData->mdData[len] = 0x00;
+        }
+    }
+    return TRUE;
+}
+
+/**
+ * ûĿУĿƫƵһص
+ *
+ * @param   pFilter         in  - ֤ȯĹṩû
+ * @param   hid             in  - ID
+ * @param   pMktData        in  - ѽ
+ * @param   pMdEntries      out - ĿEPS_MDENTRY_MAX_NUM
+ *
+ * @return  ĿδעЧʱ0
+ */
+uint32 ParseMdEntries(EpsSecFilterT* pFilter, uint32 hid, const EpsMktDataT* pMktData, EpsMdEntryT* pMdEntries)
+{
+    EpsMdDataParseCallback parser = EpsAtomicLoad(&pFilter->parser);
+    if (parser == NULL)
+    {
+        return 0;
+    }
+
+    uint32 count = parser(hid, pMktData, pMdEntries, EPS_MDENTRY_MAX_NUM);
+    if (count > EPS_MDENTRY_MAX_NUM)
+    {
+        return 0;
+    }
+
+    uint32 end = 0;
+    uint32 i = 0;
+    for (i = 0; i < count; i++)
+    {
+        EpsMdEntryT* pMdEntry = &pMdEntries[i];
+        if (pMdEntry->offset < end || pMdEntry->offset > pMktData->mdDataLen ||
+            pMdEntry->length > pMktData->mdDataLen - pMdEntry->offset)
+        {
+            return 0;
+        }
+        end = pMdEntry->offset + pMdEntry->length;
+        pMdEntry->securityID[EPS_SECURITYID_MAX_LEN] = 0x00;
+    }
+    return count;
+}
+
+/**
+ * ¼ͨ߳нĹ˽
+ *
+ * @param   pFilter         in  - ֤ȯĹ
+ * @param   filteredEntries in  - ˳Ŀ
+ * @param   isDropped       in  - Ƿ񱻶
+ */
+void CountSecFilter(EpsSecFilterT* pFilter, uint32 filteredEntries, BOOL isDropped)
+{
+    if (filteredEntries > 0)
+    {
+        EpsAtomicCounterAdd(&pFilter->filteredMdEntries, filteredEntries);
+    }
+    if (isDropped)
+    {
+        EpsAtomicCounterAdd(&pFilter->filteredMktData, 1);
+    }
+}
+
+/**
+ * ȡͳϢ
+ *
+ * @param   pFilter         in  - ֤ȯĹ
+ * @param   pStat           out - ͳϢ
+ */
+void GetSecFilterStatistics(EpsSecFilterT* pFilter, EpsStatisticsT* pStat)
+{
+    pStat->filteredMktData   = EpsAtomicLoadRelaxed(&pFilter->filteredMktData);
+    pStat->filteredMdEntries = EpsAtomicLoadRelaxed(&pFilter->filteredMdEntries);
+}
+
+/**
+ * ֤ȯɢֵ(FNV-1a)
+ *
+ * @param   securityID      in  - ֤ȯ
+ *
+ * @return  ɢֵ
+ */
+uint32 HashSecurityID(const char* securityID)
+{
+    uint32 hash = 2166136261U;
+    const unsigned char* p = (const unsigned char*)securityID;
+
+    while (*p != 0x00)
+    {
+        hash ^= *p++;
+        hash *= 16777619U;
+    }
+    return hash;
+}
+
+
+/**
+ * ڲʵ
+ */
+
+/**
+ * 䶩֤ȯ
+ *
+ * @param   count           in  - ֤ȯ
+ * @param   ppSet           out - 
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+static ResCodeT AllocSecSet(uint32 count, EpsSecSetT** ppSet)
+{
+    EpsSecSetT* pSet = NULL;
+
+    TRY
+    {
+        uint32 slotNum = EPS_SECFILTER_SLOT_MIN_NUM;
+        while (slotNum < count * 2)
+        {
+            slotNum <<= 1;
+        }
+
+        uint32 bloomBits = EPS_SECFILTER_BLOOM_MIN_BITS;
+        while (bloomBits < count * EPS_SECFILTER_BLOOM_BITS_PER_ID)
+        {
+            bloomBits <<= 1;
+        }
+
+        pSet = (EpsSecSetT*)calloc(1, sizeof(EpsSecSetT));
+        if (pSet == NULL)
+        {
+            int lstErrno = SYS_ERRNO;
+            THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, EpsGetSystemError(lstErrno));
+        }
+
+        pSet->slotMask = slotNum - 1;
+        pSet->bloomMask = bloomBits - 1;
+        pSet->bloom = (uint64*)calloc(bloomBits / 64, sizeof(uint64));
+        pSet->slots = calloc(slotNum, EPS_SECURITYID_MAX_LEN+1);
+        if (pSet->bloom == NULL || pSet->slots == NULL)
+        {
+            int lstErrno = SYS_ERRNO;
+            THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, EpsGetSystemError(lstErrno));
+        }
+
+        *ppSet = pSet;
+        pSet = NULL;
+    }
+    CATCH
+    {
+        FreeSecSet(pSet);
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ͷŶ֤ȯ
+ *
+ * @param   pSet            in  - ϣΪNULL
+ */
+static void FreeSecSet(EpsSecSetT* pSet)
+{
+    if (pSet != NULL)
+    {
+        free(pSet->bloom);
+        free(pSet->slots);
+        free(pSet);
+    }
+}
+
+/**
+ * 򼯺м֤ȯѴʱ
+ *
+ * @param   pSet            in  - ϣ㹻
+ * @param   securityID      in  - ֤ȯ
+ */
+static void AddSecSet(EpsSecSetT* pSet, const char* securityID)
+{
+    uint32 hash = HashSecurityID(securityID);
+
+    uint32 index = hash & pSet->slotMask;
+    while (pSet->slots[index][0] != 0x00)
+    {
+        if (strcmp(pSet->slots[index], securityID) == 0)
+        {
+            return;
+        }
+        index = (index + 1) & pSet->slotMask;
+    }
+    strcpy(pSet->slots[index], securityID);
+    pSet->count++;
+
+    uint32 bit1 = hash & pSet->bloomMask;
+    uint32 bit2 = GetBloomIndex2(hash) & pSet->bloomMask;
+    pSet->bloom[bit1 >> 6] |= (uint64)1 << (bit1 & 63);
+    pSet->bloom[bit2 >> 6] |= (uint64)1 << (bit2 & 63);
+}
+
+/**
+ * ֤ȯɢֵ¡ĵڶλ
+ *
+ * @param   hash            in  - ֤ȯɢֵ
+ *
+ * @return  ڶλ(δȡ)
+ */
+static uint32 GetBloomIndex2(uint32 hash)
+{
+    return (hash >> 16) ^ (hash * 0x9E3779B1U);
+}
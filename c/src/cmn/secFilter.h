@@ -0,0 +1,156 @@
+/*
+ * Copyright (C) 2013, 2014 Shanghai Stock Exchange (SSE), Shanghai, China
+ * All Rights Reserved.
+ */
+
+/**
+ * @file    secFilter.h
+ *
+ * ֤ȯĹ˶ͷļ
+ *
+ * @version $Id
+ * @since   2026/10/18
+ */
+
+/**
+MODIFICATION HISTORY:
+<pre>
+================================================================================
+DD-MMM-YYYY INIT.    SIR    Modification Description
+----------- -------- ------ ----------------------------------------------------
+18-OCT-2026                 
+================================================================================
+</pre>
+*/
+
+#ifndef EPS_SECFILTER_H
+#define EPS_SECFILTER_H
+
+/**
+ * ͷļ
+ */
+
+#include "common.h"
+#include "epsTypes.h"
+#include "epsData.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**
+ * 궨
+ */
+
+#define EPS_SECFILTER_SECURITY_MAX_NUM  65536   /* ֤ȯ */
+
+
+/**
+ * Ͷ
+ */
+
+/*
+ * ֤ȯ
+ *
+ * ֻ¡ڿųδĵ֤ȯ
+ * кڿѰַɢббȽ֤ȯ
+ */
+typedef struct EpsSecSetTag
+{
+    uint32          count;                  /* ֤ȯ0ʾ */
+    uint32          slotMask;               /* ɢб */
+    uint32          bloomMask;              /* ¡λ */
+    uint64*         bloom;                  /* ¡λͼ */
+    char          (*slots)[EPS_SECURITYID_MAX_LEN+1];   /* ɢбմʾ */
+} EpsSecSetT;
+
+/*
+ * ֤ȯĹ
+ *
+ * û߳̽¼ϺpPendingSeṭͨ߳ͨ߳ԭӽȡòͷžɼϣ
+ * ͨ߳нʱ
+ */
+typedef struct EpsSecFilterTag
+{
+    EpsMdDataParseCallback parser;          /* û */
+    EpsSecSetT*     pSet;                   /* ǰЧļϣ̷ͨ߳ */
+    EpsSecSetT*     pPendingSet;            /* Чļϣԭӽȡ */
+
+    EpsMdEntryT     mdEntries[EPS_MDENTRY_MAX_NUM]; /* ͨ߳̽Ŀ */
+
+    uint64          filteredMktData;        /* ޶֤ȯ */
+    uint64          filteredMdEntries;      /* ˳Ŀ */
+} EpsSecFilterT;
+
+
+/**
+ * 
+ */
+
+/*
+ * ʼ֤ȯĹ
+ */
+ResCodeT InitSecFilter(EpsSecFilterT* pFilter);
+
+/*
+ * ʼ֤ȯĹ
+ */
+ResCodeT UninitSecFilter(EpsSecFilterT* pFilter);
+
+/*
+ * û
+ */
+void SetSecFilterParser(EpsSecFilterT* pFilter, EpsMdDataParseCallback parser);
+
+/*
+ * ö֤ȯ
+ */
+ResCodeT SetSecFilterSecurities(EpsSecFilterT* pFilter, const char* securityIDs[], uint32 count);
+
+/*
+ * ȡôЧĶ֤ȯ
+ */
+void ApplySecFilter(EpsSecFilterT* pFilter);
+
+/*
+ * жǷ֤ȯ
+ */
+BOOL IsSecFilterEnabled(EpsSecFilterT* pFilter);
+
+/*
+ * ж֤ȯǷѶ
+ */
+BOOL MatchSecFilter(EpsSecFilterT* pFilter, const char* securityID, uint32 hash);
+
+/*
+ * ˳δ֤ȯĿ
+ */
+BOOL FilterMktData(EpsSecFilterT* pFilter, uint32 hid, EpsMktDataT* pMktData);
+
+/*
+ * УĿ
+ */
+uint32 ParseMdEntries(EpsSecFilterT* pFilter, uint32 hid, const EpsMktDataT* pMktData, EpsMdEntryT* pMdEntries);
+
+/*
+ * ¼ͨ߳нĹ˽
+ */
+void CountSecFilter(EpsSecFilterT* pFilter, uint32 filteredEntries, BOOL isDropped);
+
+/*
+ * ȡͳϢ
+ */
+void GetSecFilterStatistics(EpsSecFilterT* pFilter, EpsStatisticsT* pStat);
+
+/*
+ * ֤ȯɢֵ
+ */
+uint32 HashSecurityID(const char* securityID);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* EPS_SECFILTER_H */
@@ -0,0 +1,959 @@
+/*
+ * Copyright (C) 2013, 2014 Shanghai Stock Exchange (SSE), Shanghai, China
+ * All Rights Reserved.
+ */
+
+/**
+ * @file    subscriber.c
+ *
+ * ڶඩַʵļ
+ *
+ * @version $Id
+ * @since   2026/10/18
+ */
+
+/**
+MODIFICATION HISTORY:
+<pre>
+================================================================================
+DD-MMM-YYYY INIT.    SIR    Modification Description
+----------- -------- ------ ----------------------------------------------------
+18-OCT-2026                 
+================================================================================
+</pre>
+*/
+
+/**
+ * ͷļ
+ */
+
+#include <stddef.h>
+
+#include "common.h"
+#include "epsTypes.h"
+#include "errlib.h"
+#include "errcode.h"
+#include "atomic.h"
+#include "mktDatabase.h"
+
+#include "subscriber.h"
+
+
+/**
+ * 궨
+ */
+
+#define EPS_SUBSCRIBER_IDLE_SPIN_COUNT  1024    /* ߳̿ʱǰ */
+#define EPS_SUBSCRIBER_IDLE_INTL        100     /* ߳̿ʱ䣬λ: ΢ */
+#define EPS_SUBSCRIBER_DRAIN_MAX        64      /* ߳ÿͶݵ */
+
+
+/**
+ * ڲ
+ */
+
+static void* SubscriberTask(void* arg);
+static uint32 DrainSubscriber(EpsSubscriberT* pSub, uint32 maxCount);
+static uint32 MatchSubItem(EpsSubscriberT* pSub, const EpsSubBufferT* pBuffer, const uint32* hashes,
+        uint64* mdEntryMask);
+static void CopySubItem(EpsMktDataT* pDst, const EpsSubItemT* pItem);
+static ResCodeT FindSubscriber(EpsSubscriberHubT* pHub, uint32 sid, EpsSubscriberT** ppSub);
+static ResCodeT StartupSubscriber(EpsSubscriberT* pSub);
+static ResCodeT JoinSubscriber(EpsSubscriberT* pSub);
+static BOOL IsSubscriberThread(EpsSubscriberT* pSub);
+static void RetireSubscriber(EpsSubscriberHubT* pHub, EpsSubscriberT* pSub);
+static ResCodeT AllocSubBuffer(EpsSubscriberHubT* pHub, EpsSubBufferT** ppBuffer);
+static void FreeSubBuffer(EpsSubscriberHubT* pHub, EpsSubBufferT* pBuffer);
+static void ReleaseSubBuffer(EpsSubscriberHubT* pHub, EpsSubBufferT* pBuffer);
+static void FreeSubBufferList(EpsSubBufferT* pList);
+
+
+/**
+ * ӿںʵ
+ */
+
+/**
+ * ʼ߼
+ *
+ * @param   pHub                in  - ߼
+ * @param   hid                 in  - IDصʱû
+ * @param   pFilter             in  - ֤ȯĹ̰ͨ߳Ŀ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT InitSubscriberHub(EpsSubscriberHubT* pHub, uint32 hid, EpsSecFilterT* pFilter)
+{
+    TRY
+    {
+        pHub->hid = hid;
+        pHub->pFilter = pFilter;
+        pHub->subscribers = NULL;
+        pHub->activeCount = 0;
+        pHub->publishSeq = 0;
+        pHub->pFreeList = NULL;
+        pHub->pReturnedList = NULL;
+
+        InitRecMutex(&pHub->lock);
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ʼ߼ϣɾж߲ͷŻ
+ *
+ * @param   pHub                in  - ߼ϣֹͨ߳ͣ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT UninitSubscriberHub(EpsSubscriberHubT* pHub)
+{
+    TRY
+    {
+        LockRecMutex(&pHub->lock);
+
+        if (pHub->subscribers != NULL)
+        {
+            uint32 i = 0;
+            for (i = 0; i < EPS_SUBSCRIBER_MAX_NUM; i++)
+            {
+                if (pHub->subscribers[i].status == EPS_SUBSCRIBER_ACTIVE)
+                {
+                    RetireSubscriber(pHub, &pHub->subscribers[i]);
+                }
+            }
+
+            free(pHub->subscribers);
+            pHub->subscribers = NULL;
+        }
+
+        FreeSubBufferList(pHub->pFreeList);
+        FreeSubBufferList(EpsAtomicExchange(&pHub->pReturnedList, NULL));
+        pHub->pFreeList = NULL;
+
+        UnlockRecMutex(&pHub->lock);
+        UninitRecMutex(&pHub->lock);
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * Ӷ(û߳)ѯʽʱ߳
+ *
+ * @param   pHub                in  - ߼
+ * @param   pConfig             in  - 
+ * @param   pSid                out - ID
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT AddSubscriber(EpsSubscriberHubT* pHub, const EpsSubscriberConfigT* pConfig, uint32* pSid)
+{
+    EpsSubscriberT* pSub = NULL;
+
+    TRY
+    {
+        LockRecMutex(&pHub->lock);
+
+        if (pConfig->mktDataArrivedNotify == NULL)
+        {
+            THROW_ERROR(ERCD_EPS_INVALID_PARM, "mktDataArrivedNotify");
+        }
+
+        if (pConfig->mktType != EPS_MKTTYPE_ALL &&
+            pConfig->mktType != EPS_MKTTYPE_STK &&
+            pConfig->mktType != EPS_MKTTYPE_DEV)
+        {
+            THROW_ERROR(ERCD_EPS_INVALID_MKTTYPE);
+        }
+
+        if (pConfig->queueSize > EPS_SUBSCRIBER_QUEUE_SIZE_MAX)
+        {
+            THROW_ERROR(ERCD_EPS_INVALID_PARM, "queueSize");
+        }
+
+        if (pConfig->pollMode != 0 && pConfig->pollMode != 1)
+        {
+            THROW_ERROR(ERCD_EPS_INVALID_PARM, "pollMode");
+        }
+
+        if (pHub->subscribers == NULL)
+        {
+            EpsSubscriberT* subscribers = (EpsSubscriberT*)calloc(EPS_SUBSCRIBER_MAX_NUM, sizeof(EpsSubscriberT));
+            if (subscribers == NULL)
+            {
+                int lstErrno = SYS_ERRNO;
+                THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, EpsGetSystemError(lstErrno));
+            }
+
+            uint32 i = 0;
+            for (i = 0; i < EPS_SUBSCRIBER_MAX_NUM; i++)
+            {
+                subscribers[i].pHub = pHub;
+            }
+            EpsAtomicStore(&pHub->subscribers, subscribers);
+        }
+
+        uint32 index = 0;
+        for (index = 0; index < EPS_SUBSCRIBER_MAX_NUM; index++)
+        {
+            if (pHub->subscribers[index].status == EPS_SUBSCRIBER_FREE)
+            {
+                break;
+            }
+        }
+
+        if (index >= EPS_SUBSCRIBER_MAX_NUM)
+        {
+            THROW_ERROR(ERCD_EPS_SUBSCRIBER_COUNT_BEYOND_LIMIT, EPS_SUBSCRIBER_MAX_NUM);
+        }
+
+        uint32 size = 1;
+        uint32 queueSize = (pConfig->queueSize == 0) ? EPS_SUBSCRIBER_QUEUE_SIZE_DEFAULT : pConfig->queueSize;
+        while (size < queueSize)
+        {
+            size <<= 1;
+        }
+
+        pSub = &pHub->subscribers[index];
+        THROW_ERROR(InitSecFilter(&pSub->filter));
+        if (pConfig->securityCount > 0)
+        {
+            THROW_ERROR(SetSecFilterSecurities(&pSub->filter, pConfig->securityIDs, pConfig->securityCount));
+        }
+
+        pSub->items = (EpsSubItemT*)calloc(size, sizeof(EpsSubItemT));
+        if (pSub->items == NULL)
+        {
+            int lstErrno = SYS_ERRNO;
+            THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, EpsGetSystemError(lstErrno));
+        }
+
+        pSub->sid = ((pSub->generation++) << EPS_SUBSCRIBER_INDEX_BITS) | (index + 1);
+        pSub->mktType = pConfig->mktType;
+        pSub->pollMode = pConfig->pollMode;
+        pSub->mktDataArrivedNotify = pConfig->mktDataArrivedNotify;
+        pSub->mask = size - 1;
+        pSub->droppedCount = 0;
+        pSub->maxDepth = 0;
+        pSub->deliveredCount = 0;
+        pSub->header = 0;
+        pSub->tailer = 0;
+
+        if (pSub->pollMode == 0)
+        {
+            THROW_ERROR(StartupSubscriber(pSub));
+        }
+
+        /* мٷͨ߳ */
+        EpsAtomicStore(&pSub->status, EPS_SUBSCRIBER_ACTIVE);
+        EpsAtomicStore(&pHub->activeCount, pHub->activeCount + 1);
+
+        *pSid = pSub->sid;
+    }
+    CATCH
+    {
+        if (pSub != NULL)
+        {
+            free(pSub->items);
+            pSub->items = NULL;
+            UninitSecFilter(&pSub->filter);
+            pSub->sid = 0;
+        }
+    }
+    FINALLY
+    {
+        UnlockRecMutex(&pHub->lock);
+
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ɾ(û߳)δͶݵ
+ *
+ * @param   pHub                in  - ߼
+ * @param   sid                 in  - ID
+ *
+ * @return  ɹNO_ERR򷵻ش
+ *
+ * memo: ڸöĻصеãѯʽĶֹͣEpsPollSubscriber
+ */
+ResCodeT RemoveSubscriber(EpsSubscriberHubT* pHub, uint32 sid)
+{
+    TRY
+    {
+        LockRecMutex(&pHub->lock);
+
+        EpsSubscriberT* pSub = NULL;
+        THROW_ERROR(FindSubscriber(pHub, sid, &pSub));
+
+        if (IsSubscriberThread(pSub))
+        {
+            THROW_ERROR(ERCD_EPS_INVALID_OPERATION, "remove subscriber in its own callback");
+        }
+
+        RetireSubscriber(pHub, pSub);
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        UnlockRecMutex(&pHub->lock);
+
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * Ӧ߳Ͷݶ߶е飬ȴ
+ *
+ * @param   pHub                in  - ߼
+ * @param   sid                 in  - IDΪѯʽ
+ * @param   maxCount            in  - Ͷݵ01
+ * @param   pCount              out - Ͷݵ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT PollSubscriber(EpsSubscriberHubT* pHub, uint32 sid, uint32 maxCount, uint32* pCount)
+{
+    TRY
+    {
+        EpsSubscriberT* pSub = NULL;
+        THROW_ERROR(FindSubscriber(pHub, sid, &pSub));
+
+        if (pSub->pollMode == 0)
+        {
+            THROW_ERROR(ERCD_EPS_INVALID_OPERATION, "poll mode not enabled");
+        }
+
+        *pCount = DrainSubscriber(pSub, (maxCount == 0) ? 1 : maxCount);
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ȡͳϢ
+ *
+ * @param   pHub                in  - ߼
+ * @param   sid                 in  - ID
+ * @param   pStat               out - ͳϢ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT GetSubscriberStatistics(EpsSubscriberHubT* pHub, uint32 sid, EpsSubscriberStatT* pStat)
+{
+    TRY
+    {
+        EpsSubscriberT* pSub = NULL;
+        THROW_ERROR(FindSubscriber(pHub, sid, &pSub));
+
+        pStat->deliveredCount    = EpsAtomicLoadRelaxed(&pSub->deliveredCount);
+        pStat->droppedCount      = EpsAtomicLoadRelaxed(&pSub->droppedCount);
+        pStat->filteredMktData   = EpsAtomicLoadRelaxed(&pSub->filter.filteredMktData);
+        pStat->filteredMdEntries = EpsAtomicLoadRelaxed(&pSub->filter.filteredMdEntries);
+        pStat->maxDepth          = EpsAtomicLoadRelaxed(&pSub->maxDepth);
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ߶(ͨ߳)
+ *
+ * ֻһΣж֤߰ȯʱŵýֻһΣ
+ * ߶λͼ¼䶩֤ȯĿɶ߳ͶʱƳĵĿ
+ *
+ * @param   pHub                in  - ߼
+ * @param   pMsg                in  - STEPʽ
+ * @param   recvTime            in  - ʱ()
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT PublishSubscribers(EpsSubscriberHubT* pHub, const StepMessageT* pMsg, uint64 recvTime)
+{
+    EpsSubBufferT* pBuffer = NULL;
+
+    TRY
+    {
+        THROW_ERROR(AllocSubBuffer(pHub, &pBuffer));
+
+        EpsMktDataT* pMktData = &pBuffer->mktData;
+        THROW_ERROR(ConvertMktData(pMsg, pMktData));
+        pMktData->recvTime = recvTime;
+        pMktData->notifyTime = EpsGetTimestamp();
+        pBuffer->mdEntryCount = 0;
+
+        EpsSubscriberT* subscribers = EpsAtomicLoad(&pHub->subscribers);
+        EpsSubscriberT* targets[EPS_SUBSCRIBER_MAX_NUM];
+        uint32 targetCount = 0;
+        uint32 hashes[EPS_MDENTRY_MAX_NUM];
+        BOOL isParsed = FALSE;
+
+        /* ȱٶȡ״̬ɾߵ߳ */
+        uint32 publishSeq = pHub->publishSeq;
+        EpsAtomicStore(&pHub->publishSeq, publishSeq + 1);
+        EpsAtomicFence();
+
+        uint32 i = 0;
+        for (i = 0; subscribers != NULL && i < EPS_SUBSCRIBER_MAX_NUM; i++)
+        {
+            EpsSubscriberT* pSub = &subscribers[i];
+            if (EpsAtomicLoad(&pSub->status) != EPS_SUBSCRIBER_ACTIVE)
+            {
+                continue;
+            }
+
+            if (pSub->mktType != EPS_MKTTYPE_ALL && pSub->mktType != pMktData->mktType)
+            {
+                continue;
+            }
+
+            uint32 keptCount = 0;
+            uint64 mdEntryMask[EPS_SUBSCRIBER_MDENTRY_MASK_NUM];
+
+            ApplySecFilter(&pSub->filter);
+            if (IsSecFilterEnabled(&pSub->filter))
+            {
+                if (! isParsed)
+                {
+                    pBuffer->mdEntryCount = ParseMdEntries(pHub->pFilter, pHub->hid, pMktData, pBuffer->mdEntries);
+
+                    uint32 j = 0;
+                    for (j = 0; j < pBuffer->mdEntryCount; j++)
+                    {
+                        hashes[j] = HashSecurityID(pBuffer->mdEntries[j].securityID);
+                    }
+                    isParsed = TRUE;
+                }
+
+                /* δעЧʱͶ */
+                if (pBuffer->mdEntryCount > 0)
+                {
+                    keptCount = MatchSubItem(pSub, pBuffer, hashes, mdEntryMask);
+                    CountSecFilter(&pSub->filter, pBuffer->mdEntryCount - keptCount, (keptCount == 0));
+                    if (keptCount == 0)
+                    {
+                        continue;
+                    }
+                }
+            }
+
+            uint64 header = pSub->header;
+            uint32 depth = (uint32)(header - EpsAtomicLoad(&pSub->tailer));
+            if (depth > pSub->mask)
+            {
+                EpsAtomicCounterAdd(&pSub->droppedCount, 1);
+                continue;
+            }
+            if (depth + 1 > pSub->maxDepth)
+            {
+                EpsAtomicStoreRelaxed(&pSub->maxDepth, depth + 1);
+            }
+
+            EpsSubItemT* pItem = &pSub->items[header & pSub->mask];
+            pItem->pBuffer = pBuffer;
+            pItem->keptCount = keptCount;
+            if (keptCount > 0)
+            {
+                memcpy(pItem->mdEntryMask, mdEntryMask, sizeof(mdEntryMask));
+            }
+            targets[targetCount++] = pSub;
+        }
+
+        /* üλƷ */
+        pBuffer->refCount = targetCount;
+        for (i = 0; i < targetCount; i++)
+        {
+            EpsAtomicStore(&targets[i]->header, targets[i]->header + 1);
+        }
+
+        EpsAtomicStore(&pHub->publishSeq, publishSeq + 2);
+
+        if (targetCount == 0)
+        {
+            FreeSubBuffer(pHub, pBuffer);
+        }
+        pBuffer = NULL;
+    }
+    CATCH
+    {
+        if (pBuffer != NULL)
+        {
+            FreeSubBuffer(pHub, pBuffer);
+        }
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * жǷж
+ *
+ * @param   pHub                in  - ߼
+ *
+ * @return  нĶ߷TRUE򷵻FALSE
+ */
+BOOL IsSubscriberHubEnabled(EpsSubscriberHubT* pHub)
+{
+    return (EpsAtomicLoadRelaxed(&pHub->activeCount) > 0);
+}
+
+
+/**
+ * ڲʵ
+ */
+
+/**
+ * ̺߳
+ *
+ * @param   arg                 in  - ̲߳()
+ */
+static void* SubscriberTask(void* arg)
+{
+    EpsSubscriberT* pSub = (EpsSubscriberT*)arg;
+    uint32 spinCount = 0;
+
+    while (! EpsAtomicLoad(&pSub->canStop))
+    {
+        if (DrainSubscriber(pSub, EPS_SUBSCRIBER_DRAIN_MAX) > 0)
+        {
+            spinCount = 0;
+            continue;
+        }
+
+        if (spinCount < EPS_SUBSCRIBER_IDLE_SPIN_COUNT)
+        {
+            EpsSpinWait(&spinCount);
+        }
+        else
+        {
+#if defined(__WINDOWS__)
+            Sleep(1);
+#endif
+
+#if defined(__LINUX__) || defined(__HPUX__)
+            usleep(EPS_SUBSCRIBER_IDLE_INTL);
+#endif
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * Ӷ߶ȡ鲢Ͷ()
+ *
+ * @param   pSub                in  - 
+ * @param   maxCount            in  - Ͷݵ
+ *
+ * @return  Ͷݵ
+ */
+static uint32 DrainSubscriber(EpsSubscriberT* pSub, uint32 maxCount)
+{
+    EpsSubscriberHubT* pHub = pSub->pHub;
+    uint32 count = 0;
+    uint64 tailer = pSub->tailer;
+    uint64 header = EpsAtomicLoad(&pSub->header);
+
+    while (count < maxCount && tailer < header)
+    {
+        const EpsSubItemT* pItem = &pSub->items[tailer & pSub->mask];
+        EpsSubBufferT* pBuffer = pItem->pBuffer;
+
+        const EpsMktDataT* pMktData = &pBuffer->mktData;
+        if (pItem->keptCount > 0 && pItem->keptCount < pBuffer->mdEntryCount)
+        {
+            CopySubItem(&pSub->mktData, pItem);
+            pMktData = &pSub->mktData;
+        }
+        pSub->mktDataArrivedNotify(pHub->hid, pSub->sid, pMktData);
+
+        tailer++;
+        EpsAtomicStore(&pSub->tailer, tailer);
+        ReleaseSubBuffer(pHub, pBuffer);
+        count++;
+    }
+
+    if (count > 0)
+    {
+        EpsAtomicCounterAdd(&pSub->deliveredCount, count);
+    }
+    return count;
+}
+
+/**
+ * ߵ֤ȯϱǶ֤ȯĿ(ͨ߳)
+ *
+ * @param   pSub                in  - 
+ * @param   pBuffer             in  - ѽĹ黺
+ * @param   hashes              in  - Ŀ֤ȯɢֵ
+ * @param   mdEntryMask         out - ֤ȯĿλͼ
+ *
+ * @return  ֤ȯĿ
+ */
+static uint32 MatchSubItem(EpsSubscriberT* pSub, const EpsSubBufferT* pBuffer, const uint32* hashes,
+        uint64* mdEntryMask)
+{
+    uint32 keptCount = 0;
+
+    memset(mdEntryMask, 0x00, sizeof(uint64) * EPS_SUBSCRIBER_MDENTRY_MASK_NUM);
+
+    uint32 i = 0;
+    for (i = 0; i < pBuffer->mdEntryCount; i++)
+    {
+        if (MatchSecFilter(&pSub->filter, pBuffer->mdEntries[i].securityID, hashes[i]))
+        {
+            mdEntryMask[i >> 6] |= (uint64)1 << (i & 63);
+            keptCount++;
+        }
+    }
+    return keptCount;
+}
+
+/**
+ * ƶж֤ȯĿ()
+ *
+ * @param   pDst                out - ֻ֤ȯĿ
+ * @param   pItem               in  - 
+ */
+static void CopySubItem(EpsMktDataT* pDst, const EpsSubItemT* pItem)
+{
+    const EpsSubBufferT* pBuffer = pItem->pBuffer;
+    const EpsMktDataT* pSrc = &pBuffer->mktData;
+
+    memcpy(pDst, pSrc, offsetof(EpsMktDataT, mdData));
+
+    uint32 len = 0;
+    uint32 i = 0;
+    for (i = 0; i < pBuffer->mdEntryCount; i++)
+    {
+        if ((pItem->mdEntryMask[i >> 6] & ((uint64)1 << (i & 63))) != 0)
+        {
+            const EpsMdEntryT* pMdEntry = &pBuffer->mdEntries[i];
+            memcpy(pDst->mdData + len, pSrc->mdData + pMdEntry->offset, pMdEntry->length);
+            len += pMdEntry->length;
+        }
+    }
+    if (len < EPS_MKTDATA_MAX_LEN)
+    {
+        pDst->mdData[len] = 0x00;
+    }
+
+    pDst->mdCount = pItem->keptCount;
+    pDst->mdDataLen = len;
+    pDst->recvTime = pSrc->recvTime;
+    pDst->notifyTime = pSrc->notifyTime;
+}
+
+/**
+ * ѯĶߣIDеĲλֱӶλ
+ *
+ * @param   pHub                in  - ߼
+ * @param   sid                 in  - ID
+ * @param   ppSub               out - 
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+static ResCodeT FindSubscriber(EpsSubscriberHubT* pHub, uint32 sid, EpsSubscriberT** ppSub)
+{
+    TRY
+    {
+        uint32 index = sid & EPS_SUBSCRIBER_INDEX_MASK;
+        EpsSubscriberT* subscribers = EpsAtomicLoad(&pHub->subscribers);
+        if (subscribers == NULL || index == 0 || index > EPS_SUBSCRIBER_MAX_NUM)
+        {
+            THROW_ERROR(ERCD_EPS_INVALID_PARM, "sid");
+        }
+
+        EpsSubscriberT* pSub = &subscribers[index - 1];
+        if (EpsAtomicLoad(&pSub->status) != EPS_SUBSCRIBER_ACTIVE || pSub->sid != sid)
+        {
+            THROW_ERROR(ERCD_EPS_INVALID_PARM, "sid");
+        }
+
+        *ppSub = pSub;
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ߳
+ *
+ * @param   pSub                in  - 
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+static ResCodeT StartupSubscriber(EpsSubscriberT* pSub)
+{
+    TRY
+    {
+        EpsAtomicStore(&pSub->canStop, FALSE);
+
+#if defined(__WINDOWS__)
+        DWORD tid = 0;
+        HANDLE thread = CreateThread(NULL, 0, (LPTHREAD_START_ROUTINE)SubscriberTask,
+            (LPVOID)pSub, 0, (LPDWORD)&tid);
+        if (tid == 0)
+        {
+            int lstErrno = SYS_ERRNO;
+            THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, EpsGetSystemError(lstErrno));
+        }
+        pSub->thread = thread;
+        pSub->tid = tid;
+#endif
+
+#if defined(__LINUX__) || defined(__HPUX__)
+        pthread_t tid;
+        int result = pthread_create(&tid, NULL, SubscriberTask, (void*)pSub);
+        if (result != 0)
+        {
+            THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, EpsGetSystemError(result));
+        }
+        pSub->tid = tid;
+#endif
+    }
+    CATCH
+    {
+        EpsAtomicStore(&pSub->canStop, TRUE);
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ֹ֪ͨ߳ͣȴ
+ *
+ * @param   pSub                in  - 
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+static ResCodeT JoinSubscriber(EpsSubscriberT* pSub)
+{
+    TRY
+    {
+        EpsAtomicStore(&pSub->canStop, TRUE);
+
+#if defined(__WINDOWS__)
+        if (pSub->tid != 0)
+        {
+            int result = WaitForSingleObject(pSub->thread, INFINITE);
+            if (result != WAIT_OBJECT_0)
+            {
+                int lstErrno = SYS_ERRNO;
+                THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, EpsGetSystemError(lstErrno));
+            }
+
+            pSub->thread = NULL;
+            pSub->tid = 0;
+        }
+#endif
+
+#if defined(__LINUX__) || defined(__HPUX__)
+        if (pSub->tid != 0)
+        {
+            int result = pthread_join(pSub->tid, NULL);
+            if (result != 0)
+            {
+                THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, EpsGetSystemError(result));
+            }
+
+            pSub->tid = 0;
+        }
+#endif
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * жϵǰ߳ǷΪ߳
+ *
+ * @param   pSub                in  - 
+ *
+ * @return  ǷTRUE򷵻FALSE
+ */
+static BOOL IsSubscriberThread(EpsSubscriberT* pSub)
+{
+#if defined(__WINDOWS__)
+    return (pSub->tid != 0 && pSub->tid == GetCurrentThreadId());
+#endif
+
+#if defined(__LINUX__) || defined(__HPUX__)
+    return (pSub->tid != 0 && pSub->tid == pthread_self());
+#endif
+}
+
+/**
+ * ֹ߽ͣ鲢ͷԴж߼ͬ
+ *
+ * @param   pHub                in  - ߼
+ * @param   pSub                in  - Ķ
+ */
+static void RetireSubscriber(EpsSubscriberHubT* pHub, EpsSubscriberT* pSub)
+{
+    /* ȱɾٶȡ: ͨ߳Ѷ״̬˴ܿӣ
+       ӽ󲻻ö߶ */
+    EpsAtomicStore(&pSub->status, EPS_SUBSCRIBER_CLOSING);
+    EpsAtomicFence();
+
+    uint32 publishSeq = EpsAtomicLoad(&pHub->publishSeq);
+    if ((publishSeq & 0x01) != 0)
+    {
+        uint32 spinCount = 0;
+        while (EpsAtomicLoad(&pHub->publishSeq) == publishSeq)
+        {
+            EpsSpinWait(&spinCount);
+        }
+    }
+    EpsAtomicStore(&pHub->activeCount, pHub->activeCount - 1);
+
+    JoinSubscriber(pSub);
+
+    /* 黹δͶõĻ */
+    uint64 tailer = pSub->tailer;
+    uint64 header = EpsAtomicLoad(&pSub->header);
+    for (; tailer < header; tailer++)
+    {
+        ReleaseSubBuffer(pHub, pSub->items[tailer & pSub->mask].pBuffer);
+    }
+
+    free(pSub->items);
+    pSub->items = NULL;
+    UninitSecFilter(&pSub->filter);
+    pSub->sid = 0;
+
+    EpsAtomicStore(&pSub->status, EPS_SUBSCRIBER_FREE);
+}
+
+/**
+ * 乲黺(ͨ߳)Ϊʱȡض߹黹Ļ
+ *
+ * 涩߶лѹ֮ͼͶݵ
+ *
+ * @param   pHub                in  - ߼
+ * @param   ppBuffer            out - 
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+static ResCodeT AllocSubBuffer(EpsSubscriberHubT* pHub, EpsSubBufferT** ppBuffer)
+{
+    TRY
+    {
+        if (pHub->pFreeList == NULL)
+        {
+            pHub->pFreeList = EpsAtomicExchange(&pHub->pReturnedList, NULL);
+        }
+
+        EpsSubBufferT* pBuffer = pHub->pFreeList;
+        if (pBuffer != NULL)
+        {
+            pHub->pFreeList = pBuffer->pNext;
+        }
+        else
+        {
+            pBuffer = (EpsSubBufferT*)malloc(sizeof(EpsSubBufferT));
+            if (pBuffer == NULL)
+            {
+                int lstErrno = SYS_ERRNO;
+                THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, EpsGetSystemError(lstErrno));
+            }
+        }
+
+        pBuffer->pNext = NULL;
+        pBuffer->refCount = 0;
+        *ppBuffer = pBuffer;
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * δõĻŻؿ(ͨ߳)
+ *
+ * @param   pHub                in  - ߼
+ * @param   pBuffer             in  - 
+ */
+static void FreeSubBuffer(EpsSubscriberHubT* pHub, EpsSubBufferT* pBuffer)
+{
+    pBuffer->pNext = pHub->pFreeList;
+    pHub->pFreeList = pBuffer;
+}
+
+/**
+ * ͷŶԻ()һͷź黹ͨ߳
+ *
+ * @param   pHub                in  - ߼
+ * @param   pBuffer             in  - 
+ */
+static void ReleaseSubBuffer(EpsSubscriberHubT* pHub, EpsSubBufferT* pBuffer)
+{
+    if (EpsAtomicFetchAdd(&pBuffer->refCount, (uint32)-1) != 1)
+    {
+        return;
+    }
+
+    /* ֻͨ߳ȡѹʱABA */
+    EpsSubBufferT* pHead = EpsAtomicLoad(&pHub->pReturnedList);
+    do
+    {
+        pBuffer->pNext = pHead;
+    } while (! EpsAtomicCompareAndExchange(&pHub->pReturnedList, &pHead, pBuffer));
+}
+
+/**
+ * ͷŻ
+ *
+ * @param   pList               in  - ͷΪNULL
+ */
+static void FreeSubBufferList(EpsSubBufferT* pList)
+{
+    while (pList != NULL)
+    {
+        EpsSubBufferT* pNext = pList->pNext;
+        free(pList);
+        pList = pNext;
+    }
+}
@@ -0,0 +1,207 @@
+/*
+ * Copyright (C) 2013, 2014 Shanghai Stock Exchange (SSE), Shanghai, China
+ * All Rights Reserved.
+ */
+
+/**
+ * @file    subscriber.h
+ *
+ * ڶඩַͷļ
+ *
+ * @version $Id
+ * @since   2026/10/18
+ */
+
+/**
+MODIFICATION HISTORY:
+<pre>
+================================================================================
+DD-MMM-YYYY INIT.    SIR    Modification Description
+----------- -------- ------ ----------------------------------------------------
+18-OCT-2026                 
+================================================================================
+</pre>
+*/
+
+#ifndef EPS_SUBSCRIBER_H
+#define EPS_SUBSCRIBER_H
+
+/**
+ * ͷļ
+ */
+
+#include "common.h"
+#include "epsTypes.h"
+#include "epsData.h"
+#include "atomic.h"
+#include "recMutex.h"
+#include "secFilter.h"
+#include "stepMessage.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**
+ * 궨
+ */
+
+#define EPS_SUBSCRIBER_QUEUE_SIZE_DEFAULT   1024    /* Ĭ϶߶дС */
+#define EPS_SUBSCRIBER_QUEUE_SIZE_MAX       65536   /* ߶дС */
+#define EPS_SUBSCRIBER_MDENTRY_MASK_NUM     (EPS_MDENTRY_MAX_NUM/64)    /* Ŀλͼ */
+#define EPS_SUBSCRIBER_INDEX_BITS           8       /* IDвλռλλΪλ */
+#define EPS_SUBSCRIBER_INDEX_MASK           ((1U << EPS_SUBSCRIBER_INDEX_BITS) - 1)
+
+
+/**
+ * Ͷ
+ */
+
+/*
+ * ״̬
+ */
+typedef enum EpsSubscriberStatusTag
+{
+    EPS_SUBSCRIBER_FREE             = 0,    /*  */
+    EPS_SUBSCRIBER_ACTIVE           = 1,    /*  */
+    EPS_SUBSCRIBER_CLOSING          = 2,    /* ɾУ̲ͨ߳ */
+} EpsSubscriberStatusT;
+
+/*
+ * 黺
+ *
+ * ͨ߳̽һκɸ߶йͬãһͶݺ黹
+ */
+typedef struct EpsSubBufferTag
+{
+    struct EpsSubBufferTag* pNext;          /*  */
+    uint32          refCount;               /* üиûĶ */
+    uint32          mdEntryCount;           /* Ŀ0ʾδ */
+    EpsMdEntryT     mdEntries[EPS_MDENTRY_MAX_NUM]; /* Ŀ */
+    EpsMktDataT     mktData;                /* ѽ飬notifyTimeΪʱ */
+} EpsSubBufferT;
+
+/*
+ * ߶
+ */
+typedef struct EpsSubItemTag
+{
+    EpsSubBufferT*  pBuffer;                /* 黺 */
+    uint32          keptCount;              /* ֤ȯĿ0ڻĿʱͶ */
+    uint64          mdEntryMask[EPS_SUBSCRIBER_MDENTRY_MASK_NUM];  /* ֤ȯĿλͼ */
+} EpsSubItemT;
+
+struct EpsSubscriberHubTag;
+
+/*
+ * 
+ *
+ * ͨ߳ΪΨһߣ߳(EpsPollSubscriberӦ߳)ΪΨһ
+ */
+typedef struct EpsSubscriberTag
+{
+    struct EpsSubscriberHubTag* pHub;       /* ߼ */
+    uint32          sid;                    /* ID0ʾ */
+    uint32          generation;             /* λλʹúɶIDЧ */
+    EpsSubscriberStatusT status;            /* ״̬ */
+
+    EpsMktTypeT     mktType;                /* г */
+    uint32          pollMode;               /* Ͷݷʽ */
+    EpsSubscriberMktDataCallback mktDataArrivedNotify;  /* ݵ֪ͨ */
+    EpsSecFilterT   filter;                 /* ֤ȯĹͨ߳ȡ */
+
+#if defined(__WINDOWS__)
+    HANDLE          thread;                 /* ̶߳ */
+    DWORD           tid;                    /* ߳id */
+#endif
+
+#if defined(__LINUX__) || defined(__HPUX__)
+    pthread_t       tid;                    /* ߳id */
+#endif
+    BOOL            canStop;                /* ֹͣ߳б */
+
+    EpsSubItemT*    items;                  /*  */
+    uint32          mask;                   /*  */
+    EpsMktDataT     mktData;                /* ͶݲĿʱĸƻ߷ */
+
+    uint64          droppedCount;           /* () */
+    uint32          maxDepth;               /* ѹ() */
+    uint64          deliveredCount EPS_CACHELINE_ALIGNED;  /* Ͷݵ() */
+
+    uint64          header EPS_CACHELINE_ALIGNED;   /* λ */
+    uint64          tailer EPS_CACHELINE_ALIGNED;   /* λ */
+} EpsSubscriberT;
+
+/*
+ * ߼
+ *
+ * ̶ͨ߳ÿֻ롢һΣߵг֤ȯ˺ѹУ
+ * ߶ʱֻöߵ飬̲ͨ߳ȴ
+ */
+typedef struct EpsSubscriberHubTag
+{
+    uint32          hid;                    /* ID */
+    EpsSecFilterT*  pFilter;                /* ֤ȯĹṩû */
+
+    EpsSubscriberT* subscribers;            /* 飬״Ӷʱ䲢ԭӷ */
+    uint32          activeCount;            /* Ķ */
+    uint32          publishSeq;             /* ţʾͨ߳ */
+
+    EpsSubBufferT*  pFreeList;              /* л̷ͨ߳ */
+    EpsSubBufferT*  pReturnedList;          /* ߹黹Ļԭѹ룬ͨ߳ȡ */
+
+    EpsRecMutexT    lock;                   /* ɾߵͬ */
+} EpsSubscriberHubT;
+
+
+/**
+ * 
+ */
+
+/*
+ * ʼ߼
+ */
+ResCodeT InitSubscriberHub(EpsSubscriberHubT* pHub, uint32 hid, EpsSecFilterT* pFilter);
+
+/*
+ * ʼ߼
+ */
+ResCodeT UninitSubscriberHub(EpsSubscriberHubT* pHub);
+
+/*
+ * Ӷ
+ */
+ResCodeT AddSubscriber(EpsSubscriberHubT* pHub, const EpsSubscriberConfigT* pConfig, uint32* pSid);
+
+/*
+ * ɾ
+ */
+ResCodeT RemoveSubscriber(EpsSubscriberHubT* pHub, uint32 sid);
+
+/*
+ * Ӧ߳Ͷݶ߶е
+ */
+ResCodeT PollSubscriber(EpsSubscriberHubT* pHub, uint32 sid, uint32 maxCount, uint32* pCount);
+
+/*
+ * ȡͳϢ
+ */
+ResCodeT GetSubscriberStatistics(EpsSubscriberHubT* pHub, uint32 sid, EpsSubscriberStatT* pStat);
+
+/*
+ * ߶
+ */
+ResCodeT PublishSubscribers(EpsSubscriberHubT* pHub, const StepMessageT* pMsg, uint64 recvTime);
+
+/*
+ * жǷж
+ */
+BOOL IsSubscriberHubEnabled(EpsSubscriberHubT* pHub);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* EPS_SUBSCRIBER_H */
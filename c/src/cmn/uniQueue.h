@@ -1,86 +0,0 @@
-/*
- * Copyright (C) 2013, 2014 Shanghai Stock Exchange (SSE), Shanghai, China
- * All Rights Reserved.
- */
-
-/**
- * @file    uniQueue.h
- *
- * жͷļ
- *
- * @version $Id
- * @since   2014/04/14
- * @author  Wu Zheng
- */
-
-/**
-MODIFICATION HISTORY:
-<pre>
-================================================================================
-DD-MMM-YYYY INIT.    SIR    Modification Description
------------ -------- ------ ----------------------------------------------------
-14-APR-2014 ZHENGWU         
-================================================================================
-</pre>
-*/
-
-#ifndef EPS_UNIQUEUE_H
-#define EPS_UNIQUEUE_H
-
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-
-/**
- * Ͷ
- */
-
-/*
- * ݹ黥ṹ
- */
-typedef struct EpsUniQueueTag
-{
-    uint32      size;       /* дС */
-    void**      container;  /*  */
-    uint32      header;     /* ͷλ */
-    uint32      tailer;     /* βλ */
-} EpsUniQueueT;
-
-
-/**
- * ӿں
- */
-
-/*
- * ʼ
- */
-ResCodeT InitUniQueue(EpsUniQueueT* pQueue, uint32 size);
-
-/*
- * ʼ
- */
-ResCodeT UninitUniQueue(EpsUniQueueT* pQueue);
-
-/*
- * β
- */
-ResCodeT PushUniQueue(EpsUniQueueT* pQueue, void* pItem);
-
-/*
- * ӵͷȡ
- */
-ResCodeT PopUniQueue(EpsUniQueueT* pQueue, void** ppItem);
-
-/*
- * жϵǷѾʼ
- */
-BOOL IsUniQueueInited(EpsUniQueueT* pQueue);
-
-
-#ifdef __cplusplus
-}
-#endif
-
-#endif /* EPS_UNIQUEUE_H */
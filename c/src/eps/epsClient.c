@@ -36,6 +36,7 @@ DD-MMM-YYYY INIT.    SIR    Modification Description
 #include "recMutex.h"
 #include "udpDriver.h"
 #include "tcpDriver.h"
+#include "shmDriver.h"
 
 #include "epsClient.h"
 
@@ -45,6 +46,8 @@ DD-MMM-YYYY INIT.    SIR    Modification Description
  */
 
 #define EPS_HANDLE_MAX_COUNT            32  /*  */
+#define EPS_HANDLE_INDEX_BITS           8   /* IDвλռλλΪλ */
+#define EPS_HANDLE_INDEX_MASK           ((1U << EPS_HANDLE_INDEX_BITS) - 1)
 
 
 /**
@@ -56,12 +59,13 @@ DD-MMM-YYYY INIT.    SIR    Modification Description
  */
 typedef struct EpsHandleTag
 {
-    uint32          hid;        /* ID */
+    uint32          hid;        /* ID0ʾУԭӶд */
     EpsConnModeT    connMode;   /* ģʽ */
     union EpsDriverTag
     {
         EpsUdpDriverT udpDriver;
         EpsTcpDriverT tcpDriver;
+        EpsShmDriverT shmDriver;
     } driver;                   /*  */
 } EpsHandleT;
 
@@ -72,7 +76,8 @@ typedef struct EpsHandleTag
  
 static volatile int    g_isLibInited = FALSE;   /* ʼ */
 static EpsHandleT      g_handlePool[EPS_HANDLE_MAX_COUNT];/*  */
-static EpsRecMutexT    g_libLock;               /* ͬ */
+static uint32          g_handleGeneration[EPS_HANDLE_MAX_COUNT];/* ظλĴλͷʱ */
+static EpsRecMutexT    g_libLock;               /* ͬ󣬽ڴپ */
 
 
 /**
@@ -171,7 +176,7 @@ int32 EpsCreateHandle(uint32* pHid, EpsConnModeT mode)
             THROW_ERROR(ERCD_EPS_INVALID_PARM, "pHid");
         }
 
-        if (mode != EPS_CONNMODE_UDP && mode != EPS_CONNMODE_TCP)
+        if (mode != EPS_CONNMODE_UDP && mode != EPS_CONNMODE_TCP && mode != EPS_CONNMODE_SHM)
         {
             THROW_ERROR(ERCD_EPS_INVALID_CONNMODE);
         }
@@ -194,12 +199,18 @@ int32 EpsCreateHandle(uint32* pHid, EpsConnModeT mode)
             pDriver->hid = pHandle->hid;
             THROW_ERROR(InitUdpDriver(pDriver));
         }
-        else /* mode == EPS_CONNMODE_TCP */
+        else if (mode == EPS_CONNMODE_TCP)
         {
             EpsTcpDriverT* pDriver = &pHandle->driver.tcpDriver;
             pDriver->hid = pHandle->hid;
             THROW_ERROR(InitTcpDriver(pDriver));
         }
+        else /* mode == EPS_CONNMODE_SHM */
+        {
+            EpsShmDriverT* pDriver = &pHandle->driver.shmDriver;
+            pDriver->hid = pHandle->hid;
+            THROW_ERROR(InitShmDriver(pDriver));
+        }
 
         *pHid = pHandle->hid;
     }
@@ -237,6 +248,8 @@ int32 EpsDestroyHandle(uint32 hid)
         ResCodeT rc = FindHandle(hid, &pHandle);
         if (OK(rc))
         {
+            /* ȳID˺Ĳѯٷظþ */
+            EpsAtomicStore(&pHandle->hid, 0);
             DisconnectHandle(pHandle);
             DestroyHandle(pHandle);
         }
@@ -276,21 +289,23 @@ int32 EpsRegisterSpi(uint32 hid, const EpsClientSpiT* pSpi)
         }
 
         EpsHandleT* pHandle = NULL;
-        LockRecMutex(&g_libLock);
-        ResCodeT rc = FindHandle(hid, &pHandle);
-        UnlockRecMutex(&g_libLock);
-        THROW_ERROR(rc);
+        THROW_ERROR(FindHandle(hid, &pHandle));
        
         if (pHandle->connMode == EPS_CONNMODE_UDP)
         {
             EpsUdpDriverT* pDriver = &pHandle->driver.udpDriver;
             THROW_ERROR(RegisterUdpDriverSpi(pDriver, pSpi));
         }
-        else /* connMode == EPS_CONNMODE_TCP */
+        else if (pHandle->connMode == EPS_CONNMODE_TCP)
         {
             EpsTcpDriverT* pDriver = &pHandle->driver.tcpDriver;
             THROW_ERROR(RegisterTcpDriverSpi(pDriver, pSpi));
         }
+        else /* connMode == EPS_CONNMODE_SHM */
+        {
+            EpsShmDriverT* pDriver = &pHandle->driver.shmDriver;
+            THROW_ERROR(RegisterShmDriverSpi(pDriver, pSpi));
+        }
     }
     CATCH
     {
@@ -326,21 +341,23 @@ int32 EpsConnect(uint32 hid, const char* address)
         }
 
         EpsHandleT* pHandle = NULL;
-        LockRecMutex(&g_libLock);
-        ResCodeT rc = FindHandle(hid, &pHandle);
-        UnlockRecMutex(&g_libLock);
-        THROW_ERROR(rc);
+        THROW_ERROR(FindHandle(hid, &pHandle));
         
         if (pHandle->connMode == EPS_CONNMODE_UDP)
         {
             EpsUdpDriverT* pDriver = &pHandle->driver.udpDriver;
             THROW_ERROR(ConnectUdpDriver(pDriver, address));
         }
-        else /* connMode == EPS_CONNMODE_TCP */
+        else if (pHandle->connMode == EPS_CONNMODE_TCP)
         {
             EpsTcpDriverT* pDriver = &pHandle->driver.tcpDriver;
             THROW_ERROR(ConnectTcpDriver(pDriver, address));
         }
+        else /* connMode == EPS_CONNMODE_SHM */
+        {
+            EpsShmDriverT* pDriver = &pHandle->driver.shmDriver;
+            THROW_ERROR(ConnectShmDriver(pDriver, address));
+        }
     }
     CATCH
     {
@@ -368,21 +385,23 @@ int32 EpsDisconnect(uint32 hid)
         }
 
         EpsHandleT* pHandle = NULL;
-        LockRecMutex(&g_libLock);
-        ResCodeT rc = FindHandle(hid, &pHandle);
-        UnlockRecMutex(&g_libLock);
-        THROW_ERROR(rc);
+        THROW_ERROR(FindHandle(hid, &pHandle));
 
         if (pHandle->connMode == EPS_CONNMODE_UDP)
         {
             EpsUdpDriverT* pDriver = &pHandle->driver.udpDriver;
             THROW_ERROR(DisconnectUdpDriver(pDriver));
         }
-        else /* connMode == EPS_CONNMODE_TCP */
+        else if (pHandle->connMode == EPS_CONNMODE_TCP)
         {
             EpsTcpDriverT* pDriver = &pHandle->driver.tcpDriver;
             THROW_ERROR(DisconnectTcpDriver(pDriver));
         }
+        else /* connMode == EPS_CONNMODE_SHM */
+        {
+            EpsShmDriverT* pDriver = &pHandle->driver.shmDriver;
+            THROW_ERROR(DisconnectShmDriver(pDriver));
+        }
     }
     CATCH
     {
@@ -428,21 +447,23 @@ int32 EpsLogin(uint32 hid, const char* username, const char* password, uint16 he
         }
 
         EpsHandleT* pHandle = NULL;
-        LockRecMutex(&g_libLock);
-        ResCodeT rc = FindHandle(hid, &pHandle);
-        UnlockRecMutex(&g_libLock);
-        THROW_ERROR(rc);
+        THROW_ERROR(FindHandle(hid, &pHandle));
 
         if (pHandle->connMode == EPS_CONNMODE_UDP)
         {
             EpsUdpDriverT* pDriver = &pHandle->driver.udpDriver;
             THROW_ERROR(LoginUdpDriver(pDriver, username, password, heartbeatIntl));
         }
-        else /* connMode == EPS_CONNMODE_TCP */
+        else if (pHandle->connMode == EPS_CONNMODE_TCP)
         {
             EpsTcpDriverT* pDriver = &pHandle->driver.tcpDriver;
             THROW_ERROR(LoginTcpDriver(pDriver, username, password, heartbeatIntl));
         }
+        else /* connMode == EPS_CONNMODE_SHM */
+        {
+            EpsShmDriverT* pDriver = &pHandle->driver.shmDriver;
+            THROW_ERROR(LoginShmDriver(pDriver, username, password, heartbeatIntl));
+        }
     }
     CATCH
     {
@@ -475,21 +496,23 @@ int32 EpsLogout(uint32 hid, const char* reason)
         }
 
         EpsHandleT* pHandle = NULL;
-        LockRecMutex(&g_libLock);
-        ResCodeT rc = FindHandle(hid, &pHandle);
-        UnlockRecMutex(&g_libLock);
-        THROW_ERROR(rc);
+        THROW_ERROR(FindHandle(hid, &pHandle));
 
         if (pHandle->connMode == EPS_CONNMODE_UDP)
         {
             EpsUdpDriverT* pDriver = &pHandle->driver.udpDriver;
             THROW_ERROR(LogoutUdpDriver(pDriver, reason));
         }
-        else /* connMode == EPS_CONNMODE_TCP */
+        else if (pHandle->connMode == EPS_CONNMODE_TCP)
         {
             EpsTcpDriverT* pDriver = &pHandle->driver.tcpDriver;
             THROW_ERROR(LogoutTcpDriver(pDriver, reason));
         }
+        else /* connMode == EPS_CONNMODE_SHM */
+        {
+            EpsShmDriverT* pDriver = &pHandle->driver.shmDriver;
+            THROW_ERROR(LogoutShmDriver(pDriver, reason));
+        }
     }
     CATCH
     {
@@ -518,21 +541,23 @@ int32 EpsSubscribeMarketData(uint32 hid, EpsMktTypeT mktType)
         }
 
         EpsHandleT* pHandle = NULL;
-        LockRecMutex(&g_libLock);
-        ResCodeT rc = FindHandle(hid, &pHandle);
-        UnlockRecMutex(&g_libLock);
-        THROW_ERROR(rc);
+        THROW_ERROR(FindHandle(hid, &pHandle));
 
         if (pHandle->connMode == EPS_CONNMODE_UDP)
         {
             EpsUdpDriverT* pDriver = &pHandle->driver.udpDriver;
             THROW_ERROR(SubscribeUdpDriver(pDriver, mktType));
         }
-        else /* connMode == EPS_CONNMODE_TCP */
+        else if (pHandle->connMode == EPS_CONNMODE_TCP)
         {
             EpsTcpDriverT* pDriver = &pHandle->driver.tcpDriver;
             THROW_ERROR(SubscribeTcpDriver(pDriver, mktType));
         }
+        else /* connMode == EPS_CONNMODE_SHM */
+        {
+            EpsShmDriverT* pDriver = &pHandle->driver.shmDriver;
+            THROW_ERROR(SubscribeShmDriver(pDriver, mktType));
+        }
     }
     CATCH
     {
@@ -544,35 +569,91 @@ int32 EpsSubscribeMarketData(uint32 hid, EpsMktTypeT mktType)
 }
 
 /**
- * ȡһϢ
+ * ָ֤ȯ
  *
- * @return  شϢַ
- */
-const char* EpsGetLastError()
-{
-    return ErrGetErrorDscr();
-}
-
-/**
- * жϿǷ񱻳ʼ
+ * @param   hid             in  - ִжĲľID
+ * @param   securityIDs     in  - ֤ȯ
+ * @param   count           in  - ֤ȯ0ʾȡ֤ȯ
  *
- * @return ѾʼTRUE򷵻FALSE
+ * @return  ɹNO_ERR򷵻ش
  */
-static BOOL IsLibInited()
+int32 EpsSubscribeSecurities(uint32 hid, const char* securityIDs[], uint32 count)
 {
-    return (g_isLibInited == TRUE);
+    TRY
+    {
+        if (! IsLibInited())
+        {
+            THROW_ERROR(ERCD_EPS_UNINITED, "library");
+        }
+
+        EpsHandleT* pHandle = NULL;
+        THROW_ERROR(FindHandle(hid, &pHandle));
+
+        if (pHandle->connMode == EPS_CONNMODE_UDP)
+        {
+            EpsUdpDriverT* pDriver = &pHandle->driver.udpDriver;
+            THROW_ERROR(SubscribeUdpDriverSecurities(pDriver, securityIDs, count));
+        }
+        else if (pHandle->connMode == EPS_CONNMODE_TCP)
+        {
+            EpsTcpDriverT* pDriver = &pHandle->driver.tcpDriver;
+            THROW_ERROR(SubscribeTcpDriverSecurities(pDriver, securityIDs, count));
+        }
+        else /* connMode == EPS_CONNMODE_SHM */
+        {
+            EpsShmDriverT* pDriver = &pHandle->driver.shmDriver;
+            THROW_ERROR(SubscribeShmDriverSecurities(pDriver, securityIDs, count));
+        }
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
 }
 
 /**
- * ʼ
+ * ȡͳϢ
+ *
+ * @param   hid             in  - ѯľID
+ * @param   pStat           out - ͳϢ
  *
  * @return  ɹNO_ERR򷵻ش
  */
-static ResCodeT InitHandlePool()
+int32 EpsGetStatistics(uint32 hid, EpsStatisticsT* pStat)
 {
     TRY
     {
-        memset(g_handlePool, 0x00, sizeof(g_handlePool));
+        if (pStat == NULL)
+        {
+            THROW_ERROR(ERCD_EPS_INVALID_PARM, "pStat");
+        }
+
+        if (! IsLibInited())
+        {
+            THROW_ERROR(ERCD_EPS_UNINITED, "library");
+        }
+
+        EpsHandleT* pHandle = NULL;
+        THROW_ERROR(FindHandle(hid, &pHandle));
+
+        if (pHandle->connMode == EPS_CONNMODE_UDP)
+        {
+            EpsUdpDriverT* pDriver = &pHandle->driver.udpDriver;
+            THROW_ERROR(GetUdpDriverStatistics(pDriver, pStat));
+        }
+        else if (pHandle->connMode == EPS_CONNMODE_TCP)
+        {
+            EpsTcpDriverT* pDriver = &pHandle->driver.tcpDriver;
+            THROW_ERROR(GetTcpDriverStatistics(pDriver, pStat));
+        }
+        else /* connMode == EPS_CONNMODE_SHM */
+        {
+            EpsShmDriverT* pDriver = &pHandle->driver.shmDriver;
+            THROW_ERROR(GetShmDriverStatistics(pDriver, pStat));
+        }
     }
     CATCH
     {
@@ -584,25 +665,41 @@ static ResCodeT InitHandlePool()
 }
 
 /**
- * ʼ
+ * þѡ
  *
- * @return  ɹNO_ERR򷵻ش
+ * @param   hid             in  - õľID
+ * @param   option          in  - ѡ
+ * @param   value           in  - ѡֵ
+ *
+ * @return  ɹ1򷵻ش
  */
-static ResCodeT UninitHandlePool()
+int32 EpsSetOption(uint32 hid, EpsOptionT option, int32 value)
 {
     TRY
     {
-        uint32 i = 0;
-        for (i = 0; i < EPS_HANDLE_MAX_COUNT; i++)
+        if (! IsLibInited())
         {
-            if (g_handlePool[i].hid != 0)
-            {
-                DisconnectHandle(&g_handlePool[i]);
-                DestroyHandle(&g_handlePool[i]);
-            }
+            THROW_ERROR(ERCD_EPS_UNINITED, "library");
         }
 
-        memset(g_handlePool, 0x00, sizeof(g_handlePool));
+        EpsHandleT* pHandle = NULL;
+        THROW_ERROR(FindHandle(hid, &pHandle));
+
+        if (pHandle->connMode == EPS_CONNMODE_UDP)
+        {
+            EpsUdpDriverT* pDriver = &pHandle->driver.udpDriver;
+            THROW_ERROR(SetUdpDriverOption(pDriver, option, value));
+        }
+        else if (pHandle->connMode == EPS_CONNMODE_TCP)
+        {
+            EpsTcpDriverT* pDriver = &pHandle->driver.tcpDriver;
+            THROW_ERROR(SetTcpDriverOption(pDriver, option, value));
+        }
+        else /* connMode == EPS_CONNMODE_SHM */
+        {
+            EpsShmDriverT* pDriver = &pHandle->driver.shmDriver;
+            THROW_ERROR(SetShmDriverOption(pDriver, option, value));
+        }
     }
     CATCH
     {
@@ -614,30 +711,50 @@ static ResCodeT UninitHandlePool()
 }
 
 /**
- * ȡ¾
+ * ȡ鲥·TCPỰٲͳϢ
  *
- * @param   ppHandle             out  - ȡ¾
+ * @param   hid             in  - ѯľID
+ * @param   pStats          out - ·(Ự)ͳϢ
+ * @param   pCount          in  - 鳤
+ *                          out - ·
  *
- * @return  ɹNO_ERR򷵻ش
+ * @return  ɹ1򷵻ش
  */
-static ResCodeT GetNewHandle(EpsHandleT** ppHandle)
+int32 EpsGetLineStatistics(uint32 hid, EpsLineStatT* pStats, uint32* pCount)
 {
     TRY
     {
-        uint32 i = 0;
-        for (i = 0; i < EPS_HANDLE_MAX_COUNT; i++)
+        if (pStats == NULL)
         {
-            if (g_handlePool[i].hid == 0)
-            {
-                g_handlePool[i].hid = i + 1;
-                *ppHandle = &g_handlePool[i];
-                break;
-            }
+            THROW_ERROR(ERCD_EPS_INVALID_PARM, "pStats");
         }
 
-        if (i >= EPS_HANDLE_MAX_COUNT)
+        if (pCount == NULL)
         {
-            THROW_ERROR(ERCD_EPS_HID_COUNT_BEYOND_LIMIT, EPS_HANDLE_MAX_COUNT);
+            THROW_ERROR(ERCD_EPS_INVALID_PARM, "pCount");
+        }
+
+        if (! IsLibInited())
+        {
+            THROW_ERROR(ERCD_EPS_UNINITED, "library");
+        }
+
+        EpsHandleT* pHandle = NULL;
+        THROW_ERROR(FindHandle(hid, &pHandle));
+
+        if (pHandle->connMode == EPS_CONNMODE_UDP)
+        {
+            EpsUdpDriverT* pDriver = &pHandle->driver.udpDriver;
+            THROW_ERROR(GetUdpDriverLineStatistics(pDriver, pStats, pCount));
+        }
+        else if (pHandle->connMode == EPS_CONNMODE_TCP)
+        {
+            EpsTcpDriverT* pDriver = &pHandle->driver.tcpDriver;
+            THROW_ERROR(GetTcpDriverLineStatistics(pDriver, pStats, pCount));
+        }
+        else /* connMode == EPS_CONNMODE_SHM */
+        {
+            THROW_ERROR(ERCD_EPS_INVALID_CONNMODE);
         }
     }
     CATCH
@@ -650,28 +767,56 @@ static ResCodeT GetNewHandle(EpsHandleT** ppHandle)
 }
 
 /**
- * ѯ
+ * ȱڵTCPջָ
  *
- * @param   hid                  in   - ѯľID
- * @param   ppHandle             out  - ѯľ
+ * @param   hid             in  - õľID
+ * @param   address         in  - ַָʽΪ"ip:port"
+ * @param   username        in  - ָỰ½û
+ * @param   password        in  - ָỰ½
+ * @param   gapThreshold    in  - ָȱֵ
  *
- * @return  ɹNO_ERR򷵻ش
+ * @return  ɹ1򷵻ش
  */
-static ResCodeT FindHandle(uint32 hid, EpsHandleT** ppHandle)
+int32 EpsSetRecovery(uint32 hid, const char* address, const char* username,
+        const char* password, uint32 gapThreshold)
 {
     TRY
     {
-        if (hid == 0 || hid > EPS_HANDLE_MAX_COUNT)
+        if (address == NULL)
         {
-            THROW_ERROR(ERCD_EPS_INVALID_HID);
+            THROW_ERROR(ERCD_EPS_INVALID_PARM, "address");
         }
 
-        if (g_handlePool[hid - 1].hid == 0)
+        if (username == NULL)
         {
-            THROW_ERROR(ERCD_EPS_INVALID_HID);
+            THROW_ERROR(ERCD_EPS_INVALID_PARM, "username");
+        }
+
+        if (password == NULL)
+        {
+            THROW_ERROR(ERCD_EPS_INVALID_PARM, "password");
+        }
+
+        if (gapThreshold == 0)
+        {
+            THROW_ERROR(ERCD_EPS_INVALID_PARM, "gapThreshold");
+        }
+
+        if (! IsLibInited())
+        {
+            THROW_ERROR(ERCD_EPS_UNINITED, "library");
+        }
+
+        EpsHandleT* pHandle = NULL;
+        THROW_ERROR(FindHandle(hid, &pHandle));
+
+        if (pHandle->connMode != EPS_CONNMODE_UDP)
+        {
+            THROW_ERROR(ERCD_EPS_INVALID_CONNMODE);
         }
 
-        *ppHandle = &g_handlePool[hid - 1];
+        EpsUdpDriverT* pDriver = &pHandle->driver.udpDriver;
+        THROW_ERROR(SetUdpDriverRecovery(pDriver, address, username, password, gapThreshold));
     }
     CATCH
     {
@@ -683,41 +828,652 @@ static ResCodeT FindHandle(uint32 hid, EpsHandleT** ppHandle)
 }
 
 /**
- * Ͽ
+ * ûỰ
  *
- * @param   pHandle             in  - ִжϿľID
+ * @param   hid             in  - õľID
+ * @param   pProfile        in  - Ự
+ *
+ * @return  ɹ1򷵻ش
  */
-static void DisconnectHandle(EpsHandleT* pHandle)
+int32 EpsSetSessionProfile(uint32 hid, const EpsSessionProfileT* pProfile)
 {
-    if (pHandle->connMode == EPS_CONNMODE_UDP)
+    TRY
     {
-        EpsUdpDriverT* pDriver = &pHandle->driver.udpDriver;
-        DisconnectUdpDriver(pDriver);
+        if (pProfile == NULL)
+        {
+            THROW_ERROR(ERCD_EPS_INVALID_PARM, "pProfile");
+        }
+
+        if (pProfile->username[0] == 0x00)
+        {
+            THROW_ERROR(ERCD_EPS_INVALID_PARM, "username");
+        }
+
+        if (pProfile->password[0] == 0x00)
+        {
+            THROW_ERROR(ERCD_EPS_INVALID_PARM, "password");
+        }
+
+        if (pProfile->heartbeatIntl == 0)
+        {
+            THROW_ERROR(ERCD_EPS_INVALID_PARM, "heartbeatIntl");
+        }
+
+        if (! IsLibInited())
+        {
+            THROW_ERROR(ERCD_EPS_UNINITED, "library");
+        }
+
+        EpsHandleT* pHandle = NULL;
+        THROW_ERROR(FindHandle(hid, &pHandle));
+
+        if (pHandle->connMode != EPS_CONNMODE_TCP)
+        {
+            THROW_ERROR(ERCD_EPS_INVALID_CONNMODE);
+        }
+
+        EpsTcpDriverT* pDriver = &pHandle->driver.tcpDriver;
+        THROW_ERROR(SetTcpDriverSessionProfile(pDriver, pProfile));
     }
-    else /* connMode == EPS_CONNMODE_TCP */
+    CATCH
     {
-        EpsTcpDriverT* pDriver = &pHandle->driver.tcpDriver;
-        DisconnectTcpDriver(pDriver);
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
     }
 }
 
 /**
- * پ
+ * ùڴ߷
  *
- * @param   pHandle             in  - ִٲľID
+ * @param   hid             in  - õľID
+ * @param   name            in  - ڴ
+ * @param   slotCount       in  - ߲λ0ȡĬֵ
+ *
+ * @return  ɹ1򷵻ش
  */
-static void DestroyHandle(EpsHandleT* pHandle)
+int32 EpsSetShmPublisher(uint32 hid, const char* name, uint32 slotCount)
 {
-    if (pHandle->connMode == EPS_CONNMODE_UDP)
+    TRY
     {
-        EpsUdpDriverT* pDriver = &pHandle->driver.udpDriver;
-        UninitUdpDriver(pDriver);
+        if (name == NULL || name[0] == 0x00)
+        {
+            THROW_ERROR(ERCD_EPS_INVALID_PARM, "name");
+        }
+
+        if (! IsLibInited())
+        {
+            THROW_ERROR(ERCD_EPS_UNINITED, "library");
+        }
+
+        EpsHandleT* pHandle = NULL;
+        THROW_ERROR(FindHandle(hid, &pHandle));
+
+        if (pHandle->connMode == EPS_CONNMODE_UDP)
+        {
+            EpsUdpDriverT* pDriver = &pHandle->driver.udpDriver;
+            THROW_ERROR(SetUdpDriverShmPublisher(pDriver, name, slotCount));
+        }
+        else if (pHandle->connMode == EPS_CONNMODE_TCP)
+        {
+            EpsTcpDriverT* pDriver = &pHandle->driver.tcpDriver;
+            THROW_ERROR(SetTcpDriverShmPublisher(pDriver, name, slotCount));
+        }
+        else
+        {
+            THROW_ERROR(ERCD_EPS_INVALID_CONNMODE);
+        }
     }
-    else /* connMode == EPS_CONNMODE_TCP */
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * Ӧ߳
+ *
+ * @param   hid             in  - ľID
+ * @param   timeoutNs       in  - ʱȴʱ()0ʾȴ
+ * @param   maxEvents       in  - ִеĽ01
+ *
+ * @return  ɹ1򷵻ش
+ */
+int32 EpsPoll(uint32 hid, uint64 timeoutNs, uint32 maxEvents)
+{
+    TRY
+    {
+        if (! IsLibInited())
+        {
+            THROW_ERROR(ERCD_EPS_UNINITED, "library");
+        }
+
+        EpsHandleT* pHandle = NULL;
+        THROW_ERROR(FindHandle(hid, &pHandle));
+
+        if (pHandle->connMode == EPS_CONNMODE_UDP)
+        {
+            EpsUdpDriverT* pDriver = &pHandle->driver.udpDriver;
+            THROW_ERROR(PollUdpDriver(pDriver, timeoutNs, maxEvents));
+        }
+        else if (pHandle->connMode == EPS_CONNMODE_TCP)
+        {
+            EpsTcpDriverT* pDriver = &pHandle->driver.tcpDriver;
+            THROW_ERROR(PollTcpDriver(pDriver, timeoutNs, maxEvents));
+        }
+        else /* connMode == EPS_CONNMODE_SHM */
+        {
+            EpsShmDriverT* pDriver = &pHandle->driver.shmDriver;
+            THROW_ERROR(PollShmDriver(pDriver, timeoutNs, maxEvents));
+        }
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ȡӦ̵߳ȴ
+ *
+ * @param   hid             in  - ѯľID
+ * @param   pFd             out - 
+ *
+ * @return  ɹ1򷵻ش
+ */
+int32 EpsGetFd(uint32 hid, int* pFd)
+{
+    TRY
+    {
+        if (pFd == NULL)
+        {
+            THROW_ERROR(ERCD_EPS_INVALID_PARM, "pFd");
+        }
+
+        if (! IsLibInited())
+        {
+            THROW_ERROR(ERCD_EPS_UNINITED, "library");
+        }
+
+        EpsHandleT* pHandle = NULL;
+        THROW_ERROR(FindHandle(hid, &pHandle));
+
+        if (pHandle->connMode == EPS_CONNMODE_UDP)
+        {
+            EpsUdpDriverT* pDriver = &pHandle->driver.udpDriver;
+            THROW_ERROR(GetUdpDriverFd(pDriver, pFd));
+        }
+        else if (pHandle->connMode == EPS_CONNMODE_TCP)
+        {
+            EpsTcpDriverT* pDriver = &pHandle->driver.tcpDriver;
+            THROW_ERROR(GetTcpDriverFd(pDriver, pFd));
+        }
+        else /* connMode == EPS_CONNMODE_SHM */
+        {
+            /* ڴ޿ɵȴ */
+            THROW_ERROR(ERCD_EPS_INVALID_OPERATION, "no pollable descriptor");
+        }
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ע
+ *
+ * @param   hid                 in  - עľID
+ * @param   parser              in  - NULLʾȡ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+int32 EpsSetMdDataParser(uint32 hid, EpsMdDataParseCallback parser)
+{
+    TRY
+    {
+        if (! IsLibInited())
+        {
+            THROW_ERROR(ERCD_EPS_UNINITED, "library");
+        }
+
+        EpsHandleT* pHandle = NULL;
+        THROW_ERROR(FindHandle(hid, &pHandle));
+
+        if (pHandle->connMode == EPS_CONNMODE_UDP)
+        {
+            EpsUdpDriverT* pDriver = &pHandle->driver.udpDriver;
+            THROW_ERROR(SetUdpDriverMdDataParser(pDriver, parser));
+        }
+        else if (pHandle->connMode == EPS_CONNMODE_TCP)
+        {
+            EpsTcpDriverT* pDriver = &pHandle->driver.tcpDriver;
+            THROW_ERROR(SetTcpDriverMdDataParser(pDriver, parser));
+        }
+        else /* connMode == EPS_CONNMODE_SHM */
+        {
+            EpsShmDriverT* pDriver = &pHandle->driver.shmDriver;
+            THROW_ERROR(SetShmDriverMdDataParser(pDriver, parser));
+        }
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * Ӿڵ鶩
+ *
+ * @param   hid                 in  - ӶߵľID
+ * @param   pConfig             in  - 
+ * @param   pSid                out - ID
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+int32 EpsAddSubscriber(uint32 hid, const EpsSubscriberConfigT* pConfig, uint32* pSid)
+{
+    TRY
+    {
+        if (pConfig == NULL)
+        {
+            THROW_ERROR(ERCD_EPS_INVALID_PARM, "pConfig");
+        }
+
+        if (pSid == NULL)
+        {
+            THROW_ERROR(ERCD_EPS_INVALID_PARM, "pSid");
+        }
+
+        if (! IsLibInited())
+        {
+            THROW_ERROR(ERCD_EPS_UNINITED, "library");
+        }
+
+        EpsHandleT* pHandle = NULL;
+        THROW_ERROR(FindHandle(hid, &pHandle));
+
+        if (pHandle->connMode == EPS_CONNMODE_UDP)
+        {
+            EpsUdpDriverT* pDriver = &pHandle->driver.udpDriver;
+            THROW_ERROR(AddUdpDriverSubscriber(pDriver, pConfig, pSid));
+        }
+        else if (pHandle->connMode == EPS_CONNMODE_TCP)
+        {
+            EpsTcpDriverT* pDriver = &pHandle->driver.tcpDriver;
+            THROW_ERROR(AddTcpDriverSubscriber(pDriver, pConfig, pSid));
+        }
+        else /* connMode == EPS_CONNMODE_SHM */
+        {
+            EpsShmDriverT* pDriver = &pHandle->driver.shmDriver;
+            THROW_ERROR(AddShmDriverSubscriber(pDriver, pConfig, pSid));
+        }
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ɾڵ鶩
+ *
+ * @param   hid                 in  - ID
+ * @param   sid                 in  - ɾĶID
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+int32 EpsRemoveSubscriber(uint32 hid, uint32 sid)
+{
+    TRY
+    {
+        if (! IsLibInited())
+        {
+            THROW_ERROR(ERCD_EPS_UNINITED, "library");
+        }
+
+        EpsHandleT* pHandle = NULL;
+        THROW_ERROR(FindHandle(hid, &pHandle));
+
+        if (pHandle->connMode == EPS_CONNMODE_UDP)
+        {
+            EpsUdpDriverT* pDriver = &pHandle->driver.udpDriver;
+            THROW_ERROR(RemoveUdpDriverSubscriber(pDriver, sid));
+        }
+        else if (pHandle->connMode == EPS_CONNMODE_TCP)
+        {
+            EpsTcpDriverT* pDriver = &pHandle->driver.tcpDriver;
+            THROW_ERROR(RemoveTcpDriverSubscriber(pDriver, sid));
+        }
+        else /* connMode == EPS_CONNMODE_SHM */
+        {
+            EpsShmDriverT* pDriver = &pHandle->driver.shmDriver;
+            THROW_ERROR(RemoveShmDriverSubscriber(pDriver, sid));
+        }
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * Ӧ߳Ͷݶߵ
+ *
+ * @param   hid                 in  - ID
+ * @param   sid                 in  - ID
+ * @param   maxCount            in  - Ͷݵ01
+ * @param   pCount              out - Ͷݵ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+int32 EpsPollSubscriber(uint32 hid, uint32 sid, uint32 maxCount, uint32* pCount)
+{
+    TRY
+    {
+        if (pCount == NULL)
+        {
+            THROW_ERROR(ERCD_EPS_INVALID_PARM, "pCount");
+        }
+
+        if (! IsLibInited())
+        {
+            THROW_ERROR(ERCD_EPS_UNINITED, "library");
+        }
+
+        EpsHandleT* pHandle = NULL;
+        THROW_ERROR(FindHandle(hid, &pHandle));
+
+        if (pHandle->connMode == EPS_CONNMODE_UDP)
+        {
+            EpsUdpDriverT* pDriver = &pHandle->driver.udpDriver;
+            THROW_ERROR(PollUdpDriverSubscriber(pDriver, sid, maxCount, pCount));
+        }
+        else if (pHandle->connMode == EPS_CONNMODE_TCP)
+        {
+            EpsTcpDriverT* pDriver = &pHandle->driver.tcpDriver;
+            THROW_ERROR(PollTcpDriverSubscriber(pDriver, sid, maxCount, pCount));
+        }
+        else /* connMode == EPS_CONNMODE_SHM */
+        {
+            EpsShmDriverT* pDriver = &pHandle->driver.shmDriver;
+            THROW_ERROR(PollShmDriverSubscriber(pDriver, sid, maxCount, pCount));
+        }
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ȡͳϢ
+ *
+ * @param   hid                 in  - ID
+ * @param   sid                 in  - ID
+ * @param   pStat               out - ͳϢ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+int32 EpsGetSubscriberStatistics(uint32 hid, uint32 sid, EpsSubscriberStatT* pStat)
+{
+    TRY
+    {
+        if (pStat == NULL)
+        {
+            THROW_ERROR(ERCD_EPS_INVALID_PARM, "pStat");
+        }
+
+        if (! IsLibInited())
+        {
+            THROW_ERROR(ERCD_EPS_UNINITED, "library");
+        }
+
+        EpsHandleT* pHandle = NULL;
+        THROW_ERROR(FindHandle(hid, &pHandle));
+
+        if (pHandle->connMode == EPS_CONNMODE_UDP)
+        {
+            EpsUdpDriverT* pDriver = &pHandle->driver.udpDriver;
+            THROW_ERROR(GetUdpDriverSubscriberStatistics(pDriver, sid, pStat));
+        }
+        else if (pHandle->connMode == EPS_CONNMODE_TCP)
+        {
+            EpsTcpDriverT* pDriver = &pHandle->driver.tcpDriver;
+            THROW_ERROR(GetTcpDriverSubscriberStatistics(pDriver, sid, pStat));
+        }
+        else /* connMode == EPS_CONNMODE_SHM */
+        {
+            EpsShmDriverT* pDriver = &pHandle->driver.shmDriver;
+            THROW_ERROR(GetShmDriverSubscriberStatistics(pDriver, sid, pStat));
+        }
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ȡһϢ
+ *
+ * @return  شϢַ
+ */
+const char* EpsGetLastError()
+{
+    return ErrGetErrorDscr();
+}
+
+/**
+ * жϿǷ񱻳ʼ
+ *
+ * @return ѾʼTRUE򷵻FALSE
+ */
+static BOOL IsLibInited()
+{
+    return (g_isLibInited == TRUE);
+}
+
+/**
+ * ʼ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+static ResCodeT InitHandlePool()
+{
+    TRY
+    {
+        memset(g_handlePool, 0x00, sizeof(g_handlePool));
+        memset(g_handleGeneration, 0x00, sizeof(g_handleGeneration));
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ʼ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+static ResCodeT UninitHandlePool()
+{
+    TRY
+    {
+        uint32 i = 0;
+        for (i = 0; i < EPS_HANDLE_MAX_COUNT; i++)
+        {
+            if (g_handlePool[i].hid != 0)
+            {
+                EpsAtomicStore(&g_handlePool[i].hid, 0);
+                DisconnectHandle(&g_handlePool[i]);
+                DestroyHandle(&g_handlePool[i]);
+            }
+        }
+
+        memset(g_handlePool, 0x00, sizeof(g_handlePool));
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ȡ¾пͬ
+ *
+ * IDEPS_HANDLE_INDEX_BITSλΪλż1λΪλ
+ * λʹúɾIDЧ
+ *
+ * @param   ppHandle             out  - ȡ¾
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+static ResCodeT GetNewHandle(EpsHandleT** ppHandle)
+{
+    TRY
+    {
+        uint32 i = 0;
+        for (i = 0; i < EPS_HANDLE_MAX_COUNT; i++)
+        {
+            if (g_handlePool[i].hid == 0)
+            {
+                uint32 generation = g_handleGeneration[i]++;
+                uint32 hid = (generation << EPS_HANDLE_INDEX_BITS) | (i + 1);
+                EpsAtomicStore(&g_handlePool[i].hid, hid);
+                *ppHandle = &g_handlePool[i];
+                break;
+            }
+        }
+
+        if (i >= EPS_HANDLE_MAX_COUNT)
+        {
+            THROW_ERROR(ERCD_EPS_HID_COUNT_BEYOND_LIMIT, EPS_HANDLE_MAX_COUNT);
+        }
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ѯIDеĲλֱӶλпͬ
+ *
+ * @param   hid                  in   - ѯľID
+ * @param   ppHandle             out  - ѯľ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+static ResCodeT FindHandle(uint32 hid, EpsHandleT** ppHandle)
+{
+    TRY
+    {
+        uint32 index = hid & EPS_HANDLE_INDEX_MASK;
+        if (index == 0 || index > EPS_HANDLE_MAX_COUNT)
+        {
+            THROW_ERROR(ERCD_EPS_INVALID_HID);
+        }
+
+        /* λͷŻѱʹʱͬ */
+        EpsHandleT* pHandle = &g_handlePool[index - 1];
+        if (EpsAtomicLoad(&pHandle->hid) != hid)
+        {
+            THROW_ERROR(ERCD_EPS_INVALID_HID);
+        }
+
+        *ppHandle = pHandle;
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * Ͽ
+ *
+ * @param   pHandle             in  - ִжϿľID
+ */
+static void DisconnectHandle(EpsHandleT* pHandle)
+{
+    if (pHandle->connMode == EPS_CONNMODE_UDP)
+    {
+        EpsUdpDriverT* pDriver = &pHandle->driver.udpDriver;
+        DisconnectUdpDriver(pDriver);
+    }
+    else if (pHandle->connMode == EPS_CONNMODE_TCP)
+    {
+        EpsTcpDriverT* pDriver = &pHandle->driver.tcpDriver;
+        DisconnectTcpDriver(pDriver);
+    }
+    else /* connMode == EPS_CONNMODE_SHM */
+    {
+        EpsShmDriverT* pDriver = &pHandle->driver.shmDriver;
+        DisconnectShmDriver(pDriver);
+    }
+}
+
+/**
+ * پ
+ *
+ * @param   pHandle             in  - ִٲľID
+ */
+static void DestroyHandle(EpsHandleT* pHandle)
+{
+    if (pHandle->connMode == EPS_CONNMODE_UDP)
+    {
+        EpsUdpDriverT* pDriver = &pHandle->driver.udpDriver;
+        UninitUdpDriver(pDriver);
+    }
+    else if (pHandle->connMode == EPS_CONNMODE_TCP)
     {
         EpsTcpDriverT* pDriver = &pHandle->driver.tcpDriver;
         UninitTcpDriver(pDriver);
     }
+    else /* connMode == EPS_CONNMODE_SHM */
+    {
+        EpsShmDriverT* pDriver = &pHandle->driver.shmDriver;
+        UninitShmDriver(pDriver);
+    }
 
     memset(pHandle, 0x00, sizeof(EpsHandleT));
 }
@@ -71,7 +71,9 @@ int32 EpsUninitLib();
  * @return  ɹ1򷵻ش
  *
  * memo: ִкӡ½ĵȲĻλIDΨһʶ
- *       ڷԴ
+ *       ڷԴٺIDЧʹλ¾ʹã
+ *       ⣬ӿڰIDֱӶλ߳̿ɲö໥ȴ
+ *       ͬһִ
  */
 int32 EpsCreateHandle(uint32* pHid, EpsConnModeT mode);
 
@@ -95,7 +97,12 @@ int32 EpsDestroyHandle(uint32 hid);
  *
  * @return  ɹ1򷵻ش
  *
- * memo: עûصӿڣӿڴɹ
+ * memo: עûصӿڣӿڴɹãEpsConnectEpsDisconnect
+ *       ڼͨ߳ڻص÷شΪNULLĻصԭá
+ *       עmktDataViewArrivedNotifyֻͼͶݣٸݣ
+ *       ҲٵmktDataArrivedNotify
+ *       עmktDataBatchArrivedNotifyÿνմеۻһͶݣ
+ *       СʱEPS_OPTION_MKTDATA_BATCH_SIZE/DELAYãڻصڼЧ
  */
 int32 EpsRegisterSpi(uint32 hid, const EpsClientSpiT* pSpi);
 
@@ -105,13 +112,26 @@ int32 EpsRegisterSpi(uint32 hid, const EpsClientSpiT* pSpi);
  * @param   hid             in  - ִӲľID
  * @param   address         in  - ַַ
  *                                TCP: 196.123.1.1:8000
+ *                                TCP: 196.123.1.1:8000,196.123.1.2:8000
+ *                                TCPỰ: 196.123.1.1:8000|196.123.1.2:8000
  *                                UDP: 230.11.1.1:3333;196.123.71.1
+ *                                UDP·: 230.11.1.1:3333;196.123.71.1|230.11.1.2:3333;196.123.72.1
+ *                                SHM: /eps_md
  *
  * @return  ɹ1򷵻ش
  *
  * memo: ַָķעָķַģʽƥ䣬
  *       ӳɹͨͻ˻صconnectedNotify֪ͨû
- *       ڵEpsDisconnect()ǰӶϿԶ        
+ *       ڵEpsDisconnect()ǰӶϿԶ
+ *       UDPģʽ'|'ָEPS_LINE_MAX_NUM鲥·(A/B·)
+ *       ͬһ鰴ȡȵһͶݣ·ظ鱻
+ *       TCPģʽ'|'ָĵڶַΪȱỰȱỰỰ½ģ
+ *       ỰжϻͣͳEPS_OPTION_TCP_FAILOVER_TIMEOUTʱȱỰͶ飬
+ *       ¶ģỰжʱͨdisconnectedNotify֪ͨû
+ *       TCPģʽÿỰ','ָ4ѡʱӣ
+ *       Ƚʤ´ȳԸ÷ȫʧʱָ˱
+ *       SHMģʽĵַΪEpsSetShmPublisherõĹڴƣδ
+ *       ˳ʱ¹ҽ
  */
 int32 EpsConnect(uint32 hid, const char* address);
 
@@ -166,6 +186,234 @@ int32 EpsLogout(uint32 hid, const char* reason);
  */
 int32 EpsSubscribeMarketData(uint32 hid, EpsMktTypeT mktType);
 
+/**
+ * ָ֤ȯ
+ *
+ * @param   hid             in  - ִжĲľID
+ * @param   securityIDs     in  - ֤ȯ飬ÿ֤ȯ벻12ַ
+ * @param   count           in  - ֤ȯ65536ֻ0ʾȡ֤ȯ
+ *
+ * @return  ɹ1򷵻ش
+ *
+ * memo: ڿڰ֤ȯѶг飬ָʱ̵ã
+ *       ÿε滻ϴεĶ֤ȯͨEpsSetMdDataParserע
+ *       δע0ʱ鲻ˣδ֤ȯĿ˳mdDataֻ
+ *       ֤ȯĿӦ޸mdCountmdDataLen֤ȯ鲻Ͷݣ
+ *       ԰ȫȱ
+ */
+int32 EpsSubscribeSecurities(uint32 hid, const char* securityIDs[], uint32 count);
+
+/**
+ * ȡͳϢ
+ *
+ * @param   hid             in  - ѯľID
+ * @param   pStat           out - ͳϢ
+ *
+ * @return  ɹ1򷵻ش
+ *
+ * memo: ͳϢԾۼƣյЧ(recvPackets/recvCalls)
+ */
+int32 EpsGetStatistics(uint32 hid, EpsStatisticsT* pStat);
+
+/**
+ * þѡ
+ *
+ * @param   hid             in  - õľID
+ * @param   option          in  - ѡ
+ * @param   value           in  - ѡֵ
+ *
+ * @return  ɹ1򷵻ش
+ *
+ * memo: ѡ´νʱЧEpsConnect֮ǰã
+ *       AF_XDPҪrootȨ޻CAP_NET_ADMIN/CAP_BPFҽӿϲѹXDP
+ *       ÷ַַֻ̺߳߳Уصڷַ߳еã
+ *       ͬһгͬһַ̰߳Ͷݣصڽ߳еã
+ *       ڷ̵ַ߳ĻصеEpsDestroy
+ */
+int32 EpsSetOption(uint32 hid, EpsOptionT option, int32 value);
+
+/**
+ * ȡ鲥·TCPỰٲͳϢ
+ *
+ * @param   hid             in  - ѯľID
+ * @param   pStats          out - ·(Ự)ͳϢ飬˳EpsConnectַеһ
+ * @param   pCount          in  - 鳤
+ *                          out - ·
+ *
+ * @return  ɹ1򷵻ش
+ *
+ * memo: ͳϢÿEpsConnectʱ㣻TCPģʽͳrecvPackets/winPackets/dupPackets
+ *       ·ʤΪwinPackets/(winPackets+dupPackets)
+ *       ƽʱΪtotalLagTime/dupPackets
+ */
+int32 EpsGetLineStatistics(uint32 hid, EpsLineStatT* pStats, uint32* pCount);
+
+/**
+ * ȱڵTCPջָ
+ *
+ * @param   hid             in  - õľID
+ * @param   address         in  - ַָʽΪ"ip:port"
+ * @param   username        in  - ָỰ½û
+ * @param   password        in  - ָỰ½
+ * @param   gapThreshold    in  - ָȱֵСֵȱڽ֪ͨ
+ *
+ * @return  ɹ1򷵻ش
+ *
+ * memo: UDPģʽľ⵽ﵽֵȱںָỰȱг
+ *       طŵ鰴ȱڲmktDataArrivedNotifyٵͶݣ鲥ѽŵ
+ *       ͬͶݣȱڲָỰ׷鲥طȡǳ
+ *       ʱδȱڼunrecoveredSeqNums
+ */
+int32 EpsSetRecovery(uint32 hid, const char* address, const char* username,
+        const char* password, uint32 gapThreshold);
+
+/**
+ * ûỰ
+ *
+ * @param   hid             in  - õľID
+ * @param   pProfile        in  - Ựã½û롢г
+ *
+ * @return  ɹ1򷵻ش
+ *
+ * memo: TCPģʽľEpsConnect֮ǰãúÿ(Զ)ɹ
+ *       ½󲢽󷢳гĶ󣬲Ҫû
+ *       connectedNotifyеEpsLoginloginRspNotifyеEpsSubscribeMarketData
+ *       ½ĽͨloginRspNotifymktDataSubRspNotify֪ͨû
+ *       EpsLogoutỰʧЧ
+ */
+int32 EpsSetSessionProfile(uint32 hid, const EpsSessionProfileT* pProfile);
+
+/**
+ * ùڴ߷
+ *
+ * @param   hid             in  - õľID
+ * @param   name            in  - ڴƣ'/'ͷҲ'/'"/eps_md"
+ * @param   slotCount       in  - ߲λ(2ݣ65536)0ȡĬֵ4096
+ *
+ * @return  ɹ1򷵻ش
+ *
+ * memo: UDPTCPģʽľÿֻһΣʱرߣ
+ *       ͨżȫ鼰г״̬ѽʽд빲ڴ棬
+ *       EPS_CONNMODE_SHMԸƵEpsConnectȡ
+ *       صӿģʽͬٽռ룻˴Ӳȴȡˣ
+ *       ȡ󳬹λʱǵϢmktDataGapNotifyȱڣ
+ *       shmOverrunsͬһֻһˣѱеķռʱ
+ *       ش󣬷쳣˳ͬ滻
+ */
+int32 EpsSetShmPublisher(uint32 hid, const char* name, uint32 slotCount);
+
+/**
+ * Ӧ߳
+ *
+ * @param   hid             in  - ľID
+ * @param   timeoutNs       in  - ʱȴʱ()0ʾȴ
+ * @param   maxEvents       in  - ִеĽ01
+ *
+ * @return  ɹ1򷵻ش
+ *
+ * memo: EpsConnectǰͨEpsSetOptionEPS_OPTION_POLL_MODEΪ1ľ
+ *       ʱⲻ̣ͨ߳ա뼰ȫصڵñӿڵִ߳У
+ *       ͬһֻһ߳еñӿڣEpsDisconnectEpsDestroyHandle
+ *       ڸ߳лֹͣñӿںִУEpsLoginȲ´εñӿʱ
+ *       TCPģʽڱӿнУӿεƽtimeoutNs
+ *       ֧Linuxƽ̨select棬SHMģʽܴƣϢʱȴ
+ */
+int32 EpsPoll(uint32 hid, uint64 timeoutNs, uint32 maxEvents);
+
+/**
+ * ȡӦ̵߳ȴ
+ *
+ * @param   hid             in  - ѯľID
+ * @param   pFd             out - 
+ *
+ * @return  ɹ1򷵻ش
+ *
+ * memo: EPS_OPTION_POLL_MODEΪ1ľصepollھһ׽
+ *       (鲥·TCPỰ)ɶʱɶɼӦepoll/selectȴ
+ *       ɶtimeoutNsΪ0EpsPollٹرգ󱣳ֲ䣻
+ *       SHMģʽûпɵȴ
+ */
+int32 EpsGetFd(uint32 hid, int* pFd);
+
+/**
+ * ע
+ *
+ * @param   hid             in  - עľID
+ * @param   parser          in  - NULLʾȡ
+ *
+ * @return  ɹ1򷵻ش
+ *
+ * memo: ڰ֤ȯַַ(EPS_OPTION_DISPATCH_MODEΪ1÷ַ߳)֤ȯ
+ *       (EpsSubscribeSecurities)̶ͨ߳ÿýmdData
+ *       ֤ȯ鰴ƫƵΪصĿ(֤ȯ롢ƫơ)֤ȯַʱ
+ *       ⰴĿֳɵ֤ȯ(mdCountΪ1)֤ȯɢеַ̣߳ͬһ֤ȯ
+ *       ͬһַ̰߳Ͷݣͨ߳еãٷҲ
+ *       ñӿڣ0ĿЧ(ĿԽص)ʱ鰴гַ
+ *       ݵıû
+ *       EPS_OPTION_DISPATCH_POLICYΪ2ʱͬһ֤ȯֻµĴͶĿÿַ߳
+ *       ɵ֤ȯԼΪˮλ֤ȯڶʱȴ
+ */
+int32 EpsSetMdDataParser(uint32 hid, EpsMdDataParseCallback parser);
+
+/**
+ * Ӿڵ鶩
+ *
+ * @param   hid             in  - ӶߵľID
+ * @param   pConfig         in  - ãг֤ȯдСͶݷʽص
+ * @param   pSid            out - ID
+ *
+ * @return  ɹ1򷵻ش
+ *
+ * memo: ͬһڶԹһÿ16ߣʱӣ
+ *       ̶ͨ߳ÿֻһΣ빲üߵгͼ
+ *       ֤ȯ˺УɶԼ߳(pollModeΪ0)
+ *       EpsPollSubscriberӦ߳(pollModeΪ1)ص֤ȯע
+ *       ÿֻһΣ߶ʱöߵ鲢
+ *       droppedCountӰ߼̣ͨ߳صеpMktDataڻصڼЧ
+ *       ͶʱΪ߹ֻnotifyTimeΪʱ䣻
+ *       mktDataArrivedNotifyصճδעʱ̲ͨ߳Ϊ
+ */
+int32 EpsAddSubscriber(uint32 hid, const EpsSubscriberConfigT* pConfig, uint32* pSid);
+
+/**
+ * ɾڵ鶩
+ *
+ * @param   hid             in  - ID
+ * @param   sid             in  - ɾĶID
+ *
+ * @return  ɹ1򷵻ش
+ *
+ * memo: ȴ߳̽󷵻أδͶݵ鱻ڸö
+ *       صеãpollModeΪ1ĶֹͣEpsPollSubscriber
+ *       ʱԶɾж
+ */
+int32 EpsRemoveSubscriber(uint32 hid, uint32 sid);
+
+/**
+ * Ӧ߳Ͷݶߵ
+ *
+ * @param   hid             in  - ID
+ * @param   sid             in  - IDΪpollModeΪ1Ķ
+ * @param   maxCount        in  - Ͷݵ01
+ * @param   pCount          out - Ͷݵ0ʾΪ
+ *
+ * @return  ɹ1򷵻ش
+ *
+ * memo: ȴصڵñӿڵִ߳Уͬһֻһ߳еñӿ
+ */
+int32 EpsPollSubscriber(uint32 hid, uint32 sid, uint32 maxCount, uint32* pCount);
+
+/**
+ * ȡͳϢ
+ *
+ * @param   hid             in  - ID
+ * @param   sid             in  - ID
+ * @param   pStat           out - ͳϢ
+ *
+ * @return  ɹ1򷵻ش
+ */
+int32 EpsGetSubscriberStatistics(uint32 hid, uint32 sid, EpsSubscriberStatT* pStat);
+
 /**
  * ȡһδϢ
  *
@@ -53,6 +53,14 @@ extern "C" {
 #define EPS_USERNAME_MAX_LEN            10
 #define EPS_PASSWORD_MAX_LEN            10
 #define EPS_MKTSTATUS_LEN               8
+#define EPS_SECURITYID_MAX_LEN          12
+
+/*
+ * ƶ
+ */
+#define EPS_LINE_MAX_NUM                4       /* UDPģʽ鲥· */
+#define EPS_MDENTRY_MAX_NUM             256     /* 鰴֤ȯֵĿ */
+#define EPS_SUBSCRIBER_MAX_NUM          16      /*  */
 
 
 /**
@@ -66,6 +74,7 @@ typedef enum EpsConnModeTag
 {
     EPS_CONNMODE_UDP        = 1,        /* UDPģʽ */
     EPS_CONNMODE_TCP        = 2,        /* TCPģʽ */
+    EPS_CONNMODE_SHM        = 3,        /* ڴģʽ(ȡд빲ڴߵ) */
 } EpsConnModeT;
 
 /*
@@ -100,6 +109,24 @@ typedef enum EpsEventTypeTag
     EPS_EVENTTYPE_FATAL         = 4,    /* شϢ */
 } EpsEventTypeT;
 
+/*
+ * ѡö
+ */
+typedef enum EpsOptionTag
+{
+    EPS_OPTION_UDP_XDP_MODE     = 1,    /* UDPģʽAF_XDP: 0- 1-Զ 2-ģʽ 3-ͨģʽ */
+    EPS_OPTION_UDP_XDP_QUEUE    = 2,    /* UDPģʽAF_XDP󶨵նкţĬ0 */
+    EPS_OPTION_UDP_REORDER_WINDOW = 3,  /* UDPģʽ򻺳崰(ݱ)Ĭ0(·ʱĬ16)64 */
+    EPS_OPTION_TCP_FAILOVER_TIMEOUT = 4,/* TCPģʽỰȱỰúл()Ĭ1000 */
+    EPS_OPTION_MKTDATA_BATCH_SIZE = 5,  /* صĬ1664 */
+    EPS_OPTION_MKTDATA_BATCH_DELAY = 6, /* صȴʱ(΢)Ĭ1000ʾڽմʱͶ */
+    EPS_OPTION_POLL_MODE        = 7,    /* ʽ: 0-ͨ߳(Ĭ) 1-Ӧ̵߳EpsPollEpsConnectǰ */
+    EPS_OPTION_DISPATCH_THREADS = 8,    /* ַ߳: 0-ڽֱ߳ӻص(Ĭ) 1~8-ɷַ̻߳صEpsConnectǰ */
+    EPS_OPTION_DISPATCH_HIGH_WATER = 9, /* ÿ̵ַ߳Ķиˮλ()Ĭ102465536EpsConnectǰ */
+    EPS_OPTION_DISPATCH_POLICY  = 10,   /* ַдﵽˮλʱ: 0-̵߳ȴ(Ĭ) 1- 2-ͬһг(֤ȯʱΪͬһ֤ȯ)ֻ飬EpsConnectǰ */
+    EPS_OPTION_DISPATCH_MODE    = 11,   /* ַ߳ѡʽ: 0-г(Ĭ) 1-֤ȯ飬עEpsConnectǰ */
+} EpsOptionT;
+
 /*
  * ݽṹ
  */
@@ -115,8 +142,44 @@ typedef struct EpsMktDataTag
     uint32  mdCount;                    /* Ŀ */
     uint32  mdDataLen;                  /* ݳ */
     char    mdData[EPS_MKTDATA_MAX_LEN];/*  */
+    uint64  recvTime;                   /* ʱ1970-01-01 UTC(ȡں˽ʱ) */
+    uint64  notifyTime;                 /* ص֪ͨʱrecvTimeͬһʱӣ֮Ϊڴʱ */
 } EpsMktDataT;
 
+/*
+ * ͼ
+ *
+ * ֶѽַָڽ뻺ڻصڼЧ
+ * صغʹõûи
+ */
+typedef struct EpsMktDataViewTag
+{
+    const char* mktTime;                /* HHMMSSssʽ'\0'β */
+    EpsMktTypeT mktType;                /* г */
+    EpsTrdSesModeT tradSesMode;         /* ģʽ */
+    uint32  applID;                     /* ԴID */
+    uint64  applSeqNum;                 /*  */
+    const char* tradeDate;              /* YYYYMMDDʽ'\0'β */
+    const char* mdUpdateType;           /* ģʽ'\0'β */
+    uint32  mdCount;                    /* Ŀ */
+    uint32  mdDataLen;                  /* ݳ */
+    const char* mdData;                 /* ݣmdDataLenֽ */
+    uint64  recvTime;                   /* ʱͬEpsMktDataT */
+    uint64  notifyTime;                 /* ص֪ͨʱͬEpsMktDataT */
+} EpsMktDataViewT;
+
+/*
+ * Ŀλ
+ *
+ * ûдmdDataеֻ֤ȯĿ
+ */
+typedef struct EpsMdEntryTag
+{
+    char    securityID[EPS_SECURITYID_MAX_LEN+1];/* ֤ȯ룬'\0'β */
+    uint32  offset;                     /* ĿmdDataеʼλ */
+    uint32  length;                     /* Ŀ */
+} EpsMdEntryT;
+
 /*
  * г״̬Ϣ
  */
@@ -128,6 +191,91 @@ typedef struct EpsMktStatusTag
     uint32  totNoRelatedSym;            /* гƷ */
 } EpsMktStatusT;
 
+/*
+ * ȱϢ
+ */
+typedef struct EpsMktGapTag
+{
+    EpsMktTypeT mktType;                /* г */
+    uint32  applID;                     /* ԴID */
+    uint64  beginSeqNum;                /* ȱʧʼ */
+    uint64  endSeqNum;                  /* ȱʧ() */
+} EpsMktGapT;
+
+/*
+ * ͳϢ
+ */
+typedef struct EpsStatisticsTag
+{
+    uint64  recvCalls;                  /* ϵͳô */
+    uint64  recvPackets;                /* ݱ(UDP)ݿ(TCP) */
+    uint64  recvBytes;                  /* ֽ */
+    uint32  maxBatchSize;               /* νյõݱ */
+    uint64  xdpPackets;                 /* AF_XDPյݱ */
+    uint64  gapCount;                   /* ⵽ȱ */
+    uint64  gapSeqNums;                 /* ȱʧ */
+    uint64  gapFilledSeqNums;           /* ٵȱڵ */
+    uint64  reorderedPackets;           /* 򻺳Ͷݵ(UDP) */
+    uint64  recoveryCount;              /* TCPջָĴ(UDP) */
+    uint64  recoveredSeqNums;           /* TCPջָ(UDP) */
+    uint64  unrecoveredSeqNums;         /* ָʱ(UDP) */
+    uint64  sessionGapCount;            /* ⵽ĻỰϢȱ(TCP) */
+    uint64  resendRequests;             /* ĻỰϢط(TCP) */
+    uint64  failoverCount;              /* лȱỰĴ(TCP) */
+    uint64  failoverLatency;            /* һлʱỰͶȱỰͶݵļ(룬TCP) */
+    uint64  dispatchedCount;            /* ַ߳Ͷݵ */
+    uint64  dispatchDropped;            /* ַдﵽˮλʱ */
+    uint64  dispatchConflated;          /* ַдﵽˮλʱ鸲ǵ */
+    uint64  dispatchBlocked;            /* ַдﵽˮλʱ̵߳ȴĴ */
+    uint32  dispatchMaxDepth;           /* ַеѹ */
+    uint64  dispatchTotalLatency;       /* صۼŶʱ()dispatchedCountƽֵ */
+    uint64  dispatchMaxLatency;         /* صŶʱ() */
+    uint64  dispatchSplitCount;         /* ֤ȯֺӵĿ */
+    uint64  dispatchConflateOverflow;   /* ֤ȯϲλΪȴӵĿ */
+    uint64  filteredMktData;            /* 򲻺֤ȯδͶݵ */
+    uint64  filteredMdEntries;          /* ֤ȯ˳Ŀ */
+    uint64  shmPublished;               /* д빲ڴߵϢ() */
+    uint64  shmOverruns;                /* ڷˡǶϢ(SHM) */
+} EpsStatisticsT;
+
+/*
+ * 鲥·/TCPỰٲͳϢ
+ */
+typedef struct EpsLineStatTag
+{
+    uint64  recvPackets;                /* ·յ */
+    uint64  winPackets;                 /* ··ﲢͶݵ */
+    uint64  dupPackets;                 /* ·· */
+    uint64  lostSeqNums;                /* ·ȱʧ */
+    uint64  totalLeadTime;              /* ȵʱȺ·ۼʱ() */
+    uint64  totalLagTime;               /* ʱȵ·ۼʱ() */
+    uint64  maxLagTime;                 /* ʱȵ·ʱ() */
+} EpsLineStatT;
+
+/*
+ * Ự(TCP)
+ */
+typedef struct EpsSessionProfileTag
+{
+    char        username[EPS_USERNAME_MAX_LEN+1];   /* ½û */
+    char        password[EPS_PASSWORD_MAX_LEN+1];   /* ½ */
+    uint16      heartbeatIntl;                      /* () */
+    uint32      mktTypeCount;                       /* гEPS_MKTTYPE_NUM */
+    EpsMktTypeT mktTypes[EPS_MKTTYPE_NUM];          /* г */
+} EpsSessionProfileT;
+
+/*
+ * ͳϢ
+ */
+typedef struct EpsSubscriberStatTag
+{
+    uint64  deliveredCount;             /* Ͷݸߵ */
+    uint64  droppedCount;               /* ߶ */
+    uint64  filteredMktData;            /* 򲻺֤ȯδӵ */
+    uint64  filteredMdEntries;          /* ֤ȯ˳Ŀ */
+    uint32  maxDepth;                   /* ߶еѹ */
+} EpsSubscriberStatT;
+
 
 /*
  * ûصӿں
@@ -140,6 +288,11 @@ typedef void (*EpsMktDataSubRspCallback)(uint32 hid, EpsMktTypeT mktType, int32
 typedef void (*EpsMktDataArrivedCallback)(uint32 hid, const EpsMktDataT* pMktData);
 typedef void (*EpsMktStatusChangedCallback)(uint32 hid, const EpsMktStatusT* pMktStatus);
 typedef void (*EpsEventOccurredCallback)(uint32 hid, EpsEventTypeT eventType, int32 eventCode, const char* eventText);
+typedef void (*EpsMktDataGapCallback)(uint32 hid, const EpsMktGapT* pMktGap);
+typedef void (*EpsMktDataViewArrivedCallback)(uint32 hid, const EpsMktDataViewT* pMktDataView);
+typedef void (*EpsMktDataBatchArrivedCallback)(uint32 hid, const EpsMktDataT* items[], uint32 count);
+typedef uint32 (*EpsMdDataParseCallback)(uint32 hid, const EpsMktDataT* pMktData, EpsMdEntryT* pEntries, uint32 maxCount);
+typedef void (*EpsSubscriberMktDataCallback)(uint32 hid, uint32 sid, const EpsMktDataT* pMktData);
 
 /*
  * ûصӿ
@@ -154,8 +307,24 @@ typedef struct EpsClientSpiTag
     EpsMktDataArrivedCallback   mktDataArrivedNotify;/* ݵ֪ͨ */
     EpsMktStatusChangedCallback mktStatusChangedNotify;/* г״̬仯֪ͨ */
     EpsEventOccurredCallback    eventOccurredNotify;  /* ¼֪ͨ */
+    EpsMktDataGapCallback       mktDataGapNotify;    /* ȱ֪ͨ */
+    EpsMktDataViewArrivedCallback mktDataViewArrivedNotify;/* ͼ֪ͨעmktDataArrivedNotify */
+    EpsMktDataBatchArrivedCallback mktDataBatchArrivedNotify;/* 鵽֪ͨע֪ͨ */
 } EpsClientSpiT;
 
+/*
+ * 
+ */
+typedef struct EpsSubscriberConfigTag
+{
+    EpsMktTypeT mktType;                /* гͣEPS_MKTTYPE_ALLʾѶĵг */
+    const char** securityIDs;           /* ֤ȯ飬עNULLʾ֤ȯ */
+    uint32  securityCount;              /* ֤ȯ */
+    uint32  queueSize;                  /* дС()0ȡĬֵ102465536 */
+    uint32  pollMode;                   /* 0-ɶ̻߳ص(Ĭ) 1-Ӧ̵߳EpsPollSubscriberص */
+    EpsSubscriberMktDataCallback mktDataArrivedNotify;  /* ݵ֪ͨ */
+} EpsSubscriberConfigT;
+
 #ifdef __cplusplus
 }
 #endif
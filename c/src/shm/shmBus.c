@@ -0,0 +1,610 @@
+/*
+ * Copyright (C) 2013, 2014 Shanghai Stock Exchange (SSE), Shanghai, China
+ * All Rights Reserved.
+ */
+
+/**
+ * @file    shmBus.c
+ *
+ * ڴʵļ
+ *
+ * @version $Id
+ * @since   2026/10/18
+ */
+
+/**
+MODIFICATION HISTORY:
+<pre>
+================================================================================
+DD-MMM-YYYY INIT.    SIR    Modification Description
+----------- -------- ------ ----------------------------------------------------
+18-OCT-2026                 
+================================================================================
+</pre>
+*/
+
+/**
+ * ͷļ
+ */
+
+#include <stddef.h>
+
+#include "common.h"
+#include "epsTypes.h"
+#include "errlib.h"
+#include "errcode.h"
+#include "atomic.h"
+
+#if defined(__LINUX__) || defined(__HPUX__)
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#include "shmBus.h"
+
+
+/**
+ * ڲ
+ */
+
+static ResCodeT CheckName(const char* name);
+static ResCodeT UnlinkStaleBus(const char* name);
+static BOOL IsPublisherAlive(EpsShmBusHeaderT* pHeader);
+static void SkipOverrun(EpsShmBusT* pBus, uint64 writeSeq);
+
+
+/**
+ * ӿںʵ
+ */
+
+/**
+ * ڴ()
+ *
+ * ͬľѹرջ䷢˳(쳣˳)ʱȽ´
+ * ԹҽӾߵĶȡ˼⵽ɷ˳¹ҽӣߵķʱش
+ *
+ * @param   pBus                in  - ߶
+ * @param   name                in  - ڴƣ'/'ͷ"/eps_md"
+ * @param   slotCount           in  - λ(2)0ȡĬֵ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ *
+ * memo: ͬһͬʱֻһ
+ */
+ResCodeT CreateShmBus(EpsShmBusT* pBus, const char* name, uint32 slotCount)
+{
+    int  fd = -1;
+    BOOL isCreated = FALSE;
+
+    TRY
+    {
+        THROW_ERROR(CheckName(name));
+
+        if (slotCount == 0)
+        {
+            slotCount = EPS_SHMBUS_SLOT_NUM_DEFAULT;
+        }
+        if (slotCount > EPS_SHMBUS_SLOT_NUM_MAX || (slotCount & (slotCount - 1)) != 0)
+        {
+            THROW_ERROR(ERCD_EPS_INVALID_PARM, "slotCount");
+        }
+
+#if defined(__LINUX__) || defined(__HPUX__)
+        uint64 mapSize = sizeof(EpsShmBusHeaderT) + (uint64)slotCount * sizeof(EpsShmBusSlotT);
+
+        THROW_ERROR(UnlinkStaleBus(name));
+        fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0644);
+        if (fd < 0)
+        {
+            int lstErrno = SYS_ERRNO;
+            THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, EpsGetSystemError(lstErrno));
+        }
+        isCreated = TRUE;
+
+        /* չΪ0λʼΪ */
+        struct stat fileStat;
+        if (ftruncate(fd, (off_t)mapSize) != 0 || fstat(fd, &fileStat) != 0)
+        {
+            int lstErrno = SYS_ERRNO;
+            THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, EpsGetSystemError(lstErrno));
+        }
+
+        void* pAddr = mmap(NULL, (size_t)mapSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (pAddr == MAP_FAILED)
+        {
+            int lstErrno = SYS_ERRNO;
+            THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, EpsGetSystemError(lstErrno));
+        }
+
+        EpsShmBusHeaderT* pHeader = (EpsShmBusHeaderT*)pAddr;
+        pHeader->version    = EPS_SHMBUS_VERSION;
+        pHeader->slotCount  = slotCount;
+        pHeader->slotSize   = sizeof(EpsShmBusSlotT);
+        pHeader->pid        = (int32)getpid();
+        pHeader->isClosed   = FALSE;
+        pHeader->createTime = EpsGetTimestamp();
+        pHeader->writeSeq   = 0;
+        EpsAtomicStore(&pHeader->magic, EPS_SHMBUS_MAGIC);
+
+        snprintf(pBus->name, sizeof(pBus->name), "%s", name);
+        pBus->isPublisher  = TRUE;
+        pBus->pHeader      = pHeader;
+        pBus->slots        = (EpsShmBusSlotT*)((char*)pAddr + sizeof(EpsShmBusHeaderT));
+        pBus->mask         = slotCount - 1;
+        pBus->mapSize      = mapSize;
+        pBus->inode        = (uint64)fileStat.st_ino;
+        pBus->nextSeq      = 0;
+        pBus->overrunCount = 0;
+#else
+        THROW_ERROR(ERCD_EPS_UNSUPPORTED_OPTION, "shared memory bus");
+#endif
+    }
+    CATCH
+    {
+#if defined(__LINUX__) || defined(__HPUX__)
+        if (isCreated)
+        {
+            shm_unlink(name);
+        }
+#endif
+    }
+    FINALLY
+    {
+#if defined(__LINUX__) || defined(__HPUX__)
+        if (fd >= 0)
+        {
+            close(fd);
+        }
+#endif
+
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ҽӹڴ(ȡ)
+ *
+ * ҽӺӷһϢʼȡطŹҽǰѷϢ
+ *
+ * @param   pBus                in  - ߶
+ * @param   name                in  - ڴ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT AttachShmBus(EpsShmBusT* pBus, const char* name)
+{
+    int   fd = -1;
+    void* pAddr = NULL;
+    uint64 mapSize = 0;
+
+    TRY
+    {
+        THROW_ERROR(CheckName(name));
+
+#if defined(__LINUX__) || defined(__HPUX__)
+        fd = shm_open(name, O_RDONLY, 0);
+        if (fd < 0)
+        {
+            int lstErrno = SYS_ERRNO;
+            THROW_ERROR(ERCD_EPS_INVALID_SHMBUS, name, EpsGetSystemError(lstErrno));
+        }
+
+        struct stat fileStat;
+        if (fstat(fd, &fileStat) != 0)
+        {
+            int lstErrno = SYS_ERRNO;
+            THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, EpsGetSystemError(lstErrno));
+        }
+
+        mapSize = (uint64)fileStat.st_size;
+        if (mapSize < sizeof(EpsShmBusHeaderT))
+        {
+            THROW_ERROR(ERCD_EPS_INVALID_SHMBUS, name, "not initialized");
+        }
+
+        pAddr = mmap(NULL, (size_t)mapSize, PROT_READ, MAP_SHARED, fd, 0);
+        if (pAddr == MAP_FAILED)
+        {
+            pAddr = NULL;
+            int lstErrno = SYS_ERRNO;
+            THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, EpsGetSystemError(lstErrno));
+        }
+
+        /* ˴ʱʶδд룬Ժ¹ҽ */
+        EpsShmBusHeaderT* pHeader = (EpsShmBusHeaderT*)pAddr;
+        if (EpsAtomicLoad(&pHeader->magic) != EPS_SHMBUS_MAGIC)
+        {
+            THROW_ERROR(ERCD_EPS_INVALID_SHMBUS, name, "not initialized");
+        }
+
+        uint32 slotCount = pHeader->slotCount;
+        if (pHeader->version != EPS_SHMBUS_VERSION ||
+            pHeader->slotSize != sizeof(EpsShmBusSlotT) ||
+            slotCount == 0 || (slotCount & (slotCount - 1)) != 0 ||
+            mapSize < sizeof(EpsShmBusHeaderT) + (uint64)slotCount * sizeof(EpsShmBusSlotT))
+        {
+            THROW_ERROR(ERCD_EPS_INVALID_SHMBUS, name, "layout mismatch");
+        }
+
+        if (EpsAtomicLoad(&pHeader->isClosed))
+        {
+            THROW_ERROR(ERCD_EPS_SHMBUS_CLOSED);
+        }
+
+        snprintf(pBus->name, sizeof(pBus->name), "%s", name);
+        pBus->isPublisher = FALSE;
+        pBus->pHeader     = pHeader;
+        pBus->slots       = (EpsShmBusSlotT*)((char*)pAddr + sizeof(EpsShmBusHeaderT));
+        pBus->mask        = slotCount - 1;
+        pBus->mapSize     = mapSize;
+        pBus->inode       = (uint64)fileStat.st_ino;
+        pBus->nextSeq     = EpsAtomicLoad(&pHeader->writeSeq) + 1;
+        pAddr = NULL;
+#else
+        THROW_ERROR(ERCD_EPS_UNSUPPORTED_OPTION, "shared memory bus");
+#endif
+    }
+    CATCH
+    {
+#if defined(__LINUX__) || defined(__HPUX__)
+        if (pAddr != NULL)
+        {
+            munmap(pAddr, (size_t)mapSize);
+        }
+#endif
+    }
+    FINALLY
+    {
+#if defined(__LINUX__) || defined(__HPUX__)
+        if (fd >= 0)
+        {
+            close(fd);
+        }
+#endif
+
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * رչڴ
+ *
+ * ùرձ֪ͨȡˣδ·´ʱ
+ *
+ * @param   pBus                in  - ߶
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT CloseShmBus(EpsShmBusT* pBus)
+{
+    TRY
+    {
+        if (pBus->pHeader == NULL)
+        {
+            THROW_RESCODE(NO_ERR);
+        }
+
+#if defined(__LINUX__) || defined(__HPUX__)
+        if (pBus->isPublisher)
+        {
+            EpsAtomicStore(&pBus->pHeader->isClosed, TRUE);
+
+            int fd = shm_open(pBus->name, O_RDONLY, 0);
+            if (fd >= 0)
+            {
+                struct stat fileStat;
+                if (fstat(fd, &fileStat) == 0 && (uint64)fileStat.st_ino == pBus->inode)
+                {
+                    shm_unlink(pBus->name);
+                }
+                close(fd);
+            }
+        }
+
+        munmap(pBus->pHeader, (size_t)pBus->mapSize);
+#endif
+
+        pBus->pHeader = NULL;
+        pBus->slots = NULL;
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * Ϣڴ
+ *
+ * ֻϢЧ֣˴Ӳȴȡˣ豣֤ͬһʱֻһ̷߳
+ *
+ * @param   pBus                in  - ߶()
+ * @param   pMsg                in  - ȫг״̬Ϣͺ
+ * @param   recvTime            in  - ʱ()
+ */
+void PublishShmBus(EpsShmBusT* pBus, const StepMessageT* pMsg, uint64 recvTime)
+{
+    uint32 bodyLen = 0;
+    if (pMsg->msgType == STEP_MSGTYPE_MD_SNAPSHOT)
+    {
+        const MDSnapshotFullRefreshRecordT* pRecord = (const MDSnapshotFullRefreshRecordT*)pMsg->body;
+        uint32 mdDataLen = (pRecord->mdDataLen < STEP_MD_DATA_MAX_LEN) ? pRecord->mdDataLen : STEP_MD_DATA_MAX_LEN;
+        bodyLen = (uint32)offsetof(MDSnapshotFullRefreshRecordT, mdData) + mdDataLen;
+    }
+    else if (pMsg->msgType == STEP_MSGTYPE_TRADING_STATUS)
+    {
+        bodyLen = sizeof(TradingStatusRecordT);
+    }
+    else
+    {
+        return;
+    }
+
+    EpsShmBusHeaderT* pHeader = pBus->pHeader;
+    uint64 seq = EpsAtomicLoadRelaxed(&pHeader->writeSeq) + 1;
+    EpsShmBusSlotT* pSlot = &pBus->slots[seq & pBus->mask];
+
+    EpsAtomicStoreRelaxed(&pSlot->seq, seq * 2 - 1);
+    EpsAtomicFenceRelease();
+
+    pSlot->recvTime = recvTime;
+    pSlot->msgType  = (uint32)pMsg->msgType;
+    pSlot->bodyLen  = bodyLen;
+    memcpy(pSlot->body, pMsg->body, bodyLen);
+
+    EpsAtomicStore(&pSlot->seq, seq * 2);
+    EpsAtomicStore(&pHeader->writeSeq, seq);
+}
+
+/**
+ * ӹڴ߶ȡһϢ
+ *
+ * Ϣ帴ƵpMsgٴУڼλʱ
+ * 󳬹λʱѱǵϢoverrunCount
+ *
+ * @param   pBus                in  - ߶(ȡ)
+ * @param   pMsg                out - ϢдmsgTypeϢ
+ * @param   pRecvTime           out - ˽ʱ()
+ *
+ * @return  ȡϢTRUEϢFALSE
+ */
+BOOL ReadShmBus(EpsShmBusT* pBus, StepMessageT* pMsg, uint64* pRecvTime)
+{
+    EpsShmBusHeaderT* pHeader = pBus->pHeader;
+
+    for (;;)
+    {
+        uint64 writeSeq = EpsAtomicLoad(&pHeader->writeSeq);
+        uint64 seq = pBus->nextSeq;
+        if (seq > writeSeq)
+        {
+            return FALSE;
+        }
+
+        if (writeSeq - seq > pBus->mask)
+        {
+            SkipOverrun(pBus, writeSeq);
+            continue;
+        }
+
+        const EpsShmBusSlotT* pSlot = &pBus->slots[seq & pBus->mask];
+        uint64 slotSeq = EpsAtomicLoad(&pSlot->seq);
+        if (slotSeq != seq * 2)
+        {
+            if (slotSeq < seq * 2)
+            {
+                return FALSE;
+            }
+
+            SkipOverrun(pBus, writeSeq);
+            continue;
+        }
+
+        uint32 msgType  = pSlot->msgType;
+        uint32 bodyLen  = pSlot->bodyLen;
+        uint64 recvTime = pSlot->recvTime;
+        if (bodyLen > EPS_SHMBUS_BODY_MAX_LEN)
+        {
+            bodyLen = EPS_SHMBUS_BODY_MAX_LEN;
+        }
+        memcpy(pMsg->body, pSlot->body, bodyLen);
+
+        EpsAtomicFenceAcquire();
+        if (EpsAtomicLoadRelaxed(&pSlot->seq) != slotSeq)
+        {
+            SkipOverrun(pBus, writeSeq);
+            continue;
+        }
+
+        pMsg->msgType = (StepMsgTypeT)msgType;
+        if (msgType == STEP_MSGTYPE_MD_SNAPSHOT)
+        {
+            MDSnapshotFullRefreshRecordT* pRecord = (MDSnapshotFullRefreshRecordT*)pMsg->body;
+            if (pRecord->mdDataLen > STEP_MD_DATA_MAX_LEN)
+            {
+                pRecord->mdDataLen = STEP_MD_DATA_MAX_LEN;
+            }
+            pRecord->mdData[pRecord->mdDataLen] = 0x00;
+        }
+
+        *pRecvTime = recvTime;
+        pBus->nextSeq = seq + 1;
+        return TRUE;
+    }
+}
+
+/**
+ * жϹڴߵķǷڷ
+ *
+ * @param   pBus                in  - ߶(ȡ)
+ *
+ * @return  δرҷ̴ڷTRUE򷵻FALSE
+ */
+BOOL IsShmBusAlive(EpsShmBusT* pBus)
+{
+    if (pBus->pHeader == NULL)
+    {
+        return FALSE;
+    }
+
+    return IsPublisherAlive(pBus->pHeader);
+}
+
+/**
+ * жϹڴǷѴ
+ *
+ * @param   pBus                in  - ߶
+ *
+ * @return  ѴѹҽӷTRUE򷵻FALSE
+ */
+BOOL IsShmBusOpened(EpsShmBusT* pBus)
+{
+    return (pBus->pHeader != NULL);
+}
+
+
+/**
+ * ڲʵ
+ */
+
+/**
+ * У鹲ڴ
+ *
+ * @param   name                in  - ڴ
+ *
+ * @return  ϷNO_ERR򷵻ش
+ */
+static ResCodeT CheckName(const char* name)
+{
+    TRY
+    {
+        if (name == NULL || name[0] != '/' || name[1] == 0x00 ||
+            strlen(name) > EPS_SHMBUS_NAME_MAX_LEN || strchr(name + 1, '/') != NULL)
+        {
+            THROW_ERROR(ERCD_EPS_INVALID_PARM, "name");
+        }
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ͬߵ
+ *
+ * ߵķʱƣش󣻾ѹرա˳
+ * δɳʼ(̴˳)ʱ
+ *
+ * @param   name                in  - ڴ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+static ResCodeT UnlinkStaleBus(const char* name)
+{
+    int   fd = -1;
+    void* pAddr = NULL;
+
+    TRY
+    {
+#if defined(__LINUX__) || defined(__HPUX__)
+        fd = shm_open(name, O_RDONLY, 0);
+        if (fd < 0)
+        {
+            /* ߲ڣȨȡʱɺ */
+            shm_unlink(name);
+            THROW_RESCODE(NO_ERR);
+        }
+
+        struct stat fileStat;
+        if (fstat(fd, &fileStat) == 0 && (uint64)fileStat.st_size >= sizeof(EpsShmBusHeaderT))
+        {
+            pAddr = mmap(NULL, sizeof(EpsShmBusHeaderT), PROT_READ, MAP_SHARED, fd, 0);
+            if (pAddr == MAP_FAILED)
+            {
+                pAddr = NULL;
+                int lstErrno = SYS_ERRNO;
+                THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, EpsGetSystemError(lstErrno));
+            }
+
+            if (IsPublisherAlive((EpsShmBusHeaderT*)pAddr))
+            {
+                THROW_ERROR(ERCD_EPS_INVALID_SHMBUS, name, "publisher is running");
+            }
+        }
+
+        shm_unlink(name);
+#endif
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+#if defined(__LINUX__) || defined(__HPUX__)
+        if (pAddr != NULL)
+        {
+            munmap(pAddr, sizeof(EpsShmBusHeaderT));
+        }
+        if (fd >= 0)
+        {
+            close(fd);
+        }
+#endif
+
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * жߵķǷ
+ *
+ * @param   pHeader             in  - ͷ
+ *
+ * @return  δرҷ̴ڷTRUE򷵻FALSE
+ */
+static BOOL IsPublisherAlive(EpsShmBusHeaderT* pHeader)
+{
+    if (EpsAtomicLoad(&pHeader->isClosed))
+    {
+        return FALSE;
+    }
+
+#if defined(__LINUX__) || defined(__HPUX__)
+    /* ̺δдʱΪδУȨ򷢲̷ź(EPERM)ʱԴ */
+    if (pHeader->pid <= 0 || (kill((pid_t)pHeader->pid, 0) != 0 && SYS_ERRNO == ESRCH))
+    {
+        return FALSE;
+    }
+#endif
+
+    return TRUE;
+}
+
+/**
+ * ѱǵϢ
+ *
+ * ϢλΪȡ׷ǰһ
+ *
+ * @param   pBus                in  - ߶(ȡ)
+ * @param   writeSeq            in  - Ϣ
+ */
+static void SkipOverrun(EpsShmBusT* pBus, uint64 writeSeq)
+{
+    uint64 seq = pBus->nextSeq;
+    uint64 newSeq = writeSeq - (pBus->mask >> 1);
+    if (newSeq <= seq)
+    {
+        newSeq = seq + 1;
+    }
+
+    EpsAtomicCounterAdd(&pBus->overrunCount, newSeq - seq);
+    pBus->nextSeq = newSeq;
+}
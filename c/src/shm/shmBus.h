@@ -0,0 +1,158 @@
+/*
+ * Copyright (C) 2013, 2014 Shanghai Stock Exchange (SSE), Shanghai, China
+ * All Rights Reserved.
+ */
+
+/**
+ * @file    shmBus.h
+ *
+ * ڴ߶ͷļ
+ *
+ * @version $Id
+ * @since   2026/10/18
+ */
+
+/**
+MODIFICATION HISTORY:
+<pre>
+================================================================================
+DD-MMM-YYYY INIT.    SIR    Modification Description
+----------- -------- ------ ----------------------------------------------------
+18-OCT-2026                 
+================================================================================
+</pre>
+*/
+
+#ifndef EPS_SHM_BUS_H
+#define EPS_SHM_BUS_H
+
+/**
+ * ͷļ
+ */
+
+#include "common.h"
+#include "epsTypes.h"
+#include "atomic.h"
+#include "stepMessage.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**
+ * 궨
+ */
+
+#define EPS_SHMBUS_MAGIC                0x42535045  /* ߱ʶ("EPSB") */
+#define EPS_SHMBUS_VERSION              1           /* ְ߲汾 */
+#define EPS_SHMBUS_NAME_MAX_LEN         64          /* ڴ󳤶 */
+#define EPS_SHMBUS_SLOT_NUM_DEFAULT     4096        /* Ĭϲλ */
+#define EPS_SHMBUS_SLOT_NUM_MAX         65536       /* λ */
+#define EPS_SHMBUS_BODY_MAX_LEN         (sizeof(MDSnapshotFullRefreshRecordT))  /* λϢ󳤶 */
+
+
+/**
+ * Ͷ
+ */
+
+/*
+ * ͷ(ڴ)
+ *
+ * ˳ʼֶκдmagicȡ˾ݴжѿ
+ */
+typedef struct EpsShmBusHeaderTag
+{
+    uint32          magic;                  /* ߱ʶ */
+    uint32          version;                /* ְ߲汾 */
+    uint32          slotCount;              /* λ(2) */
+    uint32          slotSize;               /* λȣȡ˾ݴУ鲼 */
+    int32           pid;                    /* IDȡ˾ݴ˼ⷢ˳ */
+    uint32          isClosed;               /* ѹرձ */
+    uint64          createTime;             /* ʱ() */
+
+    uint64          writeSeq EPS_CACHELINE_ALIGNED; /* ѷϢϢ */
+} EpsShmBusHeaderT;
+
+/*
+ * ߲λ(ڴ)
+ *
+ * nϢд(n & )λдڼseqΪ2n-1дΪ2n
+ * ȡ˸ǰζͬһżŲȡɹ
+ */
+typedef struct EpsShmBusSlotTag
+{
+    uint64          seq EPS_CACHELINE_ALIGNED;  /*  */
+    uint64          recvTime;               /* ˽ʱ() */
+    uint32          msgType;                /* STEPϢͣȫ鼰г״̬ */
+    uint32          bodyLen;                /* ϢЧ */
+    char            body[EPS_SHMBUS_BODY_MAX_LEN];  /* ѽϢ */
+} EpsShmBusSlotT;
+
+/*
+ * ڴ(ڶ)
+ *
+ * һˡȡ˵Ĺ㲥˴Ӳȴȡˣ
+ * ȡ󳬹λʱѱǵϢݿⰴűȱ
+ */
+typedef struct EpsShmBusTag
+{
+    char            name[EPS_SHMBUS_NAME_MAX_LEN+1];/* ڴ */
+    BOOL            isPublisher;            /* ˱ */
+
+    EpsShmBusHeaderT* pHeader;              /* ͷNULLʾδ */
+    EpsShmBusSlotT* slots;                  /* λ */
+    uint32          mask;                   /* λ */
+    uint64          mapSize;                /* ӳ䳤 */
+    uint64          inode;                  /* ڴļinode˹رʱݴȷδ·滻 */
+
+    uint64          nextSeq;                /* һȡϢ(ȡ) */
+    uint64          overrunCount;           /* ǶϢ(ȡ) */
+} EpsShmBusT;
+
+
+/**
+ * 
+ */
+
+/*
+ * ڴ()
+ */
+ResCodeT CreateShmBus(EpsShmBusT* pBus, const char* name, uint32 slotCount);
+
+/*
+ * ҽӹڴ(ȡ)
+ */
+ResCodeT AttachShmBus(EpsShmBusT* pBus, const char* name);
+
+/*
+ * رչڴ
+ */
+ResCodeT CloseShmBus(EpsShmBusT* pBus);
+
+/*
+ * Ϣڴ
+ */
+void PublishShmBus(EpsShmBusT* pBus, const StepMessageT* pMsg, uint64 recvTime);
+
+/*
+ * ӹڴ߶ȡһϢ
+ */
+BOOL ReadShmBus(EpsShmBusT* pBus, StepMessageT* pMsg, uint64* pRecvTime);
+
+/*
+ * жϹڴߵķǷڷ
+ */
+BOOL IsShmBusAlive(EpsShmBusT* pBus);
+
+/*
+ * жϹڴǷѴ
+ */
+BOOL IsShmBusOpened(EpsShmBusT* pBus);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* EPS_SHM_BUS_H */
@@ -0,0 +1,815 @@
+/*
+ * Copyright (C) 2013, 2014 Shanghai Stock Exchange (SSE), Shanghai, China
+ * All Rights Reserved.
+ */
+
+/**
+ * @file    shmChannel.c
+ *
+ * ڴͨʵļ
+ *
+ * @version $Id
+ * @since   2026/10/18
+ */
+
+/**
+MODIFICATION HISTORY:
+<pre>
+================================================================================
+DD-MMM-YYYY INIT.    SIR    Modification Description
+----------- -------- ------ ----------------------------------------------------
+18-OCT-2026                 
+================================================================================
+</pre>
+*/
+
+/**
+ * ͷļ
+ */
+
+#include <stddef.h>
+
+#include "common.h"
+#include "epsTypes.h"
+#include "errlib.h"
+#include "errcode.h"
+#include "atomic.h"
+
+#include "shmChannel.h"
+
+/**
+ * 궨
+ */
+
+#define EPS_EVENTQUEUE_SIZE                      128    /* ¼гȣΪ2 */
+#define EPS_RECV_BATCH_MAX_ROUNDS                4      /* νմȡ */
+#define EPS_SHM_IDLE_SPIN_COUNT                  1024   /* Ϣʱǰ */
+#define EPS_SHM_IDLE_INTL                        100    /* Ϣʱʱ䣬λ: ΢ */
+
+
+/**
+ * ڲ
+ */
+
+static void* ChannelTask(void* arg);
+
+static ResCodeT HandleEvent(EpsShmChannelT* pChannel);
+static ResCodeT ReceiveData(EpsShmChannelT* pChannel, uint64 timeout);
+static uint32 ReceiveBatch(EpsShmChannelT* pChannel);
+static ResCodeT ClearEventQueue(EpsShmChannelT* pChannel);
+
+static BOOL IsChannelInited(EpsShmChannelT * pChannel);
+static BOOL IsChannelStarted(EpsShmChannelT* pChannel);
+static BOOL IsChannelConnected(EpsShmChannelT * pChannel);
+
+static void OnChannelConnected(void* pListener);
+static void OnChannelDisconnected(void* pListener, ResCodeT result, const char* reason);
+static void OnChannelReceived(void* pListener, ResCodeT result, const EpsShmRecordT* pRecords, uint32 recordCount);
+static void OnChannelEventOccurred(void* pListener, EpsShmChannelEventT* pEvent);
+
+
+/**
+ * ʵ
+ */
+
+/**
+ * ʼڴͨ
+ *
+ * @param   pChannel            in  - ͨ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT InitShmChannel(EpsShmChannelT* pChannel)
+{
+    TRY
+    {
+        if (IsChannelInited(pChannel))
+        {
+            THROW_ERROR(ERCD_EPS_DUPLICATE_INITED, "channel");
+        }
+
+        memset(pChannel->name, 0x00, sizeof(pChannel->name));
+        memset(&pChannel->bus, 0x00, sizeof(pChannel->bus));
+        pChannel->tid = 0;
+        EpsAtomicStore(&pChannel->canStop, TRUE);
+        EpsAtomicStore(&pChannel->status, EPS_SHMCHANNEL_STATUS_STOP);
+        memset(&pChannel->stat, 0x00, sizeof(pChannel->stat));
+        pChannel->isManual = FALSE;
+        pChannel->reconnectTime = 0;
+        pChannel->notifyTime = 0;
+        THROW_ERROR(InitRingQueue(&pChannel->eventQueue, EPS_RINGQUEUE_TYPE_MPSC,
+                EPS_EVENTQUEUE_SIZE, sizeof(EpsShmChannelEventT)));
+
+        EpsShmChannelListenerT listener =
+        {
+            NULL,
+            OnChannelConnected,
+            OnChannelDisconnected,
+            OnChannelReceived,
+            OnChannelEventOccurred
+        };
+        pChannel->listener = listener;
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ʼڴͨ
+ *
+ * @param   pChannel            in  - ڴͨ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT UninitShmChannel(EpsShmChannelT* pChannel)
+{
+    TRY
+    {
+        if (! IsChannelInited(pChannel))
+        {
+            THROW_RESCODE(NO_ERR);
+        }
+
+        CloseShmChannel(pChannel);
+        UninitRingQueue(&pChannel->eventQueue);
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ڴͨ
+ *
+ * @param   pChannel            in  - ڴͨ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT StartupShmChannel(EpsShmChannelT* pChannel)
+{
+    TRY
+    {
+        if (IsChannelStarted(pChannel))
+        {
+            if (EpsAtomicLoad(&pChannel->status) == EPS_SHMCHANNEL_STATUS_IDLE)
+            {
+                EpsAtomicStore(&pChannel->status, EPS_SHMCHANNEL_STATUS_WORK);
+                THROW_RESCODE(NO_ERR);
+            }
+            else
+            {
+                THROW_ERROR(ERCD_EPS_DUPLICATE_CONNECT);
+            }
+        }
+
+        pChannel->reconnectTime = 0;
+        pChannel->notifyTime = EpsGetTimestamp();
+        EpsAtomicStore(&pChannel->canStop, FALSE);
+        EpsAtomicStore(&pChannel->status, EPS_SHMCHANNEL_STATUS_WORK);
+
+        /* Ӧ߳ģʽӦ̵߳PollShmChannelͨ߳ */
+        if (pChannel->isManual)
+        {
+            THROW_RESCODE(NO_ERR);
+        }
+
+#if defined(__WINDOWS__)
+        DWORD tid = 0;
+        HANDLE thread = CreateThread(NULL, 0, (LPTHREAD_START_ROUTINE)ChannelTask,
+            (LPVOID)pChannel, 0, (LPDWORD)&tid);
+        if (tid == 0)
+        {
+            EpsAtomicStore(&pChannel->status, EPS_SHMCHANNEL_STATUS_STOP);
+            int lstErrno = SYS_ERRNO;
+            THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, EpsGetSystemError(lstErrno));
+        }
+        pChannel->thread = thread;
+        pChannel->tid = tid;
+#endif
+
+#if defined(__LINUX__) || defined(__HPUX__)
+        pthread_t tid;
+        int result = pthread_create(&tid, NULL, ChannelTask, (void*)pChannel);
+        if (result != 0)
+        {
+            EpsAtomicStore(&pChannel->status, EPS_SHMCHANNEL_STATUS_STOP);
+            THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, EpsGetSystemError(SYS_ERRNO));
+        }
+        pChannel->tid = tid;
+#endif
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ֹͣڴͨ
+ *
+ * @param   pChannel            in  - ڴͨ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT ShutdownShmChannel(EpsShmChannelT* pChannel)
+{
+    TRY
+    {
+        if (! IsChannelStarted(pChannel))
+        {
+            THROW_RESCODE(NO_ERR);
+        }
+
+        /* Ӧ߳ģʽɵֱ߳ӹرգȷʱûִ߳PollShmChannel */
+        if (pChannel->isManual && pChannel->tid == 0)
+        {
+            CloseShmChannel(pChannel);
+
+            EpsAtomicStore(&pChannel->canStop, TRUE);
+            EpsAtomicStore(&pChannel->status, EPS_SHMCHANNEL_STATUS_STOP);
+            THROW_RESCODE(NO_ERR);
+        }
+
+#if defined(__WINDOWS__)
+        if (pChannel->tid != GetCurrentThreadId())
+#endif
+
+#if defined(__LINUX__) || defined(__HPUX__)
+        if (pChannel->tid != pthread_self())
+#endif
+        {
+             EpsAtomicStore(&pChannel->canStop, TRUE);
+        }
+        else
+        {
+            if (EpsAtomicLoad(&pChannel->status) == EPS_SHMCHANNEL_STATUS_WORK)
+            {
+                CloseShmChannel(pChannel);
+            }
+
+            EpsAtomicStore(&pChannel->status, EPS_SHMCHANNEL_STATUS_IDLE);
+        }
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ȴڴͨ
+ *
+ * @param   pChannel            in  - ڴͨ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT JoinShmChannel(EpsShmChannelT* pChannel)
+{
+    TRY
+    {
+#if defined(__WINDOWS__)
+        if (pChannel->tid != 0 && pChannel->tid != GetCurrentThreadId())
+        {
+            int result = WaitForSingleObject(pChannel->thread, INFINITE);
+            if (result != WAIT_OBJECT_0)
+            {
+                int lstErrno = SYS_ERRNO;
+                THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, EpsGetSystemError(lstErrno));
+            }
+
+            pChannel->thread = NULL;
+            pChannel->tid = 0;
+        }
+#endif
+
+#if defined(__LINUX__) || defined(__HPUX__)
+        if (pChannel->tid != 0 && pChannel->tid != pthread_self())
+        {
+            int result = pthread_join(pChannel->tid, NULL);
+            if (result != 0)
+            {
+                THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, EpsGetSystemError(SYS_ERRNO));
+            }
+
+            pChannel->tid = 0;
+        }
+#endif
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/*
+ * ڴͨ첽¼
+ *
+ * ¼ֱд¼Уʱδ¼ERCD_EPS_QUEUE_FULLɵߴ
+ *
+ * @param   pChannel            in  - ڴͨ
+ * @param   event               in  - ¼
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT TriggerShmChannelEvent(EpsShmChannelT* pChannel, const EpsShmChannelEventT event)
+{
+    TRY
+    {
+        if(! IsChannelInited(pChannel))
+        {
+            THROW_ERROR(ERCD_EPS_UNINITED, "channel");
+        }
+
+        THROW_ERROR(PushRingQueue(&pChannel->eventQueue, &event));
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * עṲڴ߽ͨӿ
+ *
+ * @param   pChannel            in  - ڴͨ
+ * @param   pListener           in  - עͨ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT RegisterShmChannelListener(EpsShmChannelT* pChannel, const EpsShmChannelListenerT* pListener)
+{
+    TRY
+    {
+        if(! IsChannelInited(pChannel))
+        {
+            THROW_ERROR(ERCD_EPS_UNINITED, "channel");
+        }
+
+        pChannel->listener.pListener = pListener->pListener;
+        if (pListener->connectedNotify != NULL)
+        {
+            pChannel->listener.connectedNotify = pListener->connectedNotify;
+        }
+        if (pListener->disconnectedNotify != NULL)
+        {
+            pChannel->listener.disconnectedNotify = pListener->disconnectedNotify;
+        }
+        if (pListener->receivedNotify != NULL)
+        {
+            pChannel->listener.receivedNotify = pListener->receivedNotify;
+        }
+        if (pListener->eventOccurredNotify != NULL)
+        {
+            pChannel->listener.eventOccurredNotify = pListener->eventOccurredNotify;
+        }
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+
+/**
+ * ڴ̺ͨ߳
+ *
+ * @param   arg                 in  - ̲߳(ڴͨ)
+ */
+static void* ChannelTask(void* arg)
+{
+    EpsShmChannelT* pChannel = (EpsShmChannelT*)arg;
+
+    while (! EpsAtomicLoad(&pChannel->canStop))
+    {
+        if (EpsAtomicLoad(&pChannel->status) == EPS_SHMCHANNEL_STATUS_IDLE)
+        {
+            usleep(EPS_CHANNEL_IDLE_INTL * 1000);
+            continue;
+        }
+
+        if (NOTOK(PollShmChannel(pChannel, (uint64)EPS_SOCKET_RECV_TIMEOUT * 1000000)))
+        {
+            ErrClearError();
+        }
+    }
+
+    CloseShmChannel(pChannel);
+
+    EpsAtomicStore(&pChannel->status, EPS_SHMCHANNEL_STATUS_STOP);
+
+    return 0;
+}
+
+/**
+ * ִһιڴͨĹҽӡ¼ȡ
+ *
+ * ͨ߳ѭñӦ߳ģʽӦ̵߳á
+ * δ߻˳ʱEPS_CHANNEL_RECONNECT_INTL¹ҽ
+ *
+ * @param   pChannel            in  - ڴͨ
+ * @param   timeout             in  - ȴϢʱ()0ʾȴ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT PollShmChannel(EpsShmChannelT* pChannel, uint64 timeout)
+{
+    TRY
+    {
+        /* ҽӹڴ */
+        if (! IsChannelConnected(pChannel))
+        {
+            uint64 now = EpsGetTimestamp();
+            if (now < pChannel->reconnectTime)
+            {
+                uint64 waitTime = pChannel->reconnectTime - now;
+                if (waitTime > timeout)
+                {
+                    waitTime = timeout;
+                }
+                if (waitTime > 0)
+                {
+#if defined(__WINDOWS__)
+                    Sleep((DWORD)(waitTime / 1000000));
+#endif
+
+#if defined(__LINUX__) || defined(__HPUX__)
+                    usleep((useconds_t)(waitTime / 1000));
+#endif
+                }
+                THROW_RESCODE(NO_ERR);
+            }
+
+            if (NOTOK(OpenShmChannel(pChannel)))
+            {
+                pChannel->listener.disconnectedNotify(pChannel->listener.pListener,
+                    ErrGetErrorCode(), ErrGetErrorDscr());
+
+                ErrClearError();
+
+                pChannel->reconnectTime = EpsGetTimestamp() + (uint64)EPS_CHANNEL_RECONNECT_INTL * 1000000;
+                THROW_RESCODE(NO_ERR);
+            }
+            else
+            {
+                pChannel->notifyTime = EpsGetTimestamp();
+                pChannel->listener.connectedNotify(pChannel->listener.pListener);
+            }
+        }
+
+        /* ȴ첽¼ */
+        if (NOTOK(HandleEvent(pChannel)))
+        {
+            ErrClearError();
+            THROW_RESCODE(NO_ERR);
+        }
+
+        /* ȡڴߣ˳ʱͨѹرգ´εʱ¹ҽ */
+        if (NOTOK(ReceiveData(pChannel, timeout)))
+        {
+            pChannel->listener.disconnectedNotify(pChannel->listener.pListener,
+                ErrGetErrorCode(), ErrGetErrorDscr());
+
+            ErrClearError();
+
+            pChannel->reconnectTime = EpsGetTimestamp() + (uint64)EPS_CHANNEL_RECONNECT_INTL * 1000000;
+        }
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * 򿪹ڴͨ
+ *
+ * @param   pChannel            in  - ڴͨ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT OpenShmChannel(EpsShmChannelT* pChannel)
+{
+    TRY
+    {
+        if (pChannel->name[0] == 0x00)
+        {
+            THROW_ERROR(ERCD_EPS_INVALID_ADDRESS);
+        }
+
+        THROW_ERROR(AttachShmBus(&pChannel->bus, pChannel->name));
+
+        /* ǰ¼(Ӻ)򿪺 */
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * رչڴͨ
+ *
+ * @param   pChannel            in  - ڴͨ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT CloseShmChannel(EpsShmChannelT* pChannel)
+{
+    TRY
+    {
+        if (IsChannelConnected(pChannel))
+        {
+            CloseShmBus(&pChannel->bus);
+        }
+
+        ClearEventQueue(pChannel);
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+
+/**
+ * ͨ¼
+ *
+ * @param   pChannel            in  - ڴͨ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+static ResCodeT HandleEvent(EpsShmChannelT* pChannel)
+{
+    TRY
+    {
+        /* ¼ƳӺ֪ͨڼ䴥¼ʹͷŵĲλ */
+        EpsShmChannelEventT event;
+        if (PopRingQueue(&pChannel->eventQueue, &event, 1) > 0)
+        {
+            pChannel->listener.eventOccurredNotify(pChannel->listener.pListener, &event);
+        }
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ȡͨ
+ *
+ * ϢʱٶߣֱϢд¼ȴtimeout
+ * ϴν֪ͨEPS_SOCKET_RECV_TIMEOUTϢʱ֪ͨճʱ鷢Ƿڷ
+ *
+ * @param   pChannel            in  - ڴͨ
+ * @param   timeout             in  - ȴϢʱ()
+ *
+ * @return  ɹNO_ERR˳ʱرͨش
+ */
+static ResCodeT ReceiveData(EpsShmChannelT* pChannel, uint64 timeout)
+{
+    TRY
+    {
+        /* ¼пѹرͨ(ڻصжϿ) */
+        if (! IsChannelConnected(pChannel))
+        {
+            THROW_RESCODE(NO_ERR);
+        }
+
+        uint64 startTime = EpsGetTimestamp();
+        uint32 spinCount = 0;
+        uint32 recordCount = 0;
+
+        while ((recordCount = ReceiveBatch(pChannel)) == 0)
+        {
+            /* ȡ˴Ӳˣ˹رպϢ */
+            if (EpsAtomicLoad(&pChannel->bus.pHeader->isClosed))
+            {
+                THROW_ERROR(ERCD_EPS_SHMBUS_CLOSED);
+            }
+
+            uint64 now = EpsGetTimestamp();
+            if (now - pChannel->notifyTime >= (uint64)EPS_SOCKET_RECV_TIMEOUT * 1000000)
+            {
+                if (! IsShmBusAlive(&pChannel->bus))
+                {
+                    THROW_ERROR(ERCD_EPS_SHMBUS_CLOSED);
+                }
+
+                pChannel->notifyTime = now;
+                pChannel->listener.receivedNotify(pChannel->listener.pListener,
+                        ERCD_EPS_SOCKET_TIMEOUT, pChannel->recvRecords, 0);
+                THROW_RESCODE(NO_ERR);
+            }
+
+            if (now - startTime >= timeout || EpsAtomicLoad(&pChannel->canStop))
+            {
+                THROW_RESCODE(NO_ERR);
+            }
+
+            /* ڼĵ¼ĵ¼ȴʱ */
+            THROW_ERROR(HandleEvent(pChannel));
+            if (! IsChannelConnected(pChannel))
+            {
+                THROW_RESCODE(NO_ERR);
+            }
+
+            if (spinCount < EPS_SHM_IDLE_SPIN_COUNT)
+            {
+                EpsSpinWait(&spinCount);
+            }
+            else
+            {
+#if defined(__WINDOWS__)
+                Sleep(1);
+#endif
+
+#if defined(__LINUX__) || defined(__HPUX__)
+                usleep(EPS_SHM_IDLE_INTL);
+#endif
+            }
+        }
+
+        pChannel->notifyTime = EpsGetTimestamp();
+
+        /* ͻȡʱȡ */
+        uint32 round = 0;
+        do
+        {
+            pChannel->listener.receivedNotify(pChannel->listener.pListener,
+                    NO_ERR, pChannel->recvRecords, recordCount);
+        } while (recordCount == EPS_SHM_RECV_BATCH_SIZE &&
+                 ++round < EPS_RECV_BATCH_MAX_ROUNDS &&
+                 IsChannelConnected(pChannel) &&
+                 (recordCount = ReceiveBatch(pChannel)) > 0);
+    }
+    CATCH
+    {
+        CloseShmChannel(pChannel);
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ȡϢ
+ *
+ * @param   pChannel            in  - ڴͨ
+ *
+ * @return  ȡϢ
+ */
+static uint32 ReceiveBatch(EpsShmChannelT* pChannel)
+{
+    uint32 recordCount = 0;
+    while (recordCount < EPS_SHM_RECV_BATCH_SIZE)
+    {
+        EpsShmRecordT* pRecord = &pChannel->recvRecords[recordCount];
+        if (! ReadShmBus(&pChannel->bus, &pRecord->msg, &pRecord->recvTime))
+        {
+            break;
+        }
+        recordCount++;
+    }
+
+    if (recordCount > 0)
+    {
+        EpsShmChannelStatT* pStat = &pChannel->stat;
+        uint32 i = 0;
+        uint64 recvBytes = 0;
+        for (i = 0; i < recordCount; i++)
+        {
+            recvBytes += (pChannel->recvRecords[i].msg.msgType == STEP_MSGTYPE_MD_SNAPSHOT) ?
+                    offsetof(MDSnapshotFullRefreshRecordT, mdData) +
+                    ((MDSnapshotFullRefreshRecordT*)pChannel->recvRecords[i].msg.body)->mdDataLen :
+                    sizeof(TradingStatusRecordT);
+        }
+
+        EpsAtomicCounterAdd(&pStat->recvCalls, 1);
+        EpsAtomicCounterAdd(&pStat->recvPackets, recordCount);
+        EpsAtomicCounterAdd(&pStat->recvBytes, recvBytes);
+        if (recordCount > EpsAtomicLoadRelaxed(&pStat->maxBatchSize))
+        {
+            EpsAtomicStoreRelaxed(&pStat->maxBatchSize, recordCount);
+        }
+    }
+
+    return recordCount;
+}
+
+/**
+ * ¼
+ *
+ * @param   pChannel            in  - ڴͨ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+static ResCodeT ClearEventQueue(EpsShmChannelT* pChannel)
+{
+    TRY
+    {
+        EpsShmChannelEventT* pEvent = NULL;
+        uint32 count = 0;
+        while ((count = PeekRingQueue(&pChannel->eventQueue, EPS_EVENTQUEUE_SIZE, (void**)&pEvent)) > 0)
+        {
+            ReleaseRingQueue(&pChannel->eventQueue, count);
+        }
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * жͨǷʼ
+ *
+ * @param   pChannel            in  - ڴͨ
+ *
+ * @return  ѾʼTRUE򷵻FALSE
+ */
+static BOOL IsChannelInited(EpsShmChannelT* pChannel)
+{
+    return (IsRingQueueInited(&pChannel->eventQueue));
+}
+
+/**
+ * жͨǷ
+ *
+ * @param   pChannel            in  - ڴͨ
+ *
+ * @return  ѾTRUE򷵻FALSE
+ */
+static BOOL IsChannelStarted(EpsShmChannelT* pChannel)
+{
+    return (pChannel->tid != 0 ||
+            (pChannel->isManual && EpsAtomicLoad(&pChannel->status) != EPS_SHMCHANNEL_STATUS_STOP));
+}
+
+/**
+ * жͨǷӳɹ
+ *
+ * @param   pChannel            in  - ڴͨ
+ *
+ * @return  Ѿҽӹڴ߷TRUE򷵻FALSE
+ */
+static BOOL IsChannelConnected(EpsShmChannelT * pChannel)
+{
+    return IsShmBusOpened(&pChannel->bus);
+}
+
+/*
+ * ͨصռλ
+ */
+static void OnChannelConnected(void* pListener)
+{
+}
+static void OnChannelDisconnected(void* pListener, ResCodeT result, const char* reason)
+{
+}
+static void OnChannelReceived(void* pListener, ResCodeT result, const EpsShmRecordT* pRecords, uint32 recordCount)
+{
+}
+static void OnChannelEventOccurred(void* pListener, EpsShmChannelEventT* pEvent)
+{
+}
@@ -0,0 +1,205 @@
+/*
+ * Copyright (C) 2013, 2014 Shanghai Stock Exchange (SSE), Shanghai, China
+ * All Rights Reserved.
+ */
+
+/**
+ * @file    shmChannel.h
+ *
+ * ڴͨͷļ
+ *
+ * @version $Id
+ * @since   2026/10/18
+ */
+
+/**
+MODIFICATION HISTORY:
+<pre>
+================================================================================
+DD-MMM-YYYY INIT.    SIR    Modification Description
+----------- -------- ------ ----------------------------------------------------
+18-OCT-2026                 
+================================================================================
+</pre>
+*/
+
+#ifndef EPS_SHM_CHANNEL_H
+#define EPS_SHM_CHANNEL_H
+
+/**
+ * ͷļ
+ */
+
+#include "common.h"
+#include "ringQueue.h"
+#include "stepMessage.h"
+#include "shmBus.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**
+ * 궨
+ */
+
+#define EPS_SHM_RECV_BATCH_SIZE     16      /* ȡϢ */
+
+
+/**
+ * Ͷ
+ */
+
+/*
+ * ڴͨ״̬ö
+ */
+typedef enum EpsShmChannelStatusTag
+{
+    EPS_SHMCHANNEL_STATUS_STOP     = 0, /* ֹͣ״̬ */
+    EPS_SHMCHANNEL_STATUS_IDLE     = 1, /* ״̬ */
+    EPS_SHMCHANNEL_STATUS_WORK     = 2, /* ״̬ */
+} EpsShmChannelStatusT;
+
+/*
+ * 첽¼
+ */
+typedef struct EpsShmChannelEventTag
+{
+    uint32  eventType;                  /* ¼ */
+    uint32  eventParam;                 /* ¼ */
+} EpsShmChannelEventT;
+
+/*
+ * ȡϢ
+ */
+typedef struct EpsShmRecordTag
+{
+    StepMessageT msg;                   /* ѽϢmsgTypeϢЧ */
+    uint64      recvTime;               /* ˽ʱ() */
+} EpsShmRecordT;
+
+/*
+ * ڴͨȡͳ
+ */
+typedef struct EpsShmChannelStatTag
+{
+    uint64  recvCalls;                  /* ȡ */
+    uint64  recvPackets;                /* ȡϢ */
+    uint64  recvBytes;                  /* ȡϢֽ */
+    uint32  maxBatchSize;               /* ζȡϢ */
+} EpsShmChannelStatT;
+
+/*
+ * 첽صӿ
+ */
+typedef void (*EpsShmChannelConnectedCallback)(void* pListener);
+typedef void (*EpsShmChannelDisconnectedCallback)(void* pListener, ResCodeT result, const char* reason);
+typedef void (*EpsShmChannelReceivedCallback)(void* pListener, ResCodeT result, const EpsShmRecordT* pRecords, uint32 recordCount);
+typedef void (*EpsShmChannelEventOccurredCallback)(void* pListener, EpsShmChannelEventT* pEvent);
+
+/*
+ * ڴ߽ͨӿ
+ */
+typedef struct EpsShmChannelListenerTag
+{
+    void*                               pListener;          /* ߶ */
+    EpsShmChannelConnectedCallback      connectedNotify;    /* ӳɹ֪ͨ */
+    EpsShmChannelDisconnectedCallback   disconnectedNotify; /* ӶϿ֪ͨ */
+    EpsShmChannelReceivedCallback       receivedNotify;     /* ݽ֪ͨ */
+    EpsShmChannelEventOccurredCallback  eventOccurredNotify;/* ¼֪ͨ */
+} EpsShmChannelListenerT;
+
+
+/*
+ * ڴͨṹ
+ */
+typedef struct EpsShmChannelTag
+{
+    char        name[EPS_SHMBUS_NAME_MAX_LEN+1];/* ڴ */
+    EpsShmBusT  bus;                        /* ڴ(ȡ) */
+
+#if defined(__WINDOWS__)
+    HANDLE      thread;                     /* ̶߳ */
+    DWORD       tid;                        /* ߳id */
+#endif
+
+#if defined(__LINUX__) || defined(__HPUX__)
+    pthread_t   tid;                        /* ߳id */
+#endif
+
+    EpsRingQueueT eventQueue;               /* ¼(Ƕ¼ṹʱܾ¼) */
+    EpsShmRecordT recvRecords[EPS_SHM_RECV_BATCH_SIZE];/* ȡϢ */
+    EpsShmChannelStatT stat;                /* ȡͳ */
+
+    BOOL        canStop;                    /* ֹͣ߳б */
+    EpsShmChannelStatusT status;            /* ͨ״̬ */
+
+    BOOL        isManual;                   /* Ӧ߳ģʽǣʱ̣ͨ߳´ʱЧ */
+    uint64      reconnectTime;              /* ´¹ҽӵʱ() */
+    uint64      notifyTime;                 /* һν֪ͨ(ݻʱ)ʱ() */
+
+    EpsShmChannelListenerT listener;        /* ߽ӿ */
+} EpsShmChannelT;
+
+
+/**
+ * 
+ */
+
+/*
+ * ʼڴͨ
+ */
+ResCodeT InitShmChannel(EpsShmChannelT* pChannel);
+
+/*
+ * ʼڴͨ
+ */
+ResCodeT UninitShmChannel(EpsShmChannelT* pChannel);
+
+/*
+ * ڴͨ
+ */
+ResCodeT StartupShmChannel(EpsShmChannelT* pChannel);
+
+/*
+ * ֹͣڴͨ
+ */
+ResCodeT ShutdownShmChannel(EpsShmChannelT* pChannel);
+
+/*
+ * ִһιڴͨĹҽӡ¼ȡ
+ */
+ResCodeT PollShmChannel(EpsShmChannelT* pChannel, uint64 timeout);
+
+/*
+ * 򿪹ڴͨ
+ */
+ResCodeT OpenShmChannel(EpsShmChannelT* pChannel);
+
+/*
+ * رչڴͨ
+ */
+ResCodeT CloseShmChannel(EpsShmChannelT* pChannel);
+
+/*
+ * ȴڴͨ
+ */
+ResCodeT JoinShmChannel(EpsShmChannelT* pChannel);
+
+/*
+ * 첽¼
+ */
+ResCodeT TriggerShmChannelEvent(EpsShmChannelT* pChannel, const EpsShmChannelEventT event);
+
+/*
+ * ע߽ͨӿ
+ */
+ResCodeT RegisterShmChannelListener(EpsShmChannelT* pChannel, const EpsShmChannelListenerT* pListener);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* EPS_SHM_CHANNEL_H */
@@ -0,0 +1,1097 @@
+/*
+ * Copyright (C) 2013, 2014 Shanghai Stock Exchange (SSE), Shanghai, China
+ * All Rights Reserved.
+ */
+
+/**
+ * @file    shmDriver.c
+ *
+ * ڴʵļ
+ *
+ * @version $Id
+ * @since   2026/10/18
+ */
+
+/**
+MODIFICATION HISTORY:
+<pre>
+================================================================================
+DD-MMM-YYYY INIT.    SIR    Modification Description
+----------- -------- ------ ----------------------------------------------------
+18-OCT-2026                 
+================================================================================
+</pre>
+*/
+
+/**
+ * ͷļ
+ */
+
+#include "common.h"
+#include "epsTypes.h"
+#include "epsData.h"
+#include "errlib.h"
+#include "errcode.h"
+#include "atomic.h"
+
+#include "shmDriver.h"
+
+
+/**
+ * Ͷ
+ */
+
+/*
+ * ڴ¼ö
+ */
+typedef enum EpsShmEventTypeTag
+{
+    EPS_SHM_EVENTTYPE_LOGIN         = 1,    /* ½¼ */
+    EPS_SHM_EVENTTYPE_LOGOUT        = 2,    /* ǳ¼ */
+    EPS_SHM_EVENTTYPE_SUBSCRIBED    = 3,    /* ¼ */
+} EpsShmEventTypeT;
+
+
+/**
+ * ڲ
+ */
+
+static void OnChannelConnected(void* pListener);
+static void OnChannelDisconnected(void* pListener, ResCodeT result, const char* reason);
+static void OnChannelReceived(void* pListener, ResCodeT rc, const EpsShmRecordT* pRecords, uint32 recordCount);
+static void OnChannelEventOccurred(void* pListener, EpsShmChannelEventT* pEvent);
+
+static void OnEpsConnected(uint32 hid);
+static void OnEpsDisconnected(uint32 hid, ResCodeT result, const char* reason);
+static void OnEpsLoginRsp(uint32 hid, uint16 heartbeatIntl, ResCodeT result, const char* reason);
+static void OnEpsLogoutRsp(uint32 hid, ResCodeT result, const char* reason);
+static void OnEpsMktDataSubRsp(uint32 hid, EpsMktTypeT mktType, ResCodeT result, const char* reason);
+static void OnEpsMktDataArrived(uint32 hid, const EpsMktDataT* pMktData);
+static void OnEpsMktStatusChanged(uint32 hid, const EpsMktStatusT* pMktStatus);
+static void OnEpsEventOccurred(uint32 hid, EpsEventTypeT eventType, ResCodeT eventCode, const char* eventText);
+static void OnEpsMktDataGap(uint32 hid, const EpsMktGapT* pMktGap);
+
+static ResCodeT HandleRecord(EpsShmDriverT* pDriver, const EpsShmRecordT* pRecord);
+static ResCodeT HandleMktData(EpsShmDriverT* pDriver, const StepMessageT* pMsg, uint64 recvTime);
+static ResCodeT HandleReceiveTimeout(EpsShmDriverT* pDriver);
+
+
+/**
+ * ʵ
+ */
+
+/**
+ *  ʼڴ
+ *
+ * @param   pDriver             in  - ڴ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT InitShmDriver(EpsShmDriverT* pDriver)
+{
+    TRY
+    {
+        THROW_ERROR(InitShmChannel(&pDriver->channel));
+        THROW_ERROR(InitMktDatabase(&pDriver->database));
+
+        EpsShmChannelListenerT listener =
+        {
+            pDriver,
+            OnChannelConnected,
+            OnChannelDisconnected,
+            OnChannelReceived,
+            OnChannelEventOccurred
+        };
+        THROW_ERROR(RegisterShmChannelListener(&pDriver->channel, &listener));
+
+        EpsClientSpiT spi =
+        {
+            OnEpsConnected,
+            OnEpsDisconnected,
+            OnEpsLoginRsp,
+            OnEpsLogoutRsp,
+            OnEpsMktDataSubRsp,
+            OnEpsMktDataArrived,
+            OnEpsMktStatusChanged,
+            OnEpsEventOccurred,
+            OnEpsMktDataGap,
+            NULL,
+            NULL
+        };
+        pDriver->spi = spi;
+
+        THROW_ERROR(InitMktBatch(&pDriver->batch));
+        THROW_ERROR(InitSecFilter(&pDriver->filter));
+        THROW_ERROR(InitDispatcher(&pDriver->dispatcher, &pDriver->spi, &pDriver->batch, &pDriver->filter));
+        THROW_ERROR(InitSubscriberHub(&pDriver->subscribers, pDriver->hid, &pDriver->filter));
+
+        InitRecMutex(&pDriver->lock);
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/*
+ * ʼڴ
+ *
+ * @param   pDriver             in  - ڴ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT UninitShmDriver(EpsShmDriverT* pDriver)
+{
+    TRY
+    {
+        LockRecMutex(&pDriver->lock);
+
+        UninitShmChannel(&pDriver->channel);
+        UninitDispatcher(&pDriver->dispatcher);
+        UninitSubscriberHub(&pDriver->subscribers);
+        UninitSecFilter(&pDriver->filter);
+        UninitMktDatabase(&pDriver->database);
+        UninitMktBatch(&pDriver->batch);
+
+        UnlockRecMutex(&pDriver->lock);
+
+        UninitRecMutex(&pDriver->lock);
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ *  עṲڴص
+ *
+ * @param   pDriver             in  - ڴ
+ * @param   pSpi                in  - ûصӿ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT RegisterShmDriverSpi(EpsShmDriverT* pDriver, const EpsClientSpiT* pSpi)
+{
+    TRY
+    {
+        LockRecMutex(&pDriver->lock);
+
+        /* ̲ͨ߳ȡصͨڼ䲻滻 */
+        if (EpsAtomicLoad(&pDriver->channel.status) != EPS_SHMCHANNEL_STATUS_STOP)
+        {
+            THROW_ERROR(ERCD_EPS_DUPLICATE_CONNECT);
+        }
+
+        if (pSpi->connectedNotify != NULL)
+        {
+            pDriver->spi.connectedNotify = pSpi->connectedNotify;
+        }
+        if (pSpi->disconnectedNotify != NULL)
+        {
+            pDriver->spi.disconnectedNotify = pSpi->disconnectedNotify;
+        }
+        if (pSpi->loginRspNotify != NULL)
+        {
+            pDriver->spi.loginRspNotify = pSpi->loginRspNotify;
+        }
+        if (pSpi->logoutRspNotify != NULL)
+        {
+            pDriver->spi.logoutRspNotify = pSpi->logoutRspNotify;
+        }
+        if (pSpi->mktDataSubRspNotify != NULL)
+        {
+            pDriver->spi.mktDataSubRspNotify = pSpi->mktDataSubRspNotify;
+        }
+        if (pSpi->mktDataArrivedNotify != NULL)
+        {
+            pDriver->spi.mktDataArrivedNotify = pSpi->mktDataArrivedNotify;
+        }
+        if (pSpi->mktStatusChangedNotify != NULL)
+        {
+            pDriver->spi.mktStatusChangedNotify = pSpi->mktStatusChangedNotify;
+        }
+        if (pSpi->eventOccurredNotify != NULL)
+        {
+            pDriver->spi.eventOccurredNotify = pSpi->eventOccurredNotify;
+        }
+        if (pSpi->mktDataGapNotify != NULL)
+        {
+            pDriver->spi.mktDataGapNotify = pSpi->mktDataGapNotify;
+        }
+        if (pSpi->mktDataViewArrivedNotify != NULL)
+        {
+            pDriver->spi.mktDataViewArrivedNotify = pSpi->mktDataViewArrivedNotify;
+        }
+        if (pSpi->mktDataBatchArrivedNotify != NULL)
+        {
+            /* ڻصͨ߳ */
+            THROW_ERROR(AllocMktBatch(&pDriver->batch));
+            EpsAtomicStore(&pDriver->spi.mktDataBatchArrivedNotify, pSpi->mktDataBatchArrivedNotify);
+        }
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        UnlockRecMutex(&pDriver->lock);
+
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ҽӹڴ
+ *
+ * @param   pDriver             in  - ڴ
+ * @param   address             in  - ڴƣ뷢EpsSetShmPublisherͬ"/eps_md"
+ *
+ * @return  ɹNO_ERR򷵻ش
+ *
+ * memo: δʱͨ¹ҽӲԶϿ֪ͨԭ
+ */
+ResCodeT ConnectShmDriver(EpsShmDriverT* pDriver, const char* address)
+{
+    char name[EPS_SHMBUS_NAME_MAX_LEN+1];
+
+    TRY
+    {
+        LockRecMutex(&pDriver->lock);
+
+        if (address == NULL || address[0] != '/' || strlen(address) > EPS_SHMBUS_NAME_MAX_LEN)
+        {
+            THROW_ERROR(ERCD_EPS_INVALID_ADDRESS);
+        }
+
+        memcpy(name, pDriver->channel.name, sizeof(name));
+        snprintf(pDriver->channel.name, sizeof(pDriver->channel.name), "%s", address);
+
+        THROW_ERROR(StartupDispatcher(&pDriver->dispatcher, pDriver->hid));
+        THROW_ERROR(StartupShmChannel(&pDriver->channel));
+    }
+    CATCH
+    {
+        if(GET_RESCODE() == ERCD_EPS_DUPLICATE_CONNECT)
+        {
+            memcpy(pDriver->channel.name, name, sizeof(name));
+        }
+    }
+    FINALLY
+    {
+        UnlockRecMutex(&pDriver->lock);
+
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * Ͽڴ
+ *
+ * @param   pDriver             in  - ڴ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT DisconnectShmDriver(EpsShmDriverT* pDriver)
+{
+    TRY
+    {
+        ResCodeT rc = NO_ERR;
+
+        /* ַֹ֪ͨ߳ͣʹȴпռ̷ͨ߳ȴ */
+        ShutdownDispatcher(&pDriver->dispatcher);
+
+        LockRecMutex(&pDriver->lock);
+
+        rc = ShutdownShmChannel(&pDriver->channel);
+
+        UnlockRecMutex(&pDriver->lock);
+
+        THROW_ERROR(rc);
+        THROW_ERROR(JoinShmChannel(&pDriver->channel));
+        THROW_ERROR(JoinDispatcher(&pDriver->dispatcher));
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ½ڴ
+ *
+ * @param   pDriver             in  - ڴ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ *
+ * memo: ֤û˺Ų棬¼ͨ߳Ӧ
+ */
+ResCodeT LoginShmDriver(EpsShmDriverT* pDriver, const char* username,
+    const char* password, uint16 heartbeatIntl)
+{
+    TRY
+    {
+        EpsShmChannelEventT event =
+        {
+            EPS_SHM_EVENTTYPE_LOGIN, (uint32)heartbeatIntl
+        };
+
+        THROW_ERROR(TriggerShmChannelEvent(&pDriver->channel, event));
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/*
+ * ǳڴ
+ *
+ * @param   pDriver             in  - ڴ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT LogoutShmDriver(EpsShmDriverT* pDriver, const char* reason)
+{
+    TRY
+    {
+        EpsShmChannelEventT event =
+        {
+            EPS_SHM_EVENTTYPE_LOGOUT, 0
+        };
+
+        THROW_ERROR(TriggerShmChannelEvent(&pDriver->channel, event));
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * Ĺڴ
+ *
+ * @param   pDriver             in  - ڴ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT SubscribeShmDriver(EpsShmDriverT* pDriver, EpsMktTypeT mktType)
+{
+    TRY
+    {
+        if (mktType > EPS_MKTTYPE_NUM)
+        {
+            THROW_ERROR(ERCD_EPS_INVALID_MKTTYPE);
+        }
+
+        /* ݿͨ߳޸ģĽ¼ʱӦ */
+        EpsShmChannelEventT event =
+        {
+            EPS_SHM_EVENTTYPE_SUBSCRIBED, (uint32)mktType
+        };
+        THROW_ERROR(TriggerShmChannelEvent(&pDriver->channel, event));
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ȡڴͳϢ
+ *
+ * @param   pDriver             in  - ڴ
+ * @param   pStat               out - ͳϢ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT GetShmDriverStatistics(EpsShmDriverT* pDriver, EpsStatisticsT* pStat)
+{
+    TRY
+    {
+        const EpsShmChannelStatT* pChannelStat = &pDriver->channel.stat;
+        pStat->recvCalls    = EpsAtomicLoadRelaxed(&pChannelStat->recvCalls);
+        pStat->recvPackets  = EpsAtomicLoadRelaxed(&pChannelStat->recvPackets);
+        pStat->recvBytes    = EpsAtomicLoadRelaxed(&pChannelStat->recvBytes);
+        pStat->maxBatchSize = EpsAtomicLoadRelaxed(&pChannelStat->maxBatchSize);
+        pStat->xdpPackets   = 0;
+
+        const EpsMktDatabaseStatT* pDatabaseStat = &pDriver->database.stat;
+        pStat->gapCount         = EpsAtomicLoadRelaxed(&pDatabaseStat->gapCount);
+        pStat->gapSeqNums       = EpsAtomicLoadRelaxed(&pDatabaseStat->gapSeqNums);
+        pStat->gapFilledSeqNums = EpsAtomicLoadRelaxed(&pDatabaseStat->gapFilledSeqNums);
+        pStat->reorderedPackets = 0;
+
+        pStat->recoveryCount      = 0;
+        pStat->recoveredSeqNums   = 0;
+        pStat->unrecoveredSeqNums = 0;
+        pStat->sessionGapCount    = 0;
+        pStat->resendRequests     = 0;
+        pStat->failoverCount      = 0;
+        pStat->failoverLatency    = 0;
+
+        pStat->shmPublished = 0;
+        pStat->shmOverruns  = EpsAtomicLoadRelaxed(&pDriver->channel.bus.overrunCount);
+
+        GetDispatcherStatistics(&pDriver->dispatcher, pStat);
+        GetSecFilterStatistics(&pDriver->filter, pStat);
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ùڴѡ
+ *
+ * @param   pDriver             in  - ڴ
+ * @param   option              in  - ѡ
+ * @param   value               in  - ѡֵ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ *
+ * memo: ֧UDP鲥TCPỰصѡ
+ */
+ResCodeT SetShmDriverOption(EpsShmDriverT* pDriver, EpsOptionT option, int32 value)
+{
+    TRY
+    {
+        LockRecMutex(&pDriver->lock);
+
+        switch (option)
+        {
+            case EPS_OPTION_MKTDATA_BATCH_SIZE:
+            case EPS_OPTION_MKTDATA_BATCH_DELAY:
+            {
+                THROW_ERROR(SetMktBatchOption(&pDriver->batch, option, value));
+                break;
+            }
+            case EPS_OPTION_DISPATCH_THREADS:
+            case EPS_OPTION_DISPATCH_HIGH_WATER:
+            case EPS_OPTION_DISPATCH_POLICY:
+            case EPS_OPTION_DISPATCH_MODE:
+            {
+                if (EpsAtomicLoad(&pDriver->channel.status) != EPS_SHMCHANNEL_STATUS_STOP)
+                {
+                    THROW_ERROR(ERCD_EPS_DUPLICATE_CONNECT);
+                }
+                THROW_ERROR(SetDispatcherOption(&pDriver->dispatcher, option, value));
+                break;
+            }
+            case EPS_OPTION_POLL_MODE:
+            {
+                if (value != 0 && value != 1)
+                {
+                    THROW_ERROR(ERCD_EPS_INVALID_PARM, "value");
+                }
+                if (EpsAtomicLoad(&pDriver->channel.status) != EPS_SHMCHANNEL_STATUS_STOP)
+                {
+                    THROW_ERROR(ERCD_EPS_DUPLICATE_CONNECT);
+                }
+
+                /* ޿ɵȴӦ߳EpsPollȴϢ */
+                pDriver->channel.isManual = (value == 1);
+                break;
+            }
+            default:
+            {
+                THROW_ERROR(ERCD_EPS_INVALID_PARM, "option");
+            }
+        }
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        UnlockRecMutex(&pDriver->lock);
+
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * Ӧ߳ڴ
+ *
+ * ϢʱȴtimeoutϢʱִУֱĳϢִmaxEvents
+ *
+ * @param   pDriver             in  - ڴ
+ * @param   timeout             in  - Ϣʱȴʱ()0ʾȴ
+ * @param   maxEvents           in  - ִеĽ01
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT PollShmDriver(EpsShmDriverT* pDriver, uint64 timeout, uint32 maxEvents)
+{
+    TRY
+    {
+        if (! pDriver->channel.isManual)
+        {
+            THROW_ERROR(ERCD_EPS_INVALID_OPERATION, "poll mode not enabled");
+        }
+
+        if (EpsAtomicLoad(&pDriver->channel.status) != EPS_SHMCHANNEL_STATUS_WORK)
+        {
+            THROW_ERROR(ERCD_EPS_INVALID_OPERATION, "not connected");
+        }
+
+        if (maxEvents == 0)
+        {
+            maxEvents = 1;
+        }
+
+        uint32 round = 0;
+        while (round < maxEvents)
+        {
+            uint64 recvPackets = pDriver->channel.stat.recvPackets;
+            THROW_ERROR(PollShmChannel(&pDriver->channel, (round == 0) ? timeout : 0));
+            if (pDriver->channel.stat.recvPackets == recvPackets)
+            {
+                break;
+            }
+            round++;
+        }
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ùڴûʱã̴ͨ߳һʱЧ
+ *
+ * @param   pDriver             in  - ڴ
+ * @param   parser              in  - NULLʾȡ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT SetShmDriverMdDataParser(EpsShmDriverT* pDriver, EpsMdDataParseCallback parser)
+{
+    TRY
+    {
+        SetSecFilterParser(&pDriver->filter, parser);
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ùڴĶ֤ȯʱã̴ͨ߳һʱЧ
+ *
+ * @param   pDriver             in  - ڴ
+ * @param   securityIDs         in  - ֤ȯ
+ * @param   count               in  - ֤ȯ0ʾȡ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT SubscribeShmDriverSecurities(EpsShmDriverT* pDriver, const char* securityIDs[], uint32 count)
+{
+    TRY
+    {
+        THROW_ERROR(SetSecFilterSecurities(&pDriver->filter, securityIDs, count));
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ӹڴĶߣʱӣ̴ͨ߳һʱЧ
+ *
+ * @param   pDriver             in  - ڴ
+ * @param   pConfig             in  - 
+ * @param   pSid                out - ID
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT AddShmDriverSubscriber(EpsShmDriverT* pDriver, const EpsSubscriberConfigT* pConfig, uint32* pSid)
+{
+    TRY
+    {
+        THROW_ERROR(AddSubscriber(&pDriver->subscribers, pConfig, pSid));
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ɾڴĶ
+ *
+ * @param   pDriver             in  - ڴ
+ * @param   sid                 in  - ID
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT RemoveShmDriverSubscriber(EpsShmDriverT* pDriver, uint32 sid)
+{
+    TRY
+    {
+        THROW_ERROR(RemoveSubscriber(&pDriver->subscribers, sid));
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * Ӧ߳Ͷݹڴ߶е
+ *
+ * @param   pDriver             in  - ڴ
+ * @param   sid                 in  - ID
+ * @param   maxCount            in  - Ͷݵ
+ * @param   pCount              out - Ͷݵ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT PollShmDriverSubscriber(EpsShmDriverT* pDriver, uint32 sid, uint32 maxCount, uint32* pCount)
+{
+    TRY
+    {
+        THROW_ERROR(PollSubscriber(&pDriver->subscribers, sid, maxCount, pCount));
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ȡڴߵͳϢ
+ *
+ * @param   pDriver             in  - ڴ
+ * @param   sid                 in  - ID
+ * @param   pStat               out - ͳϢ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT GetShmDriverSubscriberStatistics(EpsShmDriverT* pDriver, uint32 sid, EpsSubscriberStatT* pStat)
+{
+    TRY
+    {
+        THROW_ERROR(GetSubscriberStatistics(&pDriver->subscribers, sid, pStat));
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ڴͨӳɹ֪ͨ
+ *
+ * @param   pListener             in  - ڴ
+ */
+static void OnChannelConnected(void* pListener)
+{
+    EpsShmDriverT* pDriver = (EpsShmDriverT*)pListener;
+    pDriver->spi.connectedNotify(pDriver->hid);
+}
+
+/**
+ * ڴͨӶϿ֪ͨ
+ *
+ * @param   pListener           in  - ڴ
+ * @param   result              in  - Ͽ
+ * @param   reason              in  - Ͽԭ
+ */
+static void OnChannelDisconnected(void* pListener, ResCodeT result, const char* reason)
+{
+    EpsShmDriverT* pDriver = (EpsShmDriverT*)pListener;
+    UnsubscribeAllMktData(&pDriver->database);
+    pDriver->spi.disconnectedNotify(pDriver->hid, result, reason);
+}
+
+/**
+ * ڴͨݽ֪ͨ
+ *
+ * @param   pListener           in  - ڴ
+ * @param   result              in  - մ
+ * @param   pRecords            in  - ȡϢ
+ * @param   recordCount         in  - ȡϢ
+ */
+static void OnChannelReceived(void* pListener, ResCodeT result, const EpsShmRecordT* pRecords, uint32 recordCount)
+{
+    EpsShmDriverT* pDriver = (EpsShmDriverT*)pListener;
+    TRY
+    {
+        if (OK(result))
+        {
+            uint32 i = 0;
+            for (i = 0; i < recordCount; i++)
+            {
+                THROW_ERROR(HandleRecord(pDriver, &pRecords[i]));
+            }
+        }
+        else
+        {
+            if (result == ERCD_EPS_SOCKET_TIMEOUT)
+            {
+                THROW_ERROR(HandleReceiveTimeout(pDriver));
+            }
+            else
+            {
+                THROW_ERROR(result);
+            }
+        }
+
+        FlushMktBatch(&pDriver->batch, pDriver->hid, pDriver->spi.mktDataBatchArrivedNotify);
+    }
+    CATCH
+    {
+        FlushMktBatch(&pDriver->batch, pDriver->hid, pDriver->spi.mktDataBatchArrivedNotify);
+
+        pDriver->spi.eventOccurredNotify(pDriver->hid, EPS_EVENTTYPE_ERROR, ErrGetErrorCode(), ErrGetErrorDscr());
+
+        CloseShmChannel(&pDriver->channel);
+        OnChannelDisconnected(pListener, ErrGetErrorCode(), ErrGetErrorDscr());
+
+        ErrClearError();
+    }
+    FINALLY
+    {
+        SET_RESCODE(GET_RESCODE());
+    }
+}
+
+/**
+ * ȡϢ
+ *
+ * Ϣɷ˽룬ֱӽż⼰ַ
+ *
+ * @param   pDriver             in  - ڴ
+ * @param   pRecord             in  - ȡϢ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+static ResCodeT HandleRecord(EpsShmDriverT* pDriver, const EpsShmRecordT* pRecord)
+{
+    TRY
+    {
+        ResCodeT rc = NO_ERR;
+        const StepMessageT* pMsg = &pRecord->msg;
+
+        if (pMsg->msgType == STEP_MSGTYPE_MD_SNAPSHOT)
+        {
+            THROW_ERROR(HandleMktData(pDriver, pMsg, pRecord->recvTime));
+        }
+        else if (pMsg->msgType == STEP_MSGTYPE_TRADING_STATUS)
+        {
+            rc = AcceptMktStatus(&pDriver->database, pMsg);
+            if (NOTOK(rc))
+            {
+                if (rc == ERCD_EPS_MKTSTATUS_UNCHANGED || rc == ERCD_EPS_MKTTYPE_UNSUBSCRIBED)
+                {
+                    THROW_RESCODE(NO_ERR);
+                }
+                else
+                {
+                    THROW_ERROR(rc);
+                }
+            }
+
+            EpsMktStatusT mktStatus;
+            THROW_ERROR(ConvertMktStatus(pMsg, &mktStatus));
+
+            /* Ͷۻ飬֪ͨ˳ */
+            FlushMktBatch(&pDriver->batch, pDriver->hid, pDriver->spi.mktDataBatchArrivedNotify);
+            pDriver->spi.mktStatusChangedNotify(pDriver->hid, &mktStatus);
+
+            pDriver->recvIdleTimes = 0;
+        }
+        else
+        {
+        }
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ݣȱڲ֪ͨû
+ *
+ * ȡ˸ǵڴ˰ȱڱ
+ *
+ * @param   pDriver             in  - ڴ
+ * @param   pMsg                in  - Ϣ
+ * @param   recvTime            in  - ˽ʱ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+static ResCodeT HandleMktData(EpsShmDriverT* pDriver, const StepMessageT* pMsg, uint64 recvTime)
+{
+    TRY
+    {
+        EpsMktGapT mktGap;
+        ResCodeT rc = AcceptMktData(&pDriver->database, pMsg, &mktGap);
+        if (NOTOK(rc))
+        {
+            if (rc == ERCD_EPS_MKTDATA_GAP)
+            {
+                FlushMktBatch(&pDriver->batch, pDriver->hid, pDriver->spi.mktDataBatchArrivedNotify);
+                pDriver->spi.mktDataGapNotify(pDriver->hid, &mktGap);
+            }
+            else if (rc == ERCD_EPS_DATASOURCE_CHANGED)
+            {
+                pDriver->spi.eventOccurredNotify(pDriver->hid, EPS_EVENTTYPE_WARNING, rc, ErrGetErrorDscr());
+            }
+            else if (rc == ERCD_EPS_MKTTYPE_UNSUBSCRIBED)
+            {
+                THROW_RESCODE(NO_ERR);
+            }
+            else if (rc == ERCD_EPS_MKTDATA_BACKFLOW)
+            {
+                THROW_RESCODE(NO_ERR);
+            }
+            else
+            {
+                THROW_ERROR(rc);
+            }
+        }
+
+        pDriver->recvIdleTimes = 0;
+
+        /* ֤ȯʱݿǼǣ˲Ӱȱڼ */
+        ApplySecFilter(&pDriver->filter);
+
+        EpsMktDataBatchArrivedCallback batchNotify = EpsAtomicLoad(&pDriver->spi.mktDataBatchArrivedNotify);
+        if (IsSubscriberHubEnabled(&pDriver->subscribers))
+        {
+            THROW_ERROR(PublishSubscribers(&pDriver->subscribers, pMsg, recvTime));
+
+            /* δעصʱΪ */
+            if (batchNotify == NULL && pDriver->spi.mktDataViewArrivedNotify == NULL &&
+                pDriver->spi.mktDataArrivedNotify == OnEpsMktDataArrived)
+            {
+                THROW_RESCODE(NO_ERR);
+            }
+        }
+
+        if (IsDispatcherEnabled(&pDriver->dispatcher))
+        {
+            THROW_ERROR(PushDispatcher(&pDriver->dispatcher, pMsg, recvTime));
+        }
+        else if (batchNotify != NULL)
+        {
+            EpsMktDataT* pMktData = NextMktBatchItem(&pDriver->batch);
+            THROW_ERROR(ConvertMktData(pMsg, pMktData));
+
+            pMktData->recvTime = recvTime;
+            if (FilterMktData(&pDriver->filter, pDriver->hid, pMktData) &&
+                CommitMktBatchItem(&pDriver->batch, recvTime))
+            {
+                FlushMktBatch(&pDriver->batch, pDriver->hid, batchNotify);
+            }
+        }
+        else if (pDriver->spi.mktDataViewArrivedNotify != NULL)
+        {
+            EpsMktDataViewT mktDataView;
+            if (IsSecFilterEnabled(&pDriver->filter))
+            {
+                /* дݣȸȡͼ */
+                EpsMktDataT mktData;
+                THROW_ERROR(ConvertMktData(pMsg, &mktData));
+                if (! FilterMktData(&pDriver->filter, pDriver->hid, &mktData))
+                {
+                    THROW_RESCODE(NO_ERR);
+                }
+                GetMktDataView(&mktData, &mktDataView);
+
+                mktDataView.recvTime = recvTime;
+                mktDataView.notifyTime = EpsGetTimestamp();
+                pDriver->spi.mktDataViewArrivedNotify(pDriver->hid, &mktDataView);
+                THROW_RESCODE(NO_ERR);
+            }
+
+            THROW_ERROR(ConvertMktDataView(pMsg, &mktDataView));
+
+            mktDataView.recvTime = recvTime;
+            mktDataView.notifyTime = EpsGetTimestamp();
+            pDriver->spi.mktDataViewArrivedNotify(pDriver->hid, &mktDataView);
+        }
+        else
+        {
+            EpsMktDataT mktData;
+            THROW_ERROR(ConvertMktData(pMsg, &mktData));
+            if (! FilterMktData(&pDriver->filter, pDriver->hid, &mktData))
+            {
+                THROW_RESCODE(NO_ERR);
+            }
+
+            mktData.recvTime = recvTime;
+            mktData.notifyTime = EpsGetTimestamp();
+            pDriver->spi.mktDataArrivedNotify(pDriver->hid, &mktData);
+        }
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ڴͨ¼֪ͨ
+ *
+ * @param   pListener           in  - ڴ
+ * @param   pEvent              in  - ¼
+ */
+static void OnChannelEventOccurred(void* pListener, EpsShmChannelEventT* pEvent)
+{
+    EpsShmDriverT* pDriver = (EpsShmDriverT*)pListener;
+
+    switch (pEvent->eventType)
+    {
+        case EPS_SHM_EVENTTYPE_LOGIN:
+        {
+            pDriver->heartbeatIntl = (uint16)pEvent->eventParam;
+            pDriver->spi.loginRspNotify(pDriver->hid,
+                    pDriver->heartbeatIntl, NO_ERR, "login succeed");
+            break;
+        }
+        case EPS_SHM_EVENTTYPE_LOGOUT:
+        {
+            UnsubscribeAllMktData(&pDriver->database);
+
+            pDriver->spi.logoutRspNotify(pDriver->hid,
+                    NO_ERR, "logout succeed");
+            break;
+        }
+        case EPS_SHM_EVENTTYPE_SUBSCRIBED:
+        {
+            EpsMktTypeT mktType = (EpsMktTypeT)(pEvent->eventParam);
+            ResCodeT rc = SubscribeMktData(&pDriver->database, mktType);
+            if (OK(rc))
+            {
+                pDriver->spi.mktDataSubRspNotify(pDriver->hid,
+                        mktType, NO_ERR, "subscribe succeed");
+            }
+            else
+            {
+                pDriver->spi.mktDataSubRspNotify(pDriver->hid,
+                        mktType, rc, ErrGetErrorDscr());
+                ErrClearError();
+            }
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+/**
+ * ڴͨݽճʱ֪ͨ
+ *
+ * @param   pDriver             in  - ڴ
+ */
+static ResCodeT HandleReceiveTimeout(EpsShmDriverT* pDriver)
+{
+    TRY
+    {
+        pDriver->recvIdleTimes++;
+
+        if ((pDriver->recvIdleTimes * EPS_SOCKET_RECV_TIMEOUT) >= EPS_DRIVER_KEEPALIVE_TIME)
+        {
+            ErrSetError(ERCD_EPS_CHECK_KEEPALIVE_TIMEOUT);
+
+            pDriver->spi.eventOccurredNotify(pDriver->hid, EPS_EVENTTYPE_WARNING,
+                        GET_RESCODE(), ErrGetErrorDscr());
+
+            pDriver->recvIdleTimes = 0;
+        }
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/*
+ * Express SPIռλ
+ */
+static void OnEpsConnected(uint32 hid)
+{
+}
+static void OnEpsDisconnected(uint32 hid, ResCodeT result, const char* reason)
+{
+}
+static void OnEpsLoginRsp(uint32 hid, uint16 heartbeatIntl, ResCodeT result, const char* reason)
+{
+}
+static void OnEpsLogoutRsp(uint32 hid, ResCodeT result, const char* reason)
+{
+}
+static void OnEpsMktDataSubRsp(uint32 hid, EpsMktTypeT mktType, ResCodeT result, const char* reason)
+{
+}
+static void OnEpsMktDataArrived(uint32 hid, const EpsMktDataT* pMktData)
+{
+}
+static void OnEpsMktStatusChanged(uint32 hid, const EpsMktStatusT* pMktStatus)
+{
+}
+static void OnEpsEventOccurred(uint32 hid, EpsEventTypeT eventType, ResCodeT eventCode, const char* eventText)
+{
+}
+static void OnEpsMktDataGap(uint32 hid, const EpsMktGapT* pMktGap)
+{
+}
@@ -0,0 +1,168 @@
+/*
+ * Copyright (C) 2013, 2014 Shanghai Stock Exchange (SSE), Shanghai, China
+ * All Rights Reserved.
+ */
+
+/**
+ * @file    shmDriver.h
+ *
+ * ڴͷļ
+ *
+ * @version $Id
+ * @since   2026/10/18
+ */
+
+/**
+MODIFICATION HISTORY:
+<pre>
+================================================================================
+DD-MMM-YYYY INIT.    SIR    Modification Description
+----------- -------- ------ ----------------------------------------------------
+18-OCT-2026                 
+================================================================================
+</pre>
+*/
+
+#ifndef EPS_SHM_DRIVER_H
+#define EPS_SHM_DRIVER_H
+
+/**
+ * ͷļ
+ */
+
+#include "recMutex.h"
+#include "mktDatabase.h"
+#include "mktBatch.h"
+#include "dispatcher.h"
+#include "subscriber.h"
+#include "shmChannel.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**
+ * Ͷ
+ */
+
+/*
+ * ڴṹ
+ *
+ * ȡ(UDPTCP)д빲ڴߵѽ飬
+ * ٽݼSTEPϢż⡢˼ַUDPͬ
+ */
+typedef struct EpsShmDriverTag
+{
+    uint32          hid;                    /* ID */
+
+    EpsShmChannelT  channel;                /* ڴͨ */
+    EpsMktDatabaseT database;               /* ݿ */
+    EpsClientSpiT   spi;                    /* ûصӿ */
+    EpsMktBatchT    batch;                  /* 黺 */
+    EpsDispatcherT  dispatcher;             /* ַ */
+    EpsSecFilterT   filter;                 /* ֤ȯĹ */
+    EpsSubscriberHubT subscribers;          /* ڵĶ߼ */
+    EpsRecMutexT    lock;                   /* : ӹѡã鴦 */
+
+    uint16 heartbeatIntl;                    /*  */
+    uint16 recvIdleTimes;                    /* տм */
+} EpsShmDriverT;
+
+
+/**
+ * 
+ */
+
+/*
+ *  ʼڴ
+ */
+ResCodeT InitShmDriver(EpsShmDriverT* pDriver);
+
+/*
+ *  ʼڴ
+ */
+ResCodeT UninitShmDriver(EpsShmDriverT* pDriver);
+
+/*
+ *  עṲڴص
+ */
+ResCodeT RegisterShmDriverSpi(EpsShmDriverT* pDriver, const EpsClientSpiT* pSpi);
+
+/*
+ *  ҽӹڴ
+ */
+ResCodeT ConnectShmDriver(EpsShmDriverT* pDriver, const char* address);
+
+/*
+ *  Ͽڴ
+ */
+ResCodeT DisconnectShmDriver(EpsShmDriverT* pDriver);
+
+/*
+ *  ½ڴ
+ */
+ResCodeT LoginShmDriver(EpsShmDriverT* pDriver,
+        const char* username, const char* password, uint16 heartbeatIntl);
+
+/*
+ *  ǳڴ
+ */
+ResCodeT LogoutShmDriver(EpsShmDriverT* pDriver, const char* reason);
+
+/*
+ *  Ĺڴ
+ */
+ResCodeT SubscribeShmDriver(EpsShmDriverT* pDriver, EpsMktTypeT mktType);
+
+/*
+ *  ȡڴͳϢ
+ */
+ResCodeT GetShmDriverStatistics(EpsShmDriverT* pDriver, EpsStatisticsT* pStat);
+
+/*
+ *  ùڴѡ
+ */
+ResCodeT SetShmDriverOption(EpsShmDriverT* pDriver, EpsOptionT option, int32 value);
+
+/*
+ *  Ӧ߳ڴ
+ */
+ResCodeT PollShmDriver(EpsShmDriverT* pDriver, uint64 timeout, uint32 maxEvents);
+
+/*
+ *  ùڴû
+ */
+ResCodeT SetShmDriverMdDataParser(EpsShmDriverT* pDriver, EpsMdDataParseCallback parser);
+
+/*
+ *  ùڴĶ֤ȯ
+ */
+ResCodeT SubscribeShmDriverSecurities(EpsShmDriverT* pDriver, const char* securityIDs[], uint32 count);
+
+/*
+ *  ӹڴĶ
+ */
+ResCodeT AddShmDriverSubscriber(EpsShmDriverT* pDriver, const EpsSubscriberConfigT* pConfig, uint32* pSid);
+
+/*
+ *  ɾڴĶ
+ */
+ResCodeT RemoveShmDriverSubscriber(EpsShmDriverT* pDriver, uint32 sid);
+
+/*
+ *  Ӧ߳Ͷݹڴߵ
+ */
+ResCodeT PollShmDriverSubscriber(EpsShmDriverT* pDriver, uint32 sid, uint32 maxCount, uint32* pCount);
+
+/*
+ *  ȡڴߵͳϢ
+ */
+ResCodeT GetShmDriverSubscriberStatistics(EpsShmDriverT* pDriver, uint32 sid, EpsSubscriberStatT* pStat);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* EPS_SHM_DRIVER_H */
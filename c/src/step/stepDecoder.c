@@ -70,10 +70,12 @@
     case STEP_POSSDUP_FLAG_TAG:\
     {\
         STEP_EXTRACT_CHAR_VALUE(field, char, pMsg->possDupFlag);\
+        break;\
     }\
     case STEP_POSSRESEND_TAG:\
     {\
         STEP_EXTRACT_CHAR_VALUE(field, char, pMsg->possResend);\
+        break;\
     }\
     case STEP_SENDING_TIME_TAG:\
     {\
@@ -107,6 +109,10 @@ static ResCodeT DecodeMDSnapshotFullRefreshRecord(const char* buf, int32 bufSize
         StepMessageT* pMsg);
 static ResCodeT DecodeTradingStatusRecord(const char* buf, int32 bufSize, 
         StepMessageT* pMsg);
+static ResCodeT DecodeResendRequestRecord(const char* buf, int32 bufSize, 
+        StepMessageT* pMsg);
+static ResCodeT DecodeSequenceResetRecord(const char* buf, int32 bufSize, 
+        StepMessageT* pMsg);
 
 /*
  * ʵ
@@ -282,6 +288,16 @@ static ResCodeT DecodeStepMessageBody(const char* buf, int32 bufSize, StepMessag
             THROW_ERROR(DecodeTradingStatusRecord((char*)buf + bufOffset, 
                 bufSize - bufOffset, pMsg));
         }
+        else if (strncmp(STEP_MSGTYPE_RESEND_REQUEST_VALUE, msgType, sizeof(msgType)) == 0)
+        {
+            THROW_ERROR(DecodeResendRequestRecord((char*)buf + bufOffset, 
+                bufSize - bufOffset, pMsg));
+        }
+        else if (strncmp(STEP_MSGTYPE_SEQUENCE_RESET_VALUE, msgType, sizeof(msgType)) == 0)
+        {
+            THROW_ERROR(DecodeSequenceResetRecord((char*)buf + bufOffset, 
+                bufSize - bufOffset, pMsg));
+        }
         else
         {
             THROW_ERROR(ERCD_STEP_INVALID_MSGTYPE, msgType);
@@ -767,3 +783,123 @@ static ResCodeT DecodeTradingStatusRecord(const char* buf, int32 bufSize,
         RETURN_RESCODE;
     }
 }
+
+/*
+ * STEPطϢ
+ *
+ * @param   buf             in  - 뻺
+ * @param   bufSize         in  - 뻺
+ * @param   pMsg            out - STEPϢ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+static ResCodeT DecodeResendRequestRecord(const char* buf, int32 bufSize, StepMessageT* pMsg)
+{
+    TRY
+    {
+        /* ط¼ʼģ */
+        static const ResendRequestRecordT STEP_RESENDREQUEST_RECORD_TEMPLATE = 
+        {
+            STEP_INVALID_UINT_VALUE,    /* beginSeqNo */
+            STEP_INVALID_UINT_VALUE,    /* endSeqNo */
+        };
+
+        pMsg->msgType = STEP_MSGTYPE_RESEND_REQUEST;
+
+        StepFieldT field;
+        int32 bufOffset = 0;
+        ResendRequestRecordT* pRecord = (ResendRequestRecordT*)pMsg->body;
+        memcpy(pRecord, &STEP_RESENDREQUEST_RECORD_TEMPLATE, sizeof(ResendRequestRecordT));
+        
+        while(bufOffset < bufSize)
+        {
+            THROW_ERROR(GetTextField(buf, bufSize, &field, &bufOffset));
+      
+            switch(field.tag)
+            {
+                DECODE_STEP_MSG_HEADER_STUB
+                
+                case STEP_BEGIN_SEQNO_TAG:
+                {
+                    STEP_EXTRACT_INT_VALUE(field, uint64, pRecord->beginSeqNo);
+                    break;
+                }
+                case STEP_END_SEQNO_TAG:
+                {
+                    STEP_EXTRACT_INT_VALUE(field, uint64, pRecord->endSeqNo);
+                    break;
+                }
+                default:
+                    THROW_ERROR(ERCD_STEP_UNEXPECTED_TAG, field.tag);
+                    break;
+            }
+        }
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/*
+ * STEPϢ
+ *
+ * @param   buf             in  - 뻺
+ * @param   bufSize         in  - 뻺
+ * @param   pMsg            out - STEPϢ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+static ResCodeT DecodeSequenceResetRecord(const char* buf, int32 bufSize, StepMessageT* pMsg)
+{
+    TRY
+    {
+        /* ü¼ʼģ */
+        static const SequenceResetRecordT STEP_SEQUENCERESET_RECORD_TEMPLATE = 
+        {
+            STEP_INVALID_BOOLEAN_VALUE, /* gapFillFlag */
+            STEP_INVALID_UINT_VALUE,    /* newSeqNo */
+        };
+
+        pMsg->msgType = STEP_MSGTYPE_SEQUENCE_RESET;
+
+        StepFieldT field;
+        int32 bufOffset = 0;
+        SequenceResetRecordT* pRecord = (SequenceResetRecordT*)pMsg->body;
+        memcpy(pRecord, &STEP_SEQUENCERESET_RECORD_TEMPLATE, sizeof(SequenceResetRecordT));
+        
+        while(bufOffset < bufSize)
+        {
+            THROW_ERROR(GetTextField(buf, bufSize, &field, &bufOffset));
+      
+            switch(field.tag)
+            {
+                DECODE_STEP_MSG_HEADER_STUB
+                
+                case STEP_GAPFILL_FLAG_TAG:
+                {
+                    STEP_EXTRACT_CHAR_VALUE(field, char, pRecord->gapFillFlag);
+                    break;
+                }
+                case STEP_NEW_SEQNO_TAG:
+                {
+                    STEP_EXTRACT_INT_VALUE(field, uint64, pRecord->newSeqNo);
+                    break;
+                }
+                default:
+                    THROW_ERROR(ERCD_STEP_UNEXPECTED_TAG, field.tag);
+                    break;
+            }
+        }
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
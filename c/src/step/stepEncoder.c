@@ -53,6 +53,8 @@ static const char* STEP_MSGTYPE_MAP[] =
     STEP_MSGTYPE_MD_REQUEST_VALUE,
     STEP_MSGTYPE_MD_SNAPSHOT_VALUE,
     STEP_MSGTYPE_TRADING_STATUS_VALUE,
+    STEP_MSGTYPE_RESEND_REQUEST_VALUE,
+    STEP_MSGTYPE_SEQUENCE_RESET_VALUE,
 };
 
 
@@ -72,6 +74,10 @@ static ResCodeT EncodeMDSnapshotFullRefreshRecord(MDSnapshotFullRefreshRecordT*
         char* buf, int32 bufSize, int32* pEncodeSize);
 static ResCodeT EncodeTradingStatusRecord(TradingStatusRecordT* pRecord, 
         char* buf, int32 bufSize, int32* pEncodeSize);
+static ResCodeT EncodeResendRequestRecord(ResendRequestRecordT* pRecord, 
+        char* buf, int32 bufSize, int32* pEncodeSize);
+static ResCodeT EncodeSequenceResetRecord(SequenceResetRecordT* pRecord, 
+        char* buf, int32 bufSize, int32* pEncodeSize);
 static ResCodeT EncodeStepMessageBody(StepMessageT* pMsg, 
         char* buf, int32 bufSize, int32* pEncodeSize);
 
@@ -434,6 +440,87 @@ static ResCodeT EncodeTradingStatusRecord(TradingStatusRecordT* pRecord,
     }
 }
 
+/**
+ * طϢ
+ *
+ * @param   pRecord         in  - طϢ
+ * @param   buf             in  - 뻺
+ *                          out - Ļ
+ * @param   bufSize         in  - 뻺
+ * @param   pEncodeSize     in  - ǰѱ볤
+ *                          out - 󻺳ѱ볤
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+static ResCodeT EncodeResendRequestRecord(ResendRequestRecordT* pRecord, 
+        char* buf, int32 bufSize, int32* pEncodeSize)
+{
+    TRY
+    {
+        int32 recordSize = 0;
+
+        char* bufBegin    = buf + *pEncodeSize;
+        int32 bufLeftSize = bufSize - *pEncodeSize;
+
+        THROW_ERROR(AddUint64Field(STEP_BEGIN_SEQNO_TAG, pRecord->beginSeqNo, 
+                bufBegin, bufLeftSize, &recordSize));
+
+        THROW_ERROR(AddUint64Field(STEP_END_SEQNO_TAG, pRecord->endSeqNo, 
+                bufBegin, bufLeftSize, &recordSize));
+
+        *pEncodeSize += recordSize;
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * Ϣ
+ *
+ * @param   pRecord         in  - Ϣ
+ * @param   buf             in  - 뻺
+ *                          out - Ļ
+ * @param   bufSize         in  - 뻺
+ * @param   pEncodeSize     in  - ǰѱ볤
+ *                          out - 󻺳ѱ볤
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+static ResCodeT EncodeSequenceResetRecord(SequenceResetRecordT* pRecord, 
+        char* buf, int32 bufSize, int32* pEncodeSize)
+{
+    TRY
+    {
+        int32 recordSize = 0;
+
+        char* bufBegin    = buf + *pEncodeSize;
+        int32 bufLeftSize = bufSize - *pEncodeSize;
+
+        if (pRecord->gapFillFlag != STEP_INVALID_BOOLEAN_VALUE)
+        {
+            THROW_ERROR(AddInt8Field(STEP_GAPFILL_FLAG_TAG, pRecord->gapFillFlag, 
+                    bufBegin, bufLeftSize, &recordSize));
+        }
+
+        THROW_ERROR(AddUint64Field(STEP_NEW_SEQNO_TAG, pRecord->newSeqNo, 
+                bufBegin, bufLeftSize, &recordSize));
+
+        *pEncodeSize += recordSize;
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
 /**
  * STEPϢ
  *
@@ -473,13 +560,13 @@ static ResCodeT EncodeStepMessageBody(StepMessageT* pMsg, char* buf, int32 bufSi
 
         if (pMsg->possDupFlag != STEP_INVALID_BOOLEAN_VALUE)
         {
-            THROW_ERROR(AddUint8Field(STEP_POSSDUP_FLAG_TAG, pMsg->possDupFlag, 
+            THROW_ERROR(AddInt8Field(STEP_POSSDUP_FLAG_TAG, pMsg->possDupFlag, 
                     (char*)buf, bufSize, &encodeSize));
         }
 
         if (pMsg->possResend != STEP_INVALID_BOOLEAN_VALUE)
         {
-            THROW_ERROR(AddUint8Field(STEP_POSSRESEND_TAG, pMsg->possResend, 
+            THROW_ERROR(AddInt8Field(STEP_POSSRESEND_TAG, pMsg->possResend, 
                     (char*)buf, bufSize, &encodeSize));
         }
         THROW_ERROR(AddStringField(STEP_SENDING_TIME_TAG, pMsg->sendingTime, 
@@ -526,6 +613,18 @@ static ResCodeT EncodeStepMessageBody(StepMessageT* pMsg, char* buf, int32 bufSi
                         (char*)buf, bufSize, &encodeSize));
                 break;
             }
+            case STEP_MSGTYPE_RESEND_REQUEST:
+            {
+                THROW_ERROR(EncodeResendRequestRecord((ResendRequestRecordT*)pMsg->body, 
+                        (char*)buf, bufSize, &encodeSize));
+                break;
+            }
+            case STEP_MSGTYPE_SEQUENCE_RESET:
+            {
+                THROW_ERROR(EncodeSequenceResetRecord((SequenceResetRecordT*)pMsg->body, 
+                        (char*)buf, bufSize, &encodeSize));
+                break;
+            }
             
             default:
                 THROW_ERROR(ERCD_STEP_INVALID_MSGTYPE, pMsg->msgType);
@@ -75,6 +75,8 @@ extern "C" {
  */
 
 #define STEP_MSGTYPE_HEARTBEAT_VALUE                "0"
+#define STEP_MSGTYPE_RESEND_REQUEST_VALUE           "2"
+#define STEP_MSGTYPE_SEQUENCE_RESET_VALUE           "4"
 #define STEP_MSGTYPE_LOGOUT_VALUE                   "5"
 #define STEP_MSGTYPE_LOGON_VALUE                    "A"
 #define STEP_MSGTYPE_MD_REQUEST_VALUE               "V"
@@ -163,6 +165,8 @@ typedef enum StepMsgTypeTag
     STEP_MSGTYPE_MD_REQUEST       = 3,  /* Ϣ, 'V' */
     STEP_MSGTYPE_MD_SNAPSHOT      = 4,  /* ȫϢ, 'W' */
     STEP_MSGTYPE_TRADING_STATUS   = 5,  /* г״̬Ϣ, 'h' */
+    STEP_MSGTYPE_RESEND_REQUEST   = 6,  /* طϢ, '2' */
+    STEP_MSGTYPE_SEQUENCE_RESET   = 7,  /* Ϣ, '4' */
     STEP_MSGTYPE_COUNT
 } StepMsgTypeT;
 
@@ -234,6 +238,24 @@ typedef struct LogonRecordTag
     char    defaultCstmApplVerID[STEP_CSTM_APPLVER_ID_MAX_LEN+1];
 } LogonRecordT;
 
+/*
+ * طϢṹ
+ */
+typedef struct ResendRequestRecordTag
+{
+    uint64  beginSeqNo;
+    uint64  endSeqNo;
+} ResendRequestRecordT;
+
+/*
+ * Ϣṹ
+ */
+typedef struct SequenceResetRecordTag
+{
+    char    gapFillFlag;
+    uint64  newSeqNo;
+} SequenceResetRecordT;
+
 /*
  * 鶩Ϣṹ
  */
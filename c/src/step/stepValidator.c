@@ -56,6 +56,10 @@ static ResCodeT ValidateMDSnapshortRecord(const MDSnapshotFullRefreshRecordT* pR
         StepDirectionT direction);
 static ResCodeT ValidateTradingStatusRecord(const TradingStatusRecordT* pRecord, 
         StepDirectionT direction);
+static ResCodeT ValidateResendRequestRecord(const ResendRequestRecordT* pRecord, 
+        StepDirectionT direction);
+static ResCodeT ValidateSequenceResetRecord(const SequenceResetRecordT* pRecord, 
+        StepDirectionT direction);
 
 /*
  * ʵ
@@ -109,6 +113,18 @@ ResCodeT ValidateStepMessage(const StepMessageT* pMsg, StepDirectionT direction)
                         direction));
                 break;
             }
+            case STEP_MSGTYPE_RESEND_REQUEST:
+            {
+                THROW_ERROR(ValidateResendRequestRecord((const ResendRequestRecordT*)pMsg->body, 
+                        direction));
+                break;
+            }
+            case STEP_MSGTYPE_SEQUENCE_RESET:
+            {
+                THROW_ERROR(ValidateSequenceResetRecord((const SequenceResetRecordT*)pMsg->body, 
+                        direction));
+                break;
+            }
             default:
                 THROW_ERROR(ERCD_STEP_INVALID_MSGTYPE, pMsg->msgType);
                 break;
@@ -431,3 +447,62 @@ ResCodeT ValidateTradingStatusRecord(const TradingStatusRecordT* pRecord,
         RETURN_RESCODE;
     }
 }
+
+/**
+ * УطϢ
+ *
+ * @param   pRecord         in  - طϢ
+ * @param   direction       in  - Ϣ䷽
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT ValidateResendRequestRecord(const ResendRequestRecordT* pRecord, 
+        StepDirectionT direction)
+{
+    TRY
+    {
+        if (pRecord->beginSeqNo == (uint64)STEP_INVALID_UINT_VALUE)
+        {
+            THROW_ERROR(ERCD_STEP_FLD_NOTFOUND, "7, beginSeqNo");
+        }
+
+        if (pRecord->endSeqNo == (uint64)STEP_INVALID_UINT_VALUE)
+        {
+            THROW_ERROR(ERCD_STEP_FLD_NOTFOUND, "16, endSeqNo");
+        }
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * УϢ
+ *
+ * @param   pRecord         in  - Ϣ
+ * @param   direction       in  - Ϣ䷽
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT ValidateSequenceResetRecord(const SequenceResetRecordT* pRecord, 
+        StepDirectionT direction)
+{
+    TRY
+    {
+        if (pRecord->newSeqNo == (uint64)STEP_INVALID_UINT_VALUE)
+        {
+            THROW_ERROR(ERCD_STEP_FLD_NOTFOUND, "36, newSeqNo");
+        }
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
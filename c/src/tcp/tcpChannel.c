@@ -31,6 +31,7 @@ DD-MMM-YYYY INIT.    SIR    Modification Description
 #include "common.h"
 #include "epsTypes.h"
 #include "errlib.h"
+#include "atomic.h"
 
 #include "tcpChannel.h"
 
@@ -38,8 +39,18 @@ DD-MMM-YYYY INIT.    SIR    Modification Description
  * 궨
  */
 
-#define EPS_SENDDATA_MAX_LEN                    8192
 #define EPS_SENDQUEUE_SIZE                      128
+#define EPS_EVENTQUEUE_SIZE                     128     /* ¼гȣΪ2 */
+
+#if defined(EPS_IOENGINE_URING)
+#define EPS_URING_ENTRIES                       8       /* io_uringύг */
+#define EPS_URING_BUFGROUP                      0       /* ջID */
+#define EPS_URING_BUFCOUNT                      64      /* ջƬ */
+#define EPS_URING_USERDATA_RECV                 1       /* νʶ */
+#define EPS_URING_USERDATA_TIMEOUT              2       /* ճʱʶ */
+#define EPS_URING_USERDATA_SEND                 3       /* ʶ */
+#define EPS_URING_USERDATA_LINK_TIMEOUT         4       /* ӳʱʶ */
+#endif
 
 
 /** 
@@ -62,9 +73,16 @@ typedef struct EpsSendDataTag
 
 static void* ChannelTask(void* arg);
 
+static ResCodeT HandleEvent(EpsTcpChannelT* pChannel);
 static ResCodeT SendData(EpsTcpChannelT* pChannel);
-static ResCodeT ReceiveData(EpsTcpChannelT* pChannel);
+static ResCodeT ReceiveData(EpsTcpChannelT* pChannel, uint64 timeout);
 static ResCodeT ClearSendQueue(EpsTcpChannelT* pChannel);
+static int StartConnect(const EpsTcpServerT* pServer, SOCKET* pFd, BOOL* pIsConnected);
+static void AbortConnect(EpsTcpChannelT* pChannel);
+static void CloseSocket(SOCKET fd);
+#if defined(EPS_IOENGINE_URING)
+static ResCodeT ReapCompletions(EpsTcpChannelT* pChannel, BOOL* pIsTimeout);
+#endif
 
 static BOOL IsChannelInited(EpsTcpChannelT * pChannel);
 static BOOL IsChannelStarted(EpsTcpChannelT* pChannel);
@@ -74,6 +92,7 @@ static void OnChannelConnected(void* pListener);
 static void OnChannelDisconnected(void* pListener, ResCodeT result, const char* reason);
 static void OnChannelReceived(void* pListener, ResCodeT result, const char* data, uint32 dataLen);
 static void OnChannelSended(void* pListener, ResCodeT result, const char* data, uint32 dataLen);
+static void OnChannelEventOccurred(void* pListener, EpsTcpChannelEventT* pEvent);
 
 
 /**
@@ -99,9 +118,32 @@ ResCodeT InitTcpChannel(EpsTcpChannelT* pChannel)
         pChannel->socket = INVALID_SOCKET;
         pChannel->tid = 0;
 
-        pChannel->canStop = TRUE;
-        pChannel->status  = EPS_TCPCHANNEL_STATUS_STOP;
-        InitUniQueue(&pChannel->sendQueue, EPS_SENDQUEUE_SIZE);
+        uint32 i = 0;
+        memset(&pChannel->connecting, 0x00, sizeof(pChannel->connecting));
+        for (i = 0; i < EPS_TCP_SERVER_MAX_NUM; i++)
+        {
+            pChannel->connecting.fds[i] = INVALID_SOCKET;
+        }
+
+        EpsAtomicStore(&pChannel->canStop, TRUE);
+        EpsAtomicStore(&pChannel->status, EPS_TCPCHANNEL_STATUS_STOP);
+        memset(&pChannel->stat, 0x00, sizeof(pChannel->stat));
+        pChannel->recvTime = 0;
+        pChannel->serverCount = 0;
+        pChannel->serverIndex = 0;
+        pChannel->reconnectTimes = 0;
+        pChannel->reconnectTime = 0;
+        pChannel->notifyTime = 0;
+        pChannel->isManual = FALSE;
+        pChannel->pollFd = -1;
+#if defined(EPS_IOENGINE_URING)
+        memset(&pChannel->ring, 0x00, sizeof(pChannel->ring));
+        pChannel->ring.ringFd = -1;
+#endif
+        THROW_ERROR(InitRingQueue(&pChannel->sendQueue, EPS_RINGQUEUE_TYPE_MPSC,
+                EPS_SENDQUEUE_SIZE, sizeof(EpsSendDataT)));
+        THROW_ERROR(InitRingQueue(&pChannel->eventQueue, EPS_RINGQUEUE_TYPE_MPSC,
+                EPS_EVENTQUEUE_SIZE, sizeof(EpsTcpChannelEventT)));
     
         EpsTcpChannelListenerT listener = 
         {
@@ -109,7 +151,8 @@ ResCodeT InitTcpChannel(EpsTcpChannelT* pChannel)
             OnChannelConnected,
             OnChannelDisconnected,
             OnChannelReceived,
-            OnChannelSended
+            OnChannelSended,
+            OnChannelEventOccurred
         };    
         pChannel->listener = listener;
     }
@@ -139,7 +182,8 @@ ResCodeT UninitTcpChannel(EpsTcpChannelT* pChannel)
         } 
 
         CloseTcpChannel(pChannel);
-        UninitUniQueue(&pChannel->sendQueue);
+        UninitRingQueue(&pChannel->sendQueue);
+        UninitRingQueue(&pChannel->eventQueue);
     }
     CATCH
     {
@@ -163,9 +207,9 @@ ResCodeT StartupTcpChannel(EpsTcpChannelT* pChannel)
     {
         if (IsChannelStarted(pChannel))
         {
-            if (pChannel->status == EPS_TCPCHANNEL_STATUS_IDLE)
+            if (EpsAtomicLoad(&pChannel->status) == EPS_TCPCHANNEL_STATUS_IDLE)
             {
-                pChannel->status = EPS_TCPCHANNEL_STATUS_WORK;
+                EpsAtomicStore(&pChannel->status, EPS_TCPCHANNEL_STATUS_WORK);
                 THROW_RESCODE(NO_ERR);
             }
             else
@@ -174,8 +218,16 @@ ResCodeT StartupTcpChannel(EpsTcpChannelT* pChannel)
             }
         }
        
-        pChannel->canStop = FALSE;
-        pChannel->status = EPS_TCPCHANNEL_STATUS_WORK;
+        pChannel->reconnectTime = 0;
+        pChannel->notifyTime = EpsGetTimestamp();
+        EpsAtomicStore(&pChannel->canStop, FALSE);
+        EpsAtomicStore(&pChannel->status, EPS_TCPCHANNEL_STATUS_WORK);
+
+        /* Ӧ߳ģʽӦ̵߳PollTcpChannelͨ߳ */
+        if (pChannel->isManual)
+        {
+            THROW_RESCODE(NO_ERR);
+        }
         
 #if defined(__WINDOWS__)
         DWORD tid = 0;
@@ -183,7 +235,7 @@ ResCodeT StartupTcpChannel(EpsTcpChannelT* pChannel)
             (LPVOID)pChannel, 0, (LPDWORD)&tid);
         if (tid == 0)
         {
-        	pChannel->status = EPS_TCPCHANNEL_STATUS_STOP;
+        	EpsAtomicStore(&pChannel->status, EPS_TCPCHANNEL_STATUS_STOP);
             int lstErrno = SYS_ERRNO;
         	THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, EpsGetSystemError(lstErrno));
         }
@@ -196,7 +248,7 @@ ResCodeT StartupTcpChannel(EpsTcpChannelT* pChannel)
         int result = pthread_create(&tid, NULL, ChannelTask, (void*)pChannel);
         if (result != 0)
         {
-        	pChannel->status = EPS_TCPCHANNEL_STATUS_STOP;
+        	EpsAtomicStore(&pChannel->status, EPS_TCPCHANNEL_STATUS_STOP);
             THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, EpsGetSystemError(result));
         }
         pChannel->tid = tid;
@@ -227,6 +279,16 @@ ResCodeT ShutdownTcpChannel(EpsTcpChannelT* pChannel)
             THROW_RESCODE(NO_ERR);
         }
 
+        /* Ӧ߳ģʽɵֱ߳ӹرգȷʱûִ߳PollTcpChannel */
+        if (pChannel->isManual && pChannel->tid == 0)
+        {
+            CloseTcpChannel(pChannel);
+
+            EpsAtomicStore(&pChannel->canStop, TRUE);
+            EpsAtomicStore(&pChannel->status, EPS_TCPCHANNEL_STATUS_STOP);
+            THROW_RESCODE(NO_ERR);
+        }
+
 #if defined(__WINDOWS__)
         if (pChannel->tid != GetCurrentThreadId())
 #endif
@@ -235,16 +297,16 @@ ResCodeT ShutdownTcpChannel(EpsTcpChannelT* pChannel)
         if (pChannel->tid != pthread_self())
 #endif
         {
-            pChannel->canStop = TRUE;
+            EpsAtomicStore(&pChannel->canStop, TRUE);
         }
         else
         {
-            if (pChannel->status == EPS_TCPCHANNEL_STATUS_WORK)
+            if (EpsAtomicLoad(&pChannel->status) == EPS_TCPCHANNEL_STATUS_WORK)
             {
                 CloseTcpChannel(pChannel);
             }
 
-            pChannel->status = EPS_TCPCHANNEL_STATUS_IDLE;
+            EpsAtomicStore(&pChannel->status, EPS_TCPCHANNEL_STATUS_IDLE);
         }
     }
     CATCH
@@ -327,16 +389,43 @@ ResCodeT SendTcpChannel(EpsTcpChannelT* pChannel, const char* data, uint32 dataL
             THROW_ERROR(ERCD_EPS_UNINITED, "channel");
         }
 
-        EpsSendDataT* pData = (EpsSendDataT*)calloc(1, sizeof(EpsSendDataT));
-        if (pData == NULL)
-        {
-            int lstErrno = SYS_ERRNO;
-            THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, EpsGetSystemError(lstErrno));
-        }
+        /* ֱд뷢Ͷвλû߳̿ɲ */
+        EpsSendDataT* pData = NULL;
+        THROW_ERROR(ReserveRingQueue(&pChannel->sendQueue, (void**)&pData));
+
         memcpy(pData->data, data, dataLen);
         pData->dataLen = dataLen;
+        CommitRingQueue(&pChannel->sendQueue, pData);
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
 
-        THROW_ERROR(PushUniQueue(&pChannel->sendQueue, (void*)pData));
+/*
+ * TCPͨ첽¼
+ *
+ * ¼ͨ߳״̬¼ڼδʱERCD_EPS_QUEUE_FULLɵߴ
+ *
+ * @param   pChannel            in  - TCPͨ
+ * @param   pEvent              in  - ¼
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT TriggerTcpChannelEvent(EpsTcpChannelT* pChannel, const EpsTcpChannelEventT* pEvent)
+{
+    TRY
+    {
+        if(! IsChannelInited(pChannel))
+        {
+            THROW_ERROR(ERCD_EPS_UNINITED, "channel");
+        }
+
+        THROW_ERROR(PushRingQueue(&pChannel->eventQueue, pEvent));
     }
     CATCH
     {
@@ -381,6 +470,10 @@ ResCodeT RegisterTcpChannelListener(EpsTcpChannelT* pChannel, const EpsTcpChanne
         {
             pChannel->listener.sendedNotify = pListener->sendedNotify;
         }
+        if (pListener->eventOccurredNotify != NULL)
+        {
+            pChannel->listener.eventOccurredNotify = pListener->eventOccurredNotify;
+        }
     }
     CATCH
     {
@@ -401,131 +494,372 @@ static void* ChannelTask(void* arg)
 {
     EpsTcpChannelT* pChannel = (EpsTcpChannelT*)arg;
 
-    while (! pChannel->canStop)
+    while (! EpsAtomicLoad(&pChannel->canStop))
     {
-        if (pChannel->status == EPS_TCPCHANNEL_STATUS_IDLE)
+        if (EpsAtomicLoad(&pChannel->status) == EPS_TCPCHANNEL_STATUS_IDLE)
         {
             usleep(EPS_CHANNEL_IDLE_INTL * 1000);
             continue;
         }
+
+        if (NOTOK(PollTcpChannel(pChannel, (uint64)EPS_SOCKET_RECV_TIMEOUT * 1000000)))
+        {
+            ErrClearError();
+        }
+    }
+    
+    CloseTcpChannel(pChannel);
+
+    EpsAtomicStore(&pChannel->status, EPS_TCPCHANNEL_STATUS_STOP);
+
+    return 0;
+}
+
+/**
+ * ִһTCPͨ¼Ӽշ
+ *
+ * ͨ߳ѭñӦ߳ģʽӦ̵߳ã
+ * ʱڵ߳н벢صδʱδʱȴtimeout󷵻أ
+ * ճʱ֪ͨ԰EPS_SOCKET_RECV_TIMEOUTڷtimeout޹
+ *
+ * @param   pChannel            in  - TCPͨ
+ * @param   timeout             in  - ȴݵʱ()0ʾȴ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT PollTcpChannel(EpsTcpChannelT* pChannel, uint64 timeout)
+{
+    TRY
+    {
+        /* ȴ첽¼δʱҲԱڼĲǰЧ */
+        if (NOTOK(HandleEvent(pChannel)))
+        {
+            ErrClearError();
+        }
         
         /* TCPͨ */
         if (! IsChannelConnected(pChannel))
         {
-            if (NOTOK(OpenTcpChannel(pChannel)))
+            uint64 now = EpsGetTimestamp();
+            if (! pChannel->connecting.isConnecting && now < pChannel->reconnectTime)
+            {
+                uint64 waitTime = pChannel->reconnectTime - now;
+                if (waitTime > timeout)
+                {
+                    waitTime = timeout;
+                }
+                if (waitTime > 0)
+                {
+#if defined(__WINDOWS__)
+                    Sleep((DWORD)(waitTime / 1000000));
+#endif
+
+#if defined(__LINUX__) || defined(__HPUX__) 
+                    usleep((useconds_t)(waitTime / 1000));
+#endif
+                }
+                THROW_RESCODE(NO_ERR);
+            }
+
+            BOOL isOpened = FALSE;
+            if (NOTOK(OpenTcpChannel(pChannel, timeout, &isOpened)))
             {
                 pChannel->listener.disconnectedNotify(pChannel->listener.pListener,
                     ErrGetErrorCode(), ErrGetErrorDscr());
 
                 ErrClearError();
 
-#if defined(__WINDOWS__)
-                Sleep(EPS_CHANNEL_RECONNECT_INTL);
-#endif
-
-#if defined(__LINUX__) || defined(__HPUX__) 
-                usleep(EPS_CHANNEL_RECONNECT_INTL * 1000);
-#endif                
+                /* ָ˱ܣȴʱ[delay/2, delay]ͻͬʱ */
+                uint32 delay = EPS_CHANNEL_RECONNECT_INTL;
+                if (pChannel->reconnectTimes < 16 &&
+                    (EPS_CHANNEL_RECONNECT_MIN_INTL << pChannel->reconnectTimes) < EPS_CHANNEL_RECONNECT_INTL)
+                {
+                    delay = EPS_CHANNEL_RECONNECT_MIN_INTL << pChannel->reconnectTimes;
+                }
+                delay = delay / 2 + (uint32)((EpsGetTimestamp() / 1000) % (delay / 2 + 1));
+                pChannel->reconnectTimes++;
+                pChannel->reconnectTime = EpsGetTimestamp() + (uint64)delay * 1000000;
 
-                continue;
+                THROW_RESCODE(NO_ERR);
+            }
+            else if (! isOpened)
+            {
+                /* ڽУ´εüƽ */
+                THROW_RESCODE(NO_ERR);
             }
             else
             {
+                pChannel->reconnectTimes = 0;
+                pChannel->notifyTime = EpsGetTimestamp();
                 pChannel->listener.connectedNotify(pChannel->listener.pListener);
             }
         }
         
+        /* շʧʱͨѹرղ֪ͨߣ´εʱ */
+
         /* ȴݷ */
         if (NOTOK(SendData(pChannel)))
         {
             ErrClearError();
-            continue;
+            THROW_RESCODE(NO_ERR);
         }
 
         /*  */
-        if (NOTOK(ReceiveData(pChannel)))
+        if (NOTOK(ReceiveData(pChannel, timeout)))
         {
             ErrClearError();
-            continue;
         }
     }
-    
-    CloseTcpChannel(pChannel);
-
-    pChannel->status = EPS_TCPCHANNEL_STATUS_STOP;
-
-    return 0;
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
 }
 
 /**
- * TCPͨ
+ * ƽTCPͨ
+ *
+ * δӣȽʤеӱͨУ
+ * εȴtimeout󷵻أ´εüƽEPS_TCP_CONNECT_TIMEOUTʱ
+ * epollʱе׽ͬʱӽʧʱ
  *
  * @param   pChannel            in  - TCPͨ
+ * @param   timeout             in  - εõȴӵʱ()0ʾֻһ
+ * @param   pIsOpened           out - ǷѽΪFALSEʱڽ
  *
- * @return  ɹNO_ERR򷵻ش
+ * @return  ɹNO_ERRʧܻʱش
  */
-ResCodeT OpenTcpChannel(EpsTcpChannelT* pChannel)
+ResCodeT OpenTcpChannel(EpsTcpChannelT* pChannel, uint64 timeout, BOOL* pIsOpened)
 {
+    EpsTcpConnectT* pConnect = &pChannel->connecting;
     SOCKET fd = INVALID_SOCKET;
+    uint32 i = 0;
+
+    *pIsOpened = FALSE;
 
     TRY
     {
         int result = SOCKET_ERROR;
-      
-        fd = socket(AF_INET, SOCK_STREAM, 0);
-        if (fd == INVALID_SOCKET)
+        int lstErrno = 0;
+
+        if (! pConnect->isConnecting)
         {
-            int lstErrno = NET_ERRNO;
-            THROW_ERROR(ERCD_EPS_SOCKET_ERROR, EpsGetSystemError(lstErrno));
+            if (pChannel->serverCount == 0)
+            {
+                THROW_ERROR(ERCD_EPS_SOCKET_ERROR, "no server address");
+            }
+
+            /* ϴӳɹķȣఴ˳ */
+            pConnect->count = 0;
+            pConnect->order[pConnect->count++] = pChannel->serverIndex;
+            for (i = 0; i < pChannel->serverCount; i++)
+            {
+                if (i != pChannel->serverIndex)
+                {
+                    pConnect->order[pConnect->count++] = i;
+                }
+            }
+
+            pConnect->started   = 0;
+            pConnect->failed    = 0;
+            pConnect->lstErrno  = 0;
+            pConnect->beginTime = EpsGetTimestamp();
+            pConnect->deadline  = pConnect->beginTime + (uint64)EPS_TCP_CONNECT_TIMEOUT * 1000000;
+            pConnect->nextTime  = pConnect->beginTime;
+            pConnect->isConnecting = TRUE;
         }
-   
-        BOOL reuseaddr = TRUE;
-        result = setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, (const char*)&reuseaddr, sizeof(reuseaddr));
-        if (result == SOCKET_ERROR)
+
+        /* δӣȽʤ */
+        uint64 endTime = EpsGetTimestamp() + timeout;
+        BOOL isPolled = FALSE;
+        int winner = -1;
+
+        while (winner < 0)
         {
-            int lstErrno = NET_ERRNO;
-            THROW_ERROR(ERCD_EPS_SOCKET_ERROR, EpsGetSystemError(lstErrno));
+            uint64 now = EpsGetTimestamp();
+
+            if (pConnect->started < pConnect->count &&
+                (now >= pConnect->nextTime || pConnect->failed == pConnect->started))
+            {
+                uint32 index = pConnect->order[pConnect->started++];
+                pConnect->nextTime = now + (uint64)EPS_TCP_CONNECT_STAGGER * 1000000;
+
+                BOOL isConnected = FALSE;
+                result = StartConnect(&pChannel->servers[index], &pConnect->fds[index], &isConnected);
+                if (result != 0)
+                {
+                    pConnect->lstErrno = result;
+                    pConnect->failed++;
+                }
+                else if (isConnected)
+                {
+                    winner = index;
+                    break;
+                }
+#if defined(__LINUX__)
+                else if (pChannel->pollFd >= 0 &&
+                    EpsAddPollConnectSocket(pChannel->pollFd, pConnect->fds[index]) == SOCKET_ERROR)
+                {
+                    lstErrno = SYS_ERRNO;
+                    THROW_ERROR(ERCD_EPS_SOCKET_ERROR, EpsGetSystemError(lstErrno));
+                }
+#endif
+                continue;
+            }
+
+            if (pConnect->failed == pConnect->started)
+            {
+                THROW_ERROR(ERCD_EPS_SOCKET_ERROR, EpsGetSystemError(pConnect->lstErrno));
+            }
+
+            if (now >= pConnect->deadline)
+            {
+                THROW_ERROR(ERCD_EPS_SOCKET_ERROR, "connect timeout");
+            }
+
+            /* εõĵȴʱ꣬ӱ´εüƽ */
+            if (isPolled && now >= endTime)
+            {
+                THROW_RESCODE(NO_ERR);
+            }
+
+            uint64 waitTime = pConnect->deadline - now;
+            if (pConnect->started < pConnect->count && pConnect->nextTime - now < waitTime)
+            {
+                waitTime = pConnect->nextTime - now;
+            }
+            uint64 leftTime = (endTime > now) ? (endTime - now) : 0;
+            if (leftTime < waitTime)
+            {
+                waitTime = leftTime;
+            }
+
+            fd_set wrset, exset;
+            FD_ZERO(&wrset);
+            FD_ZERO(&exset);
+            SOCKET maxFd = 0;
+            for (i = 0; i < pChannel->serverCount; i++)
+            {
+                if (pConnect->fds[i] != INVALID_SOCKET)
+                {
+                    FD_SET(pConnect->fds[i], &wrset);
+                    FD_SET(pConnect->fds[i], &exset);
+                    if (pConnect->fds[i] > maxFd)
+                    {
+                        maxFd = pConnect->fds[i];
+                    }
+                }
+            }
+
+            struct timeval tv;
+            tv.tv_sec  = waitTime / 1000000000;
+            tv.tv_usec = (waitTime % 1000000000) / 1000;
+
+            result = select(maxFd+1, 0, &wrset, &exset, &tv);
+            if (result == SOCKET_ERROR)
+            {
+                lstErrno = NET_ERRNO;
+                THROW_ERROR(ERCD_EPS_SOCKET_ERROR, EpsGetSystemError(lstErrno));
+            }
+            isPolled = TRUE;
+
+            for (i = 0; i < pConnect->count && result > 0; i++)
+            {
+                uint32 index = pConnect->order[i];
+                if (pConnect->fds[index] == INVALID_SOCKET ||
+                    (! FD_ISSET(pConnect->fds[index], &wrset) && ! FD_ISSET(pConnect->fds[index], &exset)))
+                {
+                    continue;
+                }
+
+                int error = 0;
+                socklen_t len = sizeof(error);
+                if (getsockopt(pConnect->fds[index], SOL_SOCKET, SO_ERROR, (char*)&error, &len) == SOCKET_ERROR)
+                {
+                    error = NET_ERRNO;
+                }
+
+                if (error == 0)
+                {
+                    winner = index;
+                    break;
+                }
+
+                pConnect->lstErrno = error;
+                CloseSocket(pConnect->fds[index]);
+                pConnect->fds[index] = INVALID_SOCKET;
+                pConnect->failed++;
+            }
         }
 
-        int rcvBufferSize = EPS_SOCKET_RECVBUFFER_LEN;
-        int len = sizeof(rcvBufferSize);
-        result = setsockopt(fd, SOL_SOCKET, SO_RCVBUF, (const char*)&rcvBufferSize, len);
+        /* ȡʤ׽֣ */
+        uint64 beginTime = pConnect->beginTime;
+        fd = pConnect->fds[winner];
+        pConnect->fds[winner] = INVALID_SOCKET;
+        AbortConnect(pChannel);
+
+#if defined(__LINUX__)
+        /* ڼԿд¼epollδ룬Ƴʧ */
+        if (pChannel->pollFd >= 0)
+        {
+            EpsDelPollSocket(pChannel->pollFd, fd);
+        }
+#endif
+
+        result = EpsSetSocketBlocking(fd, TRUE);
         if (result == SOCKET_ERROR)
         {
-            int lstErrno = NET_ERRNO;
+            lstErrno = NET_ERRNO;
             THROW_ERROR(ERCD_EPS_SOCKET_ERROR, EpsGetSystemError(lstErrno));
-        }   
+        }
 
-        struct sockaddr_in srvAddr;
-        memset(&srvAddr, 0x00, sizeof(srvAddr));
-            
-        srvAddr.sin_family      = AF_INET;
-        srvAddr.sin_addr.s_addr = inet_addr(pChannel->srvAddr);
-        srvAddr.sin_port        = htons(pChannel->srvPort);
+        pChannel->servers[winner].connectTime = EpsGetTimestamp() - beginTime;
+        pChannel->serverIndex = winner;
 
-        result = connect(fd, (struct sockaddr *)&srvAddr, sizeof(struct sockaddr));
-        if (result == SOCKET_ERROR)
-        {  
-            int lstErrno = NET_ERRNO;
+#if defined(EPS_IOENGINE_URING)
+        THROW_ERROR(InitIoUring(&pChannel->ring, EPS_URING_ENTRIES));
+
+        ResCodeT rc = RegisterIoUringBufRing(&pChannel->ring, EPS_URING_BUFGROUP, pChannel->recvBuffer,
+                EPS_SOCKET_RECVBUFFER_LEN / EPS_URING_BUFCOUNT, EPS_URING_BUFCOUNT);
+        if (OK(rc))
+        {
+            rc = RegisterIoUringBuffer(&pChannel->ring, pChannel->sendBuffer, EPS_SENDDATA_MAX_LEN);
+        }
+        if (NOTOK(rc))
+        {
+            UninitIoUring(&pChannel->ring);
+            THROW_ERROR(rc);
+        }
+
+        pChannel->isRecvArmed = FALSE;
+        pChannel->isTimeoutArmed = FALSE;
+        pChannel->isSendPending = FALSE;
+#endif
+            
+#if defined(__LINUX__)
+        if (pChannel->pollFd >= 0 && EpsAddPollSocket(pChannel->pollFd, fd) == SOCKET_ERROR)
+        {
+            lstErrno = SYS_ERRNO;
             THROW_ERROR(ERCD_EPS_SOCKET_ERROR, EpsGetSystemError(lstErrno));
         }
+#endif
             
         pChannel->socket = fd;
 
         ClearSendQueue(pChannel);
+
+        *pIsOpened = TRUE;
     }
     CATCH
     {
+        AbortConnect(pChannel);
+
     	if (fd != INVALID_SOCKET)
     	{
-#if defined(__WINDOWS__)
-    		closesocket(fd);
-#endif
-
-#if defined(__LINUX__) || defined(__HPUX__) 
-            close(fd);
-#endif
-
+            CloseSocket(fd);
     		fd = INVALID_SOCKET;
          }
     }
@@ -535,6 +869,110 @@ ResCodeT OpenTcpChannel(EpsTcpChannelT* pChannel)
     }
 }
 
+/**
+ * еӣرȫ׽
+ *
+ * @param   pChannel            in  - TCPͨ
+ */
+static void AbortConnect(EpsTcpChannelT* pChannel)
+{
+    EpsTcpConnectT* pConnect = &pChannel->connecting;
+    uint32 i = 0;
+
+    for (i = 0; i < EPS_TCP_SERVER_MAX_NUM; i++)
+    {
+        if (pConnect->fds[i] != INVALID_SOCKET)
+        {
+            CloseSocket(pConnect->fds[i]);
+            pConnect->fds[i] = INVALID_SOCKET;
+        }
+    }
+    pConnect->isConnecting = FALSE;
+}
+
+/**
+ * ׽ֲ
+ *
+ * @param   pServer             in  - ַ
+ * @param   pFd                 out - ׽
+ * @param   pIsConnected        out - Ƿ
+ *
+ * @return  ɹ0򷵻ϵͳ
+ */
+static int StartConnect(const EpsTcpServerT* pServer, SOCKET* pFd, BOOL* pIsConnected)
+{
+    int result = SOCKET_ERROR;
+    int lstErrno = 0;
+
+    SOCKET fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (fd == INVALID_SOCKET)
+    {
+        return NET_ERRNO;
+    }
+
+    BOOL reuseaddr = TRUE;
+    result = setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, (const char*)&reuseaddr, sizeof(reuseaddr));
+    if (result != SOCKET_ERROR)
+    {
+        int rcvBufferSize = EPS_SOCKET_RECVBUFFER_LEN;
+        result = setsockopt(fd, SOL_SOCKET, SO_RCVBUF, (const char*)&rcvBufferSize, sizeof(rcvBufferSize));
+    }
+#if defined(__LINUX__)
+    if (result != SOCKET_ERROR)
+    {
+        result = EpsEnableRecvTimestamp(fd);
+    }
+#endif
+    if (result != SOCKET_ERROR)
+    {
+        result = EpsSetSocketBlocking(fd, FALSE);
+    }
+
+    if (result != SOCKET_ERROR)
+    {
+        struct sockaddr_in srvAddr;
+        memset(&srvAddr, 0x00, sizeof(srvAddr));
+
+        srvAddr.sin_family      = AF_INET;
+        srvAddr.sin_addr.s_addr = inet_addr(pServer->srvAddr);
+        srvAddr.sin_port        = htons(pServer->srvPort);
+
+        result = connect(fd, (struct sockaddr *)&srvAddr, sizeof(struct sockaddr));
+        if (result == SOCKET_ERROR && NET_ERRNO == NET_EINPROGRESS)
+        {
+            *pFd = fd;
+            *pIsConnected = FALSE;
+            return 0;
+        }
+    }
+
+    if (result == SOCKET_ERROR)
+    {
+        lstErrno = NET_ERRNO;
+        CloseSocket(fd);
+        return lstErrno;
+    }
+
+    *pFd = fd;
+    *pIsConnected = TRUE;
+    return 0;
+}
+
+/**
+ * ر׽
+ *
+ * @param   fd                  in  - ׽
+ */
+static void CloseSocket(SOCKET fd)
+{
+#if defined(__WINDOWS__)
+    closesocket(fd);
+#endif
+
+#if defined(__LINUX__) || defined(__HPUX__) 
+    close(fd);
+#endif
+}
 
 /**
  * رTCPͨ
@@ -547,10 +985,16 @@ ResCodeT CloseTcpChannel(EpsTcpChannelT* pChannel)
 {
     TRY
     {
+        AbortConnect(pChannel);
+
        if (pChannel->socket != INVALID_SOCKET)
         {
         	shutdown(pChannel->socket, SHUT_RDWR);
 
+#if defined(EPS_IOENGINE_URING)
+            UninitIoUring(&pChannel->ring);
+#endif
+
 #if defined(__WINDOWS__)
         	closesocket(pChannel->socket);
 #endif
@@ -574,6 +1018,232 @@ ResCodeT CloseTcpChannel(EpsTcpChannelT* pChannel)
 }
 
 
+#if defined(EPS_IOENGINE_URING)
+
+/**
+ * ͨ¼(io_uring)
+ *
+ * ݿ̶WRITE_FIXEDύӷͳʱ
+ *
+ * @param   pChannel            in  - TCPͨ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+static ResCodeT SendData(EpsTcpChannelT* pChannel)
+{
+    TRY
+    {
+        EpsSendDataT* pData = NULL;
+        uint32 dataLen = 0;
+        uint32 sendLen = 0;
+        
+        while (TRUE)
+        {
+            if (PeekRingQueue(&pChannel->sendQueue, 1, (void**)&pData) == 0)
+            {
+                break;
+            }
+
+            dataLen = pData->dataLen;
+            memcpy(pChannel->sendBuffer, pData->data, dataLen);
+            ReleaseRingQueue(&pChannel->sendQueue, 1);
+
+            sendLen = 0;
+            while (sendLen < dataLen)
+            {
+                THROW_ERROR(PrepIoUringWriteFixed(&pChannel->ring, pChannel->socket, 
+                        pChannel->sendBuffer+sendLen, dataLen-sendLen, 0, EPS_URING_USERDATA_SEND, TRUE));
+                THROW_ERROR(PrepIoUringLinkTimeout(&pChannel->ring, EPS_SOCKET_SEND_TIMEOUT, 
+                        EPS_URING_USERDATA_LINK_TIMEOUT));
+                pChannel->isSendPending = TRUE;
+
+                while (pChannel->isSendPending)
+                {
+                    THROW_ERROR(SubmitIoUring(&pChannel->ring, 1));
+                    THROW_ERROR(ReapCompletions(pChannel, NULL));
+
+                    /* ߴڼѹرͨ */
+                    if (pChannel->socket == INVALID_SOCKET)
+                    {
+                        THROW_RESCODE(NO_ERR);
+                    }
+                }
+
+                if (pChannel->sendResult == -ECANCELED)
+                {
+                    THROW_ERROR(ERCD_EPS_SOCKET_TIMEOUT);
+                }
+                else if (pChannel->sendResult <= 0)
+                {
+                    THROW_ERROR(ERCD_EPS_SOCKET_ERROR, EpsGetSystemError(-pChannel->sendResult));
+                }
+
+                sendLen += pChannel->sendResult;
+            }
+        }
+    }
+    CATCH
+    {
+        CloseTcpChannel(pChannel);
+        
+        if (EpsAtomicLoad(&pChannel->status) == EPS_TCPCHANNEL_STATUS_WORK)
+        {
+            pChannel->listener.disconnectedNotify(pChannel->listener.pListener,
+                ErrGetErrorCode(), ErrGetErrorDscr());
+        }
+        ErrClearError();
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ͨ(io_uring)
+ *
+ * @param   pChannel            in  - TCPͨ
+ * @param   timeout             in  - ճʱ()ʱύʱЧ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+static ResCodeT ReceiveData(EpsTcpChannelT* pChannel, uint64 timeout)
+{
+    TRY
+    {
+        if (! pChannel->isRecvArmed)
+        {
+            THROW_ERROR(PrepIoUringRecvMultishot(&pChannel->ring, pChannel->socket, EPS_URING_USERDATA_RECV));
+            pChannel->isRecvArmed = TRUE;
+        }
+
+        if (! pChannel->isTimeoutArmed)
+        {
+            THROW_ERROR(PrepIoUringTimeout(&pChannel->ring, (uint32)(timeout / 1000000), 1, 
+                    EPS_URING_USERDATA_TIMEOUT));
+            pChannel->isTimeoutArmed = TRUE;
+        }
+
+        THROW_ERROR(SubmitIoUring(&pChannel->ring, 1));
+
+        BOOL isTimeout = FALSE;
+        THROW_ERROR(ReapCompletions(pChannel, &isTimeout));
+
+        if (isTimeout && pChannel->socket != INVALID_SOCKET)
+        {
+            pChannel->listener.receivedNotify(pChannel->listener.pListener, 
+                    ERCD_EPS_SOCKET_TIMEOUT, pChannel->recvBuffer, (uint32)0);
+        }
+    }
+    CATCH
+    {
+        CloseTcpChannel(pChannel);
+        
+        if (EpsAtomicLoad(&pChannel->status) == EPS_TCPCHANNEL_STATUS_WORK)
+        {
+            pChannel->listener.disconnectedNotify(pChannel->listener.pListener,
+                ErrGetErrorCode(), ErrGetErrorDscr());
+        }
+        ErrClearError();
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * io_uring¼ݰ˳֪ͨ
+ *
+ * @param   pChannel            in  - TCPͨ
+ * @param   pIsTimeout          out - Ƿճʱ(ΪNULL)
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+static ResCodeT ReapCompletions(EpsTcpChannelT* pChannel, BOOL* pIsTimeout)
+{
+    TRY
+    {
+        EpsIoUringT* pRing = &pChannel->ring;
+        struct io_uring_cqe* cqe = NULL;
+
+        EpsAtomicCounterAdd(&pChannel->stat.recvCalls, 1);
+
+        /* ߴڼܱͨرգʱio_uringͷ */
+        while (pChannel->socket != INVALID_SOCKET && (cqe = PeekIoUringCqe(pRing)) != NULL)
+        {
+            uint64 userData = cqe->user_data;
+            int32 res = cqe->res;
+            uint32 flags = cqe->flags;
+            AdvanceIoUringCq(pRing);
+
+            switch (userData)
+            {
+                case EPS_URING_USERDATA_TIMEOUT:
+                {
+                    pChannel->isTimeoutArmed = FALSE;
+                    if (res == -ETIME && pIsTimeout != NULL)
+                    {
+                        *pIsTimeout = TRUE;
+                    }
+                    break;
+                }
+                case EPS_URING_USERDATA_SEND:
+                {
+                    pChannel->sendResult = res;
+                    pChannel->isSendPending = FALSE;
+                    break;
+                }
+                case EPS_URING_USERDATA_RECV:
+                {
+                    if (! (flags & IORING_CQE_F_MORE))
+                    {
+                        pChannel->isRecvArmed = FALSE;
+                    }
+
+                    if (res == -ENOBUFS)
+                    {
+                        break;
+                    }
+                    else if (res < 0)
+                    {
+                        THROW_ERROR(ERCD_EPS_SOCKET_ERROR, EpsGetSystemError(-res));
+                    }
+                    else if (res == 0)
+                    {
+                        THROW_ERROR(ERCD_EPS_SOCKET_ERROR, "Connection closed by remote");
+                    }
+
+                    uint16 bufId = (uint16)(flags >> IORING_CQE_BUFFER_SHIFT);
+                    pChannel->recvTime = EpsGetTimestamp();
+                    EpsAtomicCounterAdd(&pChannel->stat.recvPackets, 1);
+                    EpsAtomicCounterAdd(&pChannel->stat.recvBytes, (uint32)res);
+
+                    pChannel->listener.receivedNotify(pChannel->listener.pListener, 
+                            NO_ERR, GetIoUringBuf(pRing, bufId), (uint32)res);
+
+                    if (pChannel->socket != INVALID_SOCKET)
+                    {
+                        RecycleIoUringBuf(pRing, bufId);
+                    }
+                    break;
+                }
+                default:
+                    break;
+            }
+        }
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+#else
+
 /**
  * ͨ¼
  *
@@ -591,9 +1261,7 @@ static ResCodeT SendData(EpsTcpChannelT* pChannel)
         
         while (TRUE)
         {
-            THROW_ERROR(PopUniQueue(&pChannel->sendQueue, (void**)(&pData)));
-    
-            if (pData == NULL)
+            if (PeekRingQueue(&pChannel->sendQueue, 1, (void**)&pData) == 0)
             {
                 break;
             }
@@ -604,7 +1272,7 @@ static ResCodeT SendData(EpsTcpChannelT* pChannel)
                 result = send(pChannel->socket, pData->data+sendLen, pData->dataLen-sendLen, 0);
                 if (result <= 0)
                 {
-                    free(pData);
+                    ReleaseRingQueue(&pChannel->sendQueue, 1);
 
                     int lstErrno = NET_ERRNO;
                     THROW_ERROR(ERCD_EPS_SOCKET_ERROR, EpsGetSystemError(lstErrno));
@@ -612,14 +1280,14 @@ static ResCodeT SendData(EpsTcpChannelT* pChannel)
 
                 sendLen += result;
             }
-            free(pData);
+            ReleaseRingQueue(&pChannel->sendQueue, 1);
         }
     }
     CATCH
     {
         CloseTcpChannel(pChannel);
         
-        if (pChannel->status == EPS_TCPCHANNEL_STATUS_WORK)
+        if (EpsAtomicLoad(&pChannel->status) == EPS_TCPCHANNEL_STATUS_WORK)
         {
             pChannel->listener.disconnectedNotify(pChannel->listener.pListener,
                 ErrGetErrorCode(), ErrGetErrorDscr());
@@ -635,11 +1303,15 @@ static ResCodeT SendData(EpsTcpChannelT* pChannel)
 /**
  * ͨ
  *
+ * ϴν֪ͨEPS_SOCKET_RECV_TIMEOUTʱ֪ͨճʱ
+ * Ӧ߳Խ϶̵ȴʱѯʱԾڲ
+ *
  * @param   pChannel            in  - TCPͨ
+ * @param   timeout             in  - ȴݵʱ()
  *
  * @return  ɹNO_ERR򷵻ش
  */
-static ResCodeT ReceiveData(EpsTcpChannelT* pChannel)
+static ResCodeT ReceiveData(EpsTcpChannelT* pChannel, uint64 timeout)
 {
     TRY
     {
@@ -647,11 +1319,11 @@ static ResCodeT ReceiveData(EpsTcpChannelT* pChannel)
         FD_ZERO(&fdset);
         FD_SET(pChannel->socket, &fdset);
 
-        struct timeval timeout;
-        timeout.tv_sec = EPS_SOCKET_RECV_TIMEOUT / 1000;
-        timeout.tv_usec = (EPS_SOCKET_RECV_TIMEOUT % 1000) * 1000;
+        struct timeval waitTime;
+        waitTime.tv_sec = timeout / 1000000000;
+        waitTime.tv_usec = (timeout % 1000000000) / 1000;
 
-        int result = select(pChannel->socket+1, &fdset, 0, 0, &timeout);
+        int result = select(pChannel->socket+1, &fdset, 0, 0, &waitTime);
         if (result == SOCKET_ERROR)
         {
             int lstErrno = NET_ERRNO;
@@ -660,9 +1332,33 @@ static ResCodeT ReceiveData(EpsTcpChannelT* pChannel)
         
         if (FD_ISSET(pChannel->socket, &fdset))
         {
+#if defined(__LINUX__)
+            struct iovec iov;
+            iov.iov_base = pChannel->recvBuffer;
+            iov.iov_len  = EPS_SOCKET_RECVBUFFER_LEN;
+
+            char ctrl[CMSG_SPACE(sizeof(struct timespec))];
+            struct msghdr msg;
+            memset(&msg, 0x00, sizeof(msg));
+            msg.msg_iov        = &iov;
+            msg.msg_iovlen     = 1;
+            msg.msg_control    = ctrl;
+            msg.msg_controllen = sizeof(ctrl);
+
+            /* δʱϢδ䣬ܽ */
+            int len = recvmsg(pChannel->socket, &msg, 0);
+            pChannel->recvTime = (len > 0) ? EpsGetRecvTimestamp(&msg) : 0;
+#else
             int len = recv(pChannel->socket, pChannel->recvBuffer, EPS_SOCKET_RECVBUFFER_LEN, 0);
+            pChannel->recvTime = EpsGetTimestamp();
+#endif
+            EpsAtomicCounterAdd(&pChannel->stat.recvCalls, 1);
             if (len > 0)
             {
+                EpsAtomicCounterAdd(&pChannel->stat.recvPackets, 1);
+                EpsAtomicCounterAdd(&pChannel->stat.recvBytes, (uint32)len);
+                pChannel->notifyTime = EpsGetTimestamp();
+
                 pChannel->listener.receivedNotify(pChannel->listener.pListener, 
                         NO_ERR, pChannel->recvBuffer, (uint32)len);
             }
@@ -678,15 +1374,20 @@ static ResCodeT ReceiveData(EpsTcpChannelT* pChannel)
         }
         else
         {
-            pChannel->listener.receivedNotify(pChannel->listener.pListener, 
-                    ERCD_EPS_SOCKET_TIMEOUT, pChannel->recvBuffer, (uint32)0);
+            uint64 now = EpsGetTimestamp();
+            if (now - pChannel->notifyTime >= (uint64)EPS_SOCKET_RECV_TIMEOUT * 1000000)
+            {
+                pChannel->notifyTime = now;
+                pChannel->listener.receivedNotify(pChannel->listener.pListener, 
+                        ERCD_EPS_SOCKET_TIMEOUT, pChannel->recvBuffer, (uint32)0);
+            }
         }
     }
     CATCH
     {
         CloseTcpChannel(pChannel);
         
-        if (pChannel->status == EPS_TCPCHANNEL_STATUS_WORK)
+        if (EpsAtomicLoad(&pChannel->status) == EPS_TCPCHANNEL_STATUS_WORK)
         {
             pChannel->listener.disconnectedNotify(pChannel->listener.pListener,
                 ErrGetErrorCode(), ErrGetErrorDscr());
@@ -699,6 +1400,35 @@ static ResCodeT ReceiveData(EpsTcpChannelT* pChannel)
     }
 }
 
+#endif /* EPS_IOENGINE_URING */
+
+/**
+ * ͨ¼
+ *
+ * @param   pChannel            in  - TCPͨ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+static ResCodeT HandleEvent(EpsTcpChannelT* pChannel)
+{
+    TRY
+    {
+        /* ¼ƳӺ֪ͨڼ䴥¼ʹͷŵĲλ */
+        EpsTcpChannelEventT event;
+        while (PopRingQueue(&pChannel->eventQueue, &event, 1) > 0)
+        {
+            pChannel->listener.eventOccurredNotify(pChannel->listener.pListener, &event);
+        }
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
 /**
  * Ͷ
  *
@@ -711,18 +1441,10 @@ static ResCodeT ClearSendQueue(EpsTcpChannelT* pChannel)
     TRY
     {
         EpsSendDataT* pData = NULL;
-        while (TRUE)
+        uint32 count = 0;
+        while ((count = PeekRingQueue(&pChannel->sendQueue, EPS_SENDQUEUE_SIZE, (void**)&pData)) > 0)
         {
-            THROW_ERROR(PopUniQueue(&pChannel->sendQueue, (void**)(&pData)));
-            
-            if (pData != NULL)
-            {
-                free(pData);
-            }
-            else
-            {
-                break;
-            }
+            ReleaseRingQueue(&pChannel->sendQueue, count);
         }
     }
     CATCH
@@ -743,7 +1465,7 @@ static ResCodeT ClearSendQueue(EpsTcpChannelT* pChannel)
  */
 static BOOL IsChannelInited(EpsTcpChannelT* pChannel)
 {
-    return (IsUniQueueInited(&pChannel->sendQueue));
+    return (IsRingQueueInited(&pChannel->sendQueue));
 }
 
 /**
@@ -755,7 +1477,8 @@ static BOOL IsChannelInited(EpsTcpChannelT* pChannel)
  */
 static BOOL IsChannelStarted(EpsTcpChannelT* pChannel)
 {
-    return (pChannel->tid != 0);
+    return (pChannel->tid != 0 || 
+            (pChannel->isManual && EpsAtomicLoad(&pChannel->status) != EPS_TCPCHANNEL_STATUS_STOP));
 }
 
 /**
@@ -785,3 +1508,6 @@ static void OnChannelReceived(void* pListener, ResCodeT result, const char* data
 static void OnChannelSended(void* pListener, ResCodeT result, const char* data, uint32 dataLen)
 {
 }
+static void OnChannelEventOccurred(void* pListener, EpsTcpChannelEventT* pEvent)
+{
+}
@@ -31,13 +31,25 @@ DD-MMM-YYYY INIT.    SIR    Modification Description
  * ͷļ
  */
 
-#include "uniQueue.h"
+#include "ringQueue.h"
+#include "ioUring.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 
+/**
+ * 궨
+ */
+
+#define EPS_SENDDATA_MAX_LEN        8192    /* η󳤶 */
+#define EPS_TCP_SERVER_MAX_NUM      4       /* ַͨ */
+#define EPS_TCP_CONNECT_STAGGER     50      /* ʱηӵļλ:  */
+#define EPS_TCP_CONNECT_TIMEOUT     (1*1000)/* ֲӳʱλ:  */
+#define EPS_TCP_EVENT_DATA_MAX_LEN  1024    /* 첽¼󳤶 */
+
+
 /**
  * Ͷ
  */
@@ -52,6 +64,16 @@ typedef enum EpsTcpChannelStatusTag
     EPS_TCPCHANNEL_STATUS_WORK     = 2,    /* ״̬ */
 } EpsTcpChannelStatusT;
 
+/*
+ * 첽¼
+ */
+typedef struct EpsTcpChannelEventTag
+{
+    uint32  eventType;                  /* ¼ */
+    uint32  eventParam;                 /* ¼ */
+    char    eventData[EPS_TCP_EVENT_DATA_MAX_LEN];  /* ¼ */
+} EpsTcpChannelEventT;
+
 /*
  * 첽صӿ
  */
@@ -59,6 +81,7 @@ typedef void (*EpsTcpChannelConnectedCallback)(void* pListener);
 typedef void (*EpsTcpChannelDisconnectedCallback)(void* pListener, ResCodeT result, const char* reason);
 typedef void (*EpsTcpChannelReceivedCallback)(void* pListener, ResCodeT result, const char* data, uint32 dataLen);
 typedef void (*EpsTcpChannelSendedCallback)(void* pListener, ResCodeT result, const char* data, uint32 dataLen);
+typedef void (*EpsTcpChannelEventOccurredCallback)(void* pListener, EpsTcpChannelEventT* pEvent);
 
 /*
  * UDP߽ͨӿ
@@ -70,18 +93,60 @@ typedef struct EpsTcpChannelListenerTag
     EpsTcpChannelDisconnectedCallback   disconnectedNotify; /* ӶϿ֪ͨ */
     EpsTcpChannelReceivedCallback       receivedNotify;     /* ݽ֪ͨ */
     EpsTcpChannelSendedCallback         sendedNotify;       /* ݷ֪ͨ */
+    EpsTcpChannelEventOccurredCallback  eventOccurredNotify;/* ¼֪ͨ */
 } EpsTcpChannelListenerT;
 
+/*
+ * ַ
+ */
+typedef struct EpsTcpServerTag
+{
+    char        srvAddr[EPS_IP_MAX_LEN+1];  /* ַ */
+    uint16      srvPort;                    /* ˿ */
+    uint64      connectTime;                /* һӳɹĺʱ()0ʾδӳɹ */
+} EpsTcpServerT;
+
+/*
+ * еĲӣPollTcpChannelƽ
+ */
+typedef struct EpsTcpConnectTag
+{
+    BOOL        isConnecting;               /* ӽб */
+    SOCKET      fds[EPS_TCP_SERVER_MAX_NUM];/* ķ׽(˳) */
+    uint32      order[EPS_TCP_SERVER_MAX_NUM];/* ӵķ˳ */
+    uint32      count;                      /* ӵķ */
+    uint32      started;                    /* ѷӵ */
+    uint32      failed;                     /* ʧܵ */
+    int         lstErrno;                   /* һʧܵϵͳ */
+    uint64      beginTime;                  /* ӿʼʱ() */
+    uint64      nextTime;                   /* ´ηӵʱ() */
+    uint64      deadline;                   /* ӳʱʱ() */
+} EpsTcpConnectT;
+
+/*
+ * TCPͨͳϢ
+ */
+typedef struct EpsTcpChannelStatTag
+{
+    uint64      recvCalls;                  /* յô */
+    uint64      recvPackets;                /* ݿ */
+    uint64      recvBytes;                  /* ֽ */
+} EpsTcpChannelStatT;
+
 
 /*
  * TCPͨṹ
  */
 typedef struct EpsTcpChannelTag
 {
-    char        srvAddr[EPS_IP_MAX_LEN+1];  /* ַ */
-    uint16      srvPort;                    /* ˿ */
+    EpsTcpServerT servers[EPS_TCP_SERVER_MAX_NUM];/* ַб(˳) */
+    uint32      serverCount;                /* ַ */
+    uint32      serverIndex;                /* һӳɹķţ´ */
+    uint32      reconnectTimes;             /* ʧܴڼ˱ʱ */
+    uint64      reconnectTime;              /* ´ʱ() */
 
     SOCKET      socket;						/* ͨѶ׽ */
+    EpsTcpConnectT connecting;              /* еĲ */
 
 #if defined(__WINDOWS__)
     HANDLE      thread;						/* ̶߳ */
@@ -92,10 +157,26 @@ typedef struct EpsTcpChannelTag
     pthread_t   tid;                        /* ߳id */
 #endif
 
-    EpsUniQueueT sendQueue;                 /* Ͷ */
+    EpsRingQueueT sendQueue;                /* Ͷ(ߵ) */
+    EpsRingQueueT eventQueue;               /* ¼(ߵߣǶ¼ṹ) */
     char        recvBuffer[EPS_SOCKET_RECVBUFFER_LEN];/* ջ */
     BOOL        canStop;                    /* ֹͣ߳б */
     EpsTcpChannelStatusT status;            /* ͨ״̬ */
+    EpsTcpChannelStatT stat;                /* ͳϢ */
+    uint64      recvTime;                   /* һνݵʱ() */
+    uint64      notifyTime;                 /* һν֪ͨ(ݻʱ)ʱ() */
+
+    BOOL        isManual;                   /* Ӧ߳ģʽǣʱ̣ͨ߳´ʱЧ */
+    int         pollFd;                     /* Ӧ̵߳ȴõepoll׽ִ򿪺룬-1ʾʹ */
+
+#if defined(EPS_IOENGINE_URING)
+    EpsIoUringT ring;                       /* io_uring׽ִ/ر */
+    BOOL        isRecvArmed;                /* νύ */
+    BOOL        isTimeoutArmed;             /* ճʱύ */
+    BOOL        isSendPending;              /* δɱ */
+    int32       sendResult;                 /* ɽ */
+    char        sendBuffer[EPS_SENDDATA_MAX_LEN];/* ͻ(עΪ̶) */
+#endif
 
     EpsTcpChannelListenerT listener;        /* ߽ӿ */
 } EpsTcpChannelT;
@@ -126,9 +207,14 @@ ResCodeT StartupTcpChannel(EpsTcpChannelT* pChannel);
 ResCodeT ShutdownTcpChannel(EpsTcpChannelT* pChannel);
 
 /*
- * TCPͨ
+ * ִһTCPͨ¼Ӽշ
+ */
+ResCodeT PollTcpChannel(EpsTcpChannelT* pChannel, uint64 timeout);
+
+/*
+ * ƽTCPͨ
  */
-ResCodeT OpenTcpChannel(EpsTcpChannelT* pChannel);
+ResCodeT OpenTcpChannel(EpsTcpChannelT* pChannel, uint64 timeout, BOOL* pIsOpened);
 
 /*
  * رTCPͨ
@@ -145,6 +231,11 @@ ResCodeT JoinTcpChannel(EpsTcpChannelT* pChannel);
  */
 ResCodeT SendTcpChannel(EpsTcpChannelT* pChannel, const char* data, uint32 dataLen);
 
+/*
+ * 첽¼
+ */
+ResCodeT TriggerTcpChannelEvent(EpsTcpChannelT* pChannel, const EpsTcpChannelEventT* pEvent);
+
 /*
  * ע߽ͨӿ
  */
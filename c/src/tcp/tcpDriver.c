@@ -32,10 +32,36 @@ DD-MMM-YYYY INIT.    SIR    Modification Description
 #include "common.h"
 #include "epsTypes.h"
 #include "errlib.h"
+#include "atomic.h"
 #include "stepCodec.h"
 
 #include "tcpDriver.h"
 
+/**
+ * Ͷ
+ */
+
+/*
+ * TCP¼ö
+ */
+typedef enum EpsTcpEventTypeTag
+{
+    EPS_TCP_EVENTTYPE_LOGIN         = 1,    /* ½¼ */
+    EPS_TCP_EVENTTYPE_LOGOUT        = 2,    /* ǳ¼ */
+    EPS_TCP_EVENTTYPE_SUBSCRIBE     = 3,    /* ¼ */
+    EPS_TCP_EVENTTYPE_PROFILE       = 4,    /* Ự¼ */
+} EpsTcpEventTypeT;
+
+/*
+ * ½¼
+ */
+typedef struct EpsTcpLoginDataTag
+{
+    char    username[EPS_USERNAME_MAX_LEN+1];   /* û˺ */
+    char    password[EPS_PASSWORD_MAX_LEN+1];   /* û */
+} EpsTcpLoginDataT;
+
+
 /**
  * ڲ
  */
@@ -44,6 +70,7 @@ static void OnChannelConnected(void* pListener);
 static void OnChannelDisconnected(void* pListener, ResCodeT result, const char* reason);
 static void OnChannelReceived(void* pListener, ResCodeT rc, const char* data, uint32 dataLen);
 static void OnChannelSended(void* pListener, ResCodeT rc, const char* data, uint32 dataLen);
+static void OnChannelEventOccurred(void* pListener, EpsTcpChannelEventT* pEvent);
 
 static void OnEpsConnected(uint32 hid);
 static void OnEpsDisconnected(uint32 hid, ResCodeT result, const char* reason);
@@ -53,6 +80,23 @@ static void OnEpsMktDataSubRsp(uint32 hid, EpsMktTypeT mktType, ResCodeT result,
 static void OnEpsMktDataArrived(uint32 hid, const EpsMktDataT* pMktData);
 static void OnEpsMktStatusChanged(uint32 hid, const EpsMktStatusT* pMktStatus);
 static void OnEpsEventOccurred(uint32 hid, EpsEventTypeT eventType, ResCodeT eventCode, const char* eventText);
+static void OnEpsMktDataGap(uint32 hid, const EpsMktGapT* pMktGap);
+
+static void OnDriverMktData(void* pListener, const StepMessageT* pMsg, uint64 recvTime);
+static void OnDriverStatus(void* pListener, EpsTcpStatusT status);
+static void OnDriverReceived(void* pListener);
+
+static void OnStandbyMktData(void* pListener, const StepMessageT* pMsg, uint64 recvTime);
+static void OnStandbyStatus(void* pListener, EpsTcpStatusT status);
+static void OnStandbyReceived(void* pListener);
+
+static ResCodeT HandleLoginEvent(EpsTcpDriverT* pDriver, const EpsTcpLoginDataT* pData, uint16 heartbeatIntl);
+static ResCodeT HandleLogoutEvent(EpsTcpDriverT* pDriver, const char* reason);
+static ResCodeT HandleSubscribeEvent(EpsTcpDriverT* pDriver, EpsMktTypeT mktType);
+static ResCodeT HandleProfileEvent(EpsTcpDriverT* pDriver, const EpsSessionProfileT* pProfile);
+static ResCodeT CheckOperation(EpsTcpDriverT* pDriver, uint32 eventType);
+static BOOL LockSession(EpsTcpDriverT* pDriver);
+static void UnlockSession(EpsTcpDriverT* pDriver, BOOL isLocked);
 
 static ResCodeT HandleLoginRsp(EpsTcpDriverT* pDriver, const StepMessageT* pMsg);
 static ResCodeT HandleLogoutRsp(EpsTcpDriverT* pDriver, const StepMessageT* pMsg);
@@ -60,14 +104,29 @@ static ResCodeT HandleMDSubscribeRsp(EpsTcpDriverT* pDriver, const StepMessageT*
 static ResCodeT HandleMarketData(EpsTcpDriverT* pDriver, const StepMessageT* pMsg);
 static ResCodeT HandleMarketStatus(EpsTcpDriverT* pDriver, const StepMessageT* pMsg);
 static ResCodeT HandleReceiveTimeout(EpsTcpDriverT* pDriver);
+static ResCodeT HandleResendRequest(EpsTcpDriverT* pDriver, const StepMessageT* pMsg);
+static ResCodeT CheckInboundSeqNum(EpsTcpDriverT* pDriver, const StepMessageT* pMsg, BOOL* pIsAccepted);
+static ResCodeT SendResendRequest(EpsTcpDriverT* pDriver);
+static ResCodeT SendLogonRequest(EpsTcpDriverT* pDriver);
+static ResCodeT SendSubscribeRequest(EpsTcpDriverT* pDriver, EpsMktTypeT mktType);
+static ResCodeT SendSessionProfile(EpsTcpDriverT* pDriver);
+static ResCodeT DeliverMarketData(EpsTcpDriverT* pDriver, const StepMessageT* pMsg, 
+            uint64 recvTime, uint32 sessionIndex);
+static ResCodeT AllocStandby(EpsTcpDriverT* pDriver);
+static ResCodeT SetPollMode(EpsTcpDriverT* pDriver, BOOL isManual);
+static uint64 GetRecvPackets(EpsTcpDriverT* pDriver);
+static void DriveStandby(EpsTcpDriverT* pDriver);
+static void CheckFailover(EpsTcpDriverT* pDriver, BOOL isPrimaryLost);
 
 static ResCodeT BuildLogonRequest(uint64 msgSeqNum, const char* username, const char* password, 
             uint16 heartbeatIntl, char* data, int32* pDataLen);
 static ResCodeT BuildLogoutRequest(uint64 msgSeqNum, const char* reason, char* data, int32* pDataLen);
 static ResCodeT BuildSubscribeRequest(uint64 msgSeqNum, EpsMktTypeT mktType, char* data, int32* pDataLen);
 static ResCodeT BuildHeartbeatRequest(uint64 msgSeqNum, char* data, int32* pDataLen);
+static ResCodeT BuildResendRequest(uint64 msgSeqNum, uint64 beginSeqNo, char* data, int32* pDataLen);
+static ResCodeT BuildSequenceReset(uint64 msgSeqNum, uint64 newSeqNo, char* data, int32* pDataLen);
     
-static ResCodeT ParseAddress(const char* address, char* srvAddr, uint16* srvPort);
+static ResCodeT ParseAddress(const char* address, EpsTcpServerT* servers, uint32* pServerCount);
 static ResCodeT GetSendingTime(char* szSendingTime);
 
 
@@ -95,7 +154,8 @@ ResCodeT InitTcpDriver(EpsTcpDriverT* pDriver)
             OnChannelConnected,
             OnChannelDisconnected,
             OnChannelReceived,
-            OnChannelSended
+            OnChannelSended,
+            OnChannelEventOccurred
         };
         THROW_ERROR(RegisterTcpChannelListener(&pDriver->channel, &listener));
 
@@ -108,14 +168,52 @@ ResCodeT InitTcpDriver(EpsTcpDriverT* pDriver)
             OnEpsMktDataSubRsp,
             OnEpsMktDataArrived,
             OnEpsMktStatusChanged,
-            OnEpsEventOccurred
+            OnEpsEventOccurred,
+            OnEpsMktDataGap,
+            NULL,
+            NULL
         };
         pDriver->spi = spi;
+
+        EpsTcpDriverListenerT driverListener =
+        {
+            NULL,
+            OnDriverMktData,
+            OnDriverStatus,
+            OnDriverReceived
+        };
+        pDriver->listener = driverListener;
        
-        pDriver->status = EPS_TCP_STATUS_DISCONNECTED;
+        EpsAtomicStore(&pDriver->status, EPS_TCP_STATUS_DISCONNECTED);
         pDriver->msgSeqNum = 1;
+        pDriver->inMsgSeqNum = 1;
+        pDriver->isResending = FALSE;
+        pDriver->resendTime = 0;
+        pDriver->sessionGapCount = 0;
+        pDriver->resendRequests = 0;
         pDriver->recvBufferLen = 0;
 
+        pDriver->pStandby = NULL;
+        pDriver->isLoginIssued = FALSE;
+        pDriver->isFailedOver = FALSE;
+        pDriver->restoreRsps = 0;
+        pDriver->standbyGen = 0;
+        pDriver->standbyDrivenGen = 0;
+        pDriver->isProfileSet = FALSE;
+        memset(&pDriver->profile, 0x00, sizeof(pDriver->profile));
+        pDriver->failoverTimeout = EPS_TCP_FAILOVER_TIMEOUT;
+        pDriver->failoverCount = 0;
+        pDriver->failoverLatency = 0;
+        pDriver->isLatencyPending = FALSE;
+        memset(pDriver->sessionArbs, 0x00, sizeof(pDriver->sessionArbs));
+        pDriver->pollFd = -1;
+        pDriver->pShmBus = NULL;
+
+        THROW_ERROR(InitMktBatch(&pDriver->batch));
+        THROW_ERROR(InitSecFilter(&pDriver->filter));
+        THROW_ERROR(InitDispatcher(&pDriver->dispatcher, &pDriver->spi, &pDriver->batch, &pDriver->filter));
+        THROW_ERROR(InitSubscriberHub(&pDriver->subscribers, pDriver->hid, &pDriver->filter));
+
         InitRecMutex(&pDriver->lock);
     }
     CATCH
@@ -141,11 +239,37 @@ ResCodeT UninitTcpDriver(EpsTcpDriverT* pDriver)
         LockRecMutex(&pDriver->lock);
 
         UninitTcpChannel(&pDriver->channel);
+        UninitDispatcher(&pDriver->dispatcher);
+        UninitSubscriberHub(&pDriver->subscribers);
+        UninitSecFilter(&pDriver->filter);
         UninitMktDatabase(&pDriver->database);
+        UninitMktBatch(&pDriver->batch);
+
+        EpsTcpDriverT* pStandby = pDriver->pStandby;
+        pDriver->pStandby = NULL;
+
+        if (pDriver->pollFd >= 0)
+        {
+            close(pDriver->pollFd);
+            pDriver->pollFd = -1;
+        }
+
+        if (pDriver->pShmBus != NULL)
+        {
+            CloseShmBus(pDriver->pShmBus);
+            free(pDriver->pShmBus);
+            pDriver->pShmBus = NULL;
+        }
 
         UnlockRecMutex(&pDriver->lock);
  
         UninitRecMutex(&pDriver->lock);
+
+        if (pStandby != NULL)
+        {
+            UninitTcpDriver(pStandby);
+            free(pStandby);
+        }
     }
     CATCH
     {
@@ -170,6 +294,14 @@ ResCodeT RegisterTcpDriverSpi(EpsTcpDriverT* pDriver, const EpsClientSpiT* pSpi)
     {
         LockRecMutex(&pDriver->lock);
 
+        /* Ự̲ͨ߳ȡصͨڼ䲻滻 */
+        EpsTcpDriverT* pStandby = pDriver->pStandby;
+        if (EpsAtomicLoad(&pDriver->channel.status) != EPS_TCPCHANNEL_STATUS_STOP ||
+            (pStandby != NULL && EpsAtomicLoad(&pStandby->channel.status) != EPS_TCPCHANNEL_STATUS_STOP))
+        {
+            THROW_ERROR(ERCD_EPS_DUPLICATE_CONNECT);
+        }
+
         if (pSpi->connectedNotify != NULL)
         {
             pDriver->spi.connectedNotify = pSpi->connectedNotify;
@@ -202,6 +334,59 @@ ResCodeT RegisterTcpDriverSpi(EpsTcpDriverT* pDriver, const EpsClientSpiT* pSpi)
         {
             pDriver->spi.eventOccurredNotify = pSpi->eventOccurredNotify;
         }
+        if (pSpi->mktDataGapNotify != NULL)
+        {
+            pDriver->spi.mktDataGapNotify = pSpi->mktDataGapNotify;
+        }
+        if (pSpi->mktDataViewArrivedNotify != NULL)
+        {
+            pDriver->spi.mktDataViewArrivedNotify = pSpi->mktDataViewArrivedNotify;
+        }
+        if (pSpi->mktDataBatchArrivedNotify != NULL)
+        {
+            /* ڻصͨ߳ */
+            THROW_ERROR(AllocMktBatch(&pDriver->batch));
+            EpsAtomicStore(&pDriver->spi.mktDataBatchArrivedNotify, pSpi->mktDataBatchArrivedNotify);
+        }
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        UnlockRecMutex(&pDriver->lock);
+ 
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * עTCPڲ߽ӿ
+ *
+ * @param   pDriver             in  - TCP
+ * @param   pListener           in  - עļ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT RegisterTcpDriverListener(EpsTcpDriverT* pDriver, const EpsTcpDriverListenerT* pListener)
+{
+    TRY
+    {
+        LockRecMutex(&pDriver->lock);
+
+        pDriver->listener.pListener = pListener->pListener;
+        if (pListener->mktDataNotify != NULL)
+        {
+            pDriver->listener.mktDataNotify = pListener->mktDataNotify;
+        }
+        if (pListener->statusNotify != NULL)
+        {
+            pDriver->listener.statusNotify = pListener->statusNotify;
+        }
+        if (pListener->receivedNotify != NULL)
+        {
+            pDriver->listener.receivedNotify = pListener->receivedNotify;
+        }
     }
     CATCH
     {
@@ -224,30 +409,78 @@ ResCodeT RegisterTcpDriverSpi(EpsTcpDriverT* pDriver, const EpsClientSpiT* pSpi)
  */
 ResCodeT ConnectTcpDriver(EpsTcpDriverT* pDriver, const char* address)
 {
-    char        srvAddr[EPS_IP_MAX_LEN+1];
-    uint16      srvPort;
+    EpsTcpServerT servers[EPS_TCP_SERVER_MAX_NUM];
+    uint32      serverCount = 0;
+    uint32      serverIndex = 0;
 
     TRY
     {
+        ResCodeT rc = NO_ERR;
+        EpsTcpServerT newServers[EPS_TCP_SERVER_MAX_NUM];
+        uint32 newServerCount = 0;
+
+        /* '|'ָĵڶַΪȱỰ */
+        const char* standbyAddress = strchr(address, '|');
+        if (standbyAddress != NULL)
+        {
+            standbyAddress++;
+            if (strchr(standbyAddress, '|') != NULL)
+            {
+                THROW_ERROR(ERCD_EPS_INVALID_ADDRESS);
+            }
+            THROW_ERROR(ParseAddress(standbyAddress, newServers, &newServerCount));
+        }
+        THROW_ERROR(ParseAddress(address, newServers, &newServerCount));
+
         LockRecMutex(&pDriver->lock);
-        memcpy(srvAddr, pDriver->channel.srvAddr, sizeof(srvAddr));
-        srvPort = pDriver->channel.srvPort;
+        memcpy(servers, pDriver->channel.servers, sizeof(servers));
+        serverCount = pDriver->channel.serverCount;
+        serverIndex = pDriver->channel.serverIndex;
+
+        memcpy(pDriver->channel.servers, newServers, sizeof(newServers));
+        pDriver->channel.serverCount = newServerCount;
+        pDriver->channel.serverIndex = 0;
+
+        if (standbyAddress != NULL)
+        {
+            rc = AllocStandby(pDriver);
+        }
+        if (OK(rc))
+        {
+            rc = StartupDispatcher(&pDriver->dispatcher, pDriver->hid);
+        }
+        if (OK(rc))
+        {
+            rc = StartupTcpChannel(&pDriver->channel);
+        }
+        if (NOTOK(rc) && rc == ERCD_EPS_DUPLICATE_CONNECT)
+        {
+            memcpy(pDriver->channel.servers, servers, sizeof(servers));
+            pDriver->channel.serverCount = serverCount;
+            pDriver->channel.serverIndex = serverIndex;
+        }
+        if (OK(rc))
+        {
+            pDriver->isFailedOver = FALSE;
+            pDriver->isLatencyPending = FALSE;
+            memset(pDriver->sessionArbs, 0x00, sizeof(pDriver->sessionArbs));
+        }
+
+        EpsTcpDriverT* pStandby = pDriver->pStandby;
+        UnlockRecMutex(&pDriver->lock);
+        THROW_ERROR(rc);
 
-        THROW_ERROR(ParseAddress(address, pDriver->channel.srvAddr, &pDriver->channel.srvPort));
-        THROW_ERROR(StartupTcpChannel(&pDriver->channel));
+        /* ȱỰỰȱỰ߳ȳٻȡỰ */
+        if (standbyAddress != NULL)
+        {
+            THROW_ERROR(ConnectTcpDriver(pStandby, standbyAddress));
+        }
     }
     CATCH
     {
-        if(GET_RESCODE() == ERCD_EPS_DUPLICATE_CONNECT)
-        {
-            memcpy(pDriver->channel.srvAddr, srvAddr, sizeof(srvAddr));
-            pDriver->channel.srvPort = srvPort;
-        }
     }
     FINALLY
     {
-        UnlockRecMutex(&pDriver->lock);
-
         RETURN_RESCODE;
     }
 }
@@ -264,6 +497,9 @@ ResCodeT DisconnectTcpDriver(EpsTcpDriverT* pDriver)
     TRY
     {
         ResCodeT rc = NO_ERR;
+
+        /* ַֹ֪ͨ߳ͣʹȴпռ̷ͨ߳ȴ */
+        ShutdownDispatcher(&pDriver->dispatcher);
         
         LockRecMutex(&pDriver->lock);
         
@@ -273,6 +509,30 @@ ResCodeT DisconnectTcpDriver(EpsTcpDriverT* pDriver)
 
         THROW_ERROR(rc);
         THROW_ERROR(JoinTcpChannel(&pDriver->channel));
+
+        /* ͨ߳˳ʱͶϿ֪ͨڴ˸λỰ״̬Աٴ */
+        LockRecMutex(&pDriver->lock);
+
+        EpsAtomicStore(&pDriver->status, EPS_TCP_STATUS_DISCONNECTED);
+        pDriver->msgSeqNum = 1;
+        pDriver->inMsgSeqNum = 1;
+        pDriver->isResending = FALSE;
+        pDriver->recvBufferLen = 0;
+        pDriver->isLoginIssued = FALSE;
+        pDriver->isFailedOver = FALSE;
+        UnsubscribeAllMktData(&pDriver->database);
+
+        EpsTcpDriverT* pStandby = pDriver->pStandby;
+
+        UnlockRecMutex(&pDriver->lock);
+
+        if (pStandby != NULL)
+        {
+            THROW_ERROR(DisconnectTcpDriver(pStandby));
+        }
+
+        /* ȱỰҲỰķַͶ飬Ựֹͣٵȴַ߳ */
+        THROW_ERROR(JoinDispatcher(&pDriver->dispatcher));
     }
     CATCH
     {
@@ -285,6 +545,9 @@ ResCodeT DisconnectTcpDriver(EpsTcpDriverT* pDriver)
 
 /**
  * ½TCP 
+ *
+ * ½̷ֻͨ߳鵱ǰ״̬½¼
+ * ȴ鴦ִͨ߳ʧʱͨ½Ӧص֪ͨ
  * 
  * @param   pDriver             in  - TCP
  *
@@ -295,35 +558,23 @@ ResCodeT LoginTcpDriver(EpsTcpDriverT* pDriver, const char* username,
 {
     TRY
     {
-        LockRecMutex(&pDriver->lock);
+        THROW_ERROR(CheckOperation(pDriver, EPS_TCP_EVENTTYPE_LOGIN));
 
-        EpsTcpStatusT status = pDriver->status;
-        if (status != EPS_TCP_STATUS_CONNECTED)
-        {
-            char errorText[128];
-            snprintf(errorText, sizeof(errorText), 
-                "login operation disallowed in current status(%d)", status); 
-            THROW_ERROR(ERCD_EPS_INVALID_OPERATION, errorText);
-        }
+        EpsTcpChannelEventT event;
+        event.eventType = EPS_TCP_EVENTTYPE_LOGIN;
+        event.eventParam = heartbeatIntl;
 
-        snprintf(pDriver->username, sizeof(pDriver->username), username);
-        snprintf(pDriver->password, sizeof(pDriver->password), username);
-        pDriver->heartbeatIntl = heartbeatIntl;
-        char data[STEP_MSG_MAX_LEN];
-        int32 dataLen = (int32)sizeof(data);
-        THROW_ERROR(BuildLogonRequest(pDriver->msgSeqNum++, 
-            username, password, heartbeatIntl, data, &dataLen));
+        EpsTcpLoginDataT* pData = (EpsTcpLoginDataT*)event.eventData;
+        snprintf(pData->username, sizeof(pData->username), "%s", username);
+        snprintf(pData->password, sizeof(pData->password), "%s", password);
 
-        pDriver->status = EPS_TCP_STATUS_LOGGING;
-        THROW_ERROR(SendTcpChannel(&pDriver->channel, data, dataLen));
+        THROW_ERROR(TriggerTcpChannelEvent(&pDriver->channel, &event));
     }
     CATCH
     {
     }
     FINALLY
     {
-        UnlockRecMutex(&pDriver->lock);
-
         RETURN_RESCODE;
     }
 }
@@ -339,31 +590,20 @@ ResCodeT LogoutTcpDriver(EpsTcpDriverT* pDriver, const char* reason)
 {
     TRY
     {
-        LockRecMutex(&pDriver->lock);
+        THROW_ERROR(CheckOperation(pDriver, EPS_TCP_EVENTTYPE_LOGOUT));
 
-        EpsTcpStatusT status = pDriver->status;
-        if (status != EPS_TCP_STATUS_LOGINED && status != EPS_TCP_STATUS_PUBLISHING)
-        {
-            char errorText[128];
-            snprintf(errorText, sizeof(errorText), 
-                "logout operation disallowed in current status(%d)", status); 
-            THROW_ERROR(ERCD_EPS_INVALID_OPERATION, errorText);   
-        }
+        EpsTcpChannelEventT event;
+        event.eventType = EPS_TCP_EVENTTYPE_LOGOUT;
+        event.eventParam = 0;
+        snprintf(event.eventData, sizeof(event.eventData), "%s", reason);
 
-        char data[STEP_MSG_MAX_LEN];
-        int32 dataLen = (int32)sizeof(data);
-        THROW_ERROR(BuildLogoutRequest(pDriver->msgSeqNum++, reason, data, &dataLen));
-        
-        pDriver->status = EPS_TCP_STATUS_LOGOUTING;
-        THROW_ERROR(SendTcpChannel(&pDriver->channel, data, dataLen));
+        THROW_ERROR(TriggerTcpChannelEvent(&pDriver->channel, &event));
     }
     CATCH
     {
     }
     FINALLY
     {
-        UnlockRecMutex(&pDriver->lock);
-
         RETURN_RESCODE;
     }
 }
@@ -379,133 +619,677 @@ ResCodeT SubscribeTcpDriver(EpsTcpDriverT* pDriver, EpsMktTypeT mktType)
 {
     TRY
     {
-        LockRecMutex(&pDriver->lock);
-        EpsTcpStatusT status = pDriver->status;
-
-        if (status != EPS_TCP_STATUS_LOGINED && status != EPS_TCP_STATUS_PUBLISHING)
+        if (mktType > EPS_MKTTYPE_NUM)
         {
-            char errorText[128];
-            snprintf(errorText, sizeof(errorText), 
-                "subscribe operation disallowed in current status(%d)", status); 
-            THROW_ERROR(ERCD_EPS_INVALID_OPERATION, errorText);
+            THROW_ERROR(ERCD_EPS_INVALID_MKTTYPE);
         }
 
-        THROW_ERROR(SubscribeMktData(&pDriver->database, mktType));
+        THROW_ERROR(CheckOperation(pDriver, EPS_TCP_EVENTTYPE_SUBSCRIBE));
 
-        char data[STEP_MSG_MAX_LEN];
-        int32 dataLen = (int32)sizeof(data);
-        THROW_ERROR(BuildSubscribeRequest(pDriver->msgSeqNum++, mktType, data, &dataLen));
+        EpsTcpChannelEventT event;
+        event.eventType = EPS_TCP_EVENTTYPE_SUBSCRIBE;
+        event.eventParam = (uint32)mktType;
 
-        THROW_ERROR(SendTcpChannel(&pDriver->channel, data, dataLen));
+        THROW_ERROR(TriggerTcpChannelEvent(&pDriver->channel, &event));
     }
     CATCH
     {
     }
     FINALLY
     {
-        UnlockRecMutex(&pDriver->lock);
-
         RETURN_RESCODE;
     }
 }
 
 /**
- * TCPͨӳɹ֪ͨ
+ * ȡTCPͳϢ
  *
- * @param   pListener             in  - TCP
+ * @param   pDriver             in  - TCP
+ * @param   pStat               out - ͳϢ
+ *
+ * @return  ɹNO_ERR򷵻ش
  */
-static void OnChannelConnected(void* pListener)
+ResCodeT GetTcpDriverStatistics(EpsTcpDriverT* pDriver, EpsStatisticsT* pStat)
 {
-    EpsTcpDriverT* pDriver = (EpsTcpDriverT*)pListener;
-
-    LockRecMutex(&pDriver->lock);
-
-    pDriver->status = EPS_TCP_STATUS_CONNECTED;
-
-    pDriver->spi.connectedNotify(pDriver->hid);
-
-    UnlockRecMutex(&pDriver->lock);
+    TRY
+    {
+        const EpsTcpChannelStatT* pChannelStat = &pDriver->channel.stat;
+        pStat->recvCalls    = EpsAtomicLoadRelaxed(&pChannelStat->recvCalls);
+        pStat->recvPackets  = EpsAtomicLoadRelaxed(&pChannelStat->recvPackets);
+        pStat->recvBytes    = EpsAtomicLoadRelaxed(&pChannelStat->recvBytes);
+        pStat->maxBatchSize = 1;
+        pStat->xdpPackets   = 0;
+
+        const EpsMktDatabaseStatT* pDatabaseStat = &pDriver->database.stat;
+        pStat->gapCount         = EpsAtomicLoadRelaxed(&pDatabaseStat->gapCount);
+        pStat->gapSeqNums       = EpsAtomicLoadRelaxed(&pDatabaseStat->gapSeqNums);
+        pStat->gapFilledSeqNums = EpsAtomicLoadRelaxed(&pDatabaseStat->gapFilledSeqNums);
+        pStat->reorderedPackets = 0;
+        pStat->recoveryCount      = 0;
+        pStat->recoveredSeqNums   = 0;
+        pStat->unrecoveredSeqNums = 0;
+        pStat->sessionGapCount    = EpsAtomicLoadRelaxed(&pDriver->sessionGapCount);
+        pStat->resendRequests     = EpsAtomicLoadRelaxed(&pDriver->resendRequests);
+        pStat->failoverCount      = EpsAtomicLoadRelaxed(&pDriver->failoverCount);
+        pStat->failoverLatency    = EpsAtomicLoadRelaxed(&pDriver->failoverLatency);
+
+        EpsShmBusT* pShmBus = EpsAtomicLoad(&pDriver->pShmBus);
+        pStat->shmPublished = (pShmBus != NULL) ? EpsAtomicLoadRelaxed(&pShmBus->pHeader->writeSeq) : 0;
+        pStat->shmOverruns  = 0;
+
+        GetDispatcherStatistics(&pDriver->dispatcher, pStat);
+        GetSecFilterStatistics(&pDriver->filter, pStat);
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
 }
 
 /**
- * TCPͨӶϿ֪ͨ
+ * ȡTCPỰͳϢ
  *
- * @param   pListener           in  - TCP
- * @param   result              in  - Ͽ
- * @param   reason              in  - Ͽԭ
+ * @param   pDriver             in  - TCP
+ * @param   pStats              out - ỰͳϢ飬Ựǰ
+ * @param   pCount              in  - 鳤
+ *                              out - Ự
+ *
+ * @return  ɹNO_ERR򷵻ش
  */
-static void OnChannelDisconnected(void* pListener, ResCodeT result, const char* reason)
+ResCodeT GetTcpDriverLineStatistics(EpsTcpDriverT* pDriver, EpsLineStatT* pStats, uint32* pCount)
 {
-    EpsTcpDriverT* pDriver = (EpsTcpDriverT*)pListener;
-
-    LockRecMutex(&pDriver->lock);
-    
-    pDriver->status = EPS_TCP_STATUS_DISCONNECTED;
-    pDriver->msgSeqNum = 1;
-    pDriver->recvBufferLen = 0;
-
-    UnsubscribeAllMktData(&pDriver->database);
-    
-    pDriver->spi.disconnectedNotify(pDriver->hid, result, reason);
+    TRY
+    {
+        uint32 sessionCount = (pDriver->pStandby != NULL) ? EPS_TCP_SESSION_NUM : 1;
+        if (*pCount < sessionCount)
+        {
+            THROW_ERROR(ERCD_EPS_INVALID_PARM, "pCount");
+        }
 
-    UnlockRecMutex(&pDriver->lock);
+        uint32 i = 0;
+        for (i = 0; i < sessionCount; i++)
+        {
+            const EpsLineStatT* pStat = &pDriver->sessionArbs[i].stat;
+            pStats[i].recvPackets   = EpsAtomicLoadRelaxed(&pStat->recvPackets);
+            pStats[i].winPackets    = EpsAtomicLoadRelaxed(&pStat->winPackets);
+            pStats[i].dupPackets    = EpsAtomicLoadRelaxed(&pStat->dupPackets);
+            pStats[i].lostSeqNums   = EpsAtomicLoadRelaxed(&pStat->lostSeqNums);
+            pStats[i].totalLeadTime = EpsAtomicLoadRelaxed(&pStat->totalLeadTime);
+            pStats[i].totalLagTime  = EpsAtomicLoadRelaxed(&pStat->totalLagTime);
+            pStats[i].maxLagTime    = EpsAtomicLoadRelaxed(&pStat->maxLagTime);
+        }
+        *pCount = sessionCount;
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
 }
 
 /**
- * TCPͨݽ֪ͨ
+ * TCPѡ
  *
- * @param   pListener           in  - TCP
- * @param   result              in  - ս
- * @param   data                in  - 
- * @param   dataLen             in  - ݳ
+ * @param   pDriver             in  - TCP
+ * @param   option              in  - ѡ
+ * @param   value               in  - ѡֵ
+ *
+ * @return  ɹNO_ERR򷵻ش
  */
-static void OnChannelReceived(void* pListener, ResCodeT result, const char* data, uint32 dataLen)
+ResCodeT SetTcpDriverOption(EpsTcpDriverT* pDriver, EpsOptionT option, int32 value)
 {
-
-    EpsTcpDriverT* pDriver = (EpsTcpDriverT*)pListener;
-  
     TRY
     {
-        LockRecMutex(&pDriver->lock);
-
-        if (OK(result))
+        switch (option)
         {
-            memcpy(pDriver->recvBuffer + pDriver->recvBufferLen, data, dataLen);
-            pDriver->recvBufferLen += dataLen;
-
-            ResCodeT rc = NO_ERR;
-            StepMessageT msg;
-            int32 decodeSize = 0;
-            uint32 pickupLen = 0;
-            
-            while (TRUE)
+            case EPS_OPTION_TCP_FAILOVER_TIMEOUT:
             {
-                rc = DecodeStepMessage(pDriver->recvBuffer + pickupLen, 
-                    pDriver->recvBufferLen - pickupLen, &msg, &decodeSize);
-      
-                if (NOTOK(rc))
+                if (value <= 0)
                 {
-                    if (rc == ERCD_STEP_STREAM_NOT_ENOUGH)
-                    {
-                        ErrClearError();
-                        break;
-                    }
-
-                    THROW_ERROR(rc);
+                    THROW_ERROR(ERCD_EPS_INVALID_PARM, "value");
                 }
-
-                pickupLen += decodeSize;
-
-                switch (msg.msgType)
+                EpsAtomicStoreRelaxed(&pDriver->failoverTimeout, (uint32)value);
+                break;
+            }
+            case EPS_OPTION_MKTDATA_BATCH_SIZE:
+            case EPS_OPTION_MKTDATA_BATCH_DELAY:
+            {
+                THROW_ERROR(SetMktBatchOption(&pDriver->batch, option, value));
+                break;
+            }
+            case EPS_OPTION_DISPATCH_THREADS:
+            case EPS_OPTION_DISPATCH_HIGH_WATER:
+            case EPS_OPTION_DISPATCH_POLICY:
+            case EPS_OPTION_DISPATCH_MODE:
+            {
+                LockRecMutex(&pDriver->lock);
+                ResCodeT rc = ERCD_EPS_DUPLICATE_CONNECT;
+                if (EpsAtomicLoad(&pDriver->channel.status) == EPS_TCPCHANNEL_STATUS_STOP)
                 {
-                    case STEP_MSGTYPE_LOGON:
-                        THROW_ERROR(HandleLoginRsp(pDriver, &msg));
-                        break;
-                    case STEP_MSGTYPE_LOGOUT:
-                        THROW_ERROR(HandleLogoutRsp(pDriver, &msg));
-                        break;
-                    case STEP_MSGTYPE_MD_REQUEST:
-                        THROW_ERROR(HandleMDSubscribeRsp(pDriver, &msg));
+                    rc = SetDispatcherOption(&pDriver->dispatcher, option, value);
+                }
+                UnlockRecMutex(&pDriver->lock);
+                THROW_ERROR(rc);
+                break;
+            }
+            case EPS_OPTION_POLL_MODE:
+            {
+                if (value != 0 && value != 1)
+                {
+                    THROW_ERROR(ERCD_EPS_INVALID_PARM, "value");
+                }
+#if ! defined(__LINUX__) || defined(EPS_IOENGINE_URING)
+                if (value != 0)
+                {
+                    THROW_ERROR(ERCD_EPS_UNSUPPORTED_OPTION, "poll mode");
+                }
+#endif
+                LockRecMutex(&pDriver->lock);
+                ResCodeT rc = SetPollMode(pDriver, (value == 1));
+                UnlockRecMutex(&pDriver->lock);
+                THROW_ERROR(rc);
+                break;
+            }
+            default:
+            {
+                THROW_ERROR(ERCD_EPS_UNSUPPORTED_OPTION, "TCP mode");
+                break;
+            }
+        }
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * TCPỰ
+ *
+ * Ự̱ͨ߳棬ǰõͨ߳״ǰЧ
+ *
+ * @param   pDriver             in  - TCP
+ * @param   pProfile            in  - Ự
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT SetTcpDriverSessionProfile(EpsTcpDriverT* pDriver, const EpsSessionProfileT* pProfile)
+{
+    TRY
+    {
+        if (pProfile->mktTypeCount > EPS_MKTTYPE_NUM)
+        {
+            THROW_ERROR(ERCD_EPS_INVALID_PARM, "mktTypeCount");
+        }
+
+        uint32 i = 0;
+        for (i = 0; i < pProfile->mktTypeCount; i++)
+        {
+            if (pProfile->mktTypes[i] > EPS_MKTTYPE_NUM)
+            {
+                THROW_ERROR(ERCD_EPS_INVALID_MKTTYPE);
+            }
+        }
+
+        EpsTcpChannelEventT event;
+        event.eventType = EPS_TCP_EVENTTYPE_PROFILE;
+        event.eventParam = 0;
+        memcpy(event.eventData, pProfile, sizeof(EpsSessionProfileT));
+
+        THROW_ERROR(TriggerTcpChannelEvent(&pDriver->channel, &event));
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * Ӧ߳TCPշ
+ *
+ * ȲȴһỰʱepollϵȴtimeout
+ * ʱֱĳݻmaxEvents֡
+ * Ựͬһ߲߳ڶ߳ͬʱ
+ *
+ * @param   pDriver             in  - TCP
+ * @param   timeout             in  - ʱȴʱ()0ʾȴ
+ * @param   maxEvents           in  - 01
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT PollTcpDriver(EpsTcpDriverT* pDriver, uint64 timeout, uint32 maxEvents)
+{
+    TRY
+    {
+        if (pDriver->pollFd < 0)
+        {
+            THROW_ERROR(ERCD_EPS_INVALID_OPERATION, "poll mode not enabled");
+        }
+
+        if (EpsAtomicLoad(&pDriver->channel.status) != EPS_TCPCHANNEL_STATUS_WORK)
+        {
+            THROW_ERROR(ERCD_EPS_INVALID_OPERATION, "not connected");
+        }
+
+        if (maxEvents == 0)
+        {
+            maxEvents = 1;
+        }
+
+        BOOL isWaited = FALSE;
+        uint32 round = 0;
+        while (round < maxEvents)
+        {
+            uint64 recvPackets = GetRecvPackets(pDriver);
+
+            THROW_ERROR(PollTcpChannel(&pDriver->channel, 0));
+            EpsTcpDriverT* pStandby = pDriver->pStandby;
+            if (pStandby != NULL && 
+                EpsAtomicLoad(&pStandby->channel.status) == EPS_TCPCHANNEL_STATUS_WORK)
+            {
+                THROW_ERROR(PollTcpChannel(&pStandby->channel, 0));
+            }
+
+            if (GetRecvPackets(pDriver) != recvPackets)
+            {
+                round++;
+                continue;
+            }
+
+            if (round > 0 || isWaited || timeout == 0)
+            {
+                break;
+            }
+
+#if defined(__LINUX__)
+            if (EpsWaitPollFd(pDriver->pollFd, timeout) < 0)
+            {
+                int lstErrno = SYS_ERRNO;
+                THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, EpsGetSystemError(lstErrno));
+            }
+#endif
+            isWaited = TRUE;
+        }
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ȡTCPӦ̵߳ȴ
+ *
+ * @param   pDriver             in  - TCP
+ * @param   pFd                 out - epollỰ׽ֿɶʱɶ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT GetTcpDriverFd(EpsTcpDriverT* pDriver, int* pFd)
+{
+    TRY
+    {
+        if (pDriver->pollFd < 0)
+        {
+            THROW_ERROR(ERCD_EPS_INVALID_OPERATION, "poll mode not enabled");
+        }
+
+        *pFd = pDriver->pollFd;
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * TCPûʱã̴ͨ߳һʱЧ
+ *
+ * @param   pDriver             in  - TCP
+ * @param   parser              in  - NULLʾȡ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT SetTcpDriverMdDataParser(EpsTcpDriverT* pDriver, EpsMdDataParseCallback parser)
+{
+    TRY
+    {
+        SetSecFilterParser(&pDriver->filter, parser);
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * TCPĶ֤ȯʱã̴ͨ߳һʱЧ
+ *
+ * @param   pDriver             in  - TCP
+ * @param   securityIDs         in  - ֤ȯ
+ * @param   count               in  - ֤ȯ0ʾȡ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT SubscribeTcpDriverSecurities(EpsTcpDriverT* pDriver, const char* securityIDs[], uint32 count)
+{
+    TRY
+    {
+        THROW_ERROR(SetSecFilterSecurities(&pDriver->filter, securityIDs, count));
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * TCPĶߣʱӣ̴ͨ߳һʱЧ
+ *
+ * @param   pDriver             in  - TCP
+ * @param   pConfig             in  - 
+ * @param   pSid                out - ID
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT AddTcpDriverSubscriber(EpsTcpDriverT* pDriver, const EpsSubscriberConfigT* pConfig, uint32* pSid)
+{
+    TRY
+    {
+        THROW_ERROR(AddSubscriber(&pDriver->subscribers, pConfig, pSid));
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ɾTCPĶ
+ *
+ * @param   pDriver             in  - TCP
+ * @param   sid                 in  - ID
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT RemoveTcpDriverSubscriber(EpsTcpDriverT* pDriver, uint32 sid)
+{
+    TRY
+    {
+        THROW_ERROR(RemoveSubscriber(&pDriver->subscribers, sid));
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * Ӧ߳ͶTCP߶е
+ *
+ * @param   pDriver             in  - TCP
+ * @param   sid                 in  - ID
+ * @param   maxCount            in  - Ͷݵ
+ * @param   pCount              out - Ͷݵ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT PollTcpDriverSubscriber(EpsTcpDriverT* pDriver, uint32 sid, uint32 maxCount, uint32* pCount)
+{
+    TRY
+    {
+        THROW_ERROR(PollSubscriber(&pDriver->subscribers, sid, maxCount, pCount));
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ȡTCPߵͳϢ
+ *
+ * @param   pDriver             in  - TCP
+ * @param   sid                 in  - ID
+ * @param   pStat               out - ͳϢ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT GetTcpDriverSubscriberStatistics(EpsTcpDriverT* pDriver, uint32 sid, EpsSubscriberStatT* pStat)
+{
+    TRY
+    {
+        THROW_ERROR(GetSubscriberStatistics(&pDriver->subscribers, sid, pStat));
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * TCPĹڴ߷
+ *
+ * ͨż鼰г״̬ڹˡַǰдߣԹڴģʽȡ
+ * Ự龭Ựȥغд룬лӰȡ˵
+ *
+ * @param   pDriver             in  - TCP
+ * @param   name                in  - ڴ
+ * @param   slotCount           in  - λ(2)0ȡĬֵ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT SetTcpDriverShmPublisher(EpsTcpDriverT* pDriver, const char* name, uint32 slotCount)
+{
+    EpsShmBusT* pShmBus = NULL;
+
+    TRY
+    {
+        LockRecMutex(&pDriver->lock);
+
+        if (pDriver->pShmBus != NULL)
+        {
+            THROW_ERROR(ERCD_EPS_DUPLICATE_INITED, "shm publisher");
+        }
+
+        pShmBus = (EpsShmBusT*)calloc(1, sizeof(EpsShmBusT));
+        if (pShmBus == NULL)
+        {
+            int lstErrno = SYS_ERRNO;
+            THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, EpsGetSystemError(lstErrno));
+        }
+
+        THROW_ERROR(CreateShmBus(pShmBus, name, slotCount));
+
+        /* ߴɺٷͨ߳ */
+        EpsAtomicStore(&pDriver->pShmBus, pShmBus);
+        pShmBus = NULL;
+    }
+    CATCH
+    {
+        if (pShmBus != NULL)
+        {
+            free(pShmBus);
+        }
+    }
+    FINALLY
+    {
+        UnlockRecMutex(&pDriver->lock);
+
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * TCPͨӳɹ֪ͨ
+ *
+ * @param   pListener             in  - TCP
+ */
+static void OnChannelConnected(void* pListener)
+{
+    EpsTcpDriverT* pDriver = (EpsTcpDriverT*)pListener;
+    BOOL isLocked = LockSession(pDriver);
+
+    EpsAtomicStore(&pDriver->status, EPS_TCP_STATUS_CONNECTED);
+
+    /* ˻Ựʱӳɹ͵½ȴӦ */
+    if (pDriver->isProfileSet)
+    {
+        if (NOTOK(SendSessionProfile(pDriver)))
+        {
+            pDriver->spi.eventOccurredNotify(pDriver->hid, EPS_EVENTTYPE_ERROR, 
+                ErrGetErrorCode(), ErrGetErrorDscr());
+            ErrClearError();
+        }
+    }
+    /* лȱỰʱỰԶ½ */
+    else if (pDriver->isFailedOver)
+    {
+        if (NOTOK(SendLogonRequest(pDriver)))
+        {
+            ErrClearError();
+        }
+    }
+
+    pDriver->listener.statusNotify(pDriver->listener.pListener, EPS_TCP_STATUS_CONNECTED);
+
+    /* лȱỰʱ֪ͨû */
+    if (! pDriver->isFailedOver)
+    {
+        pDriver->spi.connectedNotify(pDriver->hid);
+    }
+
+    UnlockSession(pDriver, isLocked);
+}
+
+/**
+ * TCPͨӶϿ֪ͨ
+ *
+ * @param   pListener           in  - TCP
+ * @param   result              in  - Ͽ
+ * @param   reason              in  - Ͽԭ
+ */
+static void OnChannelDisconnected(void* pListener, ResCodeT result, const char* reason)
+{
+    EpsTcpDriverT* pDriver = (EpsTcpDriverT*)pListener;
+    BOOL isLocked = LockSession(pDriver);
+
+    CheckFailover(pDriver, TRUE);
+    
+    EpsAtomicStore(&pDriver->status, EPS_TCP_STATUS_DISCONNECTED);
+    pDriver->msgSeqNum = 1;
+    pDriver->inMsgSeqNum = 1;
+    pDriver->isResending = FALSE;
+    pDriver->recvBufferLen = 0;
+
+    pDriver->listener.statusNotify(pDriver->listener.pListener, EpsAtomicLoad(&pDriver->status));
+
+    /* лȱỰʱģȱỰͶ */
+    if (! pDriver->isFailedOver)
+    {
+        UnsubscribeAllMktData(&pDriver->database);
+    
+        pDriver->spi.disconnectedNotify(pDriver->hid, result, reason);
+    }
+
+    UnlockSession(pDriver, isLocked);
+}
+
+/**
+ * TCPͨݽ֪ͨ
+ *
+ * @param   pListener           in  - TCP
+ * @param   result              in  - ս
+ * @param   data                in  - 
+ * @param   dataLen             in  - ݳ
+ */
+static void OnChannelReceived(void* pListener, ResCodeT result, const char* data, uint32 dataLen)
+{
+    EpsTcpDriverT* pDriver = (EpsTcpDriverT*)pListener;
+    BOOL isLocked = LockSession(pDriver);
+  
+    TRY
+    {
+        if (OK(result))
+        {
+            memcpy(pDriver->recvBuffer + pDriver->recvBufferLen, data, dataLen);
+            pDriver->recvBufferLen += dataLen;
+
+            ResCodeT rc = NO_ERR;
+            StepMessageT msg;
+            int32 decodeSize = 0;
+            uint32 pickupLen = 0;
+            
+            while (TRUE)
+            {
+                rc = DecodeStepMessage(pDriver->recvBuffer + pickupLen, 
+                    pDriver->recvBufferLen - pickupLen, &msg, &decodeSize);
+      
+                if (NOTOK(rc))
+                {
+                    if (rc == ERCD_STEP_STREAM_NOT_ENOUGH)
+                    {
+                        ErrClearError();
+                        break;
+                    }
+
+                    THROW_ERROR(rc);
+                }
+
+                pickupLen += decodeSize;
+
+                BOOL isAccepted = FALSE;
+                THROW_ERROR(CheckInboundSeqNum(pDriver, &msg, &isAccepted));
+                if (! isAccepted)
+                {
+                    continue;
+                }
+
+                switch (msg.msgType)
+                {
+                    case STEP_MSGTYPE_LOGON:
+                        THROW_ERROR(HandleLoginRsp(pDriver, &msg));
+                        break;
+                    case STEP_MSGTYPE_LOGOUT:
+                        THROW_ERROR(HandleLogoutRsp(pDriver, &msg));
+                        break;
+                    case STEP_MSGTYPE_MD_REQUEST:
+                        THROW_ERROR(HandleMDSubscribeRsp(pDriver, &msg));
                         break;
                     case STEP_MSGTYPE_MD_SNAPSHOT:
                         THROW_ERROR(HandleMarketData(pDriver, &msg));
@@ -515,131 +1299,936 @@ static void OnChannelReceived(void* pListener, ResCodeT result, const char* data
                     case STEP_MSGTYPE_TRADING_STATUS:
                         THROW_ERROR(HandleMarketStatus(pDriver, &msg));
                         break;
+                    case STEP_MSGTYPE_RESEND_REQUEST:
+                        THROW_ERROR(HandleResendRequest(pDriver, &msg));
+                        break;
+                    case STEP_MSGTYPE_SEQUENCE_RESET:
+                        break;
                     default:
                         THROW_ERROR(ERCD_EPS_UNEXPECTED_MSGTYPE);
                         break;
                 }
-                
-                pDriver->recvIdleTimes = 0;
-                pDriver->commIdleTimes = 0;
+                
+                pDriver->recvIdleTimes = 0;
+                pDriver->commIdleTimes = 0;
+            }
+
+            if (pDriver->recvBufferLen > pickupLen && pickupLen > 0)
+    		{
+    			memmove(pDriver->recvBuffer, pDriver->recvBuffer+pickupLen, pDriver->recvBufferLen-pickupLen);
+    		}
+
+            pDriver->recvBufferLen -= pickupLen;
+        }
+        else
+        {
+            if (result == ERCD_EPS_SOCKET_TIMEOUT)
+            {
+                THROW_ERROR(HandleReceiveTimeout(pDriver));
+            }
+            else
+            {
+                THROW_ERROR(result);
+            }
+        }
+
+        FlushMktBatch(&pDriver->batch, pDriver->hid, pDriver->spi.mktDataBatchArrivedNotify);
+    }
+    CATCH
+    {
+        FlushMktBatch(&pDriver->batch, pDriver->hid, pDriver->spi.mktDataBatchArrivedNotify);
+
+        pDriver->spi.eventOccurredNotify(pDriver->hid, EPS_EVENTTYPE_ERROR, ErrGetErrorCode(), ErrGetErrorDscr());
+        CloseTcpChannel(&pDriver->channel);
+        OnChannelDisconnected(pListener, ErrGetErrorCode(), ErrGetErrorDscr());
+        ErrClearError();
+    }
+    FINALLY
+    {
+        UnlockSession(pDriver, isLocked);
+
+        pDriver->listener.receivedNotify(pDriver->listener.pListener);
+        SET_RESCODE(GET_RESCODE());
+    }
+}
+
+/**
+ * TCPͨݷ֪ͨ
+ *
+ * @param   pListener           in  - TCP
+ * @param   result              in  - ͽ
+ * @param   data                in  - 
+ * @param   dataLen             in  - ݳ
+ */
+static void OnChannelSended(void* pListener, ResCodeT rc, const char* data, uint32 dataLen)
+{
+}
+
+/**
+ * TCPͨ¼ִ֪ͨͨ߳ûĵ½ǳļỰò
+ *
+ * ʧʱͨӦӦص֪ͨûִкʹȱỰỰ
+ *
+ * @param   pListener           in  - TCP
+ * @param   pEvent              in  - ¼
+ */
+static void OnChannelEventOccurred(void* pListener, EpsTcpChannelEventT* pEvent)
+{
+    EpsTcpDriverT* pDriver = (EpsTcpDriverT*)pListener;
+    BOOL isLocked = LockSession(pDriver);
+    ResCodeT rc = NO_ERR;
+
+    switch (pEvent->eventType)
+    {
+        case EPS_TCP_EVENTTYPE_LOGIN:
+        {
+            rc = HandleLoginEvent(pDriver, (const EpsTcpLoginDataT*)pEvent->eventData, 
+                    (uint16)pEvent->eventParam);
+            if (NOTOK(rc))
+            {
+                pDriver->spi.loginRspNotify(pDriver->hid, (uint16)pEvent->eventParam, 
+                    rc, ErrGetErrorDscr());
+            }
+            break;
+        }
+        case EPS_TCP_EVENTTYPE_LOGOUT:
+        {
+            rc = HandleLogoutEvent(pDriver, pEvent->eventData);
+            if (NOTOK(rc))
+            {
+                pDriver->spi.logoutRspNotify(pDriver->hid, rc, ErrGetErrorDscr());
+            }
+            break;
+        }
+        case EPS_TCP_EVENTTYPE_SUBSCRIBE:
+        {
+            rc = HandleSubscribeEvent(pDriver, (EpsMktTypeT)pEvent->eventParam);
+            if (NOTOK(rc))
+            {
+                pDriver->spi.mktDataSubRspNotify(pDriver->hid, (EpsMktTypeT)pEvent->eventParam, 
+                    rc, ErrGetErrorDscr());
+            }
+            break;
+        }
+        case EPS_TCP_EVENTTYPE_PROFILE:
+        {
+            EpsSessionProfileT profile;
+            memcpy(&profile, pEvent->eventData, sizeof(profile));
+
+            rc = HandleProfileEvent(pDriver, &profile);
+            if (NOTOK(rc))
+            {
+                pDriver->spi.eventOccurredNotify(pDriver->hid, EPS_EVENTTYPE_ERROR, 
+                    rc, ErrGetErrorDscr());
+            }
+            break;
+        }
+        default:
+            break;
+    }
+
+    if (NOTOK(rc))
+    {
+        ErrClearError();
+    }
+
+    DriveStandby(pDriver);
+
+    UnlockSession(pDriver, isLocked);
+}
+
+/**
+ * ִе½
+ *
+ * @param   pDriver             in  - TCP
+ * @param   pData               in  - ½˺
+ * @param   heartbeatIntl       in  - 
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+static ResCodeT HandleLoginEvent(EpsTcpDriverT* pDriver, const EpsTcpLoginDataT* pData, uint16 heartbeatIntl)
+{
+    TRY
+    {
+        THROW_ERROR(CheckOperation(pDriver, EPS_TCP_EVENTTYPE_LOGIN));
+
+        snprintf(pDriver->username, sizeof(pDriver->username), "%s", pData->username);
+        snprintf(pDriver->password, sizeof(pDriver->password), "%s", pData->password);
+        pDriver->heartbeatIntl = heartbeatIntl;
+        pDriver->isLoginIssued = TRUE;
+        pDriver->standbyGen++;
+
+        THROW_ERROR(SendLogonRequest(pDriver));
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ִеǳ
+ *
+ * @param   pDriver             in  - TCP
+ * @param   reason              in  - ǳԭ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+static ResCodeT HandleLogoutEvent(EpsTcpDriverT* pDriver, const char* reason)
+{
+    TRY
+    {
+        THROW_ERROR(CheckOperation(pDriver, EPS_TCP_EVENTTYPE_LOGOUT));
+
+        pDriver->isLoginIssued = FALSE;
+        pDriver->isFailedOver = FALSE;
+        pDriver->isProfileSet = FALSE;
+        pDriver->standbyGen++;
+
+        char data[STEP_MSG_MAX_LEN];
+        int32 dataLen = (int32)sizeof(data);
+        THROW_ERROR(BuildLogoutRequest(pDriver->msgSeqNum++, reason, data, &dataLen));
+        
+        EpsAtomicStore(&pDriver->status, EPS_TCP_STATUS_LOGOUTING);
+        THROW_ERROR(SendTcpChannel(&pDriver->channel, data, dataLen));
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ִжĲ
+ *
+ * @param   pDriver             in  - TCP
+ * @param   mktType             in  - г
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+static ResCodeT HandleSubscribeEvent(EpsTcpDriverT* pDriver, EpsMktTypeT mktType)
+{
+    TRY
+    {
+        THROW_ERROR(CheckOperation(pDriver, EPS_TCP_EVENTTYPE_SUBSCRIBE));
+
+        THROW_ERROR(SubscribeMktData(&pDriver->database, mktType));
+        pDriver->standbyGen++;
+
+        /* лȱỰʱỰָݿⲹ */
+        EpsTcpStatusT status = EpsAtomicLoad(&pDriver->status);
+        if (status == EPS_TCP_STATUS_LOGINED || status == EPS_TCP_STATUS_PUBLISHING)
+        {
+            THROW_ERROR(SendSubscribeRequest(pDriver, mktType));
+        }
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ỰãȱỰʹͬ
+ *
+ * @param   pDriver             in  - TCP
+ * @param   pProfile            in  - Ự
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+static ResCodeT HandleProfileEvent(EpsTcpDriverT* pDriver, const EpsSessionProfileT* pProfile)
+{
+    TRY
+    {
+        pDriver->profile = *pProfile;
+        pDriver->isProfileSet = TRUE;
+        pDriver->standbyGen++;
+
+        if (pDriver->pStandby != NULL)
+        {
+            THROW_ERROR(SetTcpDriverSessionProfile(pDriver->pStandby, pProfile));
+        }
+
+        /* δ½ʱʼ */
+        if (EpsAtomicLoad(&pDriver->status) == EPS_TCP_STATUS_CONNECTED)
+        {
+            THROW_ERROR(SendSessionProfile(pDriver));
+        }
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * 鵱ǰ״̬Ƿ½ǳĲ
+ *
+ * ӿںݴ˼ʱִܾͨ߳вǰٴμ
+ *
+ * @param   pDriver             in  - TCP
+ * @param   eventType           in  - Ӧ¼
+ *
+ * @return  NO_ERR򷵻ERCD_EPS_INVALID_OPERATION
+ */
+static ResCodeT CheckOperation(EpsTcpDriverT* pDriver, uint32 eventType)
+{
+    TRY
+    {
+        EpsTcpStatusT status = EpsAtomicLoad(&pDriver->status);
+        BOOL isLogined = (status == EPS_TCP_STATUS_LOGINED || status == EPS_TCP_STATUS_PUBLISHING);
+        const char* operation = NULL;
+
+        switch (eventType)
+        {
+            case EPS_TCP_EVENTTYPE_LOGIN:
+            {
+                if (status != EPS_TCP_STATUS_CONNECTED && status != EPS_TCP_STATUS_LOGOUT)
+                {
+                    operation = "login";
+                }
+                break;
+            }
+            case EPS_TCP_EVENTTYPE_LOGOUT:
+            {
+                if (! isLogined)
+                {
+                    operation = "logout";
+                }
+                break;
+            }
+            case EPS_TCP_EVENTTYPE_SUBSCRIBE:
+            {
+                /* лȱỰʱỰδ½ʱ */
+                if (! isLogined && ! EpsAtomicLoadRelaxed(&pDriver->isFailedOver))
+                {
+                    operation = "subscribe";
+                }
+                break;
+            }
+            default:
+                break;
+        }
+
+        if (operation != NULL)
+        {
+            char errorText[128];
+            snprintf(errorText, sizeof(errorText), 
+                "%s operation disallowed in current status(%d)", operation, status); 
+            THROW_ERROR(ERCD_EPS_INVALID_OPERATION, errorText);
+        }
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ȡỰٲ
+ *
+ * ״̶̬ͨ߳ռỰʱ鴦ȡκ
+ * ȱỰʱȱỰ߳ҲỰݿ⼰ٲ״̬
+ *
+ * @param   pDriver             in  - TCP
+ *
+ * @return  ѼTRUE򷵻FALSE
+ */
+static BOOL LockSession(EpsTcpDriverT* pDriver)
+{
+    if (pDriver->pStandby == NULL)
+    {
+        return FALSE;
+    }
+
+    LockRecMutex(&pDriver->lock);
+    return TRUE;
+}
+
+/**
+ * ͷỰٲ
+ *
+ * @param   pDriver             in  - TCP
+ * @param   isLocked            in  - LockSession()ķֵ
+ */
+static void UnlockSession(EpsTcpDriverT* pDriver, BOOL isLocked)
+{
+    if (isLocked)
+    {
+        UnlockRecMutex(&pDriver->lock);
+    }
+}
+
+/**
+ * ½Ӧ
+ *
+ * @param   pDriver             in  - TCP
+ * @param   pMsg                in  - ½ӦϢ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+static ResCodeT HandleLoginRsp(EpsTcpDriverT* pDriver, const StepMessageT* pMsg)
+{
+    TRY
+    {
+        EpsAtomicStore(&pDriver->status, EPS_TCP_STATUS_LOGINED);
+
+        LogonRecordT* pRecord = (LogonRecordT*)pMsg->body;
+        pDriver->heartbeatIntl = pRecord->heartBtInt;
+
+        pDriver->listener.statusNotify(pDriver->listener.pListener, EpsAtomicLoad(&pDriver->status));
+
+        if (pDriver->isFailedOver)
+        {
+            /* Ựµ½ݿָģỰ½󷢳 */
+            if (! pDriver->isProfileSet)
+            {
+                pDriver->restoreRsps = 0;
+
+                int32 mktType = 0;
+                for (mktType = EPS_MKTTYPE_ALL + 1; mktType <= EPS_MKTTYPE_NUM; mktType++)
+                {
+                    if (pDriver->database.isSubscribed[mktType])
+                    {
+                        THROW_ERROR(SendSubscribeRequest(pDriver, (EpsMktTypeT)mktType));
+                        pDriver->restoreRsps++;
+                    }
+                }
+            }
+            THROW_RESCODE(NO_ERR);
+        }
+        
+        pDriver->spi.loginRspNotify(pDriver->hid, pRecord->heartBtInt,
+            NO_ERR, "login succeed");
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ǳӦ
+ *
+ * @param   pDriver             in  - TCP
+ * @param   pMsg                in  - ǳӦϢ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+static ResCodeT HandleLogoutRsp(EpsTcpDriverT* pDriver, const StepMessageT* pMsg)
+{
+    TRY
+    {
+        EpsTcpStatusT status = EpsAtomicLoad(&pDriver->status);
+        EpsAtomicStore(&pDriver->status, EPS_TCP_STATUS_LOGOUT);
+
+        pDriver->listener.statusNotify(pDriver->listener.pListener, EpsAtomicLoad(&pDriver->status));
+
+        if (pDriver->isFailedOver)
+        {
+            THROW_RESCODE(NO_ERR);
+        }
+
+        UnsubscribeAllMktData(&pDriver->database);
+        
+        LogoutRecordT* pRecord = (LogoutRecordT*)pMsg->body;
+
+        switch (status)
+        {
+            case EPS_TCP_STATUS_LOGGING:
+                pDriver->spi.loginRspNotify(pDriver->hid, pDriver->heartbeatIntl,
+                    ERCD_EPS_LOGIN_FAILED, pRecord->text);
+                break;
+            case EPS_TCP_STATUS_LOGOUTING:
+                pDriver->spi.logoutRspNotify(pDriver->hid, NO_ERR, pRecord->text);
+                break;
+            case EPS_TCP_STATUS_PUBLISHING:
+                pDriver->spi.mktDataSubRspNotify(pDriver->hid, EPS_MKTTYPE_ALL,
+                    ERCD_EPS_SUBMARKETDATA_FAILED, pRecord->text);
+                break;
+            default:
+                pDriver->spi.logoutRspNotify(pDriver->hid, NO_ERR, pRecord->text);
+ 
+                break;
+        }
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * 鶩Ӧ
+ *
+ * @param   pDriver             in  - TCP
+ * @param   pMsg                in  - 鶩ӦϢ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+static ResCodeT HandleMDSubscribeRsp(EpsTcpDriverT* pDriver, const StepMessageT* pMsg)
+{
+    TRY
+    {
+        MDRequestRecordT* pRecord = (MDRequestRecordT*)pMsg->body;
+     
+        EpsMktTypeT mktType = (EpsMktTypeT)atoi(pRecord->securityType);
+
+        EpsAtomicStore(&pDriver->status, EPS_TCP_STATUS_PUBLISHING);
+
+        pDriver->listener.statusNotify(pDriver->listener.pListener, EpsAtomicLoad(&pDriver->status));
+
+        if (pDriver->restoreRsps > 0)
+        {
+            pDriver->restoreRsps--;
+            THROW_RESCODE(NO_ERR);
+        }
+
+        pDriver->spi.mktDataSubRspNotify(pDriver->hid, mktType, NO_ERR, "subscribe succeed");
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * 
+ *
+ * @param   pDriver             in  - TCP
+ * @param   pMsg                in  - Ϣ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+static ResCodeT HandleMarketData(EpsTcpDriverT* pDriver, const StepMessageT* pMsg)
+{
+    TRY
+    {
+        pDriver->listener.mktDataNotify(pDriver->listener.pListener, pMsg, pDriver->channel.recvTime);
+
+        /* νյϢȡһνյʱ */
+        THROW_ERROR(DeliverMarketData(pDriver, pMsg, pDriver->channel.recvTime, 
+            EPS_TCP_SESSION_PRIMARY));
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * г״̬
+ *
+ * @param   pDriver             in  - TCP
+ * @param   pMsg                in  - г״̬Ϣ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+static ResCodeT HandleMarketStatus(EpsTcpDriverT* pDriver, const StepMessageT* pMsg)
+{
+    TRY
+    {
+        ResCodeT rc = AcceptMktStatus(&pDriver->database, pMsg);
+        if (OK(rc))
+        {
+            EpsShmBusT* pShmBus = EpsAtomicLoad(&pDriver->pShmBus);
+            if (pShmBus != NULL)
+            {
+                PublishShmBus(pShmBus, pMsg, pDriver->channel.recvTime);
+            }
+
+            EpsMktStatusT mktStatus;
+            THROW_ERROR(ConvertMktStatus(pMsg, &mktStatus));
+
+            /* Ͷۻ飬֪ͨ˳ */
+            FlushMktBatch(&pDriver->batch, pDriver->hid, pDriver->spi.mktDataBatchArrivedNotify);
+            pDriver->spi.mktStatusChangedNotify(pDriver->hid, &mktStatus);
+        }
+        else
+        {
+            if (rc == ERCD_EPS_MKTSTATUS_UNCHANGED || rc == ERCD_EPS_MKTTYPE_UNSUBSCRIBED)
+            {
+                ErrClearError();
+                THROW_RESCODE(NO_ERR);
+            }
+            else
+            {
+                THROW_RESCODE(rc);
             }
+        }
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ݽճʱ
+ *
+ * @param   pDriver             in  - TCP
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+static ResCodeT HandleReceiveTimeout(EpsTcpDriverT* pDriver)
+{
+    TRY
+    {
+        /* ճʱʱҲ֪ͨǰ״̬ȱỰԸỰ */
+        pDriver->listener.statusNotify(pDriver->listener.pListener, EpsAtomicLoad(&pDriver->status));
+
+        CheckFailover(pDriver, FALSE);
+
+        if (EpsAtomicLoad(&pDriver->status) != EPS_TCP_STATUS_LOGINED && 
+            EpsAtomicLoad(&pDriver->status) != EPS_TCP_STATUS_PUBLISHING)
+        {
+            THROW_RESCODE(NO_ERR);
+        }
+        
+        pDriver->recvIdleTimes++;
+        pDriver->commIdleTimes++;
+
+        if (pDriver->isResending && 
+            EpsGetTimestamp() - pDriver->resendTime >= (uint64)EPS_TCP_RESEND_TIMEOUT * 1000000)
+        {
+            THROW_ERROR(SendResendRequest(pDriver));
+        }
+        
+        if ((pDriver->commIdleTimes * EPS_SOCKET_RECV_TIMEOUT) >= (pDriver->heartbeatIntl * 1000))
+        {
+            char data[STEP_MSG_MAX_LEN];
+            int32 dataLen = (int32)sizeof(data);
+            THROW_ERROR(BuildHeartbeatRequest(pDriver->msgSeqNum++, data, &dataLen));
+
+            THROW_ERROR(SendTcpChannel(&pDriver->channel, data, dataLen));
+
+            pDriver->commIdleTimes = 0;
+        }
+
+        if ((pDriver->recvIdleTimes * EPS_SOCKET_RECV_TIMEOUT) >= EPS_DRIVER_KEEPALIVE_TIME)
+        {
+            ErrSetError(ERCD_EPS_CHECK_KEEPALIVE_TIMEOUT);
+                    
+            pDriver->spi.eventOccurredNotify(pDriver->hid, EPS_EVENTTYPE_WARNING, 
+                GET_RESCODE(), ErrGetErrorDscr());
+
+            pDriver->recvIdleTimes = 0;
+
+            ErrClearError();
+         }
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+
+/**
+ * ط
+ *
+ * ͻֻͻỰطЩû壬ͳһ(ģʽ)
+ *
+ * @param   pDriver             in  - TCP
+ * @param   pMsg                in  - طϢ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+static ResCodeT HandleResendRequest(EpsTcpDriverT* pDriver, const StepMessageT* pMsg)
+{
+    TRY
+    {
+        const ResendRequestRecordT* pRecord = (const ResendRequestRecordT*)pMsg->body;
+        if (pRecord->beginSeqNo >= pDriver->msgSeqNum)
+        {
+            THROW_RESCODE(NO_ERR);
+        }
+
+        char data[STEP_MSG_MAX_LEN];
+        int32 dataLen = (int32)sizeof(data);
+        THROW_ERROR(BuildSequenceReset(pRecord->beginSeqNo, pDriver->msgSeqNum, data, &dataLen));
+
+        THROW_ERROR(SendTcpChannel(&pDriver->channel, data, dataLen));
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * Ϣ
+ *
+ * ųǰʱϢſʼططϢ
+ * ϢΪظϢֱӶ
+ *
+ * @param   pDriver             in  - TCP
+ * @param   pMsg                in  - Ϣ
+ * @param   pIsAccepted         out - ϢǷҪ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+static ResCodeT CheckInboundSeqNum(EpsTcpDriverT* pDriver, const StepMessageT* pMsg, BOOL* pIsAccepted)
+{
+    TRY
+    {
+        uint64 msgSeqNum = pMsg->msgSeqNum;
+        *pIsAccepted = FALSE;
 
-            if (pDriver->recvBufferLen > pickupLen && pickupLen > 0)
-    		{
-    			memmove(pDriver->recvBuffer, pDriver->recvBuffer+pickupLen, pDriver->recvBufferLen-pickupLen);
-    		}
+        /* ½Ӧȷ */
+        if (pMsg->msgType == STEP_MSGTYPE_LOGON)
+        {
+            pDriver->inMsgSeqNum = msgSeqNum + 1;
+            pDriver->isResending = FALSE;
+            *pIsAccepted = TRUE;
+            THROW_RESCODE(NO_ERR);
+        }
 
-            pDriver->recvBufferLen -= pickupLen;
+        const SequenceResetRecordT* pReset = (const SequenceResetRecordT*)pMsg->body;
+        BOOL isSeqReset = (pMsg->msgType == STEP_MSGTYPE_SEQUENCE_RESET);
+
+        /* ģʽò */
+        if (isSeqReset && pReset->gapFillFlag != 'Y')
+        {
+            pDriver->inMsgSeqNum = pReset->newSeqNo;
+            pDriver->isResending = FALSE;
+            THROW_RESCODE(NO_ERR);
         }
-        else
+
+        if (msgSeqNum > pDriver->inMsgSeqNum)
         {
-            if (result == ERCD_EPS_SOCKET_TIMEOUT)
+            if (! pDriver->isResending)
             {
-                THROW_ERROR(HandleReceiveTimeout(pDriver));
+                EpsAtomicCounterAdd(&pDriver->sessionGapCount, 1);
+
+                ErrSetError(ERCD_EPS_SESSION_GAP, 
+                    (unsigned long long)pDriver->inMsgSeqNum, (unsigned long long)msgSeqNum);
+                pDriver->spi.eventOccurredNotify(pDriver->hid, EPS_EVENTTYPE_WARNING, 
+                    ErrGetErrorCode(), ErrGetErrorDscr());
+                ErrClearError();
+
+                THROW_ERROR(SendResendRequest(pDriver));
             }
-            else
+            else if (EpsGetTimestamp() - pDriver->resendTime >= 
+                    (uint64)EPS_TCP_RESEND_TIMEOUT * 1000000)
             {
-                THROW_ERROR(result);
+                THROW_ERROR(SendResendRequest(pDriver));
+            }
+
+            /* ط͵ǳȱӰ */
+            if (pMsg->msgType == STEP_MSGTYPE_RESEND_REQUEST || 
+                pMsg->msgType == STEP_MSGTYPE_LOGOUT)
+            {
+                *pIsAccepted = TRUE;
+            }
+            THROW_RESCODE(NO_ERR);
+        }
+
+        if (msgSeqNum < pDriver->inMsgSeqNum)
+        {
+            THROW_RESCODE(NO_ERR);
+        }
+
+        if (isSeqReset)
+        {
+            if (pReset->newSeqNo > pDriver->inMsgSeqNum)
+            {
+                pDriver->inMsgSeqNum = pReset->newSeqNo;
             }
+            THROW_RESCODE(NO_ERR);
+        }
+
+        pDriver->inMsgSeqNum++;
+
+        /* طϢPossDupFlagյʵʱϢʾط */
+        if (pDriver->isResending && pMsg->possDupFlag != 'Y')
+        {
+            pDriver->isResending = FALSE;
         }
+
+        *pIsAccepted = TRUE;
     }
     CATCH
     {
-        pDriver->spi.eventOccurredNotify(pDriver->hid, EPS_EVENTTYPE_ERROR, ErrGetErrorCode(), ErrGetErrorDscr());
-        CloseTcpChannel(&pDriver->channel);
-        OnChannelDisconnected(pListener, ErrGetErrorCode(), ErrGetErrorDscr());
-        ErrClearError();
     }
     FINALLY
     {
-        UnlockRecMutex(&pDriver->lock);
-        SET_RESCODE(GET_RESCODE());
+        RETURN_RESCODE;
     }
 }
 
 /**
- * TCPͨݷ֪ͨ
+ * طط֮ȫϢ
  *
- * @param   pListener           in  - TCP
- * @param   result              in  - ͽ
- * @param   data                in  - 
- * @param   dataLen             in  - ݳ
+ * @param   pDriver             in  - TCP
+ *
+ * @return  ɹNO_ERR򷵻ش
  */
-static void OnChannelSended(void* pListener, ResCodeT rc, const char* data, uint32 dataLen)
+static ResCodeT SendResendRequest(EpsTcpDriverT* pDriver)
 {
+    TRY
+    {
+        char data[STEP_MSG_MAX_LEN];
+        int32 dataLen = (int32)sizeof(data);
+        THROW_ERROR(BuildResendRequest(pDriver->msgSeqNum++, pDriver->inMsgSeqNum, data, &dataLen));
+
+        THROW_ERROR(SendTcpChannel(&pDriver->channel, data, dataLen));
+
+        pDriver->isResending = TRUE;
+        pDriver->resendTime = EpsGetTimestamp();
+        EpsAtomicCounterAdd(&pDriver->resendRequests, 1);
+        pDriver->commIdleTimes = 0;
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
 }
 
 /**
- * ½Ӧ
+ * ͵½
  *
  * @param   pDriver             in  - TCP
- * @param   pMsg                in  - ½ӦϢ
  *
  * @return  ɹNO_ERR򷵻ش
  */
-static ResCodeT HandleLoginRsp(EpsTcpDriverT* pDriver, const StepMessageT* pMsg)
+static ResCodeT SendLogonRequest(EpsTcpDriverT* pDriver)
 {
     TRY
     {
-        LockRecMutex(&pDriver->lock);
-
-        pDriver->status = EPS_TCP_STATUS_LOGINED;
+        char data[STEP_MSG_MAX_LEN];
+        int32 dataLen = (int32)sizeof(data);
+        THROW_ERROR(BuildLogonRequest(pDriver->msgSeqNum++, pDriver->username, pDriver->password, 
+            pDriver->heartbeatIntl, data, &dataLen));
 
-        LogonRecordT* pRecord = (LogonRecordT*)pMsg->body;
-        pDriver->heartbeatIntl = pRecord->heartBtInt;
-        
-        pDriver->spi.loginRspNotify(pDriver->hid, pRecord->heartBtInt,
-            NO_ERR, "login succeed");
+        EpsAtomicStore(&pDriver->status, EPS_TCP_STATUS_LOGGING);
+        THROW_ERROR(SendTcpChannel(&pDriver->channel, data, dataLen));
     }
     CATCH
     {
     }
     FINALLY
     {
-        UnlockRecMutex(&pDriver->lock);
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * 鶩
+ *
+ * @param   pDriver             in  - TCP
+ * @param   mktType             in  - г
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+static ResCodeT SendSubscribeRequest(EpsTcpDriverT* pDriver, EpsMktTypeT mktType)
+{
+    TRY
+    {
+        char data[STEP_MSG_MAX_LEN];
+        int32 dataLen = (int32)sizeof(data);
+        THROW_ERROR(BuildSubscribeRequest(pDriver->msgSeqNum++, mktType, data, &dataLen));
 
+        THROW_ERROR(SendTcpChannel(&pDriver->channel, data, dataLen));
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
         RETURN_RESCODE;
     }
 }
 
 /**
- * ǳӦ
+ * Ự÷͵½
+ *
+ * ½󷢳ȴ½ӦлȱỰڼ䣬
+ * ݿбһָỰٲ()
  *
  * @param   pDriver             in  - TCP
- * @param   pMsg                in  - ǳӦϢ
  *
  * @return  ɹNO_ERR򷵻ش
  */
-static ResCodeT HandleLogoutRsp(EpsTcpDriverT* pDriver, const StepMessageT* pMsg)
+static ResCodeT SendSessionProfile(EpsTcpDriverT* pDriver)
 {
     TRY
     {
-        LockRecMutex(&pDriver->lock);
+        EpsSessionProfileT* pProfile = &pDriver->profile;
 
-        pDriver->status = EPS_TCP_STATUS_LOGOUT;
+        snprintf(pDriver->username, sizeof(pDriver->username), "%s", pProfile->username);
+        snprintf(pDriver->password, sizeof(pDriver->password), "%s", pProfile->password);
+        pDriver->heartbeatIntl = pProfile->heartbeatIntl;
+        pDriver->isLoginIssued = TRUE;
 
-        UnsubscribeAllMktData(&pDriver->database);
-        
-        LogoutRecordT* pRecord = (LogoutRecordT*)pMsg->body;
+        uint32 i = 0;
+        for (i = 0; i < pProfile->mktTypeCount; i++)
+        {
+            ResCodeT rc = SubscribeMktData(&pDriver->database, pProfile->mktTypes[i]);
+            if (NOTOK(rc))
+            {
+                if (rc != ERCD_EPS_MKTTYPE_DUPSUBSCRIBED)
+                {
+                    THROW_RESCODE(rc);
+                }
+                ErrClearError();
+            }
+        }
 
-        EpsTcpStatusT status = pDriver->status;
-        switch (status)
+        THROW_ERROR(SendLogonRequest(pDriver));
+
+        pDriver->restoreRsps = 0;
+
+        int32 mktType = 0;
+        for (mktType = EPS_MKTTYPE_ALL + 1; mktType <= EPS_MKTTYPE_NUM; mktType++)
         {
-            case EPS_TCP_STATUS_LOGGING:
-                pDriver->spi.loginRspNotify(pDriver->hid, pDriver->heartbeatIntl,
-                    ERCD_EPS_LOGIN_FAILED, pRecord->text);
-                break;
-            case EPS_TCP_STATUS_LOGOUTING:
-                pDriver->spi.logoutRspNotify(pDriver->hid, NO_ERR, pRecord->text);
-                break;
-            case EPS_TCP_STATUS_PUBLISHING:
-                pDriver->spi.mktDataSubRspNotify(pDriver->hid, EPS_MKTTYPE_ALL,
-                    ERCD_EPS_SUBMARKETDATA_FAILED, pRecord->text);
-                break;
-            default:
-                pDriver->spi.logoutRspNotify(pDriver->hid, NO_ERR, pRecord->text);
- 
-                break;
+            if (pDriver->database.isSubscribed[mktType])
+            {
+                THROW_ERROR(SendSubscribeRequest(pDriver, (EpsMktTypeT)mktType));
+                if (pDriver->isFailedOver)
+                {
+                    pDriver->restoreRsps++;
+                }
+            }
         }
     }
     CATCH
@@ -647,192 +2236,430 @@ static ResCodeT HandleLogoutRsp(EpsTcpDriverT* pDriver, const StepMessageT* pMsg
     }
     FINALLY
     {
-        UnlockRecMutex(&pDriver->lock);
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ͶỰյ
+ *
+ * Ự龭ͬһݿⰴȥأȵͶݸû
+ * Ựٲ()
+ *
+ * @param   pDriver             in  - TCP
+ * @param   pMsg                in  - Ϣ
+ * @param   recvTime            in  - ʱ()
+ * @param   sessionIndex        in  - Ự
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+static ResCodeT DeliverMarketData(EpsTcpDriverT* pDriver, const StepMessageT* pMsg, 
+    uint64 recvTime, uint32 sessionIndex)
+{
+    TRY
+    {
+        EpsTcpSessionArbT* pArb = &pDriver->sessionArbs[sessionIndex];
+        EpsTcpSessionArbT* pOther = &pDriver->sessionArbs[1 - sessionIndex];
+        uint64 timeout = (uint64)EpsAtomicLoadRelaxed(&pDriver->failoverTimeout) * 1000000;
+
+        EpsAtomicCounterAdd(&pArb->stat.recvPackets, 1);
+        pArb->lastRecvTime = recvTime;
+
+        /* Ựָ׷ȱỰлỰ */
+        if (sessionIndex == EPS_TCP_SESSION_PRIMARY && pDriver->isFailedOver && 
+            pDriver->restoreRsps == 0 && EpsAtomicLoad(&pDriver->status) == EPS_TCP_STATUS_PUBLISHING &&
+            recvTime + timeout >= pOther->lastRecvTime)
+        {
+            pDriver->isFailedOver = FALSE;
+            pDriver->isLatencyPending = FALSE;
+
+            pDriver->spi.eventOccurredNotify(pDriver->hid, EPS_EVENTTYPE_INFORMATION, 
+                NO_ERR, "primary session restored");
+        }
+
+        EpsMktGapT mktGap;
+        ResCodeT rc = AcceptMktData(&pDriver->database, pMsg, &mktGap);
+        if (NOTOK(rc))
+        {
+            if (rc == ERCD_EPS_MKTDATA_GAP)
+            {
+                FlushMktBatch(&pDriver->batch, pDriver->hid, pDriver->spi.mktDataBatchArrivedNotify);
+                pDriver->spi.mktDataGapNotify(pDriver->hid, &mktGap);
+            }
+            else if (rc == ERCD_EPS_DATASOURCE_CHANGED)
+            {
+                pDriver->spi.eventOccurredNotify(pDriver->hid, EPS_EVENTTYPE_WARNING, rc, ErrGetErrorDscr());
+                ErrClearError();
+            }
+            else if (rc == ERCD_EPS_MKTTYPE_UNSUBSCRIBED)
+            {
+                ErrClearError();
+                THROW_RESCODE(NO_ERR);
+            }
+            else if (rc == ERCD_EPS_MKTDATA_BACKFLOW)
+            {
+                /* һỰͶݻµ½ͷطѽչ鶪 */
+                EpsAtomicCounterAdd(&pArb->stat.dupPackets, 1);
+                ErrClearError();
+                THROW_RESCODE(NO_ERR);
+            }
+            else
+            {
+                THROW_RESCODE(rc);
+            }
+        }
+
+        if (pDriver->pStandby != NULL)
+        {
+            EpsAtomicCounterAdd(&pArb->stat.winPackets, 1);
+            if (pArb->firstWinTime <= pOther->lastRecvTime)
+            {
+                pArb->firstWinTime = recvTime;
+            }
+
+            /* лʱȱỰδȣ״Ͷݵʱлʱ */
+            if (sessionIndex == EPS_TCP_SESSION_STANDBY && pDriver->isLatencyPending &&
+                recvTime > pOther->lastRecvTime)
+            {
+                EpsAtomicStoreRelaxed(&pDriver->failoverLatency, recvTime - pOther->lastRecvTime);
+                pDriver->isLatencyPending = FALSE;
+            }
+        }
+
+        /* ͨżд빲ڴߣȡй */
+        EpsShmBusT* pShmBus = EpsAtomicLoad(&pDriver->pShmBus);
+        if (pShmBus != NULL)
+        {
+            PublishShmBus(pShmBus, pMsg, recvTime);
+        }
+
+        /* ֤ȯʱݿǼǣ˲Ӱȱڼ */
+        ApplySecFilter(&pDriver->filter);
+
+        EpsMktDataBatchArrivedCallback batchNotify = EpsAtomicLoad(&pDriver->spi.mktDataBatchArrivedNotify);
+        if (IsSubscriberHubEnabled(&pDriver->subscribers))
+        {
+            THROW_ERROR(PublishSubscribers(&pDriver->subscribers, pMsg, recvTime));
+
+            /* δעصʱΪ */
+            if (batchNotify == NULL && pDriver->spi.mktDataViewArrivedNotify == NULL &&
+                pDriver->spi.mktDataArrivedNotify == OnEpsMktDataArrived)
+            {
+                THROW_RESCODE(NO_ERR);
+            }
+        }
+
+        if (IsDispatcherEnabled(&pDriver->dispatcher))
+        {
+            THROW_ERROR(PushDispatcher(&pDriver->dispatcher, pMsg, recvTime));
+        }
+        else if (batchNotify != NULL)
+        {
+            EpsMktDataT* pMktData = NextMktBatchItem(&pDriver->batch);
+            THROW_ERROR(ConvertMktData(pMsg, pMktData));
+
+            pMktData->recvTime = recvTime;
+            if (FilterMktData(&pDriver->filter, pDriver->hid, pMktData) &&
+                CommitMktBatchItem(&pDriver->batch, recvTime))
+            {
+                FlushMktBatch(&pDriver->batch, pDriver->hid, batchNotify);
+            }
+        }
+        else if (pDriver->spi.mktDataViewArrivedNotify != NULL)
+        {
+            EpsMktDataViewT mktDataView;
+            if (IsSecFilterEnabled(&pDriver->filter))
+            {
+                /* дݣȸȡͼ */
+                EpsMktDataT mktData;
+                THROW_ERROR(ConvertMktData(pMsg, &mktData));
+                if (! FilterMktData(&pDriver->filter, pDriver->hid, &mktData))
+                {
+                    THROW_RESCODE(NO_ERR);
+                }
+                GetMktDataView(&mktData, &mktDataView);
+
+                mktDataView.recvTime = recvTime;
+                mktDataView.notifyTime = EpsGetTimestamp();
+                pDriver->spi.mktDataViewArrivedNotify(pDriver->hid, &mktDataView);
+                THROW_RESCODE(NO_ERR);
+            }
+
+            THROW_ERROR(ConvertMktDataView(pMsg, &mktDataView));
+
+            mktDataView.recvTime = recvTime;
+            mktDataView.notifyTime = EpsGetTimestamp();
+            pDriver->spi.mktDataViewArrivedNotify(pDriver->hid, &mktDataView);
+        }
+        else
+        {
+            EpsMktDataT mktData;
+            THROW_ERROR(ConvertMktData(pMsg, &mktData));
+            if (! FilterMktData(&pDriver->filter, pDriver->hid, &mktData))
+            {
+                THROW_RESCODE(NO_ERR);
+            }
 
+            mktData.recvTime = recvTime;
+            mktData.notifyTime = EpsGetTimestamp();
+            pDriver->spi.mktDataArrivedNotify(pDriver->hid, &mktData);
+        }
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
         RETURN_RESCODE;
     }
 }
 
 /**
- * 鶩Ӧ
+ * ȱỰ
+ *
+ * Ựٲ()
  *
  * @param   pDriver             in  - TCP
- * @param   pMsg                in  - 鶩ӦϢ
  *
  * @return  ɹNO_ERR򷵻ش
  */
-static ResCodeT HandleMDSubscribeRsp(EpsTcpDriverT* pDriver, const StepMessageT* pMsg)
+static ResCodeT AllocStandby(EpsTcpDriverT* pDriver)
 {
+    EpsTcpDriverT* pStandby = NULL;
+
     TRY
     {
-        LockRecMutex(&pDriver->lock);
+        if (pDriver->pStandby != NULL)
+        {
+            THROW_RESCODE(NO_ERR);
+        }
+
+        pStandby = (EpsTcpDriverT*)calloc(1, sizeof(EpsTcpDriverT));
+        if (pStandby == NULL)
+        {
+            THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, "calloc");
+        }
 
-        MDRequestRecordT* pRecord = (MDRequestRecordT*)pMsg->body;
-     
-        EpsMktTypeT mktType = (EpsMktTypeT)atoi(pRecord->securityType);
+        THROW_ERROR(InitTcpDriver(pStandby));
+        pStandby->hid = pDriver->hid;
 
-        pDriver->status = EPS_TCP_STATUS_PUBLISHING;
+        /* ȱỰỰͬһӦ߳Ựepoll */
+        pStandby->channel.isManual = pDriver->channel.isManual;
+        pStandby->channel.pollFd = pDriver->pollFd;
 
-        pDriver->spi.mktDataSubRspNotify(pDriver->hid, mktType, NO_ERR, "subscribe succeed");
+        EpsTcpDriverListenerT listener =
+        {
+            pDriver,
+            OnStandbyMktData,
+            OnStandbyStatus,
+            OnStandbyReceived
+        };
+        THROW_ERROR(RegisterTcpDriverListener(pStandby, &listener));
+
+        pDriver->pStandby = pStandby;
+        pStandby = NULL;
     }
     CATCH
     {
+        if (pStandby != NULL)
+        {
+            free(pStandby);
+        }
     }
     FINALLY
     {
-        UnlockRecMutex(&pDriver->lock);
-
         RETURN_RESCODE;
     }
 }
 
 /**
- * 
+ * лỰĽʽỰٲ
  *
  * @param   pDriver             in  - TCP
- * @param   pMsg                in  - Ϣ
+ * @param   isManual            in  - ǷӦ߳
  *
  * @return  ɹNO_ERR򷵻ش
  */
-static ResCodeT HandleMarketData(EpsTcpDriverT* pDriver, const StepMessageT* pMsg)
+static ResCodeT SetPollMode(EpsTcpDriverT* pDriver, BOOL isManual)
 {
     TRY
     {
-        LockRecMutex(&pDriver->lock);
+        EpsTcpDriverT* pStandby = pDriver->pStandby;
+        if (EpsAtomicLoad(&pDriver->channel.status) != EPS_TCPCHANNEL_STATUS_STOP ||
+            (pStandby != NULL && EpsAtomicLoad(&pStandby->channel.status) != EPS_TCPCHANNEL_STATUS_STOP))
+        {
+            THROW_ERROR(ERCD_EPS_DUPLICATE_CONNECT);
+        }
 
-        ResCodeT rc = AcceptMktData(&pDriver->database, pMsg);
-        if (NOTOK(rc))
+#if defined(__LINUX__)
+        if (isManual && pDriver->pollFd < 0)
         {
-            if (rc == ERCD_EPS_DATASOURCE_CHANGED)
-            {
-                pDriver->spi.eventOccurredNotify(pDriver->hid, EPS_EVENTTYPE_WARNING, rc, ErrGetErrorDscr());
-                ErrClearError();
-            }
-            else if (rc == ERCD_EPS_MKTTYPE_UNSUBSCRIBED)
-            {
-                ErrClearError();
-                THROW_RESCODE(NO_ERR);
-            }
-            else
+            pDriver->pollFd = EpsCreatePollFd();
+            if (pDriver->pollFd < 0)
             {
-                THROW_RESCODE(rc);
+                int lstErrno = SYS_ERRNO;
+                THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, EpsGetSystemError(lstErrno));
             }
         }
+        else if (! isManual && pDriver->pollFd >= 0)
+        {
+            close(pDriver->pollFd);
+            pDriver->pollFd = -1;
+        }
+#endif
 
-        EpsMktDataT mktData;
-        THROW_ERROR(ConvertMktData(pMsg, &mktData));
-
-        pDriver->spi.mktDataArrivedNotify(pDriver->hid, &mktData);
+        pDriver->channel.isManual = isManual;
+        pDriver->channel.pollFd = pDriver->pollFd;
+        if (pStandby != NULL)
+        {
+            pStandby->channel.isManual = isManual;
+            pStandby->channel.pollFd = pDriver->pollFd;
+        }
     }
     CATCH
     {
     }
     FINALLY
     {
-        UnlockRecMutex(&pDriver->lock);
-
         RETURN_RESCODE;
     }
 }
 
 /**
- * г״̬
+ * ȡỰۼƽմ
  *
  * @param   pDriver             in  - TCP
- * @param   pMsg                in  - г״̬Ϣ
  *
- * @return  ɹNO_ERR򷵻ش
+ * @return  ỰͨյݵĴ֮
  */
-static ResCodeT HandleMarketStatus(EpsTcpDriverT* pDriver, const StepMessageT* pMsg)
+static uint64 GetRecvPackets(EpsTcpDriverT* pDriver)
 {
-    TRY
+    uint64 recvPackets = EpsAtomicLoadRelaxed(&pDriver->channel.stat.recvPackets);
+    if (pDriver->pStandby != NULL)
     {
-        LockRecMutex(&pDriver->lock);
+        recvPackets += EpsAtomicLoadRelaxed(&pDriver->pStandby->channel.stat.recvPackets);
+    }
+    return recvPackets;
+}
 
-        ResCodeT rc = AcceptMktStatus(&pDriver->database, pMsg);
-        if (OK(rc))
-        {
-            EpsMktStatusT mktStatus;
-            THROW_ERROR(ConvertMktStatus(pMsg, &mktStatus));
+/**
+ * ʹȱỰỰĵ½
+ *
+ * ȱỰĲ¼ʽȱỰִͨ߳УȡȱỰ
+ * δЧʱȱỰ´״̬֪ͨͶٴỰٲ
+ *
+ * @param   pDriver             in  - TCP
+ */
+static void DriveStandby(EpsTcpDriverT* pDriver)
+{
+    EpsTcpDriverT* pStandby = pDriver->pStandby;
+    if (pStandby == NULL)
+    {
+        return;
+    }
 
-            pDriver->spi.mktStatusChangedNotify(pDriver->hid, &mktStatus);
-        }
-        else
+    BOOL isDriven = FALSE;
+    EpsTcpStatusT status = EpsAtomicLoad(&pStandby->status);
+    BOOL isLogined = (status == EPS_TCP_STATUS_LOGINED || status == EPS_TCP_STATUS_PUBLISHING);
+    
+    if (pDriver->isLoginIssued)
+    {
+        if (status == EPS_TCP_STATUS_CONNECTED || status == EPS_TCP_STATUS_LOGOUT)
         {
-            if (rc == ERCD_EPS_MKTSTATUS_UNCHANGED || rc == ERCD_EPS_MKTTYPE_UNSUBSCRIBED)
+            if (NOTOK(LoginTcpDriver(pStandby, pDriver->username, pDriver->password, 
+                    pDriver->heartbeatIntl)))
             {
                 ErrClearError();
-                THROW_RESCODE(NO_ERR);
             }
-            else
+        }
+        else if (isLogined)
+        {
+            isDriven = TRUE;
+
+            int32 mktType = 0;
+            for (mktType = EPS_MKTTYPE_ALL + 1; mktType <= EPS_MKTTYPE_NUM; mktType++)
             {
-                THROW_RESCODE(rc);
+                if (pDriver->database.isSubscribed[mktType] && 
+                    ! EpsAtomicLoadRelaxed(&pStandby->database.isSubscribed[mktType]))
+                {
+                    if (NOTOK(SubscribeTcpDriver(pStandby, (EpsMktTypeT)mktType)))
+                    {
+                        isDriven = FALSE;
+                        ErrClearError();
+                    }
+                }
             }
         }
     }
-    CATCH
+    else
     {
+        isDriven = TRUE;
+
+        if (isLogined && NOTOK(LogoutTcpDriver(pStandby, "")))
+        {
+            isDriven = FALSE;
+            ErrClearError();
+        }
     }
-    FINALLY
-    {
-        UnlockRecMutex(&pDriver->lock);
 
-        RETURN_RESCODE;
+    if (isDriven)
+    {
+        pDriver->standbyDrivenGen = pDriver->standbyGen;
     }
 }
 
 /**
- * ݽճʱ
+ * ǷҪлȱỰ
  *
- * @param   pDriver             in  - TCP
+ * ỰжϣȱỰյỰлʱʱ
+ * ȱỰͶ飬Ựٲ()
  *
- * @return  ɹNO_ERR򷵻ش
+ * @param   pDriver             in  - TCP
+ * @param   isPrimaryLost       in  - ỰǷж
  */
-static ResCodeT HandleReceiveTimeout(EpsTcpDriverT* pDriver)
+static void CheckFailover(EpsTcpDriverT* pDriver, BOOL isPrimaryLost)
 {
-    TRY
+    EpsTcpDriverT* pStandby = pDriver->pStandby;
+    if (pStandby == NULL || pDriver->isFailedOver || ! pDriver->isLoginIssued)
     {
-        if (pDriver->status != EPS_TCP_STATUS_LOGINED && 
-            pDriver->status != EPS_TCP_STATUS_PUBLISHING)
-        {
-            THROW_RESCODE(NO_ERR);
-        }
-        
-        pDriver->recvIdleTimes++;
-        pDriver->commIdleTimes++;
-        
-        if ((pDriver->commIdleTimes * EPS_SOCKET_RECV_TIMEOUT) >= (pDriver->heartbeatIntl * 1000))
-        {
-            char data[STEP_MSG_MAX_LEN];
-            int32 dataLen = (int32)sizeof(data);
-            THROW_ERROR(BuildHeartbeatRequest(pDriver->msgSeqNum++, data, &dataLen));
+        return;
+    }
 
-            THROW_ERROR(SendTcpChannel(&pDriver->channel, data, dataLen));
+    /* ȡȱỰ״̬ʱȡȱỰ */
+    if (EpsAtomicLoad(&pStandby->status) != EPS_TCP_STATUS_PUBLISHING)
+    {
+        return;
+    }
 
-            pDriver->commIdleTimes = 0;
-        }
+    if (! isPrimaryLost && pStandby->channel.recvTime < 
+            pDriver->channel.recvTime + (uint64)EpsAtomicLoadRelaxed(&pDriver->failoverTimeout) * 1000000)
+    {
+        return;
+    }
 
-        if ((pDriver->recvIdleTimes * EPS_SOCKET_RECV_TIMEOUT) >= EPS_DRIVER_KEEPALIVE_TIME)
-        {
-            ErrSetError(ERCD_EPS_CHECK_KEEPALIVE_TIMEOUT);
-                    
-            pDriver->spi.eventOccurredNotify(pDriver->hid, EPS_EVENTTYPE_WARNING, 
-                GET_RESCODE(), ErrGetErrorDscr());
+    EpsTcpSessionArbT* pPrimary = &pDriver->sessionArbs[EPS_TCP_SESSION_PRIMARY];
+    EpsTcpSessionArbT* pSecondary = &pDriver->sessionArbs[EPS_TCP_SESSION_STANDBY];
 
-            pDriver->recvIdleTimes = 0;
+    pDriver->isFailedOver = TRUE;
+    pDriver->restoreRsps = 0;
+    EpsAtomicCounterAdd(&pDriver->failoverCount, 1);
 
-            ErrClearError();
-         }
-    }
-    CATCH
+    if (pSecondary->firstWinTime > pPrimary->lastRecvTime)
     {
+        EpsAtomicStoreRelaxed(&pDriver->failoverLatency, pSecondary->firstWinTime - pPrimary->lastRecvTime);
+        pDriver->isLatencyPending = FALSE;
     }
-    FINALLY
+    else
     {
-        RETURN_RESCODE;
+        pDriver->isLatencyPending = TRUE;
     }
-}
 
+    char eventText[128];
+    snprintf(eventText, sizeof(eventText), "session failover, %s", 
+        isPrimaryLost ? "primary session lost" : "primary session stalled");
+    pDriver->spi.eventOccurredNotify(pDriver->hid, EPS_EVENTTYPE_WARNING, 
+        ERCD_EPS_SESSION_FAILOVER, eventText);
+}
 
 /**
  * ½Ϣ
@@ -996,6 +2823,87 @@ static ResCodeT BuildHeartbeatRequest(uint64 msgSeqNum, char* data, int32* pData
     }
 }
 
+/**
+ * طϢ
+ *
+ * @param   msgSeqNum           in  - Ϣ
+ * @param   beginSeqNo          in  - طʼţΪ0ʾط
+ * @param   data                out - طϢ
+ * @param   pDataLen            in  - Ϣ
+ *                              out - Ϣ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+static ResCodeT BuildResendRequest(uint64 msgSeqNum, uint64 beginSeqNo, char* data, int32* pDataLen)
+{
+    TRY
+    {
+        StepMessageT msg;
+        memset(&msg, 0x00, sizeof(msg));
+            
+        msg.msgType   = STEP_MSGTYPE_RESEND_REQUEST;
+        msg.msgSeqNum = msgSeqNum;
+        GetSendingTime(msg.sendingTime);
+        snprintf(msg.senderCompID, sizeof(msg.senderCompID), STEP_SENDER_COMPID_VALUE);
+        snprintf(msg.targetCompID, sizeof(msg.targetCompID), STEP_TARGET_COMPID_VALUE);
+        snprintf(msg.msgEncoding, sizeof(msg.msgEncoding), STEP_MSG_ENCODING_VALUE);
+
+        ResendRequestRecordT* pRecord = (ResendRequestRecordT*)msg.body;
+        pRecord->beginSeqNo = beginSeqNo;
+        pRecord->endSeqNo = 0;
+            
+        THROW_ERROR(EncodeStepMessage(&msg, data, *pDataLen, pDataLen));
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * Ϣ(ģʽ)
+ *
+ * @param   msgSeqNum           in  - Ϣţĵһ
+ * @param   newSeqNo            in  - һϢ
+ * @param   data                out - Ϣ
+ * @param   pDataLen            in  - Ϣ
+ *                              out - Ϣ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+static ResCodeT BuildSequenceReset(uint64 msgSeqNum, uint64 newSeqNo, char* data, int32* pDataLen)
+{
+    TRY
+    {
+        StepMessageT msg;
+        memset(&msg, 0x00, sizeof(msg));
+            
+        msg.msgType     = STEP_MSGTYPE_SEQUENCE_RESET;
+        msg.msgSeqNum   = msgSeqNum;
+        msg.possDupFlag = 'Y';
+        GetSendingTime(msg.sendingTime);
+        snprintf(msg.senderCompID, sizeof(msg.senderCompID), STEP_SENDER_COMPID_VALUE);
+        snprintf(msg.targetCompID, sizeof(msg.targetCompID), STEP_TARGET_COMPID_VALUE);
+        snprintf(msg.msgEncoding, sizeof(msg.msgEncoding), STEP_MSG_ENCODING_VALUE);
+
+        SequenceResetRecordT* pRecord = (SequenceResetRecordT*)msg.body;
+        pRecord->gapFillFlag = 'Y';
+        pRecord->newSeqNo = newSeqNo;
+            
+        THROW_ERROR(EncodeStepMessage(&msg, data, *pDataLen, pDataLen));
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
 /**
  * ȡ鷢ʱ
  *
@@ -1037,27 +2945,49 @@ static ResCodeT GetSendingTime(char* szSendingTime)
 }
 
 /**
- * ַַ
+ * ַб
  *
- * @param   address                 in  - ַַ
- * @param   srvAddr                 out - 鲥ַ
- * @param   srvPort                 out - 鲥˿
+ * @param   address                 in  - ַַ','ָ'|'βΪֹ
+ * @param   servers                 out - ַб
+ * @param   pServerCount            out - ַ
  *
  * @return  ɹNO_ERR򷵻ش
  */
-static ResCodeT ParseAddress(const char* address, char* srvAddr, uint16* srvPort)
+static ResCodeT ParseAddress(const char* address, EpsTcpServerT* servers, uint32* pServerCount)
 {
     TRY
     {
-        /* ַʽΪ196.123.71.3:3333 */
-        const char* p = strstr(address, ":");
-        if (p == NULL || p == address)
+        /* ַʽΪ196.123.71.3:3333,196.123.71.4:3333 */
+        uint32 count = 0;
+        const char* begin = address;
+        while (TRUE)
         {
-            THROW_ERROR(ERCD_EPS_INVALID_ADDRESS);
+            const char* end = begin + strcspn(begin, ",|");
+            const char* p = memchr(begin, ':', end - begin);
+            if (p == NULL || p == begin || p + 1 == end)
+            {
+                THROW_ERROR(ERCD_EPS_INVALID_ADDRESS);
+            }
+
+            if (p - begin > EPS_IP_MAX_LEN || count >= EPS_TCP_SERVER_MAX_NUM)
+            {
+                THROW_ERROR(ERCD_EPS_INVALID_ADDRESS);
+            }
+
+            EpsTcpServerT* pServer = &servers[count++];
+            memcpy(pServer->srvAddr, begin, (p-begin));
+            pServer->srvAddr[p-begin] = '\0';
+            pServer->srvPort = atoi(p + 1);
+            pServer->connectTime = 0;
+
+            if (*end != ',')
+            {
+                break;
+            }
+            begin = end + 1;
         }
 
-        memcpy(srvAddr, address, (p-address));
-        *srvPort = atoi(p + 1);
+        *pServerCount = count;
     }
     CATCH
     {
@@ -1095,4 +3025,89 @@ static void OnEpsMktStatusChanged(uint32 hid, const EpsMktStatusT* pMktStatus)
 static void OnEpsEventOccurred(uint32 hid, EpsEventTypeT eventType, ResCodeT eventCode, const char* eventText)
 {
 }
+static void OnEpsMktDataGap(uint32 hid, const EpsMktGapT* pMktGap)
+{
+}
+
+/*
+ * ڲռλ
+ */
+static void OnDriverMktData(void* pListener, const StepMessageT* pMsg, uint64 recvTime)
+{
+}
+static void OnDriverStatus(void* pListener, EpsTcpStatusT status)
+{
+}
+static void OnDriverReceived(void* pListener)
+{
+}
+
+/*
+ * ȱỰȱỰִͨ߳УỰٲ
+ */
+static void OnStandbyMktData(void* pListener, const StepMessageT* pMsg, uint64 recvTime)
+{
+    EpsTcpDriverT* pDriver = (EpsTcpDriverT*)pListener;
+
+    TRY
+    {
+        LockRecMutex(&pDriver->lock);
+
+        if (pDriver->standbyGen != pDriver->standbyDrivenGen)
+        {
+            DriveStandby(pDriver);
+        }
+
+        THROW_ERROR(DeliverMarketData(pDriver, pMsg, recvTime, EPS_TCP_SESSION_STANDBY));
+
+        CheckFailover(pDriver, FALSE);
+    }
+    CATCH
+    {
+        pDriver->spi.eventOccurredNotify(pDriver->hid, EPS_EVENTTYPE_ERROR, 
+            GET_RESCODE(), ErrGetErrorDscr());
+        ErrClearError();
+    }
+    FINALLY
+    {
+        UnlockRecMutex(&pDriver->lock);
+    }
+}
+static void OnStandbyStatus(void* pListener, EpsTcpStatusT status)
+{
+    EpsTcpDriverT* pDriver = (EpsTcpDriverT*)pListener;
+
+    LockRecMutex(&pDriver->lock);
+
+    if (status == EPS_TCP_STATUS_DISCONNECTED || status == EPS_TCP_STATUS_LOGOUT)
+    {
+        if (pDriver->isFailedOver)
+        {
+            /* Ựж */
+            pDriver->isFailedOver = FALSE;
+            pDriver->isLoginIssued = FALSE;
+            pDriver->restoreRsps = 0;
+            UnsubscribeAllMktData(&pDriver->database);
+
+            pDriver->spi.disconnectedNotify(pDriver->hid, ERCD_EPS_SOCKET_ERROR, 
+                "primary and standby sessions lost");
+        }
+    }
+
+    if (status != EPS_TCP_STATUS_DISCONNECTED)
+    {
+        DriveStandby(pDriver);
+    }
+
+    UnlockRecMutex(&pDriver->lock);
+}
+static void OnStandbyReceived(void* pListener)
+{
+    EpsTcpDriverT* pDriver = (EpsTcpDriverT*)pListener;
+
+    /* ȱỰͶݵմʱͶ */
+    LockRecMutex(&pDriver->lock);
+    FlushMktBatch(&pDriver->batch, pDriver->hid, pDriver->spi.mktDataBatchArrivedNotify);
+    UnlockRecMutex(&pDriver->lock);
+}
 
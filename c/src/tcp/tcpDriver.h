@@ -33,8 +33,12 @@ DD-MMM-YYYY INIT.    SIR    Modification Description
 
 #include "recMutex.h"
 #include "mktDatabase.h"
+#include "mktBatch.h"
+#include "dispatcher.h"
+#include "subscriber.h"
 #include "epsData.h"
 #include "tcpChannel.h"
+#include "shmBus.h"
 
 
 #ifdef __cplusplus
@@ -42,6 +46,18 @@ extern "C" {
 #endif
 
 
+/**
+ * 궨
+ */
+
+#define EPS_TCP_RESEND_TIMEOUT      (5*1000)    /* ط޽չٴʱ䣬λ:  */
+#define EPS_TCP_FAILOVER_TIMEOUT    (1*1000)    /* ỰȱỰﵽʱ伴лλ:  */
+
+#define EPS_TCP_SESSION_NUM         2           /* Ự(ỰȱỰ) */
+#define EPS_TCP_SESSION_PRIMARY     0           /* Ự */
+#define EPS_TCP_SESSION_STANDBY     1           /* ȱỰ */
+
+
 /**
  * Ͷ
  */
@@ -60,6 +76,31 @@ typedef enum EpsTcpStatusTag
     EPS_TCP_STATUS_LOGOUT           = 6,    /* ѵǳ */
 } EpsTcpStatusT;
 
+/*
+ * TCPڲ߽ӿڣģ(UDPָỰ)ṩԭʼϢ
+ */
+typedef void (*EpsTcpDriverMktDataCallback)(void* pListener, const StepMessageT* pMsg, uint64 recvTime);
+typedef void (*EpsTcpDriverStatusCallback)(void* pListener, EpsTcpStatusT status);
+typedef void (*EpsTcpDriverReceivedCallback)(void* pListener);
+
+typedef struct EpsTcpDriverListenerTag
+{
+    void*                           pListener;      /* ߶ */
+    EpsTcpDriverMktDataCallback     mktDataNotify;  /* ֪ͨ(ݿǰԭʼϢ) */
+    EpsTcpDriverStatusCallback      statusNotify;   /* ӡ½ġǳϿ״̬֪ͨ */
+    EpsTcpDriverReceivedCallback    receivedNotify; /* һνݴ֪ͨ */
+} EpsTcpDriverListenerT;
+
+/*
+ * Ựٲ״̬(Ự)
+ */
+typedef struct EpsTcpSessionArbTag
+{
+    uint64          lastRecvTime;           /* Ựյʱ() */
+    uint64          firstWinTime;           /* ԷỰյ󱾻Ự״Ͷݵʱ() */
+    EpsLineStatT    stat;                   /* Ựͳ */
+} EpsTcpSessionArbT;
+
 /*
  * TCPṹ
  */
@@ -70,12 +111,38 @@ typedef struct EpsTcpDriverTag
     EpsTcpChannelT  channel;                /* ͨ */
     EpsMktDatabaseT database;               /* ݿ */
     EpsClientSpiT   spi;                    /* ûصӿ */
+    EpsMktBatchT    batch;                  /* 黺ỰỰĻ */
+    EpsDispatcherT  dispatcher;             /* ַỰỰķַ */
+    EpsSecFilterT   filter;                 /* ֤ȯĹỰỰĹ */
+    EpsSubscriberHubT subscribers;          /* ڵĶ߼ϣỰỰĶ߼ */
+    EpsTcpDriverListenerT listener;         /* ڲ߽ӿ */
     
     EpsTcpStatusT   status;                 /* ״̬ */
     uint64          msgSeqNum;              /* Ϣ */
+    uint64          inMsgSeqNum;            /* յһϢ */
+    BOOL            isResending;            /* ѷط󡢵ȴط */
+    uint64          resendTime;             /* һηطʱ() */
+    uint64          sessionGapCount;        /* ⵽ĻỰϢȱ */
+    uint64          resendRequests;         /* ط */
+
+    struct EpsTcpDriverTag* pStandby;       /* ȱỰӵַ÷ʱ */
+    BOOL            isLoginIssued;          /* ûѷ½ǣȱỰлỰݴԶ½ */
+    BOOL            isFailedOver;           /* ỰʧЧлȱỰ */
+    uint32          restoreRsps;            /* ỰָδӦ */
+    uint32          standbyGen;             /* û½/ǳ/Ĳ */
+    uint32          standbyDrivenGen;       /* ȱỰѸ浽Ĳ */
+    BOOL            isProfileSet;           /* ûỰñǣӳɹԶ½ */
+    EpsSessionProfileT profile;             /* Ự */
+    uint32          failoverTimeout;        /* лʱ() */
+    uint64          failoverCount;          /* л */
+    uint64          failoverLatency;        /* һлӳ() */
+    BOOL            isLatencyPending;       /* лӳٴȱỰͶݺ */
+    EpsTcpSessionArbT sessionArbs[EPS_TCP_SESSION_NUM]; /* Ựٲ״̬ */
     char            recvBuffer[EPS_SOCKET_RECVBUFFER_LEN*2];/* ջ */
     uint32          recvBufferLen;          /* ջ */
-    EpsRecMutexT    lock;                   /*  */
+    EpsRecMutexT    lock;                   /* : ӹỰٲãỰ鴦 */
+    int             pollFd;                 /* Ӧ߳ģʽµȴỰ׽ֵepoll-1ʾͨ߳ */
+    EpsShmBusT*     pShmBus;                /* ڴ߷ˣʱ䲢ԭӷỰʹ */
     
     char   username[EPS_USERNAME_MAX_LEN+1]; /* û˺ */
     char   password[EPS_PASSWORD_MAX_LEN+1]; /* û */
@@ -104,6 +171,11 @@ ResCodeT UninitTcpDriver(EpsTcpDriverT* pDriver);
  */
 ResCodeT RegisterTcpDriverSpi(EpsTcpDriverT* pDriver, const EpsClientSpiT* pSpi);
 
+/*
+ *  עTCPڲ߽ӿ
+ */
+ResCodeT RegisterTcpDriverListener(EpsTcpDriverT* pDriver, const EpsTcpDriverListenerT* pListener);
+
 /*
  *  TCP
  */
@@ -130,6 +202,71 @@ ResCodeT LogoutTcpDriver(EpsTcpDriverT* pDriver, const char* reason);
  */
 ResCodeT SubscribeTcpDriver(EpsTcpDriverT* pDriver, EpsMktTypeT mktType);
 
+/*
+ *  ȡTCPͳϢ
+ */
+ResCodeT GetTcpDriverStatistics(EpsTcpDriverT* pDriver, EpsStatisticsT* pStat);
+
+/*
+ *  ȡTCPỰͳϢ
+ */
+ResCodeT GetTcpDriverLineStatistics(EpsTcpDriverT* pDriver, EpsLineStatT* pStats, uint32* pCount);
+
+/*
+ *  TCPѡ
+ */
+ResCodeT SetTcpDriverOption(EpsTcpDriverT* pDriver, EpsOptionT option, int32 value);
+
+/*
+ *  TCPỰ
+ */
+ResCodeT SetTcpDriverSessionProfile(EpsTcpDriverT* pDriver, const EpsSessionProfileT* pProfile);
+
+/*
+ *  Ӧ߳TCPշ
+ */
+ResCodeT PollTcpDriver(EpsTcpDriverT* pDriver, uint64 timeout, uint32 maxEvents);
+
+/*
+ *  ȡTCPӦ̵߳ȴ
+ */
+ResCodeT GetTcpDriverFd(EpsTcpDriverT* pDriver, int* pFd);
+
+/*
+ *  TCPû
+ */
+ResCodeT SetTcpDriverMdDataParser(EpsTcpDriverT* pDriver, EpsMdDataParseCallback parser);
+
+/*
+ *  TCPĶ֤ȯ
+ */
+ResCodeT SubscribeTcpDriverSecurities(EpsTcpDriverT* pDriver, const char* securityIDs[], uint32 count);
+
+/*
+ *  TCPĶ
+ */
+ResCodeT AddTcpDriverSubscriber(EpsTcpDriverT* pDriver, const EpsSubscriberConfigT* pConfig, uint32* pSid);
+
+/*
+ *  ɾTCPĶ
+ */
+ResCodeT RemoveTcpDriverSubscriber(EpsTcpDriverT* pDriver, uint32 sid);
+
+/*
+ *  Ӧ߳ͶTCPߵ
+ */
+ResCodeT PollTcpDriverSubscriber(EpsTcpDriverT* pDriver, uint32 sid, uint32 maxCount, uint32* pCount);
+
+/*
+ *  ȡTCPߵͳϢ
+ */
+ResCodeT GetTcpDriverSubscriberStatistics(EpsTcpDriverT* pDriver, uint32 sid, EpsSubscriberStatT* pStat);
+
+/*
+ *  TCPĹڴ߷
+ */
+ResCodeT SetTcpDriverShmPublisher(EpsTcpDriverT* pDriver, const char* name, uint32 slotCount);
+
 
 #ifdef __cplusplus
 }
@@ -45,6 +45,7 @@ static char g_address[EPS_IP_MAX_LEN*2+1];
 static char g_username[EPS_USERNAME_MAX_LEN+1];
 static char g_password[EPS_PASSWORD_MAX_LEN+1];
 static int g_reqMarket;
+static int g_useProfile;
 
 /**
  * ʵ
@@ -52,16 +53,24 @@ static int g_reqMarket;
 
 static void Usage()
 {
-    printf("Usage: epsComplex <address> <username> <password> <requestMarket>\n\n" \
+    printf("Usage: epsComplex <address> <username> <password> <requestMarket> [useProfile] [shmName]\n\n" \
            "example:\n" \
            "epsComplex \"230.11.1.1:3300;196.123.71.3\" username password 0\n" \
-           "epsComplex \"196.123.71.3:3473 username password 1\"\n");
+           "epsComplex \"196.123.71.3:3473 username password 1\"\n" \
+           "epsComplex \"196.123.71.3:3473 username password 1 1\"\n" \
+           "epsComplex \"196.123.71.3:3473 username password 1 0 /eps_md\"\n" \
+           "epsComplex \"/eps_md username password 1\"\n");
 }
 
 static void OnEpsConnectedTest(uint32 hid)
 {
     printf("==> OnConnected(), hid: %d\n", hid);
 
+    if (g_useProfile)
+    {
+        return;
+    }
+
     printf("==> call EpsLogin() ... ");
     ResCodeT rc = EpsLogin(hid, g_username, g_password, 10);
     if (OK(rc))
@@ -83,7 +92,7 @@ static void OnEpsLoginRspTest(uint32 hid, uint16 heartbeatIntl, ResCodeT result,
 {
     printf("==> OnEpsLoginRsp %s, hid: %d, reason: %s\n", OK(result) ? "OK" : "failed", hid, reason);
 
-    if (OK(result))
+    if (OK(result) && ! g_useProfile)
     {
         printf("==> call EpsSubscribeMarketData() ... ");
   
@@ -113,13 +122,28 @@ static void OnEpsMktDataSubRspTest(uint32 hid, EpsMktTypeT mktType, ResCodeT res
 static void OnEpsMktDataArrivedTest(uint32 hid, const EpsMktDataT* pMktData)
 {
 #if defined (__LINUX__) || defined (__HPUX__)
-    printf("==> OnMktDataArrived(), hid: %d, mktType: %d, updateType: %.3s, applID: %d, applSeqNum: %lld\n", 
-        hid, pMktData->mktType, pMktData->mdUpdateType, pMktData->applID, pMktData->applSeqNum);
+    printf("==> OnMktDataArrived(), hid: %d, mktType: %d, updateType: %.3s, applID: %d, applSeqNum: %lld, latency(ns): %lld\n", 
+        hid, pMktData->mktType, pMktData->mdUpdateType, pMktData->applID, pMktData->applSeqNum,
+        pMktData->notifyTime - pMktData->recvTime);
+#endif
+
+#if defined (__WINDOWS__)
+    printf("==> OnMktDataArrived(), hid: %d, mktType: %d, updateType: %.3s, applID: %d, applSeqNum: %I64d, latency(ns): %I64d\n", 
+        hid, pMktData->mktType, pMktData->mdUpdateType, pMktData->applID, pMktData->applSeqNum,
+        pMktData->notifyTime - pMktData->recvTime);
+#endif
+}
+
+static void OnEpsMktDataGapTest(uint32 hid, const EpsMktGapT* pMktGap)
+{
+#if defined (__LINUX__) || defined (__HPUX__)
+    printf("==> OnMktDataGap(), hid: %d, mktType: %d, applID: %d, beginSeqNum: %lld, endSeqNum: %lld\n", 
+        hid, pMktGap->mktType, pMktGap->applID, pMktGap->beginSeqNum, pMktGap->endSeqNum);
 #endif
 
 #if defined (__WINDOWS__)
-    printf("==> OnMktDataArrived(), hid: %d, mktType: %d, updateType: %.3s, applID: %d, applSeqNum: %I64d\n", 
-        hid, pMktData->mktType, pMktData->mdUpdateType, pMktData->applID, pMktData->applSeqNum);
+    printf("==> OnMktDataGap(), hid: %d, mktType: %d, applID: %d, beginSeqNum: %I64d, endSeqNum: %I64d\n", 
+        hid, pMktGap->mktType, pMktGap->applID, pMktGap->beginSeqNum, pMktGap->endSeqNum);
 #endif
 }
 
@@ -160,6 +184,7 @@ int main(int argc, char *argv[])
         snprintf(g_username, sizeof(g_username), argv[2]);
         snprintf(g_password, sizeof(g_password), argv[3]);
         g_reqMarket = atoi(argv[4]);
+        g_useProfile = (argc > 5) ? atoi(argv[5]) : 0;
         
         printf("\n>>> epsClientTest starting ... \n");
 
@@ -180,7 +205,9 @@ int main(int argc, char *argv[])
         uint32 hid;
 
         char* p1 = strstr(g_address, ";");
-        rc = EpsCreateHandle(&hid, (p1==NULL) ? EPS_CONNMODE_TCP : EPS_CONNMODE_UDP);
+        EpsConnModeT mode = (g_address[0] == '/') ? EPS_CONNMODE_SHM : 
+                ((p1==NULL) ? EPS_CONNMODE_TCP : EPS_CONNMODE_UDP);
+        rc = EpsCreateHandle(&hid, mode);
         if (OK(rc))
         {
             printf("OK. hid: %d\n", hid);
@@ -202,6 +229,7 @@ int main(int argc, char *argv[])
             OnEpsMktDataArrivedTest,
             OnEpsMktStatusChangedTest,
             OnEpsEventOccurredTest,
+            OnEpsMktDataGapTest,
         };
  
         rc = EpsRegisterSpi(hid, &spi);
@@ -215,6 +243,44 @@ int main(int argc, char *argv[])
             THROW_RESCODE(rc);
         }
 
+        if (g_useProfile)
+        {
+            printf("==> call EpsSetSessionProfile() ... ");
+            EpsSessionProfileT profile;
+            memset(&profile, 0x00, sizeof(profile));
+            snprintf(profile.username, sizeof(profile.username), "%s", g_username);
+            snprintf(profile.password, sizeof(profile.password), "%s", g_password);
+            profile.heartbeatIntl = 10;
+            profile.mktTypeCount = 1;
+            profile.mktTypes[0] = (EpsMktTypeT)g_reqMarket;
+
+            rc = EpsSetSessionProfile(hid, &profile);
+            if (OK(rc))
+            {
+                printf("OK. hid: %d\n", hid);
+            }
+            else
+            {
+                printf("failed, Error: %s!!!\n", EpsGetLastError());
+                THROW_RESCODE(rc);
+            }
+        }
+
+        if (argc > 6)
+        {
+            printf("==> call EpsSetShmPublisher() ... ");
+            rc = EpsSetShmPublisher(hid, argv[6], 0);
+            if (OK(rc))
+            {
+                printf("OK. hid: %d\n", hid);
+            }
+            else
+            {
+                printf("failed, Error: %s!!!\n", EpsGetLastError());
+                THROW_RESCODE(rc);
+            }
+        }
+
         printf("==> call EpsConnect() ... ");
         rc = EpsConnect(hid, argv[1]);
         if (OK(rc))
@@ -237,6 +303,61 @@ int main(int argc, char *argv[])
             }
         }
 
+        printf("==> call EpsGetStatistics() ... ");
+        EpsStatisticsT stat;
+        rc = EpsGetStatistics(hid, &stat);
+        if (OK(rc))
+        {
+#if defined (__LINUX__) || defined (__HPUX__)
+            printf("OK. recvPackets: %lld, gapCount: %lld, gapSeqNums: %lld\n", 
+                stat.recvPackets, stat.gapCount, stat.gapSeqNums);
+            printf("    sessionGapCount: %lld, resendRequests: %lld, failoverCount: %lld, failoverLatency: %lld\n", 
+                stat.sessionGapCount, stat.resendRequests, stat.failoverCount, stat.failoverLatency);
+            printf("    shmPublished: %lld, shmOverruns: %lld\n", 
+                stat.shmPublished, stat.shmOverruns);
+#endif
+
+#if defined (__WINDOWS__)
+            printf("OK. recvPackets: %I64d, gapCount: %I64d, gapSeqNums: %I64d\n", 
+                stat.recvPackets, stat.gapCount, stat.gapSeqNums);
+            printf("    sessionGapCount: %I64d, resendRequests: %I64d, failoverCount: %I64d, failoverLatency: %I64d\n", 
+                stat.sessionGapCount, stat.resendRequests, stat.failoverCount, stat.failoverLatency);
+            printf("    shmPublished: %I64d, shmOverruns: %I64d\n", 
+                stat.shmPublished, stat.shmOverruns);
+#endif
+        }
+        else
+        {
+            printf("failed, Error: %s!!!\n", EpsGetLastError());
+        }
+
+        printf("==> call EpsGetLineStatistics() ... ");
+        EpsLineStatT lineStats[EPS_LINE_MAX_NUM];
+        uint32 lineCount = EPS_LINE_MAX_NUM;
+        rc = EpsGetLineStatistics(hid, lineStats, &lineCount);
+        if (OK(rc))
+        {
+            printf("OK. lineCount: %u\n", lineCount);
+            uint32 i = 0;
+            for (i = 0; i < lineCount && lineCount > 1; i++)
+            {
+                EpsLineStatT* pLineStat = &lineStats[i];
+#if defined (__LINUX__) || defined (__HPUX__)
+                printf("    line %u: recvPackets: %lld, winPackets: %lld, dupPackets: %lld\n", i,
+                    pLineStat->recvPackets, pLineStat->winPackets, pLineStat->dupPackets);
+#endif
+
+#if defined (__WINDOWS__)
+                printf("    line %u: recvPackets: %I64d, winPackets: %I64d, dupPackets: %I64d\n", i,
+                    pLineStat->recvPackets, pLineStat->winPackets, pLineStat->dupPackets);
+#endif
+            }
+        }
+        else
+        {
+            printf("failed, Error: %s!!!\n", EpsGetLastError());
+        }
+
         printf("==> call EpsDisconnect() ... ");
         rc = EpsDisconnect(hid);
         if (OK(rc))
@@ -0,0 +1,461 @@
+/*
+ * Copyright (C) 2013, 2014 Shanghai Stock Exchange (SSE), Shanghai, China
+ * All Rights Reserved.
+ */
+
+/**
+ * @file    dispatchBench.c
+ *
+ * ֤ȯֵַܲԳ
+ *
+ * Ժϳɵȫгջط(ÿպֻ֤ȯĿ)ַ
+ * ֱ1248ַ̲߳£Уͬһ֤ȯ鰴Ͷݣ
+ * ϲʱͬһ֤ȯֻҪŵϲconflated
+ * ʱصأͬһ֤ȯֻҪŵУ
+ * Ͷݵδ̵ͨ߳ĸдƻ(ͷĿͬһ)
+ *
+ * @version $Id
+ * @since   2026/10/18
+ */
+
+/**
+MODIFICATION HISTORY:
+<pre>
+================================================================================
+DD-MMM-YYYY INIT.    SIR    Modification Description
+----------- -------- ------ ----------------------------------------------------
+18-OCT-2026                 
+================================================================================
+</pre>
+*/
+
+/**
+ * ͷļ
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common.h"
+#include "errlib.h"
+#include "atomic.h"
+#include "dispatcher.h"
+
+#include "epsClient.h"
+
+
+/**
+ * 궨
+ */
+
+#define BENCH_SECURITY_NUM_DEFAULT  2000    /* Ĭ֤ȯ */
+#define BENCH_ROUND_NUM_DEFAULT     50      /* Ĭȫгط */
+#define BENCH_WORK_UNITS_DEFAULT    2000    /* ĬÿĿļ */
+#define BENCH_ENTRIES_PER_SNAPSHOT  8       /* ÿյĿ */
+#define BENCH_ENTRY_LEN             48      /* ÿĿ(';') */
+
+
+/**
+ * ȫֱ
+ */
+
+static uint32   g_securityNum = BENCH_SECURITY_NUM_DEFAULT;
+static uint32   g_workUnits = BENCH_WORK_UNITS_DEFAULT;
+static int32    g_policy = EPS_DISPATCH_POLICY_BLOCK;
+static uint32   g_subscribeStep = 0;        /* ÿֻ֤ȯһֻ0ʾ */
+static uint32*  g_lastSeq = NULL;           /* ֤ȯͶݵţɸ֤ȯڵķ̷ַ߳ */
+static uint64   g_deliveredCount = 0;       /* ͶݵĿ */
+static uint64   g_outOfOrderCount = 0;      /* Ŀ */
+static uint64   g_corruptedCount = 0;       /* ݲһµĿ */
+static volatile uint32 g_checksum = 0;      /* ֹ㱻Ż */
+
+
+/**
+ * ʵ
+ */
+
+static void Usage()
+{
+    printf("Usage: epsDispatchBench [securities] [rounds] [workUnits] [policy] [subscribeStep]\n\n" \
+           "securities: number of securities in the synthetic market, default 2000\n" \
+           "rounds: full-market replays per run, default 50\n" \
+           "workUnits: callback cpu work per security record, default 2000\n" \
+           "policy: 0-block(default) 1-drop oldest 2-conflate per security\n" \
+           "subscribeStep: subscribe one of every N securities, default 0 (no filter)\n");
+}
+
+/*
+ * : ϳĿʽΪ"֤ȯ,,;"
+ */
+static uint32 ParseBenchMdData(uint32 hid, const EpsMktDataT* pMktData, EpsMdEntryT* pEntries, uint32 maxCount)
+{
+    uint32 count = 0;
+    uint32 offset = 0;
+
+    while (offset < pMktData->mdDataLen && count < maxCount)
+    {
+        const char* pRecord = pMktData->mdData + offset;
+        const char* pEnd = memchr(pRecord, ';', pMktData->mdDataLen - offset);
+        if (pEnd == NULL)
+        {
+            break;
+        }
+
+        EpsMdEntryT* pEntry = &pEntries[count];
+        uint32 idLen = 0;
+        while (idLen < EPS_SECURITYID_MAX_LEN && pRecord + idLen < pEnd && pRecord[idLen] != ',')
+        {
+            pEntry->securityID[idLen] = pRecord[idLen];
+            idLen++;
+        }
+        pEntry->securityID[idLen] = 0x00;
+        pEntry->offset = offset;
+        pEntry->length = (uint32)(pEnd - pRecord) + 1;
+
+        offset += pEntry->length;
+        count++;
+    }
+
+    return count;
+}
+
+/*
+ * УĿͷķͬһ
+ */
+static BOOL IsBenchMktDataIntact(const EpsMktDataT* pMktData, uint32 index, uint32 seq)
+{
+    if (index >= g_securityNum || seq == 0)
+    {
+        return FALSE;
+    }
+
+    uint32 snapshotNum = (g_securityNum + BENCH_ENTRIES_PER_SNAPSHOT - 1) / BENCH_ENTRIES_PER_SNAPSHOT;
+    uint64 applSeqNum = (uint64)(seq - 1) * snapshotNum + index / BENCH_ENTRIES_PER_SNAPSHOT + 1;
+    if (pMktData->mdDataLen != BENCH_ENTRY_LEN || pMktData->applSeqNum != applSeqNum)
+    {
+        return FALSE;
+    }
+
+    uint32 i = 0;
+    for (i = 16; i < BENCH_ENTRY_LEN - 1; i++)
+    {
+        if (pMktData->mdData[i] != 'x')
+        {
+            return FALSE;
+        }
+    }
+    return (pMktData->mdData[BENCH_ENTRY_LEN - 1] == ';');
+}
+
+/*
+ * ص: Уͬһ֤ȯ(ϲµ)ִģ
+ */
+static void OnBenchMktDataArrived(uint32 hid, const EpsMktDataT* pMktData)
+{
+    uint32 index = (uint32)atoi(pMktData->mdData) - 600000;
+    const char* pSeq = strchr(pMktData->mdData, ',');
+    uint32 seq = (pSeq != NULL) ? (uint32)atoi(pSeq + 1) : 0;
+
+    BOOL isInOrder = FALSE;
+    if (pMktData->mdCount == 1 && index < g_securityNum && seq > 0 &&
+        (g_subscribeStep == 0 || index % g_subscribeStep == 0))
+    {
+        isInOrder = (g_policy != EPS_DISPATCH_POLICY_BLOCK) ?
+            (seq > g_lastSeq[index]) : (seq == g_lastSeq[index] + 1);
+        g_lastSeq[index] = seq;
+    }
+    if (! IsBenchMktDataIntact(pMktData, index, seq))
+    {
+        EpsAtomicCounterAdd(&g_corruptedCount, 1);
+    }
+    if (! isInOrder)
+    {
+        EpsAtomicCounterAdd(&g_outOfOrderCount, 1);
+    }
+
+    uint32 hash = seq;
+    uint32 i = 0;
+    for (i = 0; i < g_workUnits; i++)
+    {
+        hash = (hash ^ (uint32)pMktData->mdData[i % pMktData->mdDataLen]) * 16777619U;
+    }
+    g_checksum += hash & 0x01;
+
+    EpsAtomicCounterAdd(&g_deliveredCount, 1);
+}
+
+/*
+ * һϳɿգΰfirstIndex֤ȯ
+ */
+static uint32 BuildSnapshot(StepMessageT* pMsg, uint64 applSeqNum, uint32 firstIndex, uint32 seq)
+{
+    MDSnapshotFullRefreshRecordT* pRecord = (MDSnapshotFullRefreshRecordT*)pMsg->body;
+
+    pMsg->msgType = STEP_MSGTYPE_MD_SNAPSHOT;
+    memcpy(pRecord->securityType, "01", STEP_SECURITY_TYPE_LEN+1);
+    pRecord->tradSesMode = 2;
+    pRecord->applID = 1;
+    pRecord->applSeqNum = applSeqNum;
+    memcpy(pRecord->tradeDate, "20261018", STEP_DATE_LEN+1);
+    memcpy(pRecord->lastUpdateTime, "09300000", STEP_TIME_LEN+1);
+    memcpy(pRecord->mdUpdateType, "0", 2);
+
+    uint32 count = 0;
+    uint32 len = 0;
+    while (count < BENCH_ENTRIES_PER_SNAPSHOT && firstIndex + count < g_securityNum)
+    {
+        char* pEntry = pRecord->mdData + len;
+        int n = sprintf(pEntry, "%06u,%08u,", 600000 + firstIndex + count, seq);
+        memset(pEntry + n, 'x', BENCH_ENTRY_LEN - 1 - n);
+        pEntry[BENCH_ENTRY_LEN - 1] = ';';
+
+        len += BENCH_ENTRY_LEN;
+        count++;
+    }
+    pRecord->mdData[len] = 0x00;
+    pRecord->mdCount = count;
+    pRecord->mdDataLen = len;
+
+    return count;
+}
+
+/*
+ * ļùĶ֤ȯضĵ֤ȯ
+ */
+static ResCodeT SubscribeBench(EpsSecFilterT* pFilter, uint32* pSubscribed)
+{
+    char (*ids)[EPS_SECURITYID_MAX_LEN+1] = NULL;
+    const char** pIds = NULL;
+
+    TRY
+    {
+        uint32 count = 0;
+        uint32 step = (g_subscribeStep == 0) ? 1 : g_subscribeStep;
+
+        if (g_subscribeStep > 0)
+        {
+            ids = calloc(g_securityNum, EPS_SECURITYID_MAX_LEN+1);
+            pIds = (const char**)calloc(g_securityNum, sizeof(const char*));
+            if (ids == NULL || pIds == NULL)
+            {
+                THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, "calloc");
+            }
+        }
+
+        uint32 index = 0;
+        for (index = 0; index < g_securityNum; index += step)
+        {
+            if (ids != NULL)
+            {
+                sprintf(ids[count], "%06u", 600000 + index);
+                pIds[count] = ids[count];
+            }
+            count++;
+        }
+
+        if (g_subscribeStep > 0)
+        {
+            THROW_ERROR(SetSecFilterSecurities(pFilter, pIds, count));
+            ApplySecFilter(pFilter);
+        }
+        *pSubscribed = count;
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        free(ids);
+        free(pIds);
+        RETURN_RESCODE;
+    }
+}
+
+/*
+ * ַָ߳طȫг飬غʱ()
+ */
+static ResCodeT RunBench(uint32 workerCount, uint32 roundNum, uint64* pElapsed, uint64* pEntries,
+        uint64* pConflated, uint64* pDropped)
+{
+    EpsDispatcherT* pDispatcher = NULL;
+    EpsSecFilterT* pFilter = NULL;
+    StepMessageT* pMsg = NULL;
+
+    TRY
+    {
+        EpsClientSpiT spi;
+        memset(&spi, 0x00, sizeof(spi));
+        spi.mktDataArrivedNotify = OnBenchMktDataArrived;
+
+        EpsMktBatchT batch;
+        THROW_ERROR(InitMktBatch(&batch));
+
+        pDispatcher = (EpsDispatcherT*)calloc(1, sizeof(EpsDispatcherT));
+        pFilter = (EpsSecFilterT*)calloc(1, sizeof(EpsSecFilterT));
+        pMsg = (StepMessageT*)calloc(1, sizeof(StepMessageT));
+        if (pDispatcher == NULL || pFilter == NULL || pMsg == NULL)
+        {
+            THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, "calloc");
+        }
+
+        memset(g_lastSeq, 0x00, sizeof(uint32) * g_securityNum);
+        g_deliveredCount = 0;
+        g_outOfOrderCount = 0;
+        g_corruptedCount = 0;
+
+        uint32 subscribed = 0;
+        THROW_ERROR(InitSecFilter(pFilter));
+        SetSecFilterParser(pFilter, ParseBenchMdData);
+        THROW_ERROR(SubscribeBench(pFilter, &subscribed));
+
+        THROW_ERROR(InitDispatcher(pDispatcher, &spi, &batch, pFilter));
+        THROW_ERROR(SetDispatcherOption(pDispatcher, EPS_OPTION_DISPATCH_THREADS, (int32)workerCount));
+        THROW_ERROR(SetDispatcherOption(pDispatcher, EPS_OPTION_DISPATCH_MODE, EPS_DISPATCH_MODE_SECURITY));
+        THROW_ERROR(SetDispatcherOption(pDispatcher, EPS_OPTION_DISPATCH_POLICY, g_policy));
+        THROW_ERROR(StartupDispatcher(pDispatcher, 1));
+
+        uint64 entries = 0;
+        uint64 applSeqNum = 0;
+        uint64 beginTime = EpsGetTimestamp();
+
+        uint32 round = 0;
+        for (round = 1; round <= roundNum; round++)
+        {
+            uint32 index = 0;
+            for (index = 0; index < g_securityNum; index += BENCH_ENTRIES_PER_SNAPSHOT)
+            {
+                entries += BuildSnapshot(pMsg, ++applSeqNum, index, round);
+                THROW_ERROR(PushDispatcher(pDispatcher, pMsg, EpsGetTimestamp()));
+            }
+        }
+
+        EpsStatisticsT stat;
+        GetDispatcherStatistics(pDispatcher, &stat);
+        while (EpsAtomicLoad(&g_deliveredCount) + stat.dispatchConflated + stat.dispatchDropped <
+                (uint64)subscribed * roundNum)
+        {
+#if defined(__WINDOWS__)
+            Sleep(1);
+#else
+            usleep(1000);
+#endif
+            GetDispatcherStatistics(pDispatcher, &stat);
+        }
+        *pElapsed = EpsGetTimestamp() - beginTime;
+        *pEntries = entries;
+        *pConflated = stat.dispatchConflated;
+        *pDropped = stat.dispatchDropped;
+
+        THROW_ERROR(ShutdownDispatcher(pDispatcher));
+        THROW_ERROR(JoinDispatcher(pDispatcher));
+        THROW_ERROR(UninitDispatcher(pDispatcher));
+        THROW_ERROR(UninitSecFilter(pFilter));
+        THROW_ERROR(UninitMktBatch(&batch));
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        free(pDispatcher);
+        free(pFilter);
+        free(pMsg);
+        RETURN_RESCODE;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    TRY
+    {
+        ResCodeT rc = NO_ERR;
+        uint32 roundNum = BENCH_ROUND_NUM_DEFAULT;
+
+        setvbuf(stdout, NULL, _IONBF, 0); /* ñ׼Ϊлģʽ */
+
+        if (argc > 1 && (strcmp(argv[1], "-h") == 0 || strcmp(argv[1], "--help") == 0))
+        {
+            Usage();
+            exit(0);
+        }
+        if (argc > 1)
+        {
+            g_securityNum = (uint32)atoi(argv[1]);
+        }
+        if (argc > 2)
+        {
+            roundNum = (uint32)atoi(argv[2]);
+        }
+        if (argc > 3)
+        {
+            g_workUnits = (uint32)atoi(argv[3]);
+        }
+        if (argc > 4)
+        {
+            g_policy = atoi(argv[4]);
+        }
+        if (argc > 5)
+        {
+            g_subscribeStep = (uint32)atoi(argv[5]);
+        }
+        if (g_securityNum == 0 || g_securityNum > 400000 || roundNum == 0 ||
+            g_policy < EPS_DISPATCH_POLICY_BLOCK || g_policy > EPS_DISPATCH_POLICY_CONFLATE)
+        {
+            Usage();
+            exit(0);
+        }
+
+        rc = EpsInitLib();
+        if (NOTOK(rc))
+        {
+            printf("EpsInitLib() failed, Error: %s!!!\n", EpsGetLastError());
+            THROW_RESCODE(rc);
+        }
+
+        g_lastSeq = (uint32*)calloc(g_securityNum, sizeof(uint32));
+
+        printf("securities: %u, rounds: %u, entries per snapshot: %u, work units: %u, policy: %d, "
+            "subscribe step: %u\n\n", g_securityNum, roundNum, BENCH_ENTRIES_PER_SNAPSHOT, g_workUnits,
+            g_policy, g_subscribeStep);
+        printf("%8s %12s %12s %14s %10s %12s %12s %12s %12s\n", "workers", "entries", "elapsed(ms)",
+            "entries/s", "speedup", "outOfOrder", "conflated", "dropped", "corrupted");
+
+        double baseRate = 0;
+        uint32 workerCount = 0;
+        for (workerCount = 1; workerCount <= EPS_DISPATCHER_WORKER_MAX_NUM; workerCount *= 2)
+        {
+            uint64 elapsed = 0;
+            uint64 entries = 0;
+            uint64 conflated = 0;
+            uint64 dropped = 0;
+
+            rc = RunBench(workerCount, roundNum, &elapsed, &entries, &conflated, &dropped);
+            if (NOTOK(rc))
+            {
+                printf("RunBench() failed, Error: %s!!!\n", EpsGetLastError());
+                THROW_RESCODE(rc);
+            }
+
+            double rate = (double)entries * 1000000000.0 / (double)(elapsed ? elapsed : 1);
+            if (workerCount == 1)
+            {
+                baseRate = rate;
+            }
+            printf("%8u %12llu %12.1f %14.0f %9.2fx %12llu %12llu %12llu %12llu\n", workerCount,
+                (unsigned long long)entries, (double)elapsed / 1000000.0, rate,
+                rate / baseRate, (unsigned long long)g_outOfOrderCount, (unsigned long long)conflated,
+                (unsigned long long)dropped, (unsigned long long)g_corruptedCount);
+        }
+
+        free(g_lastSeq);
+        EpsUninitLib();
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
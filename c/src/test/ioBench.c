@@ -0,0 +1,592 @@
+/*
+ * Copyright (C) 2013, 2014 Shanghai Stock Exchange (SSE), Shanghai, China
+ * All Rights Reserved.
+ */
+
+/**
+ * @file    ioBench.c
+ *
+ * ͨI/OܲԳ(֧Linux/Unix)
+ *
+ * TCPģʽ½ؿշĺͺϳɿգUDPģʽ鲥ַ
+ * ͺϳɿաͳƾĩͶݵĺʱԼϵͳô
+ * ÿεýյݿ(ݱ)ֱĬϱ IO_ENGINE=uring У
+ * Ƚ select()  io_uring I/O
+ *
+ * @version $Id
+ * @since   2026/10/18
+ */
+
+/**
+MODIFICATION HISTORY:
+<pre>
+================================================================================
+DD-MMM-YYYY INIT.    SIR    Modification Description
+----------- -------- ------ ----------------------------------------------------
+18-OCT-2026                 
+================================================================================
+</pre>
+*/
+
+/**
+ * ͷļ
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <netinet/in.h>
+
+#include "common.h"
+#include "errlib.h"
+#include "atomic.h"
+#include "stepCodec.h"
+
+#include "epsClient.h"
+
+
+/**
+ * 궨
+ */
+
+#if defined(EPS_IOENGINE_URING)
+#define BENCH_IO_ENGINE             "io_uring"
+#else
+#define BENCH_IO_ENGINE             "select"
+#endif
+
+#define BENCH_COUNT_DEFAULT         200000  /* Ĭ */
+#define BENCH_PAYLOAD_DEFAULT       200     /* Ĭÿյݳ */
+#define BENCH_PAYLOAD_MAX           3000    /* ݳ: 󲻳STEPϢ󳤶 */
+#define BENCH_TCP_PORT_DEFAULT      "3351"
+#define BENCH_MC_ADDRESS_DEFAULT    "230.11.1.1:3350;127.0.0.1"
+#define BENCH_SEND_CHUNK            65536   /* TCPη͵ݳ */
+#define BENCH_UDP_BURST             32      /* 鲥ÿͶͣһ */
+#define BENCH_UDP_BURST_INTL        50      /* 鲥ͣʱ(΢)ջ */
+#define BENCH_IDLE_TIMEOUT          1000    /* Ͷݼȴʱ() */
+
+
+/**
+ * ȫֱ
+ */
+
+static uint32   g_count = BENCH_COUNT_DEFAULT;
+static uint32   g_payload = BENCH_PAYLOAD_DEFAULT;
+static uint32   g_deliveredNum = 0;         /* Ͷݵ */
+static uint32   g_outOfOrderNum = 0;        /* δ */
+static uint64   g_lastSeqNum = 0;           /* Ͷݵ */
+static uint64   g_firstTime = 0;            /* Ͷʱ() */
+static uint64   g_lastTime = 0;             /* ĩͶʱ() */
+static BOOL     g_canStop = FALSE;          /* ߳˳ */
+
+
+/**
+ * ʵ
+ */
+
+static void Usage()
+{
+    printf("Usage: epsIoBench [mode] [count] [payload] [address]\n\n" \
+           "mode: tcp(default) or udp\n" \
+           "count: market data published, default 200000\n" \
+           "payload: mdData bytes per market data, default 200, at most 3000\n" \
+           "address: tcp - loopback port of the snapshot server, default 3351\n" \
+           "         udp - \"mcAddr:mcPort;localAddr\", default \"230.11.1.1:3350;127.0.0.1\"\n\n" \
+           "build with \"make epsIoBench\" and \"make IO_ENGINE=uring epsIoBench\" to compare the engines\n");
+}
+
+/*
+ * ȡʱʱ()
+ */
+static uint64 GetBenchTime()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+/*
+ * ϳɵĿ
+ */
+static void BuildSnapshot(StepMessageT* pMsg, uint64 msgSeqNum, uint64 applSeqNum)
+{
+    memset(pMsg, 0x00, sizeof(StepMessageT));
+    pMsg->msgType = STEP_MSGTYPE_MD_SNAPSHOT;
+    pMsg->msgSeqNum = msgSeqNum;
+    strcpy(pMsg->senderCompID, STEP_TARGET_COMPID_VALUE);
+    strcpy(pMsg->targetCompID, STEP_SENDER_COMPID_VALUE);
+    strcpy(pMsg->sendingTime, "20261018-09:30:00.000");
+    strcpy(pMsg->msgEncoding, "GBK");
+
+    MDSnapshotFullRefreshRecordT* pRecord = (MDSnapshotFullRefreshRecordT*)pMsg->body;
+    memcpy(pRecord->securityType, "01", STEP_SECURITY_TYPE_LEN+1);
+    pRecord->tradSesMode = 3;
+    pRecord->applID = 1;
+    pRecord->applSeqNum = applSeqNum;
+    memcpy(pRecord->tradeDate, "20261018", STEP_DATE_LEN+1);
+    memcpy(pRecord->lastUpdateTime, "09300000", STEP_TIME_LEN+1);
+    memcpy(pRecord->mdUpdateType, "0", 2);
+    pRecord->mdCount = 1;
+    memset(pRecord->mdData, 'x', g_payload);
+    pRecord->mdData[g_payload - 1] = ';';
+    pRecord->mdDataLen = g_payload;
+}
+
+/*
+ * STEPϢ׷ر볤ȣʧܷ0
+ */
+static int32 AppendStepMessage(StepMessageT* pMsg, char* buffer, int32 size)
+{
+    int32 len = 0;
+    if (NOTOK(EncodeStepMessage(pMsg, buffer, size, &len)))
+    {
+        printf("EncodeStepMessage() failed, Error: %s!!!\n", ErrGetErrorDscr());
+        ErrClearError();
+        return 0;
+    }
+    return len;
+}
+
+/*
+ * ͻе
+ */
+static BOOL SendAll(int sessionSocket, const char* buffer, int32 len)
+{
+    int32 sent = 0;
+    while (sent < len)
+    {
+        int result = send(sessionSocket, buffer + sent, len - sent, MSG_NOSIGNAL);
+        if (result <= 0)
+        {
+            return FALSE;
+        }
+        sent += result;
+    }
+    return TRUE;
+}
+
+/*
+ * շỰ: Ӧ½ļǳĺ󰴿ȫ
+ */
+static void ServeSession(int sessionSocket)
+{
+    char recvBuffer[STEP_MSG_MAX_LEN * 4];
+    char sendBuffer[BENCH_SEND_CHUNK + STEP_MSG_MAX_LEN];
+    int32 recvLen = 0;
+    uint64 msgSeqNum = 1;
+    StepMessageT msg;
+    StepMessageT rsp;
+
+    while (! EpsAtomicLoad(&g_canStop))
+    {
+        fd_set fdset;
+        FD_ZERO(&fdset);
+        FD_SET(sessionSocket, &fdset);
+        struct timeval waitTime = {0, 100000};
+        if (select(sessionSocket + 1, &fdset, NULL, NULL, &waitTime) <= 0)
+        {
+            continue;
+        }
+
+        int len = recv(sessionSocket, recvBuffer + recvLen, sizeof(recvBuffer) - recvLen, 0);
+        if (len <= 0)
+        {
+            return;
+        }
+        recvLen += len;
+
+        while (recvLen > 0)
+        {
+            int32 decodeSize = 0;
+            if (NOTOK(DecodeStepMessage(recvBuffer, recvLen, &msg, &decodeSize)))
+            {
+                ErrClearError();
+                break;
+            }
+            memmove(recvBuffer, recvBuffer + decodeSize, recvLen - decodeSize);
+            recvLen -= decodeSize;
+
+            if (msg.msgType == STEP_MSGTYPE_LOGON || msg.msgType == STEP_MSGTYPE_MD_REQUEST ||
+                msg.msgType == STEP_MSGTYPE_LOGOUT)
+            {
+                rsp = msg;
+                rsp.msgSeqNum = msgSeqNum++;
+                strcpy(rsp.senderCompID, STEP_TARGET_COMPID_VALUE);
+                strcpy(rsp.targetCompID, STEP_SENDER_COMPID_VALUE);
+                int32 rspLen = AppendStepMessage(&rsp, sendBuffer, sizeof(sendBuffer));
+                if (rspLen == 0 || ! SendAll(sessionSocket, sendBuffer, rspLen))
+                {
+                    return;
+                }
+            }
+
+            if (msg.msgType == STEP_MSGTYPE_MD_REQUEST)
+            {
+                int32 sendLen = 0;
+                uint32 applSeqNum = 0;
+                for (applSeqNum = 1; applSeqNum <= g_count; applSeqNum++)
+                {
+                    BuildSnapshot(&rsp, msgSeqNum++, applSeqNum);
+                    int32 msgLen = AppendStepMessage(&rsp, sendBuffer + sendLen, sizeof(sendBuffer) - sendLen);
+                    if (msgLen == 0)
+                    {
+                        return;
+                    }
+                    sendLen += msgLen;
+
+                    if (sendLen >= BENCH_SEND_CHUNK || applSeqNum == g_count)
+                    {
+                        if (! SendAll(sessionSocket, sendBuffer, sendLen))
+                        {
+                            return;
+                        }
+                        sendLen = 0;
+                    }
+                }
+            }
+        }
+    }
+}
+
+/*
+ * շ߳
+ */
+static void* RunSnapshotServer(void* arg)
+{
+    int listenSocket = *(int*)arg;
+
+    while (! EpsAtomicLoad(&g_canStop))
+    {
+        fd_set fdset;
+        FD_ZERO(&fdset);
+        FD_SET(listenSocket, &fdset);
+        struct timeval waitTime = {0, 100000};
+        if (select(listenSocket + 1, &fdset, NULL, NULL, &waitTime) <= 0)
+        {
+            continue;
+        }
+
+        int sessionSocket = accept(listenSocket, NULL, NULL);
+        if (sessionSocket < 0)
+        {
+            continue;
+        }
+        ServeSession(sessionSocket);
+        close(sessionSocket);
+    }
+
+    return NULL;
+}
+
+/*
+ * ؿշ
+ */
+static ResCodeT StartSnapshotServer(uint16 port, int* pListenSocket, pthread_t* pTid)
+{
+    TRY
+    {
+        int listenSocket = socket(AF_INET, SOCK_STREAM, 0);
+        *pListenSocket = listenSocket;
+
+        int reuseAddr = 1;
+        setsockopt(listenSocket, SOL_SOCKET, SO_REUSEADDR, &reuseAddr, sizeof(reuseAddr));
+
+        struct sockaddr_in serverAddr;
+        memset(&serverAddr, 0x00, sizeof(serverAddr));
+        serverAddr.sin_family = AF_INET;
+        serverAddr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        serverAddr.sin_port = htons(port);
+        if (listenSocket < 0 || bind(listenSocket, (struct sockaddr*)&serverAddr, sizeof(serverAddr)) != 0 ||
+            listen(listenSocket, 4) != 0)
+        {
+            int lstErrno = NET_ERRNO;
+            THROW_ERROR(ERCD_EPS_SOCKET_ERROR, EpsGetSystemError(lstErrno));
+        }
+
+        if (pthread_create(pTid, NULL, RunSnapshotServer, pListenSocket) != 0)
+        {
+            int lstErrno = SYS_ERRNO;
+            THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, EpsGetSystemError(lstErrno));
+        }
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/*
+ * 鲥飬ÿBENCH_UDP_BURSTͣһ
+ */
+static ResCodeT SendMulticast(const char* address)
+{
+    int mcSocket = -1;
+    StepMessageT msg;
+    char buffer[STEP_MSG_MAX_LEN];
+
+    TRY
+    {
+        char group[64];
+        char local[64];
+        int port = 0;
+        if (sscanf(address, "%63[^:]:%d;%63s", group, &port, local) != 3)
+        {
+            THROW_ERROR(ERCD_EPS_INVALID_ADDRESS, address);
+        }
+
+        mcSocket = socket(AF_INET, SOCK_DGRAM, 0);
+        if (mcSocket < 0)
+        {
+            int lstErrno = NET_ERRNO;
+            THROW_ERROR(ERCD_EPS_SOCKET_ERROR, EpsGetSystemError(lstErrno));
+        }
+
+        struct in_addr localAddr;
+        localAddr.s_addr = inet_addr(local);
+        setsockopt(mcSocket, IPPROTO_IP, IP_MULTICAST_IF, &localAddr, sizeof(localAddr));
+
+        struct sockaddr_in groupAddr;
+        memset(&groupAddr, 0x00, sizeof(groupAddr));
+        groupAddr.sin_family = AF_INET;
+        groupAddr.sin_addr.s_addr = inet_addr(group);
+        groupAddr.sin_port = htons((uint16)port);
+
+        uint32 applSeqNum = 0;
+        for (applSeqNum = 1; applSeqNum <= g_count; applSeqNum++)
+        {
+            BuildSnapshot(&msg, applSeqNum, applSeqNum);
+            int32 len = AppendStepMessage(&msg, buffer, sizeof(buffer));
+            if (len == 0)
+            {
+                THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, "EncodeStepMessage");
+            }
+            sendto(mcSocket, buffer, len, 0, (const struct sockaddr*)&groupAddr, sizeof(groupAddr));
+
+            if (applSeqNum % BENCH_UDP_BURST == 0)
+            {
+                usleep(BENCH_UDP_BURST_INTL);
+            }
+        }
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        if (mcSocket >= 0)
+        {
+            close(mcSocket);
+        }
+        RETURN_RESCODE;
+    }
+}
+
+static void OnEpsConnectedBench(uint32 hid)
+{
+    if (NOTOK(EpsLogin(hid, "username", "password", 10)))
+    {
+        printf("EpsLogin() failed, Error: %s!!!\n", EpsGetLastError());
+    }
+}
+
+static void OnEpsLoginRspBench(uint32 hid, uint16 heartbeatIntl, ResCodeT result, const char* reason)
+{
+    if (NOTOK(result) || NOTOK(EpsSubscribeMarketData(hid, EPS_MKTTYPE_ALL)))
+    {
+        printf("login or subscribe failed, reason: %s, Error: %s!!!\n", reason, EpsGetLastError());
+    }
+}
+
+static void OnEpsMktDataArrivedBench(uint32 hid, const EpsMktDataT* pMktData)
+{
+    uint64 now = GetBenchTime();
+    if (g_firstTime == 0)
+    {
+        g_firstTime = now;
+    }
+    g_lastTime = now;
+
+    if (pMktData->applSeqNum <= g_lastSeqNum)
+    {
+        g_outOfOrderNum++;
+    }
+    g_lastSeqNum = pMktData->applSeqNum;
+
+    EpsAtomicStore(&g_deliveredNum, g_deliveredNum + 1);
+}
+
+static void OnEpsEventOccurredBench(uint32 hid, EpsEventTypeT eventType, ResCodeT eventCode, const char* eventText)
+{
+    printf("==> OnEventOccurred(), hid: %d, eventType: %d, eventCode: %u, eventText: %s\n",
+        hid, eventType, eventCode, eventText);
+}
+
+int main(int argc, char *argv[])
+{
+    int listenSocket = -1;
+    pthread_t serverTid;
+    BOOL isServerStarted = FALSE;
+    BOOL isLibInited = FALSE;
+
+    TRY
+    {
+        ResCodeT rc = NO_ERR;
+        BOOL isTcp = TRUE;
+        const char* address = NULL;
+
+        setvbuf(stdout, NULL, _IONBF, 0); /* ñ׼Ϊлģʽ */
+
+        if (argc > 1 && (strcmp(argv[1], "-h") == 0 || strcmp(argv[1], "--help") == 0))
+        {
+            Usage();
+            exit(0);
+        }
+        if (argc > 1)
+        {
+            isTcp = (strcmp(argv[1], "udp") != 0);
+        }
+        if (argc > 2)
+        {
+            g_count = (uint32)atoi(argv[2]);
+        }
+        if (argc > 3)
+        {
+            g_payload = (uint32)atoi(argv[3]);
+        }
+        address = (argc > 4) ? argv[4] : (isTcp ? BENCH_TCP_PORT_DEFAULT : BENCH_MC_ADDRESS_DEFAULT);
+        if ((argc > 1 && isTcp && strcmp(argv[1], "tcp") != 0) || g_count == 0 ||
+            g_payload == 0 || g_payload > BENCH_PAYLOAD_MAX || (isTcp && atoi(address) <= 0))
+        {
+            Usage();
+            exit(0);
+        }
+
+        char connAddress[128];
+        if (isTcp)
+        {
+            THROW_ERROR(StartSnapshotServer((uint16)atoi(address), &listenSocket, &serverTid));
+            isServerStarted = TRUE;
+            sprintf(connAddress, "127.0.0.1:%d", atoi(address));
+        }
+        else
+        {
+            snprintf(connAddress, sizeof(connAddress), "%s", address);
+        }
+
+        printf("engine: %s, mode: %s, count: %u, payload: %u, address: %s\n\n", BENCH_IO_ENGINE,
+            isTcp ? "tcp" : "udp", g_count, g_payload, connAddress);
+
+        rc = EpsInitLib();
+        if (NOTOK(rc))
+        {
+            printf("EpsInitLib() failed, Error: %s!!!\n", EpsGetLastError());
+            THROW_RESCODE(rc);
+        }
+        isLibInited = TRUE;
+
+        uint32 hid = 0;
+        rc = EpsCreateHandle(&hid, isTcp ? EPS_CONNMODE_TCP : EPS_CONNMODE_UDP);
+        if (NOTOK(rc))
+        {
+            printf("EpsCreateHandle() failed, Error: %s!!!\n", EpsGetLastError());
+            THROW_RESCODE(rc);
+        }
+
+        EpsClientSpiT spi;
+        memset(&spi, 0x00, sizeof(spi));
+        spi.connectedNotify = OnEpsConnectedBench;
+        spi.loginRspNotify = OnEpsLoginRspBench;
+        spi.mktDataArrivedNotify = OnEpsMktDataArrivedBench;
+        spi.eventOccurredNotify = OnEpsEventOccurredBench;
+        rc = EpsRegisterSpi(hid, &spi);
+        if (NOTOK(rc))
+        {
+            printf("EpsRegisterSpi() failed, Error: %s!!!\n", EpsGetLastError());
+            THROW_RESCODE(rc);
+        }
+
+        rc = EpsConnect(hid, connAddress);
+        if (OK(rc) && ! isTcp)
+        {
+            rc = EpsSubscribeMarketData(hid, EPS_MKTTYPE_ALL);
+        }
+        if (NOTOK(rc))
+        {
+            printf("EpsConnect() failed, Error: %s!!!\n", EpsGetLastError());
+            THROW_RESCODE(rc);
+        }
+
+        if (! isTcp)
+        {
+            usleep(300000);
+            rc = SendMulticast(address);
+            if (NOTOK(rc))
+            {
+                printf("SendMulticast() failed, Error: %s!!!\n", ErrGetErrorDscr());
+                THROW_RESCODE(rc);
+            }
+        }
+
+        /* ȫͶݣͶݺ */
+        uint32 lastNum = 0;
+        uint32 idleTime = 0;
+        while (EpsAtomicLoad(&g_deliveredNum) < g_count && idleTime < BENCH_IDLE_TIMEOUT * 10)
+        {
+            usleep(10000);
+            uint32 deliveredNum = EpsAtomicLoad(&g_deliveredNum);
+            idleTime = (deliveredNum == lastNum) ? idleTime + 10 : 0;
+            if (deliveredNum > 0 && idleTime >= BENCH_IDLE_TIMEOUT)
+            {
+                break;
+            }
+            lastNum = deliveredNum;
+        }
+
+        EpsStatisticsT stat;
+        rc = EpsGetStatistics(hid, &stat);
+        if (NOTOK(rc))
+        {
+            printf("EpsGetStatistics() failed, Error: %s!!!\n", EpsGetLastError());
+            THROW_RESCODE(rc);
+        }
+
+        EpsDisconnect(hid);
+        EpsDestroyHandle(hid);
+
+        uint32 deliveredNum = EpsAtomicLoad(&g_deliveredNum);
+        double elapsed = (double)(g_lastTime - g_firstTime) / 1000000.0;
+        double seconds = (elapsed > 0) ? elapsed / 1000.0 : 1e-9;
+
+        printf("%10s %12s %12s %14s %10s %12s %12s %12s %10s\n", "engine", "delivered", "elapsed(ms)",
+            "mktData/s", "MB/s", "recvCalls", "recvPackets", "packets/call", "maxBatch");
+        printf("%10s %12u %12.1f %14.0f %10.1f %12llu %12llu %12.2f %10u\n", BENCH_IO_ENGINE, deliveredNum,
+            elapsed, deliveredNum / seconds, (double)stat.recvBytes / seconds / 1048576.0,
+            (unsigned long long)stat.recvCalls, (unsigned long long)stat.recvPackets,
+            (stat.recvCalls > 0) ? (double)stat.recvPackets / stat.recvCalls : 0.0, stat.maxBatchSize);
+        printf("\nlost: %u, outOfOrder: %u\n", g_count - deliveredNum, g_outOfOrderNum);
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        if (isLibInited)
+        {
+            EpsUninitLib();
+        }
+        if (isServerStarted)
+        {
+            EpsAtomicStore(&g_canStop, TRUE);
+            pthread_join(serverTid, NULL);
+        }
+        if (listenSocket >= 0)
+        {
+            close(listenSocket);
+        }
+        return (OK(GET_RESCODE()) ? 0 : 1);
+    }
+}
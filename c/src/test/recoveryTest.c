@@ -0,0 +1,520 @@
+/*
+ * Copyright (C) 2013, 2014 Shanghai Stock Exchange (SSE), Shanghai, China
+ * All Rights Reserved.
+ */
+
+/**
+ * @file    recoveryTest.c
+ *
+ * UDPȱTCPջָԳ(֧Linux/Unix)
+ *
+ * TCPշ(طȫ)鲥ַͰ飬
+ * 鲥飻UDPTCPջָȱڲϲ鲥ŵĿգ
+ * УÿǡͶһ
+ *
+ * @version $Id
+ * @since   2026/10/18
+ */
+
+/**
+MODIFICATION HISTORY:
+<pre>
+================================================================================
+DD-MMM-YYYY INIT.    SIR    Modification Description
+----------- -------- ------ ----------------------------------------------------
+18-OCT-2026                 
+================================================================================
+</pre>
+*/
+
+/**
+ * ͷļ
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <netinet/in.h>
+
+#include "common.h"
+#include "errlib.h"
+#include "atomic.h"
+#include "stepCodec.h"
+#include "mktDatabase.h"
+#include "udpRecovery.h"
+
+#include "epsClient.h"
+
+
+/**
+ * 궨
+ */
+
+#define TEST_COUNT_DEFAULT          2000    /* Ĭ */
+#define TEST_DROP_EVERY_DEFAULT     50      /* Ĭ鲥 */
+#define TEST_TAIL_COUNT_DEFAULT     100     /* Ĭ鲥͵ĩβ */
+#define TEST_COUNT_MAX              (EPS_UDP_RECOVERY_QUEUE_SIZE - 96)  /* : طȫָ */
+#define TEST_MC_ADDRESS_DEFAULT     "230.11.1.1:3340;127.0.0.1"
+#define TEST_TCP_PORT_DEFAULT       3341
+#define TEST_SEND_INTL              200     /* 鲥ͼ(΢) */
+#define TEST_WAIT_TIMEOUT           15000   /* ȴȫͶݵĳʱʱ() */
+
+
+/**
+ * ȫֱ
+ */
+
+static uint32   g_count = TEST_COUNT_DEFAULT;
+static uint16   g_tcpPort = TEST_TCP_PORT_DEFAULT;
+static uint32*  g_deliveredTimes = NULL;    /* ŵͶݴ */
+static uint32   g_deliveredNum = 0;         /* ͶݵĲͬ */
+static uint32   g_duplicateNum = 0;         /* ظͶݵĴ */
+static BOOL     g_canStop = FALSE;          /* ߳˳ */
+
+
+/**
+ * ʵ
+ */
+
+static void Usage()
+{
+    printf("Usage: epsRecoveryTest [count] [dropEvery] [tailCount] [mcAddr:mcPort;localAddr] [tcpPort]\n\n" \
+           "count: market data published by the servers, default 2000, at most 4000\n" \
+           "dropEvery: multicast drops every Nth market data, default 50, count/dropEvery at most 64\n" \
+           "tailCount: last market data never sent by multicast, default 100\n" \
+           "mcAddr:mcPort;localAddr: default \"230.11.1.1:3340;127.0.0.1\"\n" \
+           "tcpPort: loopback port of the snapshot server, default 3341\n");
+}
+
+/*
+ * ϳɵĿ
+ */
+static void BuildSnapshot(StepMessageT* pMsg, uint64 msgSeqNum, uint64 applSeqNum)
+{
+    memset(pMsg, 0x00, sizeof(StepMessageT));
+    pMsg->msgType = STEP_MSGTYPE_MD_SNAPSHOT;
+    pMsg->msgSeqNum = msgSeqNum;
+    strcpy(pMsg->senderCompID, STEP_TARGET_COMPID_VALUE);
+    strcpy(pMsg->targetCompID, STEP_SENDER_COMPID_VALUE);
+    strcpy(pMsg->sendingTime, "20261018-09:30:00.000");
+    strcpy(pMsg->msgEncoding, "GBK");
+
+    MDSnapshotFullRefreshRecordT* pRecord = (MDSnapshotFullRefreshRecordT*)pMsg->body;
+    memcpy(pRecord->securityType, "01", STEP_SECURITY_TYPE_LEN+1);
+    pRecord->tradSesMode = 3;
+    pRecord->applID = 1;
+    pRecord->applSeqNum = applSeqNum;
+    memcpy(pRecord->tradeDate, "20261018", STEP_DATE_LEN+1);
+    memcpy(pRecord->lastUpdateTime, "09300000", STEP_TIME_LEN+1);
+    memcpy(pRecord->mdUpdateType, "0", 2);
+    pRecord->mdCount = 1;
+    pRecord->mdDataLen = (uint32)sprintf(pRecord->mdData, "600000|%llu;", (unsigned long long)applSeqNum);
+}
+
+/*
+ * 벢STEPϢ
+ */
+static BOOL SendStepMessage(int sessionSocket, StepMessageT* pMsg, const struct sockaddr_in* pAddr)
+{
+    char buffer[STEP_MSG_MAX_LEN];
+    int32 len = 0;
+    if (NOTOK(EncodeStepMessage(pMsg, buffer, sizeof(buffer), &len)))
+    {
+        printf("EncodeStepMessage() failed, Error: %s!!!\n", ErrGetErrorDscr());
+        ErrClearError();
+        return FALSE;
+    }
+
+    int result = (pAddr == NULL) ? send(sessionSocket, buffer, len, MSG_NOSIGNAL) :
+        sendto(sessionSocket, buffer, len, 0, (const struct sockaddr*)pAddr, sizeof(struct sockaddr_in));
+    return (result == len);
+}
+
+/*
+ * շỰ: Ӧ½ļǳĺطȫ
+ */
+static void ServeSession(int sessionSocket)
+{
+    char recvBuffer[STEP_MSG_MAX_LEN * 4];
+    int32 recvLen = 0;
+    uint64 msgSeqNum = 1;
+
+    while (! EpsAtomicLoad(&g_canStop))
+    {
+        fd_set fdset;
+        FD_ZERO(&fdset);
+        FD_SET(sessionSocket, &fdset);
+        struct timeval waitTime = {0, 100000};
+        if (select(sessionSocket + 1, &fdset, NULL, NULL, &waitTime) <= 0)
+        {
+            continue;
+        }
+
+        int len = recv(sessionSocket, recvBuffer + recvLen, sizeof(recvBuffer) - recvLen, 0);
+        if (len <= 0)
+        {
+            return;
+        }
+        recvLen += len;
+
+        while (recvLen > 0)
+        {
+            StepMessageT msg;
+            int32 decodeSize = 0;
+            if (NOTOK(DecodeStepMessage(recvBuffer, recvLen, &msg, &decodeSize)))
+            {
+                ErrClearError();
+                break;
+            }
+            memmove(recvBuffer, recvBuffer + decodeSize, recvLen - decodeSize);
+            recvLen -= decodeSize;
+
+            if (msg.msgType == STEP_MSGTYPE_LOGON || msg.msgType == STEP_MSGTYPE_MD_REQUEST ||
+                msg.msgType == STEP_MSGTYPE_LOGOUT)
+            {
+                StepMessageT rsp = msg;
+                rsp.msgSeqNum = msgSeqNum++;
+                strcpy(rsp.senderCompID, STEP_TARGET_COMPID_VALUE);
+                strcpy(rsp.targetCompID, STEP_SENDER_COMPID_VALUE);
+                if (! SendStepMessage(sessionSocket, &rsp, NULL))
+                {
+                    return;
+                }
+            }
+
+            if (msg.msgType == STEP_MSGTYPE_MD_REQUEST)
+            {
+                uint32 applSeqNum = 0;
+                for (applSeqNum = 1; applSeqNum <= g_count; applSeqNum++)
+                {
+                    StepMessageT snapshot;
+                    BuildSnapshot(&snapshot, msgSeqNum++, applSeqNum);
+                    if (! SendStepMessage(sessionSocket, &snapshot, NULL))
+                    {
+                        return;
+                    }
+                }
+            }
+        }
+    }
+}
+
+/*
+ * շ߳
+ */
+static void* RunSnapshotServer(void* arg)
+{
+    int listenSocket = *(int*)arg;
+
+    while (! EpsAtomicLoad(&g_canStop))
+    {
+        fd_set fdset;
+        FD_ZERO(&fdset);
+        FD_SET(listenSocket, &fdset);
+        struct timeval waitTime = {0, 100000};
+        if (select(listenSocket + 1, &fdset, NULL, NULL, &waitTime) <= 0)
+        {
+            continue;
+        }
+
+        int sessionSocket = accept(listenSocket, NULL, NULL);
+        if (sessionSocket < 0)
+        {
+            continue;
+        }
+        ServeSession(sessionSocket);
+        close(sessionSocket);
+    }
+
+    return NULL;
+}
+
+/*
+ * 鲥飬ΪdropEvery鼰tailCount鲻
+ */
+static ResCodeT SendMulticast(const char* address, uint32 dropEvery, uint32 tailCount)
+{
+    int mcSocket = -1;
+
+    TRY
+    {
+        char group[64];
+        char local[64];
+        int port = 0;
+        if (sscanf(address, "%63[^:]:%d;%63s", group, &port, local) != 3)
+        {
+            THROW_ERROR(ERCD_EPS_INVALID_ADDRESS, address);
+        }
+
+        mcSocket = socket(AF_INET, SOCK_DGRAM, 0);
+        if (mcSocket < 0)
+        {
+            int lstErrno = NET_ERRNO;
+            THROW_ERROR(ERCD_EPS_SOCKET_ERROR, EpsGetSystemError(lstErrno));
+        }
+
+        struct in_addr localAddr;
+        localAddr.s_addr = inet_addr(local);
+        setsockopt(mcSocket, IPPROTO_IP, IP_MULTICAST_IF, &localAddr, sizeof(localAddr));
+
+        struct sockaddr_in groupAddr;
+        memset(&groupAddr, 0x00, sizeof(groupAddr));
+        groupAddr.sin_family = AF_INET;
+        groupAddr.sin_addr.s_addr = inet_addr(group);
+        groupAddr.sin_port = htons((uint16)port);
+
+        uint32 applSeqNum = 0;
+        for (applSeqNum = 1; applSeqNum + tailCount <= g_count; applSeqNum++)
+        {
+            if (dropEvery > 0 && applSeqNum % dropEvery == 0)
+            {
+                continue;
+            }
+
+            StepMessageT msg;
+            BuildSnapshot(&msg, applSeqNum, applSeqNum);
+            SendStepMessage(mcSocket, &msg, &groupAddr);
+            usleep(TEST_SEND_INTL);
+        }
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        if (mcSocket >= 0)
+        {
+            close(mcSocket);
+        }
+        RETURN_RESCODE;
+    }
+}
+
+static void OnEpsMktDataArrivedTest(uint32 hid, const EpsMktDataT* pMktData)
+{
+    if (pMktData->applSeqNum == 0 || pMktData->applSeqNum > g_count)
+    {
+        return;
+    }
+
+    if (g_deliveredTimes[pMktData->applSeqNum]++ == 0)
+    {
+        EpsAtomicStore(&g_deliveredNum, g_deliveredNum + 1);
+    }
+    else
+    {
+        g_duplicateNum++;
+    }
+}
+
+static void OnEpsEventOccurredTest(uint32 hid, EpsEventTypeT eventType, ResCodeT eventCode, const char* eventText)
+{
+    printf("==> OnEventOccurred(), hid: %d, eventType: %d, eventCode: %u, eventText: %s\n",
+        hid, eventType, eventCode, eventText);
+}
+
+static void OnEpsMktDataGapTest(uint32 hid, const EpsMktGapT* pMktGap)
+{
+}
+
+int main(int argc, char *argv[])
+{
+    int listenSocket = -1;
+    pthread_t serverTid;
+    BOOL isServerStarted = FALSE;
+
+    TRY
+    {
+        ResCodeT rc = NO_ERR;
+        uint32 dropEvery = TEST_DROP_EVERY_DEFAULT;
+        uint32 tailCount = TEST_TAIL_COUNT_DEFAULT;
+        const char* mcAddress = TEST_MC_ADDRESS_DEFAULT;
+
+        setvbuf(stdout, NULL, _IONBF, 0); /* ñ׼Ϊлģʽ */
+
+        if (argc > 1 && (strcmp(argv[1], "-h") == 0 || strcmp(argv[1], "--help") == 0))
+        {
+            Usage();
+            exit(0);
+        }
+        if (argc > 1)
+        {
+            g_count = (uint32)atoi(argv[1]);
+        }
+        if (argc > 2)
+        {
+            dropEvery = (uint32)atoi(argv[2]);
+        }
+        if (argc > 3)
+        {
+            tailCount = (uint32)atoi(argv[3]);
+        }
+        if (argc > 4)
+        {
+            mcAddress = argv[4];
+        }
+        if (argc > 5)
+        {
+            g_tcpPort = (uint16)atoi(argv[5]);
+        }
+        /* 鲥ȱڲŻָᷢȱݿⱣδȱ */
+        if (g_count == 0 || g_count > TEST_COUNT_MAX || tailCount >= g_count || dropEvery < 2 ||
+            g_count / dropEvery > EPS_MKTDB_GAP_MAX_NUM)
+        {
+            Usage();
+            exit(0);
+        }
+
+        g_deliveredTimes = (uint32*)calloc(g_count + 1, sizeof(uint32));
+        if (g_deliveredTimes == NULL)
+        {
+            THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, "calloc");
+        }
+
+        listenSocket = socket(AF_INET, SOCK_STREAM, 0);
+        int reuseAddr = 1;
+        setsockopt(listenSocket, SOL_SOCKET, SO_REUSEADDR, &reuseAddr, sizeof(reuseAddr));
+
+        struct sockaddr_in serverAddr;
+        memset(&serverAddr, 0x00, sizeof(serverAddr));
+        serverAddr.sin_family = AF_INET;
+        serverAddr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        serverAddr.sin_port = htons(g_tcpPort);
+        if (listenSocket < 0 || bind(listenSocket, (struct sockaddr*)&serverAddr, sizeof(serverAddr)) != 0 ||
+            listen(listenSocket, 4) != 0)
+        {
+            int lstErrno = NET_ERRNO;
+            THROW_ERROR(ERCD_EPS_SOCKET_ERROR, EpsGetSystemError(lstErrno));
+        }
+
+        if (pthread_create(&serverTid, NULL, RunSnapshotServer, &listenSocket) != 0)
+        {
+            int lstErrno = SYS_ERRNO;
+            THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, EpsGetSystemError(lstErrno));
+        }
+        isServerStarted = TRUE;
+
+        printf("count: %u, dropEvery: %u, tailCount: %u, multicast: %s, snapshot server: 127.0.0.1:%u\n\n",
+            g_count, dropEvery, tailCount, mcAddress, g_tcpPort);
+
+        rc = EpsInitLib();
+        if (NOTOK(rc))
+        {
+            printf("EpsInitLib() failed, Error: %s!!!\n", EpsGetLastError());
+            THROW_RESCODE(rc);
+        }
+
+        uint32 hid = 0;
+        rc = EpsCreateHandle(&hid, EPS_CONNMODE_UDP);
+        if (NOTOK(rc))
+        {
+            printf("EpsCreateHandle() failed, Error: %s!!!\n", EpsGetLastError());
+            THROW_RESCODE(rc);
+        }
+
+        EpsClientSpiT spi;
+        memset(&spi, 0x00, sizeof(spi));
+        spi.mktDataArrivedNotify = OnEpsMktDataArrivedTest;
+        spi.eventOccurredNotify = OnEpsEventOccurredTest;
+        spi.mktDataGapNotify = OnEpsMktDataGapTest;
+        rc = EpsRegisterSpi(hid, &spi);
+        if (NOTOK(rc))
+        {
+            printf("EpsRegisterSpi() failed, Error: %s!!!\n", EpsGetLastError());
+            THROW_RESCODE(rc);
+        }
+
+        char recoveryAddress[32];
+        sprintf(recoveryAddress, "127.0.0.1:%u", g_tcpPort);
+        rc = EpsSetRecovery(hid, recoveryAddress, "username", "password", 1);
+        if (NOTOK(rc))
+        {
+            printf("EpsSetRecovery() failed, Error: %s!!!\n", EpsGetLastError());
+            THROW_RESCODE(rc);
+        }
+
+        rc = EpsConnect(hid, mcAddress);
+        if (OK(rc))
+        {
+            rc = EpsSubscribeMarketData(hid, EPS_MKTTYPE_ALL);
+        }
+        if (NOTOK(rc))
+        {
+            printf("EpsConnect() failed, Error: %s!!!\n", EpsGetLastError());
+            THROW_RESCODE(rc);
+        }
+        usleep(300000);
+
+        rc = SendMulticast(mcAddress, dropEvery, tailCount);
+        if (NOTOK(rc))
+        {
+            printf("SendMulticast() failed, Error: %s!!!\n", ErrGetErrorDscr());
+            THROW_RESCODE(rc);
+        }
+
+        uint32 waitTime = 0;
+        while (EpsAtomicLoad(&g_deliveredNum) < g_count && waitTime < TEST_WAIT_TIMEOUT)
+        {
+            usleep(10000);
+            waitTime += 10;
+        }
+        usleep(100000);
+
+        EpsStatisticsT stat;
+        rc = EpsGetStatistics(hid, &stat);
+        if (NOTOK(rc))
+        {
+            printf("EpsGetStatistics() failed, Error: %s!!!\n", EpsGetLastError());
+            THROW_RESCODE(rc);
+        }
+
+        EpsDisconnect(hid);
+        EpsDestroyHandle(hid);
+        EpsUninitLib();
+
+        uint32 missing = 0;
+        uint32 applSeqNum = 0;
+        for (applSeqNum = 1; applSeqNum <= g_count; applSeqNum++)
+        {
+            if (g_deliveredTimes[applSeqNum] == 0)
+            {
+                if (missing++ < 10)
+                {
+                    printf("missing applSeqNum: %u\n", applSeqNum);
+                }
+            }
+        }
+
+        printf("recvPackets: %llu, gapCount: %llu, gapSeqNums: %llu, recoveryCount: %llu, "
+            "recoveredSeqNums: %llu, unrecoveredSeqNums: %llu\n",
+            (unsigned long long)stat.recvPackets, (unsigned long long)stat.gapCount,
+            (unsigned long long)stat.gapSeqNums, (unsigned long long)stat.recoveryCount,
+            (unsigned long long)stat.recoveredSeqNums, (unsigned long long)stat.unrecoveredSeqNums);
+        printf("delivered: %u/%u, missing: %u, duplicated: %u\n\n", g_deliveredNum, g_count,
+            missing, g_duplicateNum);
+
+        if (missing > 0 || g_duplicateNum > 0)
+        {
+            printf(">>> recovery test FAILED\n");
+            THROW_RESCODE(ERCD_EPS_MKTDATA_GAP);
+        }
+        printf(">>> recovery test PASSED\n");
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        if (isServerStarted)
+        {
+            EpsAtomicStore(&g_canStop, TRUE);
+            pthread_join(serverTid, NULL);
+        }
+        if (listenSocket >= 0)
+        {
+            close(listenSocket);
+        }
+        free(g_deliveredTimes);
+        return (OK(GET_RESCODE()) ? 0 : 1);
+    }
+}
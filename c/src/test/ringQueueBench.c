@@ -0,0 +1,355 @@
+/*
+ * Copyright (C) 2013, 2014 Shanghai Stock Exchange (SSE), Shanghai, China
+ * All Rights Reserved.
+ */
+
+/**
+ * @file    ringQueueBench.c
+ *
+ * ͶоܲԳ(֧Linux/Unix)
+ *
+ * ģTCPͨͶ: û̲߳д뷢ݣͨ߳ȡƵ
+ * ͻֱ1248ֶ߲е:
+ * ring  - ߵ߻ζУֱдԤλ(ǰʵ)
+ * mutex - ָУÿݵcalloc/free(ԭʵ)
+ *
+ * @version $Id
+ * @since   2026/10/18
+ */
+
+/**
+MODIFICATION HISTORY:
+<pre>
+================================================================================
+DD-MMM-YYYY INIT.    SIR    Modification Description
+----------- -------- ------ ----------------------------------------------------
+18-OCT-2026                 
+================================================================================
+</pre>
+*/
+
+/**
+ * ͷļ
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sched.h>
+
+#include "common.h"
+#include "errlib.h"
+#include "atomic.h"
+#include "recMutex.h"
+#include "ringQueue.h"
+
+#include "epsClient.h"
+
+
+/**
+ * 궨
+ */
+
+#define BENCH_ITEM_NUM_DEFAULT      200000  /* Ĭÿдķ */
+#define BENCH_DATA_LEN_DEFAULT      256     /* Ĭÿݳ */
+#define BENCH_QUEUE_SIZE            128     /* ͶдСTCPͨͬ */
+#define BENCH_SENDDATA_MAX_LEN      8192    /* η󳤶ȣTCPͨͬ */
+#define BENCH_PRODUCER_NUM_MAX      8       /*  */
+
+
+/**
+ * Ͷ
+ */
+
+/*
+ * ݽṹTCPͨͶеͬ
+ */
+typedef struct BenchSendDataTag
+{
+    char    data[BENCH_SENDDATA_MAX_LEN];
+    uint32  dataLen;
+} BenchSendDataT;
+
+/*
+ * ָ
+ */
+typedef struct BenchLockedQueueTag
+{
+    EpsRecMutexT mutex;                 /*  */
+    BenchSendDataT* container[BENCH_QUEUE_SIZE];/*  */
+    uint32  header;                     /* λ */
+    uint32  tailer;                     /* λ */
+} BenchLockedQueueT;
+
+
+/**
+ * ȫֱ
+ */
+
+static uint32   g_itemNum = BENCH_ITEM_NUM_DEFAULT;
+static uint32   g_dataLen = BENCH_DATA_LEN_DEFAULT;
+static BOOL     g_isRing = TRUE;            /* ֲԵĶ */
+static EpsRingQueueT g_ringQueue;
+static BenchLockedQueueT g_lockedQueue;
+static uint32   g_startFlag = 0;            /* ߿ʼд */
+static uint64   g_fullCount = 0;            /* Ĵ */
+static char     g_sendBuffer[BENCH_SENDDATA_MAX_LEN];/* ģͨͻ */
+
+
+/**
+ * ʵ
+ */
+
+static void Usage()
+{
+    printf("Usage: epsRingQueueBench [items] [dataLen]\n\n" \
+           "items: send requests per producer, default 200000\n" \
+           "dataLen: bytes per send request, default 256, at most 8192\n");
+}
+
+/*
+ * д: ䷢ݺ
+ */
+static BOOL PushLockedQueue(const char* data, uint32 dataLen)
+{
+    BenchSendDataT* pData = (BenchSendDataT*)calloc(1, sizeof(BenchSendDataT));
+    if (pData == NULL)
+    {
+        return FALSE;
+    }
+    memcpy(pData->data, data, dataLen);
+    pData->dataLen = dataLen;
+
+    while (TRUE)
+    {
+        LockRecMutex(&g_lockedQueue.mutex);
+        if (g_lockedQueue.header - g_lockedQueue.tailer < BENCH_QUEUE_SIZE)
+        {
+            g_lockedQueue.container[g_lockedQueue.header++ % BENCH_QUEUE_SIZE] = pData;
+            UnlockRecMutex(&g_lockedQueue.mutex);
+            return TRUE;
+        }
+        UnlockRecMutex(&g_lockedQueue.mutex);
+
+        EpsAtomicFetchAdd(&g_fullCount, 1);
+        sched_yield();
+    }
+}
+
+/*
+ * ȡ: ӺƵͻͷ
+ */
+static BOOL PopLockedQueue()
+{
+    BenchSendDataT* pData = NULL;
+
+    LockRecMutex(&g_lockedQueue.mutex);
+    if (g_lockedQueue.tailer != g_lockedQueue.header)
+    {
+        pData = g_lockedQueue.container[g_lockedQueue.tailer++ % BENCH_QUEUE_SIZE];
+    }
+    UnlockRecMutex(&g_lockedQueue.mutex);
+
+    if (pData == NULL)
+    {
+        return FALSE;
+    }
+    memcpy(g_sendBuffer, pData->data, pData->dataLen);
+    free(pData);
+    return TRUE;
+}
+
+/*
+ * ζд: Ԥλֱд벢ύ
+ */
+static BOOL PushRing(const char* data, uint32 dataLen)
+{
+    BenchSendDataT* pData = NULL;
+    while (NOTOK(ReserveRingQueue(&g_ringQueue, (void**)&pData)))
+    {
+        ErrClearError();
+        EpsAtomicFetchAdd(&g_fullCount, 1);
+        sched_yield();
+    }
+
+    memcpy(pData->data, data, dataLen);
+    pData->dataLen = dataLen;
+    CommitRingQueue(&g_ringQueue, pData);
+    return TRUE;
+}
+
+/*
+ * ζȡ: 鿴Ƶͻͷ
+ */
+static BOOL PopRing()
+{
+    BenchSendDataT* pData = NULL;
+    if (PeekRingQueue(&g_ringQueue, 1, (void**)&pData) == 0)
+    {
+        return FALSE;
+    }
+    memcpy(g_sendBuffer, pData->data, pData->dataLen);
+    ReleaseRingQueue(&g_ringQueue, 1);
+    return TRUE;
+}
+
+/*
+ * ߳
+ */
+static void* RunProducer(void* arg)
+{
+    char data[BENCH_SENDDATA_MAX_LEN];
+    memset(data, 'x', g_dataLen);
+
+    while (! EpsAtomicLoad(&g_startFlag))
+    {
+        sched_yield();
+    }
+
+    uint32 i = 0;
+    for (i = 0; i < g_itemNum; i++)
+    {
+        BOOL isPushed = g_isRing ? PushRing(data, g_dataLen) : PushLockedQueue(data, g_dataLen);
+        if (! isPushed)
+        {
+            printf("push failed!!!\n");
+            exit(1);
+        }
+    }
+    return NULL;
+}
+
+/*
+ * ָһֲԣغʱ()ȡ
+ */
+static ResCodeT RunBench(BOOL isRing, uint32 producerNum, uint64* pElapsed, uint64* pPopped)
+{
+    pthread_t tids[BENCH_PRODUCER_NUM_MAX];
+    uint32 startedNum = 0;
+
+    TRY
+    {
+        g_isRing = isRing;
+        g_startFlag = 0;
+        g_fullCount = 0;
+        if (isRing)
+        {
+            memset(&g_ringQueue, 0x00, sizeof(g_ringQueue));
+            THROW_ERROR(InitRingQueue(&g_ringQueue, EPS_RINGQUEUE_TYPE_MPSC, BENCH_QUEUE_SIZE,
+                    sizeof(BenchSendDataT)));
+        }
+        else
+        {
+            g_lockedQueue.header = 0;
+            g_lockedQueue.tailer = 0;
+        }
+
+        for (startedNum = 0; startedNum < producerNum; startedNum++)
+        {
+            if (pthread_create(&tids[startedNum], NULL, RunProducer, NULL) != 0)
+            {
+                int lstErrno = SYS_ERRNO;
+                THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, EpsGetSystemError(lstErrno));
+            }
+        }
+
+        uint64 total = (uint64)producerNum * g_itemNum;
+        uint64 popped = 0;
+        uint64 beginTime = EpsGetTimestamp();
+        EpsAtomicStore(&g_startFlag, 1);
+
+        /* : ģͨ߳ȡ */
+        while (popped < total)
+        {
+            BOOL isPopped = isRing ? PopRing() : PopLockedQueue();
+            if (isPopped)
+            {
+                popped++;
+            }
+            else
+            {
+                sched_yield();
+            }
+        }
+        *pElapsed = EpsGetTimestamp() - beginTime;
+        *pPopped = popped;
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        EpsAtomicStore(&g_startFlag, 1);
+        while (startedNum > 0)
+        {
+            pthread_join(tids[--startedNum], NULL);
+        }
+        if (isRing)
+        {
+            UninitRingQueue(&g_ringQueue);
+        }
+        RETURN_RESCODE;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    TRY
+    {
+        setvbuf(stdout, NULL, _IONBF, 0); /* ñ׼Ϊлģʽ */
+
+        if (argc > 1 && (strcmp(argv[1], "-h") == 0 || strcmp(argv[1], "--help") == 0))
+        {
+            Usage();
+            exit(0);
+        }
+        if (argc > 1)
+        {
+            g_itemNum = (uint32)atoi(argv[1]);
+        }
+        if (argc > 2)
+        {
+            g_dataLen = (uint32)atoi(argv[2]);
+        }
+        if (g_itemNum == 0 || g_dataLen == 0 || g_dataLen > BENCH_SENDDATA_MAX_LEN)
+        {
+            Usage();
+            exit(0);
+        }
+
+        InitRecMutex(&g_lockedQueue.mutex);
+
+        printf("items per producer: %u, data length: %u, queue size: %u\n\n", g_itemNum, g_dataLen,
+            BENCH_QUEUE_SIZE);
+        printf("%10s %9s %12s %12s %14s %12s %10s\n", "queue", "producers", "items", "elapsed(ms)",
+            "items/s", "full retries", "vs mutex");
+
+        uint32 producerNum = 0;
+        for (producerNum = 1; producerNum <= BENCH_PRODUCER_NUM_MAX; producerNum *= 2)
+        {
+            uint64 lockedElapsed = 0;
+            uint64 elapsed = 0;
+            uint64 popped = 0;
+
+            THROW_ERROR(RunBench(FALSE, producerNum, &lockedElapsed, &popped));
+            printf("%10s %9u %12llu %12.1f %14.0f %12llu %10s\n", "mutex", producerNum,
+                (unsigned long long)popped, lockedElapsed / 1000000.0, popped * 1e9 / lockedElapsed,
+                (unsigned long long)g_fullCount, "-");
+
+            THROW_ERROR(RunBench(TRUE, producerNum, &elapsed, &popped));
+            printf("%10s %9u %12llu %12.1f %14.0f %12llu %9.2fx\n", "ring", producerNum,
+                (unsigned long long)popped, elapsed / 1000000.0, popped * 1e9 / elapsed,
+                (unsigned long long)g_fullCount, (double)lockedElapsed / elapsed);
+        }
+
+        UninitRecMutex(&g_lockedQueue.mutex);
+    }
+    CATCH
+    {
+        printf("RunBench() failed, Error: %s!!!\n", ErrGetErrorDscr());
+    }
+    FINALLY
+    {
+        return (OK(GET_RESCODE()) ? 0 : 1);
+    }
+}
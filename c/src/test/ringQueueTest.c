@@ -0,0 +1,363 @@
+/*
+ * Copyright (C) 2013, 2014 Shanghai Stock Exchange (SSE), Shanghai, China
+ * All Rights Reserved.
+ */
+
+/**
+ * @file    ringQueueTest.c
+ *
+ * ߵ߻ζѹԳ(֧Linux/Unix)
+ *
+ * ߳̽PushRingQueueReserveRingQueue/CommitRingQueueд(ʱδύλ)
+ * ߽PopRingQueuePeekRingQueue/ReleaseRingQueueȡнС
+ * λƶƻɴӽӽuint32޵λƿʼԸλ
+ * УÿǡñȡһΡͬһߵд˳ȡ
+ *
+ * @version $Id
+ * @since   2026/10/18
+ */
+
+/**
+MODIFICATION HISTORY:
+<pre>
+================================================================================
+DD-MMM-YYYY INIT.    SIR    Modification Description
+----------- -------- ------ ----------------------------------------------------
+18-OCT-2026                 
+================================================================================
+</pre>
+*/
+
+/**
+ * ͷļ
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sched.h>
+
+#include "common.h"
+#include "errlib.h"
+#include "atomic.h"
+#include "ringQueue.h"
+
+#include "epsClient.h"
+
+
+/**
+ * 궨
+ */
+
+#define TEST_PRODUCER_NUM_DEFAULT   4       /* Ĭ߳ */
+#define TEST_PRODUCER_NUM_MAX       64      /* ߳ */
+#define TEST_ITEM_NUM_DEFAULT       1000000 /* Ĭÿд */
+#define TEST_QUEUE_SIZE_DEFAULT     64      /* Ĭ϶дС */
+#define TEST_POP_BATCH              16      /* ߵȡ */
+#define TEST_HOLD_EVERY             64      /* ÿٸԤóCPUύ */
+#define TEST_START_POS              (0xFFFFFFFFU - 1000) /* λʱʼλ */
+
+
+/**
+ * Ͷ
+ */
+
+/*
+ * 
+ */
+typedef struct TestItemTag
+{
+    uint32  producer;                   /* ߱ */
+    uint32  seq;                        /* ţ1ʼ */
+    uint32  check;                      /* Уֵ */
+    char    padding[20];                /* ʹȲ8 */
+} TestItemT;
+
+
+/**
+ * ȫֱ
+ */
+
+static EpsRingQueueT g_queue;
+static uint32   g_itemNum = TEST_ITEM_NUM_DEFAULT;
+static uint32   g_startFlag = 0;            /* ߿ʼд */
+static uint64   g_fullCount = 0;            /* Ĵ */
+
+
+/**
+ * ʵ
+ */
+
+static void Usage()
+{
+    printf("Usage: epsRingQueueTest [producers] [items] [queueSize] [wrapIndex]\n\n" \
+           "producers: producer threads, default 4, at most 64\n" \
+           "items: items pushed by each producer, default 1000000\n" \
+           "queueSize: ring size (power of two), default 64\n" \
+           "wrapIndex: 1-start the indices just below the uint32 limit (default), 0-start from 0\n");
+}
+
+static uint32 CalcCheck(uint32 producer, uint32 seq)
+{
+    return (producer * 2654435761U) ^ (seq * 40503U) ^ 0x5A5A5A5AU;
+}
+
+/*
+ * նеλָλãλŰ״̬
+ */
+static void RebaseRingQueue(EpsRingQueueT* pQueue, uint32 startPos)
+{
+    uint32 i = 0;
+    for (i = 0; i < pQueue->size; i++)
+    {
+        pQueue->sequences[(startPos + i) & pQueue->mask] = startPos + i;
+    }
+    pQueue->header = startPos;
+    pQueue->tailer = startPos;
+}
+
+/*
+ * ߳: żPushRingQueueд룬Ԥλֱ䣬
+ * ʱԤύ֮óCPU
+ */
+static void* RunProducer(void* arg)
+{
+    uint32 producer = (uint32)(size_t)arg;
+    uint64 fullCount = 0;
+
+    while (! EpsAtomicLoad(&g_startFlag))
+    {
+        sched_yield();
+    }
+
+    uint32 seq = 0;
+    for (seq = 1; seq <= g_itemNum; seq++)
+    {
+        while (TRUE)
+        {
+            ResCodeT rc = NO_ERR;
+            if (seq % 2 == 0)
+            {
+                TestItemT item;
+                memset(&item, 0x00, sizeof(item));
+                item.producer = producer;
+                item.seq = seq;
+                item.check = CalcCheck(producer, seq);
+                rc = PushRingQueue(&g_queue, &item);
+            }
+            else
+            {
+                TestItemT* pSlot = NULL;
+                rc = ReserveRingQueue(&g_queue, (void**)&pSlot);
+                if (OK(rc))
+                {
+                    if (seq % TEST_HOLD_EVERY == 1)
+                    {
+                        /* ԤδύĲλԽòλύ */
+                        sched_yield();
+                    }
+                    pSlot->producer = producer;
+                    pSlot->seq = seq;
+                    pSlot->check = CalcCheck(producer, seq);
+                    CommitRingQueue(&g_queue, pSlot);
+                }
+            }
+
+            if (OK(rc))
+            {
+                break;
+            }
+            if (rc != ERCD_EPS_QUEUE_FULL)
+            {
+                printf("producer %u: push failed, Error: %s!!!\n", producer, ErrGetErrorDscr());
+                exit(1);
+            }
+            ErrClearError();
+            fullCount++;
+            sched_yield();
+        }
+    }
+
+    EpsAtomicFetchAdd(&g_fullCount, fullCount);
+    return NULL;
+}
+
+/*
+ * У¸ȡţǷЧ
+ */
+static BOOL CheckItem(const TestItemT* pItem, uint32 producerNum, uint32* lastSeqs)
+{
+    if (pItem->producer >= producerNum || pItem->check != CalcCheck(pItem->producer, pItem->seq))
+    {
+        return FALSE;
+    }
+    if (pItem->seq != lastSeqs[pItem->producer] + 1)
+    {
+        return FALSE;
+    }
+    lastSeqs[pItem->producer] = pItem->seq;
+    return TRUE;
+}
+
+int main(int argc, char *argv[])
+{
+    pthread_t tids[TEST_PRODUCER_NUM_MAX];
+    uint32 startedNum = 0;
+
+    TRY
+    {
+        uint32 producerNum = TEST_PRODUCER_NUM_DEFAULT;
+        uint32 queueSize = TEST_QUEUE_SIZE_DEFAULT;
+        BOOL isWrapIndex = TRUE;
+
+        setvbuf(stdout, NULL, _IONBF, 0); /* ñ׼Ϊлģʽ */
+
+        if (argc > 1 && (strcmp(argv[1], "-h") == 0 || strcmp(argv[1], "--help") == 0))
+        {
+            Usage();
+            exit(0);
+        }
+        if (argc > 1)
+        {
+            producerNum = (uint32)atoi(argv[1]);
+        }
+        if (argc > 2)
+        {
+            g_itemNum = (uint32)atoi(argv[2]);
+        }
+        if (argc > 3)
+        {
+            queueSize = (uint32)atoi(argv[3]);
+        }
+        if (argc > 4)
+        {
+            isWrapIndex = (atoi(argv[4]) != 0);
+        }
+        if (producerNum == 0 || producerNum > TEST_PRODUCER_NUM_MAX || g_itemNum == 0 ||
+            queueSize < 2 || (queueSize & (queueSize - 1)) != 0)
+        {
+            Usage();
+            exit(0);
+        }
+
+        memset(&g_queue, 0x00, sizeof(g_queue));
+        THROW_ERROR(InitRingQueue(&g_queue, EPS_RINGQUEUE_TYPE_MPSC, queueSize, sizeof(TestItemT)));
+        if (isWrapIndex)
+        {
+            RebaseRingQueue(&g_queue, TEST_START_POS);
+        }
+
+        printf("producers: %u, items per producer: %u, queue size: %u, item size: %u, start index: %u\n\n",
+            producerNum, g_itemNum, queueSize, (uint32)sizeof(TestItemT), g_queue.header);
+
+        for (startedNum = 0; startedNum < producerNum; startedNum++)
+        {
+            if (pthread_create(&tids[startedNum], NULL, RunProducer, (void*)(size_t)startedNum) != 0)
+            {
+                int lstErrno = SYS_ERRNO;
+                THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, EpsGetSystemError(lstErrno));
+            }
+        }
+
+        uint32 lastSeqs[TEST_PRODUCER_NUM_MAX];
+        memset(lastSeqs, 0x00, sizeof(lastSeqs));
+        TestItemT items[TEST_POP_BATCH];
+        uint64 total = (uint64)producerNum * g_itemNum;
+        uint64 popped = 0;
+        uint64 invalid = 0;
+        uint64 emptyCount = 0;
+        uint64 batchCount = 0;
+        uint64 beginTime = EpsGetTimestamp();
+
+        EpsAtomicStore(&g_startFlag, 1);
+
+        /* : ԸƷʽȡԭز鿴ͷ */
+        while (popped < total)
+        {
+            uint32 count = 0;
+            uint32 i = 0;
+            if (batchCount % 2 == 0)
+            {
+                count = PopRingQueue(&g_queue, items, TEST_POP_BATCH);
+                for (i = 0; i < count; i++)
+                {
+                    if (! CheckItem(&items[i], producerNum, lastSeqs))
+                    {
+                        invalid++;
+                    }
+                }
+            }
+            else
+            {
+                void* pFirst = NULL;
+                count = PeekRingQueue(&g_queue, TEST_POP_BATCH, &pFirst);
+                for (i = 0; i < count; i++)
+                {
+                    if (! CheckItem((TestItemT*)((char*)pFirst + (size_t)i * g_queue.slotSize),
+                            producerNum, lastSeqs))
+                    {
+                        invalid++;
+                    }
+                }
+                ReleaseRingQueue(&g_queue, count);
+            }
+
+            if (count == 0)
+            {
+                emptyCount++;
+                sched_yield();
+                continue;
+            }
+            popped += count;
+            batchCount++;
+        }
+        uint64 elapsed = EpsGetTimestamp() - beginTime;
+
+        while (startedNum > 0)
+        {
+            pthread_join(tids[--startedNum], NULL);
+        }
+
+        /* ȫȡӦΪգҸߵȫȡ */
+        void* pFirst = NULL;
+        uint32 leftover = PeekRingQueue(&g_queue, queueSize, &pFirst);
+        uint32 incomplete = 0;
+        uint32 producer = 0;
+        for (producer = 0; producer < producerNum; producer++)
+        {
+            if (lastSeqs[producer] != g_itemNum)
+            {
+                printf("producer %u: last seq %u, expected %u\n", producer, lastSeqs[producer], g_itemNum);
+                incomplete++;
+            }
+        }
+
+        printf("popped: %llu/%llu, invalid: %llu, incomplete producers: %u, leftover: %u, "
+            "end index: %u\n", (unsigned long long)popped, (unsigned long long)total,
+            (unsigned long long)invalid, incomplete, leftover, g_queue.tailer);
+        printf("elapsed(ms): %.1f, batches: %llu, consumer empty polls: %llu, producer full retries: %llu\n\n",
+            elapsed / 1000000.0, (unsigned long long)batchCount, (unsigned long long)emptyCount,
+            (unsigned long long)g_fullCount);
+
+        UninitRingQueue(&g_queue);
+
+        if (popped != total || invalid > 0 || incomplete > 0 || leftover > 0)
+        {
+            printf(">>> ring queue test FAILED\n");
+            THROW_RESCODE(ERCD_EPS_INVALID_OPERATION);
+        }
+        printf(">>> ring queue test PASSED\n");
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        EpsAtomicStore(&g_startFlag, 1);
+        while (startedNum > 0)
+        {
+            pthread_join(tids[--startedNum], NULL);
+        }
+        return (OK(GET_RESCODE()) ? 0 : 1);
+    }
+}
@@ -44,7 +44,10 @@ DD-MMM-YYYY INIT.    SIR    Modification Description
 
 static void Usage()
 {
-    printf("Usage: epsSimple <mcAddr:mcPort;localAddr>\n\n" \
+    printf("Usage: epsSimple <mcAddr:mcPort;localAddr> [xdpMode] [reorderWindow] [recoveryAddr]\n\n" \
+           "xdpMode: 0-none 1-auto 2-native 3-generic\n" \
+           "reorderWindow: 0-64, 0 disables reordering\n" \
+           "recoveryAddr: tcp snapshot server ip:port, recovers every gap\n\n" \
            "example:\n" \
            "epsSimple \"230.11.1.1:3300;196.123.71.3\"\n");
 }
@@ -62,11 +65,26 @@ static void OnEpsDisconnectedTest(uint32 hid, ResCodeT result, const char* reaso
 static void OnEpsMktDataArrivedTest(uint32 hid, const EpsMktDataT* pMktData)
 {
 #if defined (__LINUX__) || defined (__HPUX__)
-    printf("==> OnMktDataArrived(), hid: %d, applID: %d, applSeqNum: %lld\n", hid, pMktData->applID, pMktData->applSeqNum);
+    printf("==> OnMktDataArrived(), hid: %d, applID: %d, applSeqNum: %lld, latency(ns): %lld\n", hid, pMktData->applID, pMktData->applSeqNum,
+        pMktData->notifyTime - pMktData->recvTime);
 #endif
 
 #if defined (__WINDOWS__)
-    printf("==> OnMktDataArrived(), hid: %d, applID: %d, applSeqNum: %I64d\n", hid, pMktData->applID, pMktData->applSeqNum);
+    printf("==> OnMktDataArrived(), hid: %d, applID: %d, applSeqNum: %I64d, latency(ns): %I64d\n", hid, pMktData->applID, pMktData->applSeqNum,
+        pMktData->notifyTime - pMktData->recvTime);
+#endif
+}
+
+static void OnEpsMktDataGapTest(uint32 hid, const EpsMktGapT* pMktGap)
+{
+#if defined (__LINUX__) || defined (__HPUX__)
+    printf("==> OnMktDataGap(), hid: %d, mktType: %d, applID: %d, beginSeqNum: %lld, endSeqNum: %lld\n", 
+        hid, pMktGap->mktType, pMktGap->applID, pMktGap->beginSeqNum, pMktGap->endSeqNum);
+#endif
+
+#if defined (__WINDOWS__)
+    printf("==> OnMktDataGap(), hid: %d, mktType: %d, applID: %d, beginSeqNum: %I64d, endSeqNum: %I64d\n", 
+        hid, pMktGap->mktType, pMktGap->applID, pMktGap->beginSeqNum, pMktGap->endSeqNum);
 #endif
 }
 
@@ -141,6 +159,7 @@ int main(int argc, char *argv[])
             OnEpsMktDataArrivedTest,
             OnEpsMktStatusChangedTest,
             OnEpsEventOccurredTest,
+            OnEpsMktDataGapTest,
         };
  
         rc = EpsRegisterSpi(hid, &spi);
@@ -154,6 +173,51 @@ int main(int argc, char *argv[])
             THROW_RESCODE(rc);
         }
 
+        if (argc > 2)
+        {
+            printf("==> call EpsSetOption() ... ");
+            rc = EpsSetOption(hid, EPS_OPTION_UDP_XDP_MODE, atoi(argv[2]));
+            if (OK(rc))
+            {
+                printf("OK. xdpMode: %s\n", argv[2]);
+            }
+            else
+            {
+                printf("failed, Error: %s!!!\n", EpsGetLastError());
+                THROW_RESCODE(rc);
+            }
+        }
+
+        if (argc > 3)
+        {
+            printf("==> call EpsSetOption() ... ");
+            rc = EpsSetOption(hid, EPS_OPTION_UDP_REORDER_WINDOW, atoi(argv[3]));
+            if (OK(rc))
+            {
+                printf("OK. reorderWindow: %s\n", argv[3]);
+            }
+            else
+            {
+                printf("failed, Error: %s!!!\n", EpsGetLastError());
+                THROW_RESCODE(rc);
+            }
+        }
+
+        if (argc > 4)
+        {
+            printf("==> call EpsSetRecovery() ... ");
+            rc = EpsSetRecovery(hid, argv[4], "username", "password", 1);
+            if (OK(rc))
+            {
+                printf("OK. recoveryAddr: %s\n", argv[4]);
+            }
+            else
+            {
+                printf("failed, Error: %s!!!\n", EpsGetLastError());
+                THROW_RESCODE(rc);
+            }
+        }
+
         printf("==> call EpsConnect() ... ");
         rc = EpsConnect(hid, argv[1]);
         if (OK(rc))
@@ -188,6 +252,65 @@ int main(int argc, char *argv[])
             }
         }
 
+        printf("==> call EpsGetStatistics() ... ");
+        EpsStatisticsT stat;
+        rc = EpsGetStatistics(hid, &stat);
+        if (OK(rc))
+        {
+#if defined (__LINUX__) || defined (__HPUX__)
+            printf("OK. recvCalls: %lld, recvPackets: %lld, recvBytes: %lld, maxBatchSize: %u, xdpPackets: %lld\n", 
+                stat.recvCalls, stat.recvPackets, stat.recvBytes, stat.maxBatchSize, stat.xdpPackets);
+            printf("    gapCount: %lld, gapSeqNums: %lld, gapFilledSeqNums: %lld, reorderedPackets: %lld\n", 
+                stat.gapCount, stat.gapSeqNums, stat.gapFilledSeqNums, stat.reorderedPackets);
+            printf("    recoveryCount: %lld, recoveredSeqNums: %lld, unrecoveredSeqNums: %lld\n", 
+                stat.recoveryCount, stat.recoveredSeqNums, stat.unrecoveredSeqNums);
+#endif
+
+#if defined (__WINDOWS__)
+            printf("OK. recvCalls: %I64d, recvPackets: %I64d, recvBytes: %I64d, maxBatchSize: %u, xdpPackets: %I64d\n", 
+                stat.recvCalls, stat.recvPackets, stat.recvBytes, stat.maxBatchSize, stat.xdpPackets);
+            printf("    gapCount: %I64d, gapSeqNums: %I64d, gapFilledSeqNums: %I64d, reorderedPackets: %I64d\n", 
+                stat.gapCount, stat.gapSeqNums, stat.gapFilledSeqNums, stat.reorderedPackets);
+            printf("    recoveryCount: %I64d, recoveredSeqNums: %I64d, unrecoveredSeqNums: %I64d\n", 
+                stat.recoveryCount, stat.recoveredSeqNums, stat.unrecoveredSeqNums);
+#endif
+        }
+        else
+        {
+            printf("failed, Error: %s!!!\n", EpsGetLastError());
+        }
+
+        printf("==> call EpsGetLineStatistics() ... ");
+        EpsLineStatT lineStats[EPS_LINE_MAX_NUM];
+        uint32 lineCount = EPS_LINE_MAX_NUM;
+        rc = EpsGetLineStatistics(hid, lineStats, &lineCount);
+        if (OK(rc))
+        {
+            printf("OK. lineCount: %u\n", lineCount);
+            uint32 i = 0;
+            for (i = 0; i < lineCount && lineCount > 1; i++)
+            {
+                EpsLineStatT* pLineStat = &lineStats[i];
+#if defined (__LINUX__) || defined (__HPUX__)
+                printf("    line %u: recvPackets: %lld, winPackets: %lld, dupPackets: %lld, lostSeqNums: %lld, "
+                    "totalLeadTime: %lld, totalLagTime: %lld, maxLagTime: %lld\n", i,
+                    pLineStat->recvPackets, pLineStat->winPackets, pLineStat->dupPackets, pLineStat->lostSeqNums,
+                    pLineStat->totalLeadTime, pLineStat->totalLagTime, pLineStat->maxLagTime);
+#endif
+
+#if defined (__WINDOWS__)
+                printf("    line %u: recvPackets: %I64d, winPackets: %I64d, dupPackets: %I64d, lostSeqNums: %I64d, "
+                    "totalLeadTime: %I64d, totalLagTime: %I64d, maxLagTime: %I64d\n", i,
+                    pLineStat->recvPackets, pLineStat->winPackets, pLineStat->dupPackets, pLineStat->lostSeqNums,
+                    pLineStat->totalLeadTime, pLineStat->totalLagTime, pLineStat->maxLagTime);
+#endif
+            }
+        }
+        else
+        {
+            printf("failed, Error: %s!!!\n", EpsGetLastError());
+        }
+
         printf("==> call EpsDisconnect() ... ");
         rc = EpsDisconnect(hid);
         if (OK(rc))
@@ -28,10 +28,14 @@ DD-MMM-YYYY INIT.    SIR    Modification Description
  * ͷļ
  */
 
+#if defined(__LINUX__) || defined(__linux__)
+#define _GNU_SOURCE                     /* recvmmsg */
+#endif
 
 #include "common.h"
 #include "epsTypes.h"
 #include "errlib.h"
+#include "atomic.h"
 
 #include "udpChannel.h"
 
@@ -39,7 +43,15 @@ DD-MMM-YYYY INIT.    SIR    Modification Description
  * 궨
  */
 
-#define EPS_EVENTQUEUE_SIZE                      128
+#define EPS_EVENTQUEUE_SIZE                      128    /* ¼гȣΪ2 */
+#define EPS_RECV_BATCH_MAX_ROUNDS                4      /* νմ */
+
+#if defined(EPS_IOENGINE_URING)
+#define EPS_URING_ENTRIES                        8      /* io_uringύг */
+#define EPS_URING_BUFGROUP                       0      /* ջID */
+#define EPS_URING_USERDATA_TIMEOUT               0      /* ճʱʶ */
+#define EPS_URING_USERDATA_RECV                  1      /* νʶ(·) */
+#endif
 
 
 /**
@@ -48,8 +60,16 @@ DD-MMM-YYYY INIT.    SIR    Modification Description
 
 static void* ChannelTask(void* arg);
 
+static ResCodeT OpenUdpLine(EpsUdpLineT* pLine);
+static void CloseUdpLine(EpsUdpLineT* pLine);
 static ResCodeT HandleEvent(EpsUdpChannelT* pChannel);
-static ResCodeT ReceiveData(EpsUdpChannelT* pChannel);
+static ResCodeT ReceiveData(EpsUdpChannelT* pChannel, uint64 timeout);
+#if ! defined(EPS_IOENGINE_URING)
+static ResCodeT ReceiveBatch(EpsUdpChannelT* pChannel, uint32 lineIndex, uint32* pPacketCount);
+#if defined(__LINUX__)
+static ResCodeT ReceiveXdp(EpsUdpChannelT* pChannel);
+#endif
+#endif
 static ResCodeT ClearEventQueue(EpsUdpChannelT* pChannel);
 
 static BOOL IsChannelInited(EpsUdpChannelT * pChannel);
@@ -58,7 +78,7 @@ static BOOL IsChannelConnected(EpsUdpChannelT * pChannel);
 
 static void OnChannelConnected(void* pListener);
 static void OnChannelDisconnected(void* pListener, ResCodeT result, const char* reason);
-static void OnChannelReceived(void* pListener, ResCodeT result, const char* data, uint32 dataLen);
+static void OnChannelReceived(void* pListener, ResCodeT result, const EpsUdpPacketT* pPackets, uint32 packetCount);
 static void OnChannelEventOccurred(void* pListener, EpsUdpChannelEventT* pEvent);
 
 
@@ -82,11 +102,31 @@ ResCodeT InitUdpChannel(EpsUdpChannelT* pChannel)
             THROW_ERROR(ERCD_EPS_DUPLICATE_INITED, "channel");
         }
 
-        pChannel->socket = INVALID_SOCKET;
+        uint32 i = 0;
+        for (i = 0; i < EPS_UDP_LINE_MAX_NUM; i++)
+        {
+            pChannel->lines[i].socket = INVALID_SOCKET;
+        }
+        pChannel->lineCount = 0;
         pChannel->tid = 0;
-        pChannel->canStop = TRUE;
-        pChannel->status  = EPS_UDPCHANNEL_STATUS_STOP;
-        InitUniQueue(&pChannel->eventQueue, EPS_EVENTQUEUE_SIZE);
+        EpsAtomicStore(&pChannel->canStop, TRUE);
+        EpsAtomicStore(&pChannel->status, EPS_UDPCHANNEL_STATUS_STOP);
+        memset(&pChannel->stat, 0x00, sizeof(pChannel->stat));
+#if defined(EPS_IOENGINE_URING)
+        memset(&pChannel->ring, 0x00, sizeof(pChannel->ring));
+        pChannel->ring.ringFd = -1;
+#endif
+        pChannel->xdpMode = EPS_UDP_XDP_MODE_NONE;
+        pChannel->xdpQueueId = 0;
+#if defined(__LINUX__)
+        InitUdpXdp(&pChannel->xdp);
+#endif
+        pChannel->isManual = FALSE;
+        pChannel->pollFd = -1;
+        pChannel->reconnectTime = 0;
+        pChannel->notifyTime = 0;
+        THROW_ERROR(InitRingQueue(&pChannel->eventQueue, EPS_RINGQUEUE_TYPE_MPSC,
+                EPS_EVENTQUEUE_SIZE, sizeof(EpsUdpChannelEventT)));
  
         EpsUdpChannelListenerT listener =
         {
@@ -124,7 +164,7 @@ ResCodeT UninitUdpChannel(EpsUdpChannelT* pChannel)
         } 
 
         CloseUdpChannel(pChannel);
-        UninitUniQueue(&pChannel->eventQueue);
+        UninitRingQueue(&pChannel->eventQueue);
     }
     CATCH
     {
@@ -148,9 +188,9 @@ ResCodeT StartupUdpChannel(EpsUdpChannelT* pChannel)
     {
         if (IsChannelStarted(pChannel))
         {
-            if (pChannel->status == EPS_UDPCHANNEL_STATUS_IDLE)
+            if (EpsAtomicLoad(&pChannel->status) == EPS_UDPCHANNEL_STATUS_IDLE)
             {
-                pChannel->status = EPS_UDPCHANNEL_STATUS_WORK;
+                EpsAtomicStore(&pChannel->status, EPS_UDPCHANNEL_STATUS_WORK);
                 THROW_RESCODE(NO_ERR);
             }
             else
@@ -159,8 +199,16 @@ ResCodeT StartupUdpChannel(EpsUdpChannelT* pChannel)
             }
         }
        
-        pChannel->canStop = FALSE;
-        pChannel->status = EPS_UDPCHANNEL_STATUS_WORK;
+        pChannel->reconnectTime = 0;
+        pChannel->notifyTime = EpsGetTimestamp();
+        EpsAtomicStore(&pChannel->canStop, FALSE);
+        EpsAtomicStore(&pChannel->status, EPS_UDPCHANNEL_STATUS_WORK);
+
+        /* Ӧ߳ģʽӦ̵߳PollUdpChannelͨ߳ */
+        if (pChannel->isManual)
+        {
+            THROW_RESCODE(NO_ERR);
+        }
         
 #if defined(__WINDOWS__)
         DWORD tid = 0;
@@ -168,7 +216,7 @@ ResCodeT StartupUdpChannel(EpsUdpChannelT* pChannel)
             (LPVOID)pChannel, 0, (LPDWORD)&tid);
         if (tid == 0)
         {
-        	pChannel->status = EPS_UDPCHANNEL_STATUS_STOP;
+        	EpsAtomicStore(&pChannel->status, EPS_UDPCHANNEL_STATUS_STOP);
             int lstErrno = SYS_ERRNO;
         	THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, EpsGetSystemError(lstErrno));
         }
@@ -181,7 +229,7 @@ ResCodeT StartupUdpChannel(EpsUdpChannelT* pChannel)
         int result = pthread_create(&tid, NULL, ChannelTask, (void*)pChannel);
         if (result != 0)
         {
-        	pChannel->status = EPS_UDPCHANNEL_STATUS_STOP;
+        	EpsAtomicStore(&pChannel->status, EPS_UDPCHANNEL_STATUS_STOP);
             THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, EpsGetSystemError(SYS_ERRNO));
         }
         pChannel->tid = tid;
@@ -212,6 +260,16 @@ ResCodeT ShutdownUdpChannel(EpsUdpChannelT* pChannel)
             THROW_RESCODE(NO_ERR);
         }
 
+        /* Ӧ߳ģʽɵֱ߳ӹرգȷʱûִ߳PollUdpChannel */
+        if (pChannel->isManual && pChannel->tid == 0)
+        {
+            CloseUdpChannel(pChannel);
+
+            EpsAtomicStore(&pChannel->canStop, TRUE);
+            EpsAtomicStore(&pChannel->status, EPS_UDPCHANNEL_STATUS_STOP);
+            THROW_RESCODE(NO_ERR);
+        }
+
 #if defined(__WINDOWS__)
         if (pChannel->tid != GetCurrentThreadId())
 #endif
@@ -220,16 +278,16 @@ ResCodeT ShutdownUdpChannel(EpsUdpChannelT* pChannel)
         if (pChannel->tid != pthread_self())
 #endif
         {
-             pChannel->canStop = TRUE;
+             EpsAtomicStore(&pChannel->canStop, TRUE);
         }
         else
         {
-            if (pChannel->status == EPS_UDPCHANNEL_STATUS_WORK)
+            if (EpsAtomicLoad(&pChannel->status) == EPS_UDPCHANNEL_STATUS_WORK)
             {
                 CloseUdpChannel(pChannel);
             }
 
-            pChannel->status = EPS_UDPCHANNEL_STATUS_IDLE;
+            EpsAtomicStore(&pChannel->status, EPS_UDPCHANNEL_STATUS_IDLE);
         }
     }
     CATCH
@@ -292,6 +350,8 @@ ResCodeT ShutdownUdpChannel(EpsUdpChannelT* pChannel)
 /*
  * UDPͨ첽¼
  *
+ * ¼ֱд¼Уʱδ¼ERCD_EPS_QUEUE_FULLɵߴ
+ *
  * @param   pChannel            in  - UDPͨ
  * @param   event               in  - ¼
  *
@@ -306,15 +366,7 @@ ResCodeT TriggerUdpChannelEvent(EpsUdpChannelT* pChannel, const EpsUdpChannelEve
             THROW_ERROR(ERCD_EPS_UNINITED, "channel");
         }
 
-        EpsUdpChannelEventT* pEvent = (EpsUdpChannelEventT*)calloc(1, sizeof(EpsUdpChannelEventT));
-        if (pEvent == NULL)
-        {
-            int lstErrno = SYS_ERRNO;
-            THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, EpsGetSystemError(lstErrno));
-        }
-        *pEvent = event;
-
-        THROW_ERROR(PushUniQueue(&pChannel->eventQueue, (void*)pEvent));
+        THROW_ERROR(PushRingQueue(&pChannel->eventQueue, &event));
     }
     CATCH
     {
@@ -380,36 +432,80 @@ static void* ChannelTask(void* arg)
 {
     EpsUdpChannelT* pChannel = (EpsUdpChannelT*)arg;
 
-    while (! pChannel->canStop)
+    while (! EpsAtomicLoad(&pChannel->canStop))
     {
-        if (pChannel->status == EPS_UDPCHANNEL_STATUS_IDLE)
+        if (EpsAtomicLoad(&pChannel->status) == EPS_UDPCHANNEL_STATUS_IDLE)
         {
             usleep(EPS_CHANNEL_IDLE_INTL * 1000);
             continue;
         }
 
+        if (NOTOK(PollUdpChannel(pChannel, (uint64)EPS_SOCKET_RECV_TIMEOUT * 1000000)))
+        {
+            ErrClearError();
+        }
+    }
+    
+    CloseUdpChannel(pChannel);
+
+    EpsAtomicStore(&pChannel->status, EPS_UDPCHANNEL_STATUS_STOP);
+    
+    return 0;
+}
+
+/**
+ * ִһUDPͨĴ򿪡¼
+ *
+ * ͨ߳ѭñӦ߳ģʽӦ̵߳ã
+ * ʱڵ߳н벢صδ´ʱʱȴtimeout󷵻أ
+ * ճʱ֪ͨ԰EPS_SOCKET_RECV_TIMEOUTڷtimeout޹
+ *
+ * @param   pChannel            in  - UDPͨ
+ * @param   timeout             in  - ȴݵʱ()0ʾȴ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT PollUdpChannel(EpsUdpChannelT* pChannel, uint64 timeout)
+{
+    TRY
+    {
         /* UDPͨ */
         if (! IsChannelConnected(pChannel))
         {
-            if (NOTOK(OpenUdpChannel(pChannel)))
+            uint64 now = EpsGetTimestamp();
+            if (now < pChannel->reconnectTime)
             {
-                pChannel->listener.disconnectedNotify(pChannel->listener.pListener,
-                    ErrGetErrorCode(), ErrGetErrorDscr());
-
-                ErrClearError();
-
+                uint64 waitTime = pChannel->reconnectTime - now;
+                if (waitTime > timeout)
+                {
+                    waitTime = timeout;
+                }
+                if (waitTime > 0)
+                {
 #if defined(__WINDOWS__)
-                Sleep(EPS_CHANNEL_RECONNECT_INTL);
+                    Sleep((DWORD)(waitTime / 1000000));
 #endif
 
 #if defined(__LINUX__) || defined(__HPUX__) 
-                usleep(EPS_CHANNEL_RECONNECT_INTL * 1000);
+                    usleep((useconds_t)(waitTime / 1000));
 #endif
+                }
+                THROW_RESCODE(NO_ERR);
+            }
 
-                continue;
+            if (NOTOK(OpenUdpChannel(pChannel)))
+            {
+                pChannel->listener.disconnectedNotify(pChannel->listener.pListener,
+                    ErrGetErrorCode(), ErrGetErrorDscr());
+
+                ErrClearError();
+
+                pChannel->reconnectTime = EpsGetTimestamp() + (uint64)EPS_CHANNEL_RECONNECT_INTL * 1000000;
+                THROW_RESCODE(NO_ERR);
             }
             else
             {
+                pChannel->notifyTime = EpsGetTimestamp();
                 pChannel->listener.connectedNotify(pChannel->listener.pListener);
             }
         }
@@ -418,34 +514,179 @@ static void* ChannelTask(void* arg)
         if (NOTOK(HandleEvent(pChannel)))
         {
             ErrClearError();
-         
-            continue;
+            THROW_RESCODE(NO_ERR);
         }
 
-        /*  */
-        if (NOTOK(ReceiveData(pChannel)))
+        /* ݣʧʱͨѹرգ´εʱ´ */
+        if (NOTOK(ReceiveData(pChannel, timeout)))
         {
             ErrClearError();
-         
-            continue;
         }
     }
-    
-    CloseUdpChannel(pChannel);
-
-    pChannel->status = EPS_UDPCHANNEL_STATUS_STOP;
-    
-    return 0;
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
 }
 
 /**
  * UDPͨ
  *
+ * δ򿪸鲥·һ·ʧʱرȫ·
+ *
  * @param   pChannel            in  - UDPͨ
  *
  * @return  ɹNO_ERR򷵻ش
  */
 ResCodeT OpenUdpChannel(EpsUdpChannelT* pChannel)
+{
+    TRY
+    {
+        if (pChannel->lineCount == 0)
+        {
+            THROW_ERROR(ERCD_EPS_INVALID_ADDRESS);
+        }
+
+        uint32 i = 0;
+        for (i = 0; i < pChannel->lineCount; i++)
+        {
+            THROW_ERROR(OpenUdpLine(&pChannel->lines[i]));
+        }
+
+        /* AF_XDPʱͨ׽Աά鲥ԱϵXDPеı */
+        EpsUdpXdpModeT xdpMode = EpsAtomicLoadRelaxed(&pChannel->xdpMode);
+        if (xdpMode != EPS_UDP_XDP_MODE_NONE)
+        {
+#if defined(__LINUX__) && ! defined(EPS_IOENGINE_URING)
+            if (pChannel->lineCount > 1)
+            {
+                THROW_ERROR(ERCD_EPS_UNSUPPORTED_OPTION, "AF_XDP with multiple lines");
+            }
+
+            EpsUdpLineT* pLine = &pChannel->lines[0];
+            THROW_ERROR(OpenUdpXdp(&pChannel->xdp, xdpMode, EpsAtomicLoadRelaxed(&pChannel->xdpQueueId),
+                    pLine->localAddr, pLine->mcAddr, pLine->mcPort));
+#else
+            THROW_ERROR(ERCD_EPS_UNSUPPORTED_OPTION, "AF_XDP");
+#endif
+        }
+
+#if defined(__LINUX__)
+        if (pChannel->pollFd >= 0)
+        {
+            for (i = 0; i < pChannel->lineCount; i++)
+            {
+                if (EpsAddPollSocket(pChannel->pollFd, pChannel->lines[i].socket) == SOCKET_ERROR)
+                {
+                    int lstErrno = SYS_ERRNO;
+                    THROW_ERROR(ERCD_EPS_SOCKET_ERROR, EpsGetSystemError(lstErrno));
+                }
+            }
+            if (IsUdpXdpOpened(&pChannel->xdp) && 
+                EpsAddPollSocket(pChannel->pollFd, pChannel->xdp.xsk) == SOCKET_ERROR)
+            {
+                int lstErrno = SYS_ERRNO;
+                THROW_ERROR(ERCD_EPS_SOCKET_ERROR, EpsGetSystemError(lstErrno));
+            }
+        }
+#endif
+
+#if defined(EPS_IOENGINE_URING)
+        THROW_ERROR(InitIoUring(&pChannel->ring, EPS_URING_ENTRIES));
+
+        ResCodeT rc = RegisterIoUringBufRing(&pChannel->ring, EPS_URING_BUFGROUP, 
+                pChannel->recvBuffer, EPS_UDP_DATAGRAM_MAX_LEN, EPS_UDP_RECV_BATCH_SIZE);
+        if (NOTOK(rc))
+        {
+            UninitIoUring(&pChannel->ring);
+            THROW_ERROR(rc);
+        }
+
+        for (i = 0; i < pChannel->lineCount; i++)
+        {
+            pChannel->lines[i].isRecvArmed = FALSE;
+        }
+        pChannel->isTimeoutArmed = FALSE;
+#endif
+
+        /* ǰ¼(Ӻ)򿪺 */
+    }
+    CATCH
+    {
+#if defined(__LINUX__)
+        if (IsUdpXdpOpened(&pChannel->xdp))
+        {
+            CloseUdpXdp(&pChannel->xdp);
+        }
+#endif
+
+        uint32 i = 0;
+        for (i = 0; i < pChannel->lineCount; i++)
+        {
+            CloseUdpLine(&pChannel->lines[i]);
+        }
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;      
+    }
+}
+
+
+/**
+ * رUDPͨ
+ *
+ * @param   pChannel            in  - UDPͨ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT CloseUdpChannel(EpsUdpChannelT* pChannel)
+{
+    TRY
+    {
+        if (IsChannelConnected(pChannel))
+        {
+#if defined(EPS_IOENGINE_URING)
+            UninitIoUring(&pChannel->ring);
+#endif
+
+#if defined(__LINUX__)
+            if (IsUdpXdpOpened(&pChannel->xdp))
+            {
+                CloseUdpXdp(&pChannel->xdp);
+            }
+#endif
+
+            uint32 i = 0;
+            for (i = 0; i < pChannel->lineCount; i++)
+            {
+                CloseUdpLine(&pChannel->lines[i]);
+            }
+        }
+
+        ClearEventQueue(pChannel);
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+
+/**
+ * 鲥·
+ *
+ * @param   pLine               in  - 鲥·
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+static ResCodeT OpenUdpLine(EpsUdpLineT* pLine)
 {
     SOCKET fd = INVALID_SOCKET;
 
@@ -472,8 +713,13 @@ ResCodeT OpenUdpChannel(EpsUdpChannelT* pChannel)
         memset(&mcAddr, 0x00, sizeof(mcAddr));
             
         mcAddr.sin_family      = AF_INET;
+#if defined(__LINUX__)
+        /* 鲥ַͬ˿ڵĶ·׽յ˴˵ݱ */
+        mcAddr.sin_addr.s_addr = inet_addr(pLine->mcAddr);
+#else
         mcAddr.sin_addr.s_addr = htonl(INADDR_ANY);
-        mcAddr.sin_port        = htons(pChannel->mcPort);
+#endif
+        mcAddr.sin_port        = htons(pLine->mcPort);
 
         result = bind(fd, (struct sockaddr*)&mcAddr, sizeof(mcAddr));
         if (result == SOCKET_ERROR)
@@ -490,11 +736,20 @@ ResCodeT OpenUdpChannel(EpsUdpChannelT* pChannel)
             int lstErrno = NET_ERRNO;
             THROW_ERROR(ERCD_EPS_SOCKET_ERROR, EpsGetSystemError(lstErrno));
         }   
+
+#if defined(__LINUX__)
+        result = EpsEnableRecvTimestamp(fd);
+        if (result == SOCKET_ERROR)
+        {
+            int lstErrno = NET_ERRNO;
+            THROW_ERROR(ERCD_EPS_SOCKET_ERROR, EpsGetSystemError(lstErrno));
+        }
+#endif
  
         struct ip_mreq mreq;
         memset(&mreq, 0x00, sizeof(mreq));
-        mreq.imr_multiaddr.s_addr = inet_addr(pChannel->mcAddr);
-        mreq.imr_interface.s_addr = inet_addr(pChannel->localAddr);
+        mreq.imr_multiaddr.s_addr = inet_addr(pLine->mcAddr);
+        mreq.imr_interface.s_addr = inet_addr(pLine->localAddr);
         result = setsockopt(fd, IPPROTO_IP, IP_ADD_MEMBERSHIP, (const char*)&mreq, sizeof(mreq));
         if (result == SOCKET_ERROR)
         {
@@ -517,9 +772,7 @@ ResCodeT OpenUdpChannel(EpsUdpChannelT* pChannel)
             THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, EpsGetSystemError(lstErrno));
         }
 
-        pChannel->socket = fd;
-
-        ClearEventQueue(pChannel);
+        pLine->socket = fd;
     }
     CATCH
     {
@@ -542,34 +795,47 @@ ResCodeT OpenUdpChannel(EpsUdpChannelT* pChannel)
     }
 }
 
-
 /**
- * رUDPͨ
+ * ر鲥·
  *
- * @param   pChannel            in  - UDPͨ
- *
- * @return  ɹNO_ERR򷵻ش
+ * @param   pLine               in  - 鲥·
  */
-ResCodeT CloseUdpChannel(EpsUdpChannelT* pChannel)
+static void CloseUdpLine(EpsUdpLineT* pLine)
 {
-    TRY
+    if (pLine->socket != INVALID_SOCKET)
     {
-       if (pChannel->socket != INVALID_SOCKET)
-        {
-        	shutdown(pChannel->socket, SHUT_RDWR);
+        shutdown(pLine->socket, SHUT_RDWR);
 
 #if defined(__WINDOWS__)
-        	closesocket(pChannel->socket);
+        closesocket(pLine->socket);
 #endif
 
 #if defined(__LINUX__) || defined(__HPUX__) 
-            close(pChannel->socket);
+        close(pLine->socket);
 #endif
-   
-        	pChannel->socket = INVALID_SOCKET;
-        }
 
-        ClearEventQueue(pChannel);
+        pLine->socket = INVALID_SOCKET;
+    }
+}
+
+
+/**
+ * ͨ¼
+ *
+ * @param   pChannel            in  - UDPͨ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+static ResCodeT HandleEvent(EpsUdpChannelT* pChannel)
+{
+    TRY
+    {
+        /* ¼ƳӺ֪ͨڼ䴥¼ʹͷŵĲλ */
+        EpsUdpChannelEventT event;
+        if (PopRingQueue(&pChannel->eventQueue, &event, 1) > 0)
+        {
+            pChannel->listener.eventOccurredNotify(pChannel->listener.pListener, &event);
+        }
     }
     CATCH
     {
@@ -580,29 +846,139 @@ ResCodeT CloseUdpChannel(EpsUdpChannelT* pChannel)
     }
 }
 
+#if defined(EPS_IOENGINE_URING)
 
 /**
- * ͨ¼
+ * ͨ(io_uring)
+ *
+ * νݱֱдṩеĽջƬ
+ * ʱյ¼ʱɣճʱ֪ͨ
  *
  * @param   pChannel            in  - UDPͨ
+ * @param   timeout             in  - ճʱ()ʱύʱЧ
  *
  * @return  ɹNO_ERR򷵻ش
  */
-static ResCodeT HandleEvent(EpsUdpChannelT* pChannel)
+static ResCodeT ReceiveData(EpsUdpChannelT* pChannel, uint64 timeout)
 {
     TRY
     {
-        EpsUdpChannelEventT* pEvent = NULL;
-        THROW_ERROR(PopUniQueue(&pChannel->eventQueue, (void**)&pEvent));
-      
-        if (pEvent != NULL)
+        EpsIoUringT* pRing = &pChannel->ring;
+        uint32 i = 0;
+
+        for (i = 0; i < pChannel->lineCount; i++)
+        {
+            EpsUdpLineT* pLine = &pChannel->lines[i];
+            if (! pLine->isRecvArmed)
+            {
+                THROW_ERROR(PrepIoUringRecvMultishot(pRing, pLine->socket, EPS_URING_USERDATA_RECV + i));
+                pLine->isRecvArmed = TRUE;
+            }
+        }
+
+        if (! pChannel->isTimeoutArmed)
+        {
+            THROW_ERROR(PrepIoUringTimeout(pRing, (uint32)(timeout / 1000000), 1, EPS_URING_USERDATA_TIMEOUT));
+            pChannel->isTimeoutArmed = TRUE;
+        }
+
+        THROW_ERROR(SubmitIoUring(pRing, 1));
+        EpsAtomicCounterAdd(&pChannel->stat.recvCalls, 1);
+
+        uint16 bufIds[EPS_UDP_RECV_BATCH_SIZE];
+        uint64 recvTime = EpsGetTimestamp();
+        uint32 packetCount = 0;
+        uint32 recvBytes = 0;
+        BOOL isTimeout = FALSE;
+        
+        struct io_uring_cqe* cqe = NULL;
+        while (packetCount < EPS_UDP_RECV_BATCH_SIZE && (cqe = PeekIoUringCqe(pRing)) != NULL)
+        {
+            uint64 userData = cqe->user_data;
+            int32 res = cqe->res;
+            uint32 flags = cqe->flags;
+            AdvanceIoUringCq(pRing);
+
+            if (userData == EPS_URING_USERDATA_TIMEOUT)
+            {
+                pChannel->isTimeoutArmed = FALSE;
+                if (res == -ETIME)
+                {
+                    isTimeout = TRUE;
+                }
+                continue;
+            }
+
+            uint32 lineIndex = (uint32)(userData - EPS_URING_USERDATA_RECV);
+            if (lineIndex >= pChannel->lineCount)
+            {
+                continue;
+            }
+
+            if (! (flags & IORING_CQE_F_MORE))
+            {
+                pChannel->lines[lineIndex].isRecvArmed = FALSE;
+            }
+
+            if (res < 0)
+            {
+                /* ľʱνֹ黹ύ */
+                if (res == -ENOBUFS)
+                {
+                    continue;
+                }
+                THROW_ERROR(ERCD_EPS_SOCKET_ERROR, EpsGetSystemError(-res));
+            }
+
+            if (flags & IORING_CQE_F_BUFFER)
+            {
+                uint16 bufId = (uint16)(flags >> IORING_CQE_BUFFER_SHIFT);
+                if (res == 0)
+                {
+                    RecycleIoUringBuf(pRing, bufId);
+                    continue;
+                }
+
+                bufIds[packetCount] = bufId;
+                pChannel->recvPackets[packetCount].data = GetIoUringBuf(pRing, bufId);
+                pChannel->recvPackets[packetCount].dataLen = (uint32)res;
+                pChannel->recvPackets[packetCount].recvTime = recvTime;
+                pChannel->recvPackets[packetCount].lineIndex = lineIndex;
+                recvBytes += (uint32)res;
+                packetCount++;
+            }
+        }
+
+        EpsAtomicCounterAdd(&pChannel->stat.recvPackets, packetCount);
+        EpsAtomicCounterAdd(&pChannel->stat.recvBytes, recvBytes);
+        if (packetCount > pChannel->stat.maxBatchSize)
         {
-            pChannel->listener.eventOccurredNotify(pChannel->listener.pListener, pEvent);
-            free(pEvent);
+            EpsAtomicStoreRelaxed(&pChannel->stat.maxBatchSize, packetCount);
+        }
+
+        if (packetCount > 0)
+        {
+            pChannel->listener.receivedNotify(pChannel->listener.pListener, 
+                    NO_ERR, pChannel->recvPackets, packetCount);
+
+            /* ߴڼͨѱرգʱio_uringͷ */
+            if (IsChannelConnected(pChannel))
+            {
+                for (i = 0; i < packetCount; i++)
+                {
+                    RecycleIoUringBuf(pRing, bufIds[i]);
+                }
+            }
+        }
+        else if (isTimeout)
+        {
+            pChannel->listener.receivedNotify(pChannel->listener.pListener, 
+                    ERCD_EPS_SOCKET_TIMEOUT, pChannel->recvPackets, 0);
         }
     }
     CATCH
     {
+        CloseUdpChannel(pChannel);
     }
     FINALLY
     {
@@ -610,63 +986,213 @@ static ResCodeT HandleEvent(EpsUdpChannelT* pChannel)
     }
 }
 
+#else
+
 /**
  * ͨ
  *
+ * ϴν֪ͨEPS_SOCKET_RECV_TIMEOUTʱ֪ͨճʱ
+ * Ӧ߳Խ϶̵ȴʱѯʱĻԾڲ
+ *
  * @param   pChannel            in  - UDPͨ
+ * @param   timeout             in  - ȴݵʱ()
  *
  * @return  ɹNO_ERR򷵻ش
  */
-static ResCodeT ReceiveData(EpsUdpChannelT* pChannel)
+static ResCodeT ReceiveData(EpsUdpChannelT* pChannel, uint64 timeout)
 {
     TRY
     {
-        struct sockaddr_in srcAddr;
-        socklen_t addrlen = sizeof(srcAddr);
-
         fd_set fdset;
         FD_ZERO(&fdset);
-        FD_SET(pChannel->socket, &fdset);
+        int maxFd = 0;
+        uint32 i = 0;
+        for (i = 0; i < pChannel->lineCount; i++)
+        {
+            FD_SET(pChannel->lines[i].socket, &fdset);
+            if ((int)pChannel->lines[i].socket > maxFd)
+            {
+                maxFd = (int)pChannel->lines[i].socket;
+            }
+        }
+
+#if defined(__LINUX__)
+        BOOL isXdpOpened = IsUdpXdpOpened(&pChannel->xdp);
+        if (isXdpOpened)
+        {
+            FD_SET(pChannel->xdp.xsk, &fdset);
+            if (pChannel->xdp.xsk > maxFd)
+            {
+                maxFd = pChannel->xdp.xsk;
+            }
+        }
+#endif
 
-        struct timeval timeout;
-        timeout.tv_sec = EPS_SOCKET_RECV_TIMEOUT / 1000;
-        timeout.tv_usec = (EPS_SOCKET_RECV_TIMEOUT % 1000) * 1000;
+        struct timeval waitTime;
+        waitTime.tv_sec = timeout / 1000000000;
+        waitTime.tv_usec = (timeout % 1000000000) / 1000;
 
-        int result = select(pChannel->socket+1, &fdset, 0, 0, &timeout);
+        int result = select(maxFd+1, &fdset, 0, 0, &waitTime);
         if (result == SOCKET_ERROR)
         {
             int lstErrno = NET_ERRNO;
             THROW_ERROR(ERCD_EPS_SOCKET_ERROR, EpsGetSystemError(lstErrno));
         }
-        
-        if (FD_ISSET(pChannel->socket, &fdset))
+
+        if (result == 0)
         {
-            int len = recvfrom(pChannel->socket, pChannel->recvBuffer, EPS_SOCKET_RECVBUFFER_LEN, 
-                0, (struct sockaddr*)&srcAddr, &addrlen);
-            if (len > 0)
+            uint64 now = EpsGetTimestamp();
+            if (now - pChannel->notifyTime >= (uint64)EPS_SOCKET_RECV_TIMEOUT * 1000000)
             {
+                pChannel->notifyTime = now;
                 pChannel->listener.receivedNotify(pChannel->listener.pListener, 
-                        NO_ERR, pChannel->recvBuffer, (uint32)len);
+                        ERCD_EPS_SOCKET_TIMEOUT, pChannel->recvPackets, 0);
+            }
+            THROW_RESCODE(NO_ERR);
+        }
+
+        pChannel->notifyTime = EpsGetTimestamp();
+
+#if defined(__LINUX__)
+        if (isXdpOpened && FD_ISSET(pChannel->xdp.xsk, &fdset))
+        {
+            THROW_ERROR(ReceiveXdp(pChannel));
+        }
+#endif
+
+        /* ·νգ·ȵٲ */
+        for (i = 0; i < pChannel->lineCount && IsChannelConnected(pChannel); i++)
+        {
+            if (! FD_ISSET(pChannel->lines[i].socket, &fdset))
+            {
+                continue;
             }
-            else if(len == 0)
+
+            /* ͻʱգselect */
+            uint32 round = 0;
+            uint32 packetCount = 0;
+            do
+            {
+                THROW_ERROR(ReceiveBatch(pChannel, i, &packetCount));
+                if (packetCount > 0)
+                {
+                    pChannel->listener.receivedNotify(pChannel->listener.pListener, 
+                            NO_ERR, pChannel->recvPackets, packetCount);
+                }
+            } while (packetCount == EPS_UDP_RECV_BATCH_SIZE && 
+                     ++round < EPS_RECV_BATCH_MAX_ROUNDS &&
+                     IsChannelConnected(pChannel));
+        }
+    }
+    CATCH
+    {
+        CloseUdpChannel(pChannel);
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ݱ
+ *
+ * @param   pChannel            in  - UDPͨ
+ * @param   lineIndex           in  - 鲥·
+ * @param   pPacketCount        out - յݱ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+static ResCodeT ReceiveBatch(EpsUdpChannelT* pChannel, uint32 lineIndex, uint32* pPacketCount)
+{
+    TRY
+    {
+        SOCKET fd = pChannel->lines[lineIndex].socket;
+        uint32 packetCount = 0;
+        uint32 recvBytes = 0;
+
+#if defined(__LINUX__)
+        struct mmsghdr msgs[EPS_UDP_RECV_BATCH_SIZE];
+        struct iovec iovs[EPS_UDP_RECV_BATCH_SIZE];
+        char ctrls[EPS_UDP_RECV_BATCH_SIZE][CMSG_SPACE(sizeof(struct timespec))];
+        uint32 i = 0;
+
+        memset(msgs, 0x00, sizeof(msgs));
+        for (i = 0; i < EPS_UDP_RECV_BATCH_SIZE; i++)
+        {
+            iovs[i].iov_base = pChannel->recvBuffer + i * EPS_UDP_DATAGRAM_MAX_LEN;
+            iovs[i].iov_len  = EPS_UDP_DATAGRAM_MAX_LEN;
+            msgs[i].msg_hdr.msg_iov    = &iovs[i];
+            msgs[i].msg_hdr.msg_iovlen = 1;
+            msgs[i].msg_hdr.msg_control    = ctrls[i];
+            msgs[i].msg_hdr.msg_controllen = sizeof(ctrls[i]);
+        }
+
+        int result = recvmmsg(fd, msgs, EPS_UDP_RECV_BATCH_SIZE, MSG_DONTWAIT, NULL);
+        EpsAtomicCounterAdd(&pChannel->stat.recvCalls, 1);
+        if (result < 0)
+        {
+            int lstErrno = NET_ERRNO;
+            if (lstErrno == EAGAIN || lstErrno == EWOULDBLOCK || lstErrno == EINTR)
             {
-                THROW_ERROR(ERCD_EPS_SOCKET_ERROR, "Connection closed by remote");
+                *pPacketCount = 0;
+                THROW_RESCODE(NO_ERR);
             }
-            else
+            THROW_ERROR(ERCD_EPS_SOCKET_ERROR, EpsGetSystemError(lstErrno));
+        }
+
+        for (i = 0; i < (uint32)result; i++)
+        {
+            if (msgs[i].msg_len == 0)
             {
-                int lstErrno = NET_ERRNO;
-                THROW_ERROR(ERCD_EPS_SOCKET_ERROR, EpsGetSystemError(lstErrno));
+                continue;
             }
+
+            pChannel->recvPackets[packetCount].data = (const char*)iovs[i].iov_base;
+            pChannel->recvPackets[packetCount].dataLen = msgs[i].msg_len;
+            pChannel->recvPackets[packetCount].recvTime = EpsGetRecvTimestamp(&msgs[i].msg_hdr);
+            pChannel->recvPackets[packetCount].lineIndex = lineIndex;
+            recvBytes += msgs[i].msg_len;
+            packetCount++;
+        }
+#else
+        struct sockaddr_in srcAddr;
+        socklen_t addrlen = sizeof(srcAddr);
+
+        int len = recvfrom(fd, pChannel->recvBuffer, EPS_SOCKET_RECVBUFFER_LEN, 
+            0, (struct sockaddr*)&srcAddr, &addrlen);
+        EpsAtomicCounterAdd(&pChannel->stat.recvCalls, 1);
+        if (len > 0)
+        {
+            pChannel->recvPackets[0].data = pChannel->recvBuffer;
+            pChannel->recvPackets[0].dataLen = (uint32)len;
+            pChannel->recvPackets[0].recvTime = EpsGetTimestamp();
+            pChannel->recvPackets[0].lineIndex = lineIndex;
+            recvBytes = (uint32)len;
+            packetCount = 1;
+        }
+        else if(len == 0)
+        {
+            THROW_ERROR(ERCD_EPS_SOCKET_ERROR, "Connection closed by remote");
         }
         else
         {
-            pChannel->listener.receivedNotify(pChannel->listener.pListener, 
-                    ERCD_EPS_SOCKET_TIMEOUT, pChannel->recvBuffer, (uint32)0);
+            int lstErrno = NET_ERRNO;
+            THROW_ERROR(ERCD_EPS_SOCKET_ERROR, EpsGetSystemError(lstErrno));
+        }
+#endif
+
+        EpsAtomicCounterAdd(&pChannel->stat.recvPackets, packetCount);
+        EpsAtomicCounterAdd(&pChannel->stat.recvBytes, recvBytes);
+        if (packetCount > pChannel->stat.maxBatchSize)
+        {
+            EpsAtomicStoreRelaxed(&pChannel->stat.maxBatchSize, packetCount);
         }
+
+        *pPacketCount = packetCount;
     }
     CATCH
     {
-        CloseUdpChannel(pChannel);
     }
     FINALLY
     {
@@ -674,30 +1200,91 @@ static ResCodeT ReceiveData(EpsUdpChannelT* pChannel)
     }
 }
 
+#if defined(__LINUX__)
+
 /**
- * ¼
+ * AF_XDPݱ
+ *
+ * ݱֱָUMEM֡ߴɺٹ黹֡
  *
  * @param   pChannel            in  - UDPͨ
  *
  * @return  ɹNO_ERR򷵻ش
  */
-static ResCodeT ClearEventQueue(EpsUdpChannelT* pChannel)
+static ResCodeT ReceiveXdp(EpsUdpChannelT* pChannel)
 {
     TRY
     {
-        EpsUdpChannelEventT* pEvent = NULL;
-        while (TRUE)
+        uint32 round = 0;
+        uint32 packetCount = 0;
+        do
         {
-            THROW_ERROR(PopUniQueue(&pChannel->eventQueue, (void**)&pEvent));
+            THROW_ERROR(ReceiveUdpXdp(&pChannel->xdp, pChannel->recvPackets, 
+                    EPS_UDP_RECV_BATCH_SIZE, &packetCount));
+            EpsAtomicCounterAdd(&pChannel->stat.recvCalls, 1);
+
+            /* AF_XDP֡Яںʱȡʱ */
+            uint64 recvTime = EpsGetTimestamp();
+            uint32 recvBytes = 0;
+            uint32 i = 0;
+            for (i = 0; i < packetCount; i++)
+            {
+                pChannel->recvPackets[i].recvTime = recvTime;
+                pChannel->recvPackets[i].lineIndex = 0;
+                recvBytes += pChannel->recvPackets[i].dataLen;
+            }
+            EpsAtomicCounterAdd(&pChannel->stat.recvPackets, packetCount);
+            EpsAtomicCounterAdd(&pChannel->stat.xdpPackets, packetCount);
+            EpsAtomicCounterAdd(&pChannel->stat.recvBytes, recvBytes);
+            if (packetCount > pChannel->stat.maxBatchSize)
+            {
+                EpsAtomicStoreRelaxed(&pChannel->stat.maxBatchSize, packetCount);
+            }
 
-            if (pEvent != NULL)
+            if (packetCount > 0)
             {
-                free(pEvent);
+                pChannel->listener.receivedNotify(pChannel->listener.pListener, 
+                        NO_ERR, pChannel->recvPackets, packetCount);
             }
-            else
+
+            /* ߴڼͨѱرգʱUMEMAF_XDPͷ */
+            if (! IsUdpXdpOpened(&pChannel->xdp))
             {
                 break;
             }
+            ReleaseUdpXdp(&pChannel->xdp);
+        } while (packetCount == EPS_UDP_RECV_BATCH_SIZE && 
+                 ++round < EPS_RECV_BATCH_MAX_ROUNDS);
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+#endif /* __LINUX__ */
+
+#endif /* EPS_IOENGINE_URING */
+
+/**
+ * ¼
+ *
+ * @param   pChannel            in  - UDPͨ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+static ResCodeT ClearEventQueue(EpsUdpChannelT* pChannel)
+{
+    TRY
+    {
+        EpsUdpChannelEventT* pEvent = NULL;
+        uint32 count = 0;
+        while ((count = PeekRingQueue(&pChannel->eventQueue, EPS_EVENTQUEUE_SIZE, (void**)&pEvent)) > 0)
+        {
+            ReleaseRingQueue(&pChannel->eventQueue, count);
         }
     }
     CATCH
@@ -718,7 +1305,7 @@ static ResCodeT ClearEventQueue(EpsUdpChannelT* pChannel)
  */
 static BOOL IsChannelInited(EpsUdpChannelT* pChannel)
 {
-    return (IsUniQueueInited(&pChannel->eventQueue));
+    return (IsRingQueueInited(&pChannel->eventQueue));
 }
 
 /**
@@ -730,7 +1317,8 @@ static BOOL IsChannelInited(EpsUdpChannelT* pChannel)
  */
 static BOOL IsChannelStarted(EpsUdpChannelT* pChannel)
 {
-    return (pChannel->tid != 0);
+    return (pChannel->tid != 0 || 
+            (pChannel->isManual && EpsAtomicLoad(&pChannel->status) != EPS_UDPCHANNEL_STATUS_STOP));
 }
 
 /**
@@ -742,7 +1330,7 @@ static BOOL IsChannelStarted(EpsUdpChannelT* pChannel)
  */
 static BOOL IsChannelConnected(EpsUdpChannelT * pChannel)
 {
-    return (pChannel->socket != INVALID_SOCKET);
+    return (pChannel->lineCount > 0 && pChannel->lines[0].socket != INVALID_SOCKET);
 }
 
 /*
@@ -754,7 +1342,7 @@ static void OnChannelConnected(void* pListener)
 static void OnChannelDisconnected(void* pListener, ResCodeT result, const char* reason)
 {
 }
-static void OnChannelReceived(void* pListener, ResCodeT result, const char* data, uint32 dataLen)
+static void OnChannelReceived(void* pListener, ResCodeT result, const EpsUdpPacketT* pPackets, uint32 packetCount)
 {
 }
 static void OnChannelEventOccurred(void* pListener, EpsUdpChannelEventT* pEvent)
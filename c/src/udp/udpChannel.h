@@ -32,13 +32,24 @@ DD-MMM-YYYY INIT.    SIR    Modification Description
  */
 
 #include "common.h"
-#include "uniQueue.h"
+#include "ringQueue.h"
+#include "ioUring.h"
+#include "udpXdp.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 
+/**
+ * 궨
+ */
+
+#define EPS_UDP_RECV_BATCH_SIZE     64      /* ݱ */
+#define EPS_UDP_DATAGRAM_MAX_LEN    (EPS_SOCKET_RECVBUFFER_LEN / EPS_UDP_RECV_BATCH_SIZE) /* ݱ󳤶 */
+#define EPS_UDP_LINE_MAX_NUM        4       /* ͨ鲥· */
+
+
 /**
  * Ͷ
  */
@@ -62,12 +73,50 @@ typedef struct EpsUdpChannelEventTag
     uint32  eventParam;                 /* ¼ */     
 } EpsUdpChannelEventT;
 
+/*
+ * ݱ
+ */
+typedef struct EpsUdpPacketTag
+{
+    const char* data;                   /* ݱ */
+    uint32      dataLen;                /* ݱ */
+    uint64      recvTime;               /* ʱ() */
+    uint32      lineIndex;              /* · */
+} EpsUdpPacketT;
+
+/*
+ * 鲥·
+ */
+typedef struct EpsUdpLineTag
+{
+    char        localAddr[EPS_IP_MAX_LEN+1];/* صַ */
+    char        mcAddr[EPS_IP_MAX_LEN+1];   /* 鲥ַ */
+    uint16      mcPort;                     /* 鲥˿ */
+
+    SOCKET      socket;                     /* ͨѶ׽ */
+#if defined(EPS_IOENGINE_URING)
+    BOOL        isRecvArmed;                /* νύ */
+#endif
+} EpsUdpLineT;
+
+/*
+ * UDPͨͳ
+ */
+typedef struct EpsUdpChannelStatTag
+{
+    uint64  recvCalls;                  /* ϵͳô */
+    uint64  recvPackets;                /* ݱ */
+    uint64  recvBytes;                  /* ֽ */
+    uint32  maxBatchSize;               /* νյݱ */
+    uint64  xdpPackets;                 /* AF_XDPյݱ */
+} EpsUdpChannelStatT;
+
 /*
  * 첽صӿ
  */
 typedef void (*EpsUdpChannelConnectedCallback)(void* pListener);
 typedef void (*EpsUdpChannelDisconnectedCallback)(void* pListener, ResCodeT result, const char* reason);
-typedef void (*EpsUdpChannelReceivedCallback)(void* pListener, ResCodeT result, const char* data, uint32 dataLen);
+typedef void (*EpsUdpChannelReceivedCallback)(void* pListener, ResCodeT result, const EpsUdpPacketT* pPackets, uint32 packetCount);
 typedef void (*EpsUdpChannelEventOccurredCallback)(void* pListener, EpsUdpChannelEventT* pEvent);
 
 /*
@@ -88,11 +137,8 @@ typedef struct EpsUdpChannelListenerTag
  */
 typedef struct EpsUdpChannelTag
 {
-    char        localAddr[EPS_IP_MAX_LEN+1];/* صַ */
-    char        mcAddr[EPS_IP_MAX_LEN+1];   /* 鲥ַ */
-    uint16      mcPort;                     /* 鲥˿ */
-
-    SOCKET      socket;						/* ͨѶ׽ */
+    EpsUdpLineT lines[EPS_UDP_LINE_MAX_NUM];/* 鲥·(A/B·) */
+    uint32      lineCount;                  /* 鲥· */
 
 #if defined(__WINDOWS__)
     HANDLE      thread;						/* ̶߳ */
@@ -103,11 +149,30 @@ typedef struct EpsUdpChannelTag
     pthread_t   tid;                        /* ߳id */
 #endif
 
-    EpsUniQueueT eventQueue;                /* ¼ */
-    char        recvBuffer[EPS_SOCKET_RECVBUFFER_LEN];/* ջ */
+    EpsRingQueueT eventQueue;               /* ¼(Ƕ¼ṹʱܾ¼) */
+    char        recvBuffer[EPS_SOCKET_RECVBUFFER_LEN];/* ջ(ݱ󳤶ȷƬ) */
+    EpsUdpPacketT recvPackets[EPS_UDP_RECV_BATCH_SIZE];/* ݱ */
+    EpsUdpChannelStatT stat;                /* ͳ */
+
+#if defined(EPS_IOENGINE_URING)
+    EpsIoUringT ring;                       /* io_uring׽ִ/ر */
+    BOOL        isTimeoutArmed;             /* ճʱύ */
+#endif
+
+    EpsUdpXdpModeT xdpMode;                 /* AF_XDPģʽ´δʱЧ */
+    uint32      xdpQueueId;                 /* AF_XDP󶨵նк */
+#if defined(__LINUX__)
+    EpsUdpXdpT  xdp;                        /* AF_XDPն׽ִ/ر */
+#endif
+
     BOOL        canStop;                    /* ֹͣ߳б */ 
     EpsUdpChannelStatusT status;            /* ͨ״̬ */
 
+    BOOL        isManual;                   /* Ӧ߳ģʽǣʱ̣ͨ߳´ʱЧ */
+    int         pollFd;                     /* Ӧ̵߳ȴõepoll׽ִ򿪺룬-1ʾʹ */
+    uint64      reconnectTime;              /* ´´򿪵ʱ() */
+    uint64      notifyTime;                 /* һν֪ͨ(ݻʱ)ʱ() */
+
     EpsUdpChannelListenerT listener;        /* ߽ӿ */
 } EpsUdpChannelT;
 
@@ -136,6 +201,11 @@ ResCodeT StartupUdpChannel(EpsUdpChannelT* pChannel);
  */
 ResCodeT ShutdownUdpChannel(EpsUdpChannelT* pChannel);
 
+/*
+ * ִһUDPͨĴ򿪡¼
+ */
+ResCodeT PollUdpChannel(EpsUdpChannelT* pChannel, uint64 timeout);
+
 /*
  * UDPͨ
  */
@@ -33,6 +33,7 @@ DD-MMM-YYYY INIT.    SIR    Modification Description
 #include "epsTypes.h"
 #include "epsData.h"
 #include "errlib.h"
+#include "atomic.h"
 #include "stepCodec.h"
 
 #include "udpDriver.h"
@@ -59,7 +60,7 @@ typedef enum EpsUdpEventTypeTag
 
 static void OnChannelConnected(void* pListener);
 static void OnChannelDisconnected(void* pListener, ResCodeT result, const char* reason);
-static void OnChannelReceived(void* pListener, ResCodeT rc, const char* data, uint32 dataLen);
+static void OnChannelReceived(void* pListener, ResCodeT rc, const EpsUdpPacketT* pPackets, uint32 packetCount);
 static void OnChannelEventOccurred(void* pListener, EpsUdpChannelEventT* pEvent);
 
 static void OnEpsConnected(uint32 hid);
@@ -70,9 +71,20 @@ static void OnEpsMktDataSubRsp(uint32 hid, EpsMktTypeT mktType, ResCodeT result,
 static void OnEpsMktDataArrived(uint32 hid, const EpsMktDataT* pMktData);
 static void OnEpsMktStatusChanged(uint32 hid, const EpsMktStatusT* pMktStatus);
 static void OnEpsEventOccurred(uint32 hid, EpsEventTypeT eventType, ResCodeT eventCode, const char* eventText);
-
+static void OnEpsMktDataGap(uint32 hid, const EpsMktGapT* pMktGap);
+
+static ResCodeT HandlePacket(EpsUdpDriverT* pDriver, const EpsUdpPacketT* pPacket);
+static ResCodeT ArbitrateMktData(EpsUdpDriverT* pDriver, const StepMessageT* pMsg, 
+        const EpsUdpPacketT* pPacket, BOOL* pIsDuplicate);
+static ResCodeT HandleMktData(EpsUdpDriverT* pDriver, const StepMessageT* pMsg, uint64 recvTime);
+static ResCodeT HoldMktData(EpsUdpDriverT* pDriver, const StepMessageT* pMsg, uint64 recvTime);
+static ResCodeT ReleaseMktData(EpsUdpDriverT* pDriver, BOOL isFlushAll);
 static ResCodeT HandleReceiveTimeout(EpsUdpDriverT* pDriver);
-static ResCodeT ParseAddress(const char* address, char* mcAddr, uint16* mcPort, char* localAddr);
+static ResCodeT HandleRecovery(EpsUdpDriverT* pDriver);
+static ResCodeT FinishRecovery(EpsUdpDriverT* pDriver, EpsMktTypeT mktType);
+static ResCodeT AllocReorderBuffer(EpsUdpDriverT* pDriver);
+static ResCodeT ParseAddress(const char* address, EpsUdpLineT* pLines, uint32* pLineCount);
+static void CopyLineAddress(EpsUdpLineT* pDst, const EpsUdpLineT* pSrc, uint32 lineCount);
 
 
 /**
@@ -112,10 +124,30 @@ ResCodeT InitUdpDriver(EpsUdpDriverT* pDriver)
             OnEpsMktDataSubRsp,
             OnEpsMktDataArrived,
             OnEpsMktStatusChanged,
-            OnEpsEventOccurred
+            OnEpsEventOccurred,
+            OnEpsMktDataGap,
+            NULL,
+            NULL
         };
         pDriver->spi = spi;
 
+        pDriver->reorderBuffer = NULL;
+        pDriver->reorderWindow = 0;
+        pDriver->reorderCount = 0;
+        pDriver->reorderedPackets = 0;
+
+        memset(pDriver->lineArbs, 0x00, sizeof(pDriver->lineArbs));
+        memset(pDriver->arbHistory, 0x00, sizeof(pDriver->arbHistory));
+
+        pDriver->pRecovery = NULL;
+        pDriver->pShmBus = NULL;
+        pDriver->pollFd = -1;
+
+        THROW_ERROR(InitMktBatch(&pDriver->batch));
+        THROW_ERROR(InitSecFilter(&pDriver->filter));
+        THROW_ERROR(InitDispatcher(&pDriver->dispatcher, &pDriver->spi, &pDriver->batch, &pDriver->filter));
+        THROW_ERROR(InitSubscriberHub(&pDriver->subscribers, pDriver->hid, &pDriver->filter));
+
         InitRecMutex(&pDriver->lock);
     }
     CATCH
@@ -141,7 +173,38 @@ ResCodeT UninitUdpDriver(EpsUdpDriverT* pDriver)
         LockRecMutex(&pDriver->lock);
             
         UninitUdpChannel(&pDriver->channel);
+        UninitDispatcher(&pDriver->dispatcher);
+        UninitSubscriberHub(&pDriver->subscribers);
+        UninitSecFilter(&pDriver->filter);
         UninitMktDatabase(&pDriver->database);
+        UninitMktBatch(&pDriver->batch);
+
+        if (pDriver->reorderBuffer != NULL)
+        {
+            free(pDriver->reorderBuffer);
+            pDriver->reorderBuffer = NULL;
+        }
+        pDriver->reorderCount = 0;
+
+        if (pDriver->pRecovery != NULL)
+        {
+            UninitUdpRecovery(pDriver->pRecovery);
+            free(pDriver->pRecovery);
+            pDriver->pRecovery = NULL;
+        }
+
+        if (pDriver->pShmBus != NULL)
+        {
+            CloseShmBus(pDriver->pShmBus);
+            free(pDriver->pShmBus);
+            pDriver->pShmBus = NULL;
+        }
+
+        if (pDriver->pollFd >= 0)
+        {
+            close(pDriver->pollFd);
+            pDriver->pollFd = -1;
+        }
 
         UnlockRecMutex(&pDriver->lock);
  
@@ -170,6 +233,12 @@ ResCodeT RegisterUdpDriverSpi(EpsUdpDriverT* pDriver, const EpsClientSpiT* pSpi)
     {
         LockRecMutex(&pDriver->lock);
 
+        /* ̲ͨ߳ȡصͨڼ䲻滻 */
+        if (EpsAtomicLoad(&pDriver->channel.status) != EPS_UDPCHANNEL_STATUS_STOP)
+        {
+            THROW_ERROR(ERCD_EPS_DUPLICATE_CONNECT);
+        }
+
         if (pSpi->connectedNotify != NULL)
         {
             pDriver->spi.connectedNotify = pSpi->connectedNotify;
@@ -202,6 +271,20 @@ ResCodeT RegisterUdpDriverSpi(EpsUdpDriverT* pDriver, const EpsClientSpiT* pSpi)
         {
             pDriver->spi.eventOccurredNotify = pSpi->eventOccurredNotify;
         }
+        if (pSpi->mktDataGapNotify != NULL)
+        {
+            pDriver->spi.mktDataGapNotify = pSpi->mktDataGapNotify;
+        }
+        if (pSpi->mktDataViewArrivedNotify != NULL)
+        {
+            pDriver->spi.mktDataViewArrivedNotify = pSpi->mktDataViewArrivedNotify;
+        }
+        if (pSpi->mktDataBatchArrivedNotify != NULL)
+        {
+            /* ڻصͨ߳ */
+            THROW_ERROR(AllocMktBatch(&pDriver->batch));
+            EpsAtomicStore(&pDriver->spi.mktDataBatchArrivedNotify, pSpi->mktDataBatchArrivedNotify);
+        }
     }
     CATCH
     {
@@ -224,29 +307,42 @@ ResCodeT RegisterUdpDriverSpi(EpsUdpDriverT* pDriver, const EpsClientSpiT* pSpi)
  */
 ResCodeT ConnectUdpDriver(EpsUdpDriverT* pDriver, const char* address)
 {
-    char        localAddr[EPS_IP_MAX_LEN+1];
-    char        mcAddr[EPS_IP_MAX_LEN+1];
-    uint16      mcPort;
+    EpsUdpLineT lines[EPS_UDP_LINE_MAX_NUM];
+    uint32      lineCount = 0;
 
     TRY
     {
         LockRecMutex(&pDriver->lock);
         
-        memcpy(localAddr, pDriver->channel.localAddr, sizeof(localAddr));
-        memcpy(mcAddr, pDriver->channel.mcAddr, sizeof(mcAddr));
-        mcPort = pDriver->channel.mcPort;
-   
-        THROW_ERROR(ParseAddress(address, pDriver->channel.mcAddr, 
-            &pDriver->channel.mcPort, pDriver->channel.localAddr));
+        EpsUdpLineT newLines[EPS_UDP_LINE_MAX_NUM];
+        uint32      newLineCount = 0;
+        THROW_ERROR(ParseAddress(address, newLines, &newLineCount));
+
+        lineCount = pDriver->channel.lineCount;
+        CopyLineAddress(lines, pDriver->channel.lines, lineCount);
+
+        CopyLineAddress(pDriver->channel.lines, newLines, newLineCount);
+        pDriver->channel.lineCount = newLineCount;
+
+        /* ·ʱĬ򻺳壬ĳ·Ķ·ǰΪȱ */
+        if (newLineCount > 1 && pDriver->reorderWindow == 0)
+        {
+            THROW_ERROR(AllocReorderBuffer(pDriver));
+            EpsAtomicStore(&pDriver->reorderWindow, EPS_UDP_ARB_REORDER_WINDOW);
+        }
+
+        THROW_ERROR(StartupDispatcher(&pDriver->dispatcher, pDriver->hid));
         THROW_ERROR(StartupUdpChannel(&pDriver->channel));
+
+        memset(pDriver->lineArbs, 0x00, sizeof(pDriver->lineArbs));
+        memset(pDriver->arbHistory, 0x00, sizeof(pDriver->arbHistory));
     }
     CATCH
     {
         if(GET_RESCODE() == ERCD_EPS_DUPLICATE_CONNECT)
         {
-            memcpy(pDriver->channel.localAddr, localAddr, sizeof(localAddr));
-            memcpy(pDriver->channel.mcAddr, mcAddr, sizeof(mcAddr));
-            pDriver->channel.mcPort = mcPort;
+            CopyLineAddress(pDriver->channel.lines, lines, lineCount);
+            pDriver->channel.lineCount = lineCount;
         }
     }
     FINALLY
@@ -269,6 +365,9 @@ ResCodeT DisconnectUdpDriver(EpsUdpDriverT* pDriver)
     TRY
     {
         ResCodeT rc = NO_ERR;
+
+        /* ַֹ֪ͨ߳ͣʹȴпռ̷ͨ߳ȴ */
+        ShutdownDispatcher(&pDriver->dispatcher);
         
         LockRecMutex(&pDriver->lock);
         
@@ -278,6 +377,13 @@ ResCodeT DisconnectUdpDriver(EpsUdpDriverT* pDriver)
 
         THROW_ERROR(rc);
         THROW_ERROR(JoinUdpChannel(&pDriver->channel));
+        THROW_ERROR(JoinDispatcher(&pDriver->dispatcher));
+
+        EpsUdpRecoveryT* pRecovery = EpsAtomicLoad(&pDriver->pRecovery);
+        if (pRecovery != NULL)
+        {
+            THROW_ERROR(StopUdpRecovery(pRecovery));
+        }
     }
     CATCH
     {
@@ -294,22 +400,19 @@ ResCodeT DisconnectUdpDriver(EpsUdpDriverT* pDriver)
  * @param   pDriver             in  - UDP
  *
  * @return  ɹNO_ERR򷵻ش
+ *
+ * memo: 鲥֤û˺Ų棬¼ͨ߳Ӧ
  */
 ResCodeT LoginUdpDriver(EpsUdpDriverT* pDriver, const char* username, 
     const char* password, uint16 heartbeatIntl)
 {
     TRY
     {
-        LockRecMutex(&pDriver->lock);
-
         EpsUdpChannelEventT event = 
         {
-            EPS_UDP_EVENTTYPE_LOGIN, 0
+            EPS_UDP_EVENTTYPE_LOGIN, (uint32)heartbeatIntl
         };
 
-        snprintf(pDriver->username, sizeof(pDriver->username), username);
-        snprintf(pDriver->password, sizeof(pDriver->password), username);
-        pDriver->heartbeatIntl = heartbeatIntl;
         THROW_ERROR(TriggerUdpChannelEvent(&pDriver->channel, event));
     }
     CATCH
@@ -317,8 +420,6 @@ ResCodeT LoginUdpDriver(EpsUdpDriverT* pDriver, const char* username,
     }
     FINALLY
     {
-        UnlockRecMutex(&pDriver->lock);
-
         RETURN_RESCODE;
     }
 }
@@ -334,8 +435,6 @@ ResCodeT LogoutUdpDriver(EpsUdpDriverT* pDriver, const char* reason)
 {
     TRY
     {
-        LockRecMutex(&pDriver->lock);
-
         EpsUdpChannelEventT event = 
         {
             EPS_UDP_EVENTTYPE_LOGOUT, 0
@@ -348,8 +447,6 @@ ResCodeT LogoutUdpDriver(EpsUdpDriverT* pDriver, const char* reason)
     }
     FINALLY
     {
-        UnlockRecMutex(&pDriver->lock);
-
         RETURN_RESCODE;
     }
 }
@@ -365,10 +462,12 @@ ResCodeT SubscribeUdpDriver(EpsUdpDriverT* pDriver, EpsMktTypeT mktType)
 {
     TRY
     {
-        LockRecMutex(&pDriver->lock);
-
-        THROW_ERROR(SubscribeMktData(&pDriver->database, mktType));
+        if (mktType > EPS_MKTTYPE_NUM)
+        {
+            THROW_ERROR(ERCD_EPS_INVALID_MKTTYPE);
+        }
 
+        /* ݿͨ߳޸ģĽ¼ʱӦ */
         EpsUdpChannelEventT event = 
         {
             EPS_UDP_EVENTTYPE_SUBSCRIBED, (uint32)mktType
@@ -380,252 +479,360 @@ ResCodeT SubscribeUdpDriver(EpsUdpDriverT* pDriver, EpsMktTypeT mktType)
     }
     FINALLY
     {
-        UnlockRecMutex(&pDriver->lock);
-
         RETURN_RESCODE;
     }
 }
 
 /**
- * UDPͨӳɹ֪ͨ
+ * ȡUDPͳϢ
  *
- * @param   pListener             in  - UDP
- */
-static void OnChannelConnected(void* pListener)
-{
-    EpsUdpDriverT* pDriver = (EpsUdpDriverT*)pListener;
-    LockRecMutex(&pDriver->lock);
-    pDriver->spi.connectedNotify(pDriver->hid);
-    UnlockRecMutex(&pDriver->lock);
-}
-
-/**
- * UDPͨӶϿ֪ͨ
+ * @param   pDriver             in  - UDP
+ * @param   pStat               out - ͳϢ
  *
- * @param   pListener           in  - UDP
- * @param   result              in  - Ͽ
- * @param   reason              in  - Ͽԭ
+ * @return  ɹNO_ERR򷵻ش
  */
-static void OnChannelDisconnected(void* pListener, ResCodeT result, const char* reason)
+ResCodeT GetUdpDriverStatistics(EpsUdpDriverT* pDriver, EpsStatisticsT* pStat)
 {
-    EpsUdpDriverT* pDriver = (EpsUdpDriverT*)pListener;
-    LockRecMutex(&pDriver->lock);
-    UnsubscribeAllMktData(&pDriver->database);
-    pDriver->spi.disconnectedNotify(pDriver->hid, result, reason);
-    UnlockRecMutex(&pDriver->lock);
+    TRY
+    {
+        const EpsUdpChannelStatT* pChannelStat = &pDriver->channel.stat;
+        pStat->recvCalls    = EpsAtomicLoadRelaxed(&pChannelStat->recvCalls);
+        pStat->recvPackets  = EpsAtomicLoadRelaxed(&pChannelStat->recvPackets);
+        pStat->recvBytes    = EpsAtomicLoadRelaxed(&pChannelStat->recvBytes);
+        pStat->maxBatchSize = EpsAtomicLoadRelaxed(&pChannelStat->maxBatchSize);
+        pStat->xdpPackets   = EpsAtomicLoadRelaxed(&pChannelStat->xdpPackets);
+
+        const EpsMktDatabaseStatT* pDatabaseStat = &pDriver->database.stat;
+        pStat->gapCount         = EpsAtomicLoadRelaxed(&pDatabaseStat->gapCount);
+        pStat->gapSeqNums       = EpsAtomicLoadRelaxed(&pDatabaseStat->gapSeqNums);
+        pStat->gapFilledSeqNums = EpsAtomicLoadRelaxed(&pDatabaseStat->gapFilledSeqNums);
+        pStat->reorderedPackets = EpsAtomicLoadRelaxed(&pDriver->reorderedPackets);
+
+        EpsUdpRecoveryT* pRecovery = EpsAtomicLoad(&pDriver->pRecovery);
+        if (pRecovery != NULL)
+        {
+            const EpsUdpRecoveryStatT* pRecoveryStat = &pRecovery->stat;
+            pStat->recoveryCount      = EpsAtomicLoadRelaxed(&pRecoveryStat->recoveryCount);
+            pStat->recoveredSeqNums   = EpsAtomicLoadRelaxed(&pRecoveryStat->recoveredSeqNums);
+            pStat->unrecoveredSeqNums = EpsAtomicLoadRelaxed(&pRecoveryStat->unrecoveredSeqNums);
+        }
+        else
+        {
+            pStat->recoveryCount      = 0;
+            pStat->recoveredSeqNums   = 0;
+            pStat->unrecoveredSeqNums = 0;
+        }
+
+        pStat->sessionGapCount = 0;
+        pStat->resendRequests  = 0;
+        pStat->failoverCount   = 0;
+        pStat->failoverLatency = 0;
+
+        EpsShmBusT* pShmBus = EpsAtomicLoad(&pDriver->pShmBus);
+        pStat->shmPublished = (pShmBus != NULL) ? EpsAtomicLoadRelaxed(&pShmBus->pHeader->writeSeq) : 0;
+        pStat->shmOverruns  = 0;
+
+        GetDispatcherStatistics(&pDriver->dispatcher, pStat);
+        GetSecFilterStatistics(&pDriver->filter, pStat);
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
 }
 
 /**
- * UDPͨݽ֪ͨ
+ * UDPѡ
  *
- * @param   pListener           in  - UDP
- * @param   result              in  - մ
- * @param   data                in  - 
- * @param   dataLen             in  - ݳ
+ * @param   pDriver             in  - UDP
+ * @param   option              in  - ѡ
+ * @param   value               in  - ѡֵ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ *
+ * memo: ѡͨ´δʱЧ
  */
-static void OnChannelReceived(void* pListener, ResCodeT result, const char* data, uint32 dataLen)
+ResCodeT SetUdpDriverOption(EpsUdpDriverT* pDriver, EpsOptionT option, int32 value)
 {
-    EpsUdpDriverT* pDriver = (EpsUdpDriverT*)pListener;
     TRY
     {
         LockRecMutex(&pDriver->lock);
 
-        if (OK(result))
+        switch (option)
         {
-            ResCodeT rc = NO_ERR;
-            
-            StepMessageT msg;
-            int32 decodeSize = 0;
-            THROW_ERROR(DecodeStepMessage(data, dataLen, &msg, &decodeSize));
-
-            if (msg.msgType == STEP_MSGTYPE_MD_SNAPSHOT)
+            case EPS_OPTION_UDP_XDP_MODE:
             {
-                rc = AcceptMktData(&pDriver->database, &msg);
-                if (NOTOK(rc))
+                if (value < EPS_UDP_XDP_MODE_NONE || value > EPS_UDP_XDP_MODE_GENERIC)
                 {
-                    if (rc == ERCD_EPS_DATASOURCE_CHANGED)
-                    {
-                        pDriver->spi.eventOccurredNotify(pDriver->hid, EPS_EVENTTYPE_WARNING, rc, ErrGetErrorDscr());
-                    }
-                    else if (rc == ERCD_EPS_MKTTYPE_UNSUBSCRIBED)
-                    {
-                        THROW_RESCODE(NO_ERR);
-                    }
-                    else if (rc == ERCD_EPS_MKTDATA_BACKFLOW)
-                    {
-                        THROW_RESCODE(NO_ERR);
-                    }
-                    else
-                    {
-                        THROW_ERROR(rc);
-                    }
+                    THROW_ERROR(ERCD_EPS_INVALID_PARM, "value");
                 }
-            
-                EpsMktDataT mktData;
-                THROW_ERROR(ConvertMktData(&msg, &mktData));
-
-                pDriver->spi.mktDataArrivedNotify(pDriver->hid, &mktData);
-
-                pDriver->recvIdleTimes = 0;
+#if ! defined(__LINUX__) || defined(EPS_IOENGINE_URING)
+                if (value != EPS_UDP_XDP_MODE_NONE)
+                {
+                    THROW_ERROR(ERCD_EPS_UNSUPPORTED_OPTION, "AF_XDP");
+                }
+#endif
+                EpsAtomicStoreRelaxed(&pDriver->channel.xdpMode, (EpsUdpXdpModeT)value);
+                break;
             }
-            else if (msg.msgType == STEP_MSGTYPE_TRADING_STATUS)
+            case EPS_OPTION_UDP_XDP_QUEUE:
             {
-                rc = AcceptMktStatus(&pDriver->database, &msg);
-                if (NOTOK(rc))
+                if (value < 0)
                 {
-                    if (rc == ERCD_EPS_MKTSTATUS_UNCHANGED || rc == ERCD_EPS_MKTTYPE_UNSUBSCRIBED)
-                    {
-                        THROW_RESCODE(NO_ERR);
-                    }
-                    else 
-                    {
-                        THROW_ERROR(rc);
-                    }
+                    THROW_ERROR(ERCD_EPS_INVALID_PARM, "value");
+                }
+                EpsAtomicStoreRelaxed(&pDriver->channel.xdpQueueId, (uint32)value);
+                break;
+            }
+            case EPS_OPTION_UDP_REORDER_WINDOW:
+            {
+                if (value < 0 || value > EPS_UDP_REORDER_WINDOW_MAX)
+                {
+                    THROW_ERROR(ERCD_EPS_INVALID_PARM, "value");
                 }
-            
-                EpsMktStatusT mktStatus;
-                THROW_ERROR(ConvertMktStatus(&msg, &mktStatus));
 
-                pDriver->spi.mktStatusChangedNotify(pDriver->hid, &mktStatus);
+                if (value > 0)
+                {
+                    THROW_ERROR(AllocReorderBuffer(pDriver));
+                }
 
-                pDriver->recvIdleTimes = 0;
+                /* ڴڷСʱ´νʱͷ */
+                EpsAtomicStore(&pDriver->reorderWindow, (uint32)value);
+                break;
             }
-            else
+            case EPS_OPTION_MKTDATA_BATCH_SIZE:
+            case EPS_OPTION_MKTDATA_BATCH_DELAY:
             {
+                THROW_ERROR(SetMktBatchOption(&pDriver->batch, option, value));
+                break;
             }
-        }
-        else
-        {
-            if (result == ERCD_EPS_SOCKET_TIMEOUT)
+            case EPS_OPTION_DISPATCH_THREADS:
+            case EPS_OPTION_DISPATCH_HIGH_WATER:
+            case EPS_OPTION_DISPATCH_POLICY:
+            case EPS_OPTION_DISPATCH_MODE:
             {
-                THROW_ERROR(HandleReceiveTimeout(pDriver));
+                if (EpsAtomicLoad(&pDriver->channel.status) != EPS_UDPCHANNEL_STATUS_STOP)
+                {
+                    THROW_ERROR(ERCD_EPS_DUPLICATE_CONNECT);
+                }
+                THROW_ERROR(SetDispatcherOption(&pDriver->dispatcher, option, value));
+                break;
             }
-            else 
+            case EPS_OPTION_POLL_MODE:
             {
-                THROW_ERROR(result);
+                if (value != 0 && value != 1)
+                {
+                    THROW_ERROR(ERCD_EPS_INVALID_PARM, "value");
+                }
+#if ! defined(__LINUX__) || defined(EPS_IOENGINE_URING)
+                if (value != 0)
+                {
+                    THROW_ERROR(ERCD_EPS_UNSUPPORTED_OPTION, "poll mode");
+                }
+#else
+                if (EpsAtomicLoad(&pDriver->channel.status) != EPS_UDPCHANNEL_STATUS_STOP)
+                {
+                    THROW_ERROR(ERCD_EPS_DUPLICATE_CONNECT);
+                }
+
+                if (value == 1 && pDriver->pollFd < 0)
+                {
+                    pDriver->pollFd = EpsCreatePollFd();
+                    if (pDriver->pollFd < 0)
+                    {
+                        int lstErrno = SYS_ERRNO;
+                        THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, EpsGetSystemError(lstErrno));
+                    }
+                }
+                else if (value == 0 && pDriver->pollFd >= 0)
+                {
+                    close(pDriver->pollFd);
+                    pDriver->pollFd = -1;
+                }
+
+                pDriver->channel.isManual = (value == 1);
+                pDriver->channel.pollFd = pDriver->pollFd;
+#endif
+                break;
+            }
+            default:
+            {
+                THROW_ERROR(ERCD_EPS_INVALID_PARM, "option");
             }
         }
     }
     CATCH
     {
-        pDriver->spi.eventOccurredNotify(pDriver->hid, EPS_EVENTTYPE_ERROR, ErrGetErrorCode(), ErrGetErrorDscr());
-
-        CloseUdpChannel(&pDriver->channel);
-        OnChannelDisconnected(pListener, ErrGetErrorCode(), ErrGetErrorDscr());
-
-        ErrClearError();
     }
     FINALLY
     {
         UnlockRecMutex(&pDriver->lock);
+
+        RETURN_RESCODE;
     }
 }
 
 /**
- * UDPͨ¼֪ͨ
+ * ȡUDP·ٲͳϢ
  *
- * @param   pListener               in  - UDP
- * @param   pEvent                  in  - ¼
+ * @param   pDriver             in  - UDP
+ * @param   pStats              out - ·ͳϢ
+ * @param   pCount              in  - 鳤
+ *                              out - ·
+ *
+ * @return  ɹNO_ERR򷵻ش
  */
-static void OnChannelEventOccurred(void* pListener, EpsUdpChannelEventT* pEvent)
+ResCodeT GetUdpDriverLineStatistics(EpsUdpDriverT* pDriver, EpsLineStatT* pStats, uint32* pCount)
 {
-    EpsUdpDriverT* pDriver = (EpsUdpDriverT*)pListener;
-
-    LockRecMutex(&pDriver->lock);
-
-    switch (pEvent->eventType)
+    TRY
     {
-        case EPS_UDP_EVENTTYPE_LOGIN:
-        {
-            pDriver->spi.loginRspNotify(pDriver->hid, 
-                    pDriver->heartbeatIntl, NO_ERR, "login succeed");
-            break;
-        }
-        case EPS_UDP_EVENTTYPE_LOGOUT:
-        {
-            UnsubscribeAllMktData(&pDriver->database);
-            
-            pDriver->spi.logoutRspNotify(pDriver->hid, 
-                    NO_ERR, "logout succeed");
-            break;
-        }
-        case EPS_UDP_EVENTTYPE_SUBSCRIBED:
+        LockRecMutex(&pDriver->lock);
+
+        uint32 lineCount = pDriver->channel.lineCount;
+        uint32 i = 0;
+        for (i = 0; i < lineCount && i < *pCount; i++)
         {
-            pDriver->spi.mktDataSubRspNotify(pDriver->hid, 
-                    (EpsMktTypeT)(pEvent->eventParam), NO_ERR, "subscribe succeed");
-            break;
+            const EpsLineStatT* pStat = &pDriver->lineArbs[i].stat;
+            pStats[i].recvPackets   = EpsAtomicLoadRelaxed(&pStat->recvPackets);
+            pStats[i].winPackets    = EpsAtomicLoadRelaxed(&pStat->winPackets);
+            pStats[i].dupPackets    = EpsAtomicLoadRelaxed(&pStat->dupPackets);
+            pStats[i].lostSeqNums   = EpsAtomicLoadRelaxed(&pStat->lostSeqNums);
+            pStats[i].totalLeadTime = EpsAtomicLoadRelaxed(&pStat->totalLeadTime);
+            pStats[i].totalLagTime  = EpsAtomicLoadRelaxed(&pStat->totalLagTime);
+            pStats[i].maxLagTime    = EpsAtomicLoadRelaxed(&pStat->maxLagTime);
         }
-        default:
-            break;
+        *pCount = lineCount;
     }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        UnlockRecMutex(&pDriver->lock);
 
-    UnlockRecMutex(&pDriver->lock);
+        RETURN_RESCODE;
+    }
 }
 
 /**
- * UDPͨݽճʱ֪ͨ
+ * UDPȱڻָỰ
  *
  * @param   pDriver             in  - UDP
+ * @param   address             in  - ַָ
+ * @param   username            in  - ½û
+ * @param   password            in  - ½
+ * @param   gapThreshold        in  - ָȱֵ
+ *
+ * @return  ɹNO_ERR򷵻ش
  */
-static ResCodeT HandleReceiveTimeout(EpsUdpDriverT* pDriver)
+ResCodeT SetUdpDriverRecovery(EpsUdpDriverT* pDriver, const char* address,
+        const char* username, const char* password, uint32 gapThreshold)
 {
+    EpsUdpRecoveryT* pRecovery = NULL;
+
     TRY
     {
-        pDriver->recvIdleTimes++;
-        
-        if ((pDriver->recvIdleTimes * EPS_SOCKET_RECV_TIMEOUT) >= EPS_DRIVER_KEEPALIVE_TIME)
+        LockRecMutex(&pDriver->lock);
+
+        if (pDriver->pRecovery == NULL)
         {
-            ErrSetError(ERCD_EPS_CHECK_KEEPALIVE_TIMEOUT);
-                    
-            pDriver->spi.eventOccurredNotify(pDriver->hid, EPS_EVENTTYPE_WARNING, 
-                        GET_RESCODE(), ErrGetErrorDscr());
+            pRecovery = (EpsUdpRecoveryT*)calloc(1, sizeof(EpsUdpRecoveryT));
+            if (pRecovery == NULL)
+            {
+                int lstErrno = SYS_ERRNO;
+                THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, EpsGetSystemError(lstErrno));
+            }
 
-            pDriver->recvIdleTimes = 0;
+            THROW_ERROR(InitUdpRecovery(pRecovery, pDriver->hid));
+            THROW_ERROR(ConfigUdpRecovery(pRecovery, address, username, password, gapThreshold));
+            ApplyUdpRecoveryConfig(pRecovery);
+
+            /* ʼɺٷͨ߳ */
+            EpsAtomicStore(&pDriver->pRecovery, pRecovery);
+            pRecovery = NULL;
+        }
+        else
+        {
+            /* ²ͨ߳´ƽָỰʱȡ */
+            THROW_ERROR(ConfigUdpRecovery(pDriver->pRecovery, address, username, password, gapThreshold));
         }
     }
     CATCH
     {
+        if (pRecovery != NULL)
+        {
+            UninitUdpRecovery(pRecovery);
+            free(pRecovery);
+        }
     }
     FINALLY
     {
+        UnlockRecMutex(&pDriver->lock);
+
         RETURN_RESCODE;
     }
 }
 
 /**
- * ַַ
+ * Ӧ߳UDP
  *
- * @param   address                 in  - ַַ
- * @param   mcAddr                  out - 鲥ַ
- * @param   mcPort                  out - 鲥˿
- * @param   localAddr               out - صַ
+ * ȲȴִһֽգʱepollϵȴtimeoutִУ
+ * ʱִУֱĳݻִmaxEvents
+ *
+ * @param   pDriver             in  - UDP
+ * @param   timeout             in  - ʱȴʱ()0ʾȴ
+ * @param   maxEvents           in  - ִеĽ01
  *
  * @return  ɹNO_ERR򷵻ش
  */
-static ResCodeT ParseAddress(const char* address, char* mcAddr, uint16* mcPort, char* localAddr)
+ResCodeT PollUdpDriver(EpsUdpDriverT* pDriver, uint64 timeout, uint32 maxEvents)
 {
     TRY
     {
-        /* ַʽΪ230.11.1.1:3333;196.123.71.1 */
-        const char* p1, *p2;
+        if (pDriver->pollFd < 0)
+        {
+            THROW_ERROR(ERCD_EPS_INVALID_OPERATION, "poll mode not enabled");
+        }
 
-        int len = strlen(address);
-        
-        p1 = strstr(address, ":");
-        if (p1 == NULL || p1 == address)
+        if (EpsAtomicLoad(&pDriver->channel.status) != EPS_UDPCHANNEL_STATUS_WORK)
         {
-            THROW_ERROR(ERCD_EPS_INVALID_ADDRESS);
+            THROW_ERROR(ERCD_EPS_INVALID_OPERATION, "not connected");
         }
 
-        p2 = strstr(p1+1, ";");
-        if (p2 == NULL)
+        if (maxEvents == 0)
         {
-            THROW_ERROR(ERCD_EPS_INVALID_ADDRESS);
+            maxEvents = 1;
         }
 
-        memcpy(mcAddr, address, (p1-address));
-        memcpy(localAddr, p2+1, (address+len-p2-1));
-        *mcPort = atoi(p1 + 1);
+        BOOL isWaited = FALSE;
+        uint32 round = 0;
+        while (round < maxEvents)
+        {
+            uint64 recvPackets = pDriver->channel.stat.recvPackets;
+            THROW_ERROR(PollUdpChannel(&pDriver->channel, 0));
+            if (pDriver->channel.stat.recvPackets != recvPackets)
+            {
+                round++;
+                continue;
+            }
+
+            if (round > 0 || isWaited || timeout == 0)
+            {
+                break;
+            }
+
+#if defined(__LINUX__)
+            if (EpsWaitPollFd(pDriver->pollFd, timeout) < 0)
+            {
+                int lstErrno = SYS_ERRNO;
+                THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, EpsGetSystemError(lstErrno));
+            }
+#endif
+            isWaited = TRUE;
+        }
     }
     CATCH
     {
@@ -636,16 +843,1101 @@ static ResCodeT ParseAddress(const char* address, char* mcAddr, uint16* mcPort,
     }
 }
 
-/*
- * Express SPIռλ
+/**
+ * ȡUDPӦ̵߳ȴ
+ *
+ * @param   pDriver             in  - UDP
+ * @param   pFd                 out - epoll·׽ֿɶʱɶ
+ *
+ * @return  ɹNO_ERR򷵻ش
  */
-static void OnEpsConnected(uint32 hid)
-{
-}
-static void OnEpsDisconnected(uint32 hid, ResCodeT result, const char* reason)
-{
-}
-static void OnEpsLoginRsp(uint32 hid, uint16 heartbeatIntl, ResCodeT result, const char* reason)
+ResCodeT GetUdpDriverFd(EpsUdpDriverT* pDriver, int* pFd)
+{
+    TRY
+    {
+        if (pDriver->pollFd < 0)
+        {
+            THROW_ERROR(ERCD_EPS_INVALID_OPERATION, "poll mode not enabled");
+        }
+
+        *pFd = pDriver->pollFd;
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * UDPûʱã̴ͨ߳һʱЧ
+ *
+ * @param   pDriver             in  - UDP
+ * @param   parser              in  - NULLʾȡ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT SetUdpDriverMdDataParser(EpsUdpDriverT* pDriver, EpsMdDataParseCallback parser)
+{
+    TRY
+    {
+        SetSecFilterParser(&pDriver->filter, parser);
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * UDPĶ֤ȯʱã̴ͨ߳һʱЧ
+ *
+ * @param   pDriver             in  - UDP
+ * @param   securityIDs         in  - ֤ȯ
+ * @param   count               in  - ֤ȯ0ʾȡ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT SubscribeUdpDriverSecurities(EpsUdpDriverT* pDriver, const char* securityIDs[], uint32 count)
+{
+    TRY
+    {
+        THROW_ERROR(SetSecFilterSecurities(&pDriver->filter, securityIDs, count));
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * UDPĶߣʱӣ̴ͨ߳һʱЧ
+ *
+ * @param   pDriver             in  - UDP
+ * @param   pConfig             in  - 
+ * @param   pSid                out - ID
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT AddUdpDriverSubscriber(EpsUdpDriverT* pDriver, const EpsSubscriberConfigT* pConfig, uint32* pSid)
+{
+    TRY
+    {
+        THROW_ERROR(AddSubscriber(&pDriver->subscribers, pConfig, pSid));
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ɾUDPĶ
+ *
+ * @param   pDriver             in  - UDP
+ * @param   sid                 in  - ID
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT RemoveUdpDriverSubscriber(EpsUdpDriverT* pDriver, uint32 sid)
+{
+    TRY
+    {
+        THROW_ERROR(RemoveSubscriber(&pDriver->subscribers, sid));
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * Ӧ߳ͶUDP߶е
+ *
+ * @param   pDriver             in  - UDP
+ * @param   sid                 in  - ID
+ * @param   maxCount            in  - Ͷݵ
+ * @param   pCount              out - Ͷݵ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT PollUdpDriverSubscriber(EpsUdpDriverT* pDriver, uint32 sid, uint32 maxCount, uint32* pCount)
+{
+    TRY
+    {
+        THROW_ERROR(PollSubscriber(&pDriver->subscribers, sid, maxCount, pCount));
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ȡUDPߵͳϢ
+ *
+ * @param   pDriver             in  - UDP
+ * @param   sid                 in  - ID
+ * @param   pStat               out - ͳϢ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT GetUdpDriverSubscriberStatistics(EpsUdpDriverT* pDriver, uint32 sid, EpsSubscriberStatT* pStat)
+{
+    TRY
+    {
+        THROW_ERROR(GetSubscriberStatistics(&pDriver->subscribers, sid, pStat));
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * UDPĹڴ߷
+ *
+ * ͨż鼰г״̬ڹˡַǰдߣԹڴģʽȡ
+ *
+ * @param   pDriver             in  - UDP
+ * @param   name                in  - ڴ
+ * @param   slotCount           in  - λ(2)0ȡĬֵ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT SetUdpDriverShmPublisher(EpsUdpDriverT* pDriver, const char* name, uint32 slotCount)
+{
+    EpsShmBusT* pShmBus = NULL;
+
+    TRY
+    {
+        LockRecMutex(&pDriver->lock);
+
+        if (pDriver->pShmBus != NULL)
+        {
+            THROW_ERROR(ERCD_EPS_DUPLICATE_INITED, "shm publisher");
+        }
+
+        pShmBus = (EpsShmBusT*)calloc(1, sizeof(EpsShmBusT));
+        if (pShmBus == NULL)
+        {
+            int lstErrno = SYS_ERRNO;
+            THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, EpsGetSystemError(lstErrno));
+        }
+
+        THROW_ERROR(CreateShmBus(pShmBus, name, slotCount));
+
+        /* ߴɺٷͨ߳ */
+        EpsAtomicStore(&pDriver->pShmBus, pShmBus);
+        pShmBus = NULL;
+    }
+    CATCH
+    {
+        if (pShmBus != NULL)
+        {
+            free(pShmBus);
+        }
+    }
+    FINALLY
+    {
+        UnlockRecMutex(&pDriver->lock);
+
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * UDPͨӳɹ֪ͨ
+ *
+ * @param   pListener             in  - UDP
+ */
+static void OnChannelConnected(void* pListener)
+{
+    EpsUdpDriverT* pDriver = (EpsUdpDriverT*)pListener;
+    pDriver->spi.connectedNotify(pDriver->hid);
+}
+
+/**
+ * UDPͨӶϿ֪ͨ
+ *
+ * @param   pListener           in  - UDP
+ * @param   result              in  - Ͽ
+ * @param   reason              in  - Ͽԭ
+ */
+static void OnChannelDisconnected(void* pListener, ResCodeT result, const char* reason)
+{
+    EpsUdpDriverT* pDriver = (EpsUdpDriverT*)pListener;
+    UnsubscribeAllMktData(&pDriver->database);
+    pDriver->reorderCount = 0;
+    pDriver->spi.disconnectedNotify(pDriver->hid, result, reason);
+}
+
+/**
+ * UDPͨݽ֪ͨ
+ *
+ * @param   pListener           in  - UDP
+ * @param   result              in  - մ
+ * @param   pPackets            in  - ݱ
+ * @param   packetCount         in  - ݱ
+ */
+static void OnChannelReceived(void* pListener, ResCodeT result, const EpsUdpPacketT* pPackets, uint32 packetCount)
+{
+    EpsUdpDriverT* pDriver = (EpsUdpDriverT*)pListener;
+    TRY
+    {
+        if (OK(result))
+        {
+            uint32 i = 0;
+            for (i = 0; i < packetCount; i++)
+            {
+                THROW_ERROR(HandlePacket(pDriver, &pPackets[i]));
+            }
+
+            if (pDriver->reorderCount > 0)
+            {
+                THROW_ERROR(ReleaseMktData(pDriver, FALSE));
+            }
+        }
+        else
+        {
+            if (result == ERCD_EPS_SOCKET_TIMEOUT)
+            {
+                THROW_ERROR(HandleReceiveTimeout(pDriver));
+            }
+            else 
+            {
+                THROW_ERROR(result);
+            }
+        }
+
+        if (EpsAtomicLoad(&pDriver->pRecovery) != NULL)
+        {
+            THROW_ERROR(HandleRecovery(pDriver));
+        }
+
+        FlushMktBatch(&pDriver->batch, pDriver->hid, pDriver->spi.mktDataBatchArrivedNotify);
+    }
+    CATCH
+    {
+        FlushMktBatch(&pDriver->batch, pDriver->hid, pDriver->spi.mktDataBatchArrivedNotify);
+
+        pDriver->spi.eventOccurredNotify(pDriver->hid, EPS_EVENTTYPE_ERROR, ErrGetErrorCode(), ErrGetErrorDscr());
+
+        CloseUdpChannel(&pDriver->channel);
+        OnChannelDisconnected(pListener, ErrGetErrorCode(), ErrGetErrorDscr());
+
+        ErrClearError();
+    }
+    FINALLY
+    {
+        SET_RESCODE(GET_RESCODE());
+    }
+}
+
+/**
+ * UDPݱ
+ *
+ * @param   pDriver             in  - UDP
+ * @param   pPacket             in  - ݱ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+static ResCodeT HandlePacket(EpsUdpDriverT* pDriver, const EpsUdpPacketT* pPacket)
+{
+    TRY
+    {
+        ResCodeT rc = NO_ERR;
+        
+        StepMessageT msg;
+        int32 decodeSize = 0;
+        rc = DecodeStepMessage(pPacket->data, pPacket->dataLen, &msg, &decodeSize);
+        if (NOTOK(rc))
+        {
+            /* ݱ֮໥ݱ޷ʱ澯ݱ
+               ͬյݱ */
+            if (ErrGetErrorCode() != rc)
+            {
+                ErrSetError(rc);
+            }
+            FlushMktBatch(&pDriver->batch, pDriver->hid, pDriver->spi.mktDataBatchArrivedNotify);
+            pDriver->spi.eventOccurredNotify(pDriver->hid, EPS_EVENTTYPE_WARNING, rc, ErrGetErrorDscr());
+            ErrClearError();
+            THROW_RESCODE(NO_ERR);
+        }
+
+        if (msg.msgType == STEP_MSGTYPE_MD_SNAPSHOT)
+        {
+            if (pDriver->channel.lineCount > 1)
+            {
+                BOOL isDuplicate = FALSE;
+                THROW_ERROR(ArbitrateMktData(pDriver, &msg, pPacket, &isDuplicate));
+                if (isDuplicate)
+                {
+                    THROW_RESCODE(NO_ERR);
+                }
+            }
+
+            if (EpsAtomicLoad(&pDriver->reorderWindow) > 0)
+            {
+                BOOL isAhead = FALSE;
+                THROW_ERROR(CheckMktDataOrder(&pDriver->database, &msg, &isAhead));
+                if (isAhead)
+                {
+                    THROW_ERROR(HoldMktData(pDriver, &msg, pPacket->recvTime));
+                    THROW_RESCODE(NO_ERR);
+                }
+            }
+
+            THROW_ERROR(HandleMktData(pDriver, &msg, pPacket->recvTime));
+
+            if (pDriver->reorderCount > 0)
+            {
+                THROW_ERROR(ReleaseMktData(pDriver, FALSE));
+            }
+        }
+        else if (msg.msgType == STEP_MSGTYPE_TRADING_STATUS)
+        {
+            rc = AcceptMktStatus(&pDriver->database, &msg);
+            if (NOTOK(rc))
+            {
+                if (rc == ERCD_EPS_MKTSTATUS_UNCHANGED || rc == ERCD_EPS_MKTTYPE_UNSUBSCRIBED)
+                {
+                    THROW_RESCODE(NO_ERR);
+                }
+                else 
+                {
+                    THROW_ERROR(rc);
+                }
+            }
+        
+            EpsShmBusT* pShmBus = EpsAtomicLoad(&pDriver->pShmBus);
+            if (pShmBus != NULL)
+            {
+                PublishShmBus(pShmBus, &msg, pPacket->recvTime);
+            }
+
+            EpsMktStatusT mktStatus;
+            THROW_ERROR(ConvertMktStatus(&msg, &mktStatus));
+
+            /* Ͷۻ飬֪ͨ˳ */
+            FlushMktBatch(&pDriver->batch, pDriver->hid, pDriver->spi.mktDataBatchArrivedNotify);
+            pDriver->spi.mktStatusChangedNotify(pDriver->hid, &mktStatus);
+
+            pDriver->recvIdleTimes = 0;
+        }
+        else
+        {
+        }
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ·ٲãͬһȵ·Ϊ׼ͳƸ·Ķʧ/ʱ
+ *
+ * @param   pDriver             in  - UDP
+ * @param   pMsg                in  - Ϣ
+ * @param   pPacket             in  - ݱ
+ * @param   pIsDuplicate        out - ǷΪ·ѵظ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+static ResCodeT ArbitrateMktData(EpsUdpDriverT* pDriver, const StepMessageT* pMsg, 
+        const EpsUdpPacketT* pPacket, BOOL* pIsDuplicate)
+{
+    TRY
+    {
+        const MDSnapshotFullRefreshRecordT* pRecord = (const MDSnapshotFullRefreshRecordT*)pMsg->body;
+
+        *pIsDuplicate = FALSE;
+
+        EpsMktTypeT mktType = (EpsMktTypeT)(atoi(pRecord->securityType));
+        if (mktType == EPS_MKTTYPE_ALL || mktType > EPS_MKTTYPE_NUM || 
+            pPacket->lineIndex >= EPS_UDP_LINE_MAX_NUM)
+        {
+            THROW_RESCODE(NO_ERR);
+        }
+
+        uint64 seqNum = pRecord->applSeqNum;
+        EpsUdpLineArbT* pLineArb = &pDriver->lineArbs[pPacket->lineIndex];
+        EpsAtomicCounterAdd(&pLineArb->stat.recvPackets, 1);
+
+        /* ·ԾΪ·ʧԴлʱ¿ʼ */
+        if (pLineArb->applID[mktType] != pRecord->applID)
+        {
+            pLineArb->applID[mktType] = pRecord->applID;
+            pLineArb->lastSeqNum[mktType] = 0;
+        }
+        uint64 lastSeqNum = pLineArb->lastSeqNum[mktType];
+        if (seqNum > lastSeqNum)
+        {
+            if (lastSeqNum != 0)
+            {
+                EpsAtomicCounterAdd(&pLineArb->stat.lostSeqNums, seqNum - lastSeqNum - 1);
+            }
+            pLineArb->lastSeqNum[mktType] = seqNum;
+        }
+
+        EpsUdpArbSlotT* pSlot = &pDriver->arbHistory[mktType][seqNum & (EPS_UDP_ARB_HISTORY_SIZE - 1)];
+        if (pSlot->seqNum == seqNum && pSlot->applID == pRecord->applID && seqNum != 0)
+        {
+            uint64 lagTime = 0;
+            if (pPacket->recvTime > pSlot->recvTime)
+            {
+                lagTime = pPacket->recvTime - pSlot->recvTime;
+            }
+
+            EpsAtomicCounterAdd(&pLineArb->stat.dupPackets, 1);
+            EpsAtomicCounterAdd(&pLineArb->stat.totalLagTime, lagTime);
+            if (lagTime > pLineArb->stat.maxLagTime)
+            {
+                EpsAtomicStoreRelaxed(&pLineArb->stat.maxLagTime, lagTime);
+            }
+            EpsAtomicCounterAdd(&pDriver->lineArbs[pSlot->lineIndex].stat.totalLeadTime, lagTime);
+
+            *pIsDuplicate = TRUE;
+        }
+        else
+        {
+            pSlot->seqNum = seqNum;
+            pSlot->applID = pRecord->applID;
+            pSlot->lineIndex = pPacket->lineIndex;
+            pSlot->recvTime = pPacket->recvTime;
+
+            EpsAtomicCounterAdd(&pLineArb->stat.winPackets, 1);
+        }
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ݣȱڲ֪ͨû
+ *
+ * @param   pDriver             in  - UDP
+ * @param   pMsg                in  - Ϣ
+ * @param   recvTime            in  - ʱ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+static ResCodeT HandleMktData(EpsUdpDriverT* pDriver, const StepMessageT* pMsg, uint64 recvTime)
+{
+    TRY
+    {
+        EpsMktGapT mktGap;
+        ResCodeT rc = AcceptMktData(&pDriver->database, pMsg, &mktGap);
+        if (NOTOK(rc))
+        {
+            if (rc == ERCD_EPS_MKTDATA_GAP)
+            {
+                FlushMktBatch(&pDriver->batch, pDriver->hid, pDriver->spi.mktDataBatchArrivedNotify);
+                pDriver->spi.mktDataGapNotify(pDriver->hid, &mktGap);
+
+                EpsUdpRecoveryT* pRecovery = EpsAtomicLoad(&pDriver->pRecovery);
+                if (pRecovery != NULL &&
+                    mktGap.endSeqNum - mktGap.beginSeqNum + 1 >= pRecovery->config.gapThreshold)
+                {
+                    THROW_ERROR(StartUdpRecovery(pRecovery, mktGap.mktType));
+                }
+            }
+            else if (rc == ERCD_EPS_DATASOURCE_CHANGED)
+            {
+                pDriver->spi.eventOccurredNotify(pDriver->hid, EPS_EVENTTYPE_WARNING, rc, ErrGetErrorDscr());
+            }
+            else if (rc == ERCD_EPS_MKTTYPE_UNSUBSCRIBED)
+            {
+                THROW_RESCODE(NO_ERR);
+            }
+            else if (rc == ERCD_EPS_MKTDATA_BACKFLOW)
+            {
+                THROW_RESCODE(NO_ERR);
+            }
+            else
+            {
+                THROW_ERROR(rc);
+            }
+        }
+
+        pDriver->recvIdleTimes = 0;
+
+        /* ͨżд빲ڴߣȡй */
+        EpsShmBusT* pShmBus = EpsAtomicLoad(&pDriver->pShmBus);
+        if (pShmBus != NULL)
+        {
+            PublishShmBus(pShmBus, pMsg, recvTime);
+        }
+
+        /* ֤ȯʱݿǼǣ˲Ӱȱڼ */
+        ApplySecFilter(&pDriver->filter);
+
+        EpsMktDataBatchArrivedCallback batchNotify = EpsAtomicLoad(&pDriver->spi.mktDataBatchArrivedNotify);
+        if (IsSubscriberHubEnabled(&pDriver->subscribers))
+        {
+            THROW_ERROR(PublishSubscribers(&pDriver->subscribers, pMsg, recvTime));
+
+            /* δעصʱΪ */
+            if (batchNotify == NULL && pDriver->spi.mktDataViewArrivedNotify == NULL &&
+                pDriver->spi.mktDataArrivedNotify == OnEpsMktDataArrived)
+            {
+                THROW_RESCODE(NO_ERR);
+            }
+        }
+
+        if (IsDispatcherEnabled(&pDriver->dispatcher))
+        {
+            THROW_ERROR(PushDispatcher(&pDriver->dispatcher, pMsg, recvTime));
+        }
+        else if (batchNotify != NULL)
+        {
+            EpsMktDataT* pMktData = NextMktBatchItem(&pDriver->batch);
+            THROW_ERROR(ConvertMktData(pMsg, pMktData));
+
+            pMktData->recvTime = recvTime;
+            if (FilterMktData(&pDriver->filter, pDriver->hid, pMktData) &&
+                CommitMktBatchItem(&pDriver->batch, recvTime))
+            {
+                FlushMktBatch(&pDriver->batch, pDriver->hid, batchNotify);
+            }
+        }
+        else if (pDriver->spi.mktDataViewArrivedNotify != NULL)
+        {
+            EpsMktDataViewT mktDataView;
+            if (IsSecFilterEnabled(&pDriver->filter))
+            {
+                /* дݣȸȡͼ */
+                EpsMktDataT mktData;
+                THROW_ERROR(ConvertMktData(pMsg, &mktData));
+                if (! FilterMktData(&pDriver->filter, pDriver->hid, &mktData))
+                {
+                    THROW_RESCODE(NO_ERR);
+                }
+                GetMktDataView(&mktData, &mktDataView);
+
+                mktDataView.recvTime = recvTime;
+                mktDataView.notifyTime = EpsGetTimestamp();
+                pDriver->spi.mktDataViewArrivedNotify(pDriver->hid, &mktDataView);
+                THROW_RESCODE(NO_ERR);
+            }
+
+            THROW_ERROR(ConvertMktDataView(pMsg, &mktDataView));
+
+            mktDataView.recvTime = recvTime;
+            mktDataView.notifyTime = EpsGetTimestamp();
+            pDriver->spi.mktDataViewArrivedNotify(pDriver->hid, &mktDataView);
+        }
+        else
+        {
+            EpsMktDataT mktData;
+            THROW_ERROR(ConvertMktData(pMsg, &mktData));
+            if (! FilterMktData(&pDriver->filter, pDriver->hid, &mktData))
+            {
+                THROW_RESCODE(NO_ERR);
+            }
+
+            mktData.recvTime = recvTime;
+            mktData.notifyTime = EpsGetTimestamp();
+            pDriver->spi.mktDataArrivedNotify(pDriver->hid, &mktData);
+        }
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * 峬ǰݣȴȱʧ򴰿ڵ
+ *
+ * @param   pDriver             in  - UDP
+ * @param   pMsg                in  - Ϣ
+ * @param   recvTime            in  - ʱ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+static ResCodeT HoldMktData(EpsUdpDriverT* pDriver, const StepMessageT* pMsg, uint64 recvTime)
+{
+    TRY
+    {
+        if (pDriver->reorderCount >= EPS_UDP_REORDER_WINDOW_MAX)
+        {
+            THROW_ERROR(ReleaseMktData(pDriver, TRUE));
+        }
+
+        EpsUdpReorderEntryT* pEntry = &pDriver->reorderBuffer[pDriver->reorderCount];
+        memcpy(&pEntry->msg, pMsg, sizeof(StepMessageT));
+        pEntry->recvTime = recvTime;
+        pDriver->reorderCount++;
+
+        if (pDriver->reorderCount >= EpsAtomicLoad(&pDriver->reorderWindow))
+        {
+            THROW_ERROR(ReleaseMktData(pDriver, FALSE));
+        }
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * Ͷ򻺳е
+ *
+ * ѰͶݵͶݣﵽڻ黺峬ʱʱ
+ * ȴͶݸгС(AcceptMktDataȱ)
+ *
+ * @param   pDriver             in  - UDP
+ * @param   isFlushAll          in  - ǷͶȫ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+static ResCodeT ReleaseMktData(EpsUdpDriverT* pDriver, BOOL isFlushAll)
+{
+    TRY
+    {
+        uint64 expireTime = EpsGetTimestamp() - (uint64)EPS_UDP_REORDER_HOLD_TIME * 1000000;
+
+        while (pDriver->reorderCount > 0)
+        {
+            uint32 releaseIndex = pDriver->reorderCount;
+            uint32 oldestIndex = 0;
+            uint32 i = 0;
+
+            for (i = 0; i < pDriver->reorderCount; i++)
+            {
+                BOOL isAhead = FALSE;
+                THROW_ERROR(CheckMktDataOrder(&pDriver->database, &pDriver->reorderBuffer[i].msg, &isAhead));
+                if (! isAhead)
+                {
+                    releaseIndex = i;
+                    break;
+                }
+
+                if (pDriver->reorderBuffer[i].recvTime < pDriver->reorderBuffer[oldestIndex].recvTime)
+                {
+                    oldestIndex = i;
+                }
+            }
+
+            if (releaseIndex == pDriver->reorderCount)
+            {
+                if (! isFlushAll && 
+                    pDriver->reorderCount < EpsAtomicLoad(&pDriver->reorderWindow) &&
+                    pDriver->reorderBuffer[oldestIndex].recvTime > expireTime)
+                {
+                    break;
+                }
+
+                /* ȴȡ绺ͬгС */
+                const MDSnapshotFullRefreshRecordT* pOldest = 
+                        (const MDSnapshotFullRefreshRecordT*)pDriver->reorderBuffer[oldestIndex].msg.body;
+                releaseIndex = oldestIndex;
+                for (i = 0; i < pDriver->reorderCount; i++)
+                {
+                    const MDSnapshotFullRefreshRecordT* pRecord = 
+                            (const MDSnapshotFullRefreshRecordT*)pDriver->reorderBuffer[i].msg.body;
+                    const MDSnapshotFullRefreshRecordT* pRelease = 
+                            (const MDSnapshotFullRefreshRecordT*)pDriver->reorderBuffer[releaseIndex].msg.body;
+                    if (strcmp(pRecord->securityType, pOldest->securityType) == 0 &&
+                        pRecord->applSeqNum < pRelease->applSeqNum)
+                    {
+                        releaseIndex = i;
+                    }
+                }
+            }
+
+            EpsUdpReorderEntryT* pEntry = &pDriver->reorderBuffer[releaseIndex];
+            ResCodeT rc = HandleMktData(pDriver, &pEntry->msg, pEntry->recvTime);
+
+            pDriver->reorderCount--;
+            if (releaseIndex != pDriver->reorderCount)
+            {
+                memcpy(pEntry, &pDriver->reorderBuffer[pDriver->reorderCount], sizeof(EpsUdpReorderEntryT));
+            }
+            EpsAtomicCounterAdd(&pDriver->reorderedPackets, 1);
+
+            THROW_ERROR(rc);
+        }
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * UDPͨ¼֪ͨ
+ *
+ * @param   pListener               in  - UDP
+ * @param   pEvent                  in  - ¼
+ */
+static void OnChannelEventOccurred(void* pListener, EpsUdpChannelEventT* pEvent)
+{
+    EpsUdpDriverT* pDriver = (EpsUdpDriverT*)pListener;
+
+    switch (pEvent->eventType)
+    {
+        case EPS_UDP_EVENTTYPE_LOGIN:
+        {
+            pDriver->heartbeatIntl = (uint16)pEvent->eventParam;
+            pDriver->spi.loginRspNotify(pDriver->hid, 
+                    pDriver->heartbeatIntl, NO_ERR, "login succeed");
+            break;
+        }
+        case EPS_UDP_EVENTTYPE_LOGOUT:
+        {
+            UnsubscribeAllMktData(&pDriver->database);
+            
+            pDriver->spi.logoutRspNotify(pDriver->hid, 
+                    NO_ERR, "logout succeed");
+            break;
+        }
+        case EPS_UDP_EVENTTYPE_SUBSCRIBED:
+        {
+            EpsMktTypeT mktType = (EpsMktTypeT)(pEvent->eventParam);
+            ResCodeT rc = SubscribeMktData(&pDriver->database, mktType);
+            if (OK(rc))
+            {
+                pDriver->spi.mktDataSubRspNotify(pDriver->hid, 
+                        mktType, NO_ERR, "subscribe succeed");
+            }
+            else
+            {
+                pDriver->spi.mktDataSubRspNotify(pDriver->hid, 
+                        mktType, rc, ErrGetErrorDscr());
+                ErrClearError();
+            }
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+/**
+ * UDPͨݽճʱ֪ͨ
+ *
+ * @param   pDriver             in  - UDP
+ */
+static ResCodeT HandleReceiveTimeout(EpsUdpDriverT* pDriver)
+{
+    TRY
+    {
+        if (pDriver->reorderCount > 0)
+        {
+            THROW_ERROR(ReleaseMktData(pDriver, TRUE));
+        }
+
+        pDriver->recvIdleTimes++;
+        
+        if ((pDriver->recvIdleTimes * EPS_SOCKET_RECV_TIMEOUT) >= EPS_DRIVER_KEEPALIVE_TIME)
+        {
+            ErrSetError(ERCD_EPS_CHECK_KEEPALIVE_TIMEOUT);
+                    
+            pDriver->spi.eventOccurredNotify(pDriver->hid, EPS_EVENTTYPE_WARNING, 
+                        GET_RESCODE(), ErrGetErrorDscr());
+
+            pDriver->recvIdleTimes = 0;
+        }
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ָỰƽỰ״ָ̬鰴źϲUDP
+ *
+ * δȱڵĻָΪٵͶݣUDPѽŵĻָ鰴Ͷݲƽ
+ * ѽţΪָȡ꣬ȱȫָỰ׷UDPʱ
+ * гĻָʱδʱʣȱ
+ *
+ * @param   pDriver             in  - UDP
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+static ResCodeT HandleRecovery(EpsUdpDriverT* pDriver)
+{
+    EpsUdpRecoveryEntryT* pEntry = NULL;
+
+    TRY
+    {
+        EpsUdpRecoveryT* pRecovery = EpsAtomicLoad(&pDriver->pRecovery);
+        EpsMktDatabaseT* pDatabase = &pDriver->database;
+
+        DriveUdpRecovery(pRecovery);
+
+        while (TRUE)
+        {
+            THROW_ERROR(PopUdpRecovery(pRecovery, &pEntry));
+            if (pEntry == NULL)
+            {
+                break;
+            }
+
+            const MDSnapshotFullRefreshRecordT* pRecord = 
+                    (const MDSnapshotFullRefreshRecordT*)pEntry->msg.body;
+            EpsMktTypeT mktType = (EpsMktTypeT)(atoi(pRecord->securityType));
+
+            if (mktType != EPS_MKTTYPE_ALL && mktType <= EPS_MKTTYPE_NUM &&
+                pRecovery->isPending[mktType] && pRecord->applID == pDatabase->applID)
+            {
+                /* ȱڵĿճٵ룬UDPŵĿͬżͶݲƽţ
+                   Ϊ */
+                if (pRecord->applSeqNum > pDatabase->applSeqNum[mktType])
+                {
+                    pRecovery->isCaughtUp[mktType] = TRUE;
+                }
+
+                uint64 gapFilledSeqNums = pDatabase->stat.gapFilledSeqNums;
+                THROW_ERROR(HandleMktData(pDriver, &pEntry->msg, pEntry->recvTime));
+                EpsAtomicCounterAdd(&pRecovery->stat.recoveredSeqNums, 
+                        pDatabase->stat.gapFilledSeqNums - gapFilledSeqNums);
+            }
+
+            free(pEntry);
+            pEntry = NULL;
+        }
+
+        /* ָỰͣгΪһʱΪȡ꣬ⶪδӵĸ¿ */
+        uint64 now = EpsGetTimestamp();
+        uint64 expireTime = now - (uint64)EPS_UDP_RECOVERY_TIMEOUT * 1000000;
+        BOOL isDrained = (now - pRecovery->popTime >= (uint64)EPS_UDP_RECOVERY_DRAIN_TIME * 1000000);
+
+        int32 mktType = 0;
+        for (mktType = EPS_MKTTYPE_ALL + 1; mktType <= EPS_MKTTYPE_NUM; mktType++)
+        {
+            if (! pRecovery->isPending[mktType])
+            {
+                continue;
+            }
+
+            if (pRecovery->beginTime[mktType] < expireTime || (isDrained &&
+                (pRecovery->isCaughtUp[mktType] || pDatabase->gapList[mktType].count == 0)))
+            {
+                THROW_ERROR(FinishRecovery(pDriver, (EpsMktTypeT)mktType));
+            }
+        }
+    }
+    CATCH
+    {
+        if (pEntry != NULL)
+        {
+            free(pEntry);
+        }
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * гָгѽ֮ǰʣȱ
+ *
+ * @param   pDriver             in  - UDP
+ * @param   mktType             in  - г
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+static ResCodeT FinishRecovery(EpsUdpDriverT* pDriver, EpsMktTypeT mktType)
+{
+    TRY
+    {
+        uint64 unrecoveredSeqNums = 0;
+        THROW_ERROR(ResolveMktGap(&pDriver->database, mktType, 
+                pDriver->database.applSeqNum[mktType], &unrecoveredSeqNums));
+        THROW_ERROR(CompleteUdpRecovery(EpsAtomicLoad(&pDriver->pRecovery), mktType, unrecoveredSeqNums));
+
+        if (unrecoveredSeqNums > 0)
+        {
+            char eventText[128];
+            snprintf(eventText, sizeof(eventText), 
+                "market data recovery finished with %llu unrecovered, mktType(%d)", 
+                (unsigned long long)unrecoveredSeqNums, mktType);
+            pDriver->spi.eventOccurredNotify(pDriver->hid, EPS_EVENTTYPE_WARNING, 
+                ERCD_EPS_MKTDATA_GAP, eventText);
+        }
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * 򻺳
+ *
+ * @param   pDriver             in  - UDP
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+static ResCodeT AllocReorderBuffer(EpsUdpDriverT* pDriver)
+{
+    TRY
+    {
+        if (pDriver->reorderBuffer == NULL)
+        {
+            pDriver->reorderBuffer = (EpsUdpReorderEntryT*)calloc(
+                    EPS_UDP_REORDER_WINDOW_MAX, sizeof(EpsUdpReorderEntryT));
+            if (pDriver->reorderBuffer == NULL)
+            {
+                int lstErrno = SYS_ERRNO;
+                THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, EpsGetSystemError(lstErrno));
+            }
+        }
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ַַ
+ *
+ * @param   address                 in  - ַַ
+ * @param   pLines                  out - 鲥·
+ * @param   pLineCount              out - 鲥·
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+static ResCodeT ParseAddress(const char* address, EpsUdpLineT* pLines, uint32* pLineCount)
+{
+    TRY
+    {
+        /* ַʽΪ230.11.1.1:3333;196.123.71.1·'|'ָ */
+        const char* p = address;
+        uint32 lineCount = 0;
+
+        while (TRUE)
+        {
+            const char* pEnd = strchr(p, '|');
+            if (pEnd == NULL)
+            {
+                pEnd = p + strlen(p);
+            }
+
+            if (lineCount >= EPS_UDP_LINE_MAX_NUM)
+            {
+                THROW_ERROR(ERCD_EPS_INVALID_ADDRESS);
+            }
+
+            const char* p1 = memchr(p, ':', pEnd - p);
+            if (p1 == NULL || p1 == p || (p1 - p) > EPS_IP_MAX_LEN)
+            {
+                THROW_ERROR(ERCD_EPS_INVALID_ADDRESS);
+            }
+
+            const char* p2 = memchr(p1 + 1, ';', pEnd - p1 - 1);
+            if (p2 == NULL || (pEnd - p2 - 1) > EPS_IP_MAX_LEN)
+            {
+                THROW_ERROR(ERCD_EPS_INVALID_ADDRESS);
+            }
+
+            EpsUdpLineT* pLine = &pLines[lineCount];
+            memset(pLine->mcAddr, 0x00, sizeof(pLine->mcAddr));
+            memset(pLine->localAddr, 0x00, sizeof(pLine->localAddr));
+            memcpy(pLine->mcAddr, p, (p1 - p));
+            memcpy(pLine->localAddr, p2 + 1, (pEnd - p2 - 1));
+            pLine->mcPort = atoi(p1 + 1);
+            lineCount++;
+
+            if (*pEnd == '\0')
+            {
+                break;
+            }
+            p = pEnd + 1;
+        }
+
+        *pLineCount = lineCount;
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * 鲥·ַıĿ·׽
+ *
+ * @param   pDst                    out - Ŀ·
+ * @param   pSrc                    in  - Դ·
+ * @param   lineCount               in  - ·
+ */
+static void CopyLineAddress(EpsUdpLineT* pDst, const EpsUdpLineT* pSrc, uint32 lineCount)
+{
+    uint32 i = 0;
+    for (i = 0; i < lineCount; i++)
+    {
+        memcpy(pDst[i].localAddr, pSrc[i].localAddr, sizeof(pDst[i].localAddr));
+        memcpy(pDst[i].mcAddr, pSrc[i].mcAddr, sizeof(pDst[i].mcAddr));
+        pDst[i].mcPort = pSrc[i].mcPort;
+    }
+}
+
+/*
+ * Express SPIռλ
+ */
+static void OnEpsConnected(uint32 hid)
+{
+}
+static void OnEpsDisconnected(uint32 hid, ResCodeT result, const char* reason)
+{
+}
+static void OnEpsLoginRsp(uint32 hid, uint16 heartbeatIntl, ResCodeT result, const char* reason)
 {
 }
 static void OnEpsLogoutRsp(uint32 hid, ResCodeT result, const char* reason)
@@ -663,4 +1955,7 @@ static void OnEpsMktStatusChanged(uint32 hid, const EpsMktStatusT* pMktStatus)
 static void OnEpsEventOccurred(uint32 hid, EpsEventTypeT eventType, ResCodeT eventCode, const char* eventText)
 {
 }
+static void OnEpsMktDataGap(uint32 hid, const EpsMktGapT* pMktGap)
+{
+}
 
@@ -33,17 +33,62 @@ DD-MMM-YYYY INIT.    SIR    Modification Description
 
 #include "recMutex.h"
 #include "mktDatabase.h"
+#include "mktBatch.h"
+#include "dispatcher.h"
+#include "subscriber.h"
 #include "udpChannel.h"
+#include "shmBus.h"
+#include "udpRecovery.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 
+/**
+ * 궨
+ */
+
+#define EPS_UDP_REORDER_WINDOW_MAX      64      /* 򻺳崰ֵ */
+#define EPS_UDP_REORDER_HOLD_TIME       5       /* ʱ䣬λ:  */
+#define EPS_UDP_ARB_REORDER_WINDOW      16      /* ·ʱĬ򻺳崰 */
+#define EPS_UDP_ARB_HISTORY_SIZE        256     /* ·ٲü¼(2) */
+
+
 /**
  * Ͷ
  */
 
+/*
+ * 򻺳Ϣ
+ */
+typedef struct EpsUdpReorderEntryTag
+{
+    StepMessageT    msg;                    /* ѽϢ */
+    uint64          recvTime;               /* ʱ() */
+} EpsUdpReorderEntryT;
+
+/*
+ * ·ٲü¼ŵ״εϢ
+ */
+typedef struct EpsUdpArbSlotTag
+{
+    uint64          seqNum;                 /*  */
+    uint32          applID;                 /* ԴID */
+    uint32          lineIndex;              /* ״ε· */
+    uint64          recvTime;               /* ״εʱ() */
+} EpsUdpArbSlotT;
+
+/*
+ * ·ٲ״̬
+ */
+typedef struct EpsUdpLineArbTag
+{
+    uint32          applID[EPS_MKTTYPE_NUM+1];      /* ·гķԴID */
+    uint64          lastSeqNum[EPS_MKTTYPE_NUM+1];  /* ·г */
+    EpsLineStatT    stat;                           /* ·ͳ */
+} EpsUdpLineArbT;
+
 /*
  * UDPṹ
  */
@@ -54,12 +99,27 @@ typedef struct EpsUdpDriverTag
     EpsUdpChannelT  channel;                /* ͨ */
     EpsMktDatabaseT database;               /* ݿ */
     EpsClientSpiT   spi;                    /* ûصӿ */
-    EpsRecMutexT    lock;                   /*  */
+    EpsMktBatchT    batch;                  /* 黺 */
+    EpsDispatcherT  dispatcher;             /* ַ */
+    EpsSecFilterT   filter;                 /* ֤ȯĹ */
+    EpsSubscriberHubT subscribers;          /* ڵĶ߼ */
+    EpsRecMutexT    lock;                   /* : ӹѡã鴦 */
 
-    char   username[EPS_USERNAME_MAX_LEN+1]; /* û˺ */
-    char   password[EPS_PASSWORD_MAX_LEN+1]; /* û */
     uint16 heartbeatIntl;                    /*  */
     uint16 recvIdleTimes;                    /* տм */  
+
+    EpsUdpReorderEntryT* reorderBuffer;      /* 򻺳״ôʱ */
+    uint32 reorderWindow;                    /* 򻺳崰ڣ0ʾ(ԭӷ) */
+    uint32 reorderCount;                     /* е */
+    uint64 reorderedPackets;                 /* 򻺳Ͷݵ */
+
+    EpsUdpLineArbT lineArbs[EPS_UDP_LINE_MAX_NUM];  /* ·ٲ״̬ */
+    EpsUdpArbSlotT arbHistory[EPS_MKTTYPE_NUM+1][EPS_UDP_ARB_HISTORY_SIZE]; /* гٲü¼ */
+
+    EpsUdpRecoveryT* pRecovery;              /* ȱڻָỰ״ʱ䲢ԭӷ */
+    EpsShmBusT* pShmBus;                     /* ڴ߷ˣʱ䲢ԭӷ */
+
+    int    pollFd;                           /* Ӧ߳ģʽµȴ׽ֵepoll-1ʾͨ߳ */
 } EpsUdpDriverT;
 
 
@@ -108,6 +168,72 @@ ResCodeT LogoutUdpDriver(EpsUdpDriverT* pDriver, const char* reason);
  */
 ResCodeT SubscribeUdpDriver(EpsUdpDriverT* pDriver, EpsMktTypeT mktType);
 
+/*
+ *  ȡUDPͳϢ
+ */
+ResCodeT GetUdpDriverStatistics(EpsUdpDriverT* pDriver, EpsStatisticsT* pStat);
+
+/*
+ *  UDPѡ
+ */
+ResCodeT SetUdpDriverOption(EpsUdpDriverT* pDriver, EpsOptionT option, int32 value);
+
+/*
+ *  ȡUDP·ٲͳϢ
+ */
+ResCodeT GetUdpDriverLineStatistics(EpsUdpDriverT* pDriver, EpsLineStatT* pStats, uint32* pCount);
+
+/*
+ *  UDPȱڻָỰ
+ */
+ResCodeT SetUdpDriverRecovery(EpsUdpDriverT* pDriver, const char* address,
+        const char* username, const char* password, uint32 gapThreshold);
+
+/*
+ *  Ӧ߳UDP
+ */
+ResCodeT PollUdpDriver(EpsUdpDriverT* pDriver, uint64 timeout, uint32 maxEvents);
+
+/*
+ *  ȡUDPӦ̵߳ȴ
+ */
+ResCodeT GetUdpDriverFd(EpsUdpDriverT* pDriver, int* pFd);
+
+/*
+ *  UDPû
+ */
+ResCodeT SetUdpDriverMdDataParser(EpsUdpDriverT* pDriver, EpsMdDataParseCallback parser);
+
+/*
+ *  UDPĶ֤ȯ
+ */
+ResCodeT SubscribeUdpDriverSecurities(EpsUdpDriverT* pDriver, const char* securityIDs[], uint32 count);
+
+/*
+ *  UDPĶ
+ */
+ResCodeT AddUdpDriverSubscriber(EpsUdpDriverT* pDriver, const EpsSubscriberConfigT* pConfig, uint32* pSid);
+
+/*
+ *  ɾUDPĶ
+ */
+ResCodeT RemoveUdpDriverSubscriber(EpsUdpDriverT* pDriver, uint32 sid);
+
+/*
+ *  Ӧ߳ͶUDPߵ
+ */
+ResCodeT PollUdpDriverSubscriber(EpsUdpDriverT* pDriver, uint32 sid, uint32 maxCount, uint32* pCount);
+
+/*
+ *  ȡUDPߵͳϢ
+ */
+ResCodeT GetUdpDriverSubscriberStatistics(EpsUdpDriverT* pDriver, uint32 sid, EpsSubscriberStatT* pStat);
+
+/*
+ *  UDPĹڴ߷
+ */
+ResCodeT SetUdpDriverShmPublisher(EpsUdpDriverT* pDriver, const char* name, uint32 slotCount);
+
 
 #ifdef __cplusplus
 }
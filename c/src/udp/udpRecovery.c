@@ -0,0 +1,455 @@
+/*
+ * Copyright (C) 2013, 2014 Shanghai Stock Exchange (SSE), Shanghai, China
+ * All Rights Reserved.
+ */
+
+/**
+ * @file    udpRecovery.c
+ *
+ * UDPȱڻָỰʵļ
+ *
+ * @version $Id
+ * @since   2026/10/18
+ */
+
+/**
+MODIFICATION HISTORY:
+<pre>
+================================================================================
+DD-MMM-YYYY INIT.    SIR    Modification Description
+----------- -------- ------ ----------------------------------------------------
+18-OCT-2026                 
+================================================================================
+</pre>
+*/
+
+/**
+ * ͷļ
+ */
+
+#include "common.h"
+#include "epsTypes.h"
+#include "errlib.h"
+#include "atomic.h"
+#include "errcode.h"
+
+#include "udpRecovery.h"
+
+
+/**
+ * ڲ
+ */
+
+static void OnRecoveryMktData(void* pListener, const StepMessageT* pMsg, uint64 recvTime);
+static void ClearRecoveryQueue(EpsUdpRecoveryT* pRecovery);
+
+
+/**
+ * ʵ
+ */
+
+/**
+ * ʼָỰ
+ *
+ * @param   pRecovery           in  - ָỰ
+ * @param   hid                 in  - UDPID
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT InitUdpRecovery(EpsUdpRecoveryT* pRecovery, uint32 hid)
+{
+    TRY
+    {
+        pRecovery->tcpDriver.hid = hid;
+        THROW_ERROR(InitTcpDriver(&pRecovery->tcpDriver));
+
+        EpsTcpDriverListenerT listener =
+        {
+            pRecovery,
+            OnRecoveryMktData,
+            NULL
+        };
+        THROW_ERROR(RegisterTcpDriverListener(&pRecovery->tcpDriver, &listener));
+
+        THROW_ERROR(InitRingQueue(&pRecovery->queue, EPS_RINGQUEUE_TYPE_SPSC,
+                EPS_UDP_RECOVERY_QUEUE_SIZE, sizeof(EpsUdpRecoveryEntryT*)));
+
+        memset((void*)pRecovery->isPending, 0x00, sizeof(pRecovery->isPending));
+        memset(pRecovery->beginTime, 0x00, sizeof(pRecovery->beginTime));
+        memset(pRecovery->isCaughtUp, 0x00, sizeof(pRecovery->isCaughtUp));
+        pRecovery->popTime = 0;
+        memset(pRecovery->isSubscribed, 0x00, sizeof(pRecovery->isSubscribed));
+        memset(&pRecovery->stat, 0x00, sizeof(pRecovery->stat));
+        pRecovery->isConnectIssued = FALSE;
+        pRecovery->loginTime = 0;
+        pRecovery->lastStatus = EPS_TCP_STATUS_DISCONNECTED;
+        memset(&pRecovery->config, 0x00, sizeof(pRecovery->config));
+        pRecovery->config.gapThreshold = 1;
+        pRecovery->pPendingConfig = NULL;
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ʼָỰ
+ *
+ * @param   pRecovery           in  - ָỰ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT UninitUdpRecovery(EpsUdpRecoveryT* pRecovery)
+{
+    TRY
+    {
+        StopUdpRecovery(pRecovery);
+
+        UninitTcpDriver(&pRecovery->tcpDriver);
+        UninitRingQueue(&pRecovery->queue);
+
+        free(EpsAtomicExchange(&pRecovery->pPendingConfig, NULL));
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ûָỰ
+ *
+ * @param   pRecovery           in  - ָỰ
+ * @param   address             in  - ַָʽͬTCPӵַ
+ * @param   username            in  - ½û
+ * @param   password            in  - ½
+ * @param   gapThreshold        in  - ָȱֵ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ *
+ * memo: UDPͨ߳ApplyUdpRecoveryConfig()ʱȡãµķַڻָỰ´ʱЧ
+ */
+ResCodeT ConfigUdpRecovery(EpsUdpRecoveryT* pRecovery, const char* address,
+        const char* username, const char* password, uint32 gapThreshold)
+{
+    EpsUdpRecoveryConfigT* pConfig = NULL;
+
+    TRY
+    {
+        if (strlen(address) > EPS_UDP_RECOVERY_ADDRESS_MAX_LEN)
+        {
+            THROW_ERROR(ERCD_EPS_INVALID_ADDRESS);
+        }
+
+        if (gapThreshold == 0)
+        {
+            THROW_ERROR(ERCD_EPS_INVALID_PARM, "gapThreshold");
+        }
+
+        pConfig = (EpsUdpRecoveryConfigT*)calloc(1, sizeof(EpsUdpRecoveryConfigT));
+        if (pConfig == NULL)
+        {
+            int lstErrno = SYS_ERRNO;
+            THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, EpsGetSystemError(lstErrno));
+        }
+
+        snprintf(pConfig->address, sizeof(pConfig->address), "%s", address);
+        snprintf(pConfig->username, sizeof(pConfig->username), "%s", username);
+        snprintf(pConfig->password, sizeof(pConfig->password), "%s", password);
+        pConfig->gapThreshold = gapThreshold;
+
+        /* 滻δȡõĲ */
+        free(EpsAtomicExchange(&pRecovery->pPendingConfig, pConfig));
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ȡôЧĻָỰ(UDPͨ߳)
+ *
+ * @param   pRecovery           in  - ָỰ
+ */
+void ApplyUdpRecoveryConfig(EpsUdpRecoveryT* pRecovery)
+{
+    EpsUdpRecoveryConfigT* pConfig = EpsAtomicExchange(&pRecovery->pPendingConfig, NULL);
+    if (pConfig != NULL)
+    {
+        pRecovery->config = *pConfig;
+        free(pConfig);
+    }
+}
+
+/**
+ * гָڻָег¼ʱ
+ *
+ * @param   pRecovery           in  - ָỰ
+ * @param   mktType             in  - г
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT StartUdpRecovery(EpsUdpRecoveryT* pRecovery, EpsMktTypeT mktType)
+{
+    TRY
+    {
+        if (mktType == EPS_MKTTYPE_ALL || mktType > EPS_MKTTYPE_NUM)
+        {
+            THROW_ERROR(ERCD_EPS_INVALID_MKTTYPE);
+        }
+
+        if (! pRecovery->isPending[mktType])
+        {
+            pRecovery->beginTime[mktType] = EpsGetTimestamp();
+            pRecovery->isCaughtUp[mktType] = FALSE;
+            pRecovery->isPending[mktType] = TRUE;
+            EpsAtomicCounterAdd(&pRecovery->stat.recoveryCount, 1);
+        }
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * гָ
+ *
+ * @param   pRecovery           in  - ָỰ
+ * @param   mktType             in  - г
+ * @param   unrecoveredSeqNums  in  - 
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT CompleteUdpRecovery(EpsUdpRecoveryT* pRecovery, EpsMktTypeT mktType, uint64 unrecoveredSeqNums)
+{
+    TRY
+    {
+        if (mktType == EPS_MKTTYPE_ALL || mktType > EPS_MKTTYPE_NUM)
+        {
+            THROW_ERROR(ERCD_EPS_INVALID_MKTTYPE);
+        }
+
+        pRecovery->isPending[mktType] = FALSE;
+        EpsAtomicCounterAdd(&pRecovery->stat.unrecoveredSeqNums, unrecoveredSeqNums);
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ƽָỰӡ½ģ޴ָгʱǳ
+ *
+ * UDPͨ߳ڵãָỰĴӰUDPգ´εʱ
+ *
+ * @param   pRecovery           in  - ָỰ
+ */
+void DriveUdpRecovery(EpsUdpRecoveryT* pRecovery)
+{
+    EpsTcpDriverT* pTcpDriver = &pRecovery->tcpDriver;
+    EpsTcpStatusT status = EpsAtomicLoad(&pTcpDriver->status);
+    ResCodeT rc = NO_ERR;
+
+    ApplyUdpRecoveryConfig(pRecovery);
+
+    if (status != pRecovery->lastStatus)
+    {
+        if (status == EPS_TCP_STATUS_DISCONNECTED ||
+            status == EPS_TCP_STATUS_CONNECTED ||
+            status == EPS_TCP_STATUS_LOGOUT)
+        {
+            memset(pRecovery->isSubscribed, 0x00, sizeof(pRecovery->isSubscribed));
+        }
+        pRecovery->lastStatus = status;
+    }
+
+    BOOL isPending = FALSE;
+    int32 mktType = 0;
+    for (mktType = EPS_MKTTYPE_ALL + 1; mktType <= EPS_MKTTYPE_NUM; mktType++)
+    {
+        isPending = isPending || pRecovery->isPending[mktType];
+    }
+
+    if (isPending)
+    {
+        switch (status)
+        {
+            case EPS_TCP_STATUS_DISCONNECTED:
+            {
+                if (! pRecovery->isConnectIssued)
+                {
+                    rc = ConnectTcpDriver(pTcpDriver, pRecovery->config.address);
+                    pRecovery->isConnectIssued = OK(rc);
+                }
+                break;
+            }
+            case EPS_TCP_STATUS_CONNECTED:
+            case EPS_TCP_STATUS_LOGOUT:
+            {
+                /* ½ܾʱ״̬صѵǳ */
+                uint64 now = EpsGetTimestamp();
+                if (now - pRecovery->loginTime >= (uint64)EPS_CHANNEL_RECONNECT_INTL * 1000000)
+                {
+                    pRecovery->loginTime = now;
+                    rc = LoginTcpDriver(pTcpDriver, pRecovery->config.username,
+                            pRecovery->config.password, EPS_UDP_RECOVERY_HEARTBEAT_INTL);
+                }
+                break;
+            }
+            case EPS_TCP_STATUS_LOGINED:
+            case EPS_TCP_STATUS_PUBLISHING:
+            {
+                for (mktType = EPS_MKTTYPE_ALL + 1; mktType <= EPS_MKTTYPE_NUM && OK(rc); mktType++)
+                {
+                    if (pRecovery->isPending[mktType] && ! pRecovery->isSubscribed[mktType])
+                    {
+                        rc = SubscribeTcpDriver(pTcpDriver, (EpsMktTypeT)mktType);
+                        pRecovery->isSubscribed[mktType] = OK(rc);
+                    }
+                }
+                break;
+            }
+            default:
+                break;
+        }
+    }
+    else if (status == EPS_TCP_STATUS_LOGINED || status == EPS_TCP_STATUS_PUBLISHING)
+    {
+        /* ǳֹͣͣ´λָµ½ȡ */
+        rc = LogoutTcpDriver(pTcpDriver, "recovery completed");
+    }
+
+    if (NOTOK(rc))
+    {
+        ErrClearError();
+    }
+}
+
+/**
+ * ӻָȡ飬ɵͷ
+ *
+ * @param   pRecovery           in  - ָỰ
+ * @param   ppEntry             out - ָ飬ΪʱΪNULL
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT PopUdpRecovery(EpsUdpRecoveryT* pRecovery, EpsUdpRecoveryEntryT** ppEntry)
+{
+    TRY
+    {
+        if (PopRingQueue(&pRecovery->queue, ppEntry, 1) == 0)
+        {
+            *ppEntry = NULL;
+        }
+        else
+        {
+            pRecovery->popTime = EpsGetTimestamp();
+        }
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ָֹͣỰϿTCPӲδĻָ
+ *
+ * @param   pRecovery           in  - ָỰ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT StopUdpRecovery(EpsUdpRecoveryT* pRecovery)
+{
+    TRY
+    {
+        memset((void*)pRecovery->isPending, 0x00, sizeof(pRecovery->isPending));
+
+        if (pRecovery->isConnectIssued)
+        {
+            THROW_ERROR(DisconnectTcpDriver(&pRecovery->tcpDriver));
+            pRecovery->isConnectIssued = FALSE;
+        }
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        ClearRecoveryQueue(pRecovery);
+
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ָỰ֪ͨ(TCPͨ߳)
+ *
+ * @param   pListener           in  - ָỰ
+ * @param   pMsg                in  - Ϣ
+ * @param   recvTime            in  - ʱ
+ */
+static void OnRecoveryMktData(void* pListener, const StepMessageT* pMsg, uint64 recvTime)
+{
+    EpsUdpRecoveryT* pRecovery = (EpsUdpRecoveryT*)pListener;
+    const MDSnapshotFullRefreshRecordT* pRecord = (const MDSnapshotFullRefreshRecordT*)pMsg->body;
+
+    EpsMktTypeT mktType = (EpsMktTypeT)(atoi(pRecord->securityType));
+    if (mktType == EPS_MKTTYPE_ALL || mktType > EPS_MKTTYPE_NUM || ! pRecovery->isPending[mktType])
+    {
+        return;
+    }
+
+    EpsUdpRecoveryEntryT* pEntry = (EpsUdpRecoveryEntryT*)calloc(1, sizeof(EpsUdpRecoveryEntryT));
+    if (pEntry == NULL)
+    {
+        EpsAtomicCounterAdd(&pRecovery->stat.droppedPackets, 1);
+        return;
+    }
+    memcpy(&pEntry->msg, pMsg, sizeof(StepMessageT));
+    pEntry->recvTime = recvTime;
+
+    if (NOTOK(PushRingQueue(&pRecovery->queue, &pEntry)))
+    {
+        free(pEntry);
+        EpsAtomicCounterAdd(&pRecovery->stat.droppedPackets, 1);
+        ErrClearError();
+    }
+}
+
+/**
+ * ָ
+ *
+ * @param   pRecovery           in  - ָỰ
+ */
+static void ClearRecoveryQueue(EpsUdpRecoveryT* pRecovery)
+{
+    EpsUdpRecoveryEntryT* pEntry = NULL;
+    while (PopRingQueue(&pRecovery->queue, &pEntry, 1) > 0)
+    {
+        free(pEntry);
+        pEntry = NULL;
+    }
+}
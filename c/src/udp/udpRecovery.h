@@ -0,0 +1,171 @@
+/*
+ * Copyright (C) 2013, 2014 Shanghai Stock Exchange (SSE), Shanghai, China
+ * All Rights Reserved.
+ */
+
+/**
+ * @file    udpRecovery.h
+ *
+ * UDPȱڻָỰͷļ
+ *
+ * @version $Id
+ * @since   2026/10/18
+ */
+
+/**
+MODIFICATION HISTORY:
+<pre>
+================================================================================
+DD-MMM-YYYY INIT.    SIR    Modification Description
+----------- -------- ------ ----------------------------------------------------
+18-OCT-2026                 
+================================================================================
+</pre>
+*/
+
+#ifndef EPS_UDP_RECOVERY_H
+#define EPS_UDP_RECOVERY_H
+
+/**
+ * ͷļ
+ */
+
+#include "common.h"
+#include "epsTypes.h"
+#include "ringQueue.h"
+#include "tcpDriver.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**
+ * 궨
+ */
+
+#define EPS_UDP_RECOVERY_ADDRESS_MAX_LEN    64          /* ַָ󳤶 */
+#define EPS_UDP_RECOVERY_QUEUE_SIZE         4096        /* ָг */
+#define EPS_UDP_RECOVERY_TIMEOUT            (10*1000)   /* λָʱ䣬λ:  */
+#define EPS_UDP_RECOVERY_DRAIN_TIME         100         /* ָгΪնΪȡ꣬λ:  */
+#define EPS_UDP_RECOVERY_HEARTBEAT_INTL     30          /* ָỰڣλ:  */
+
+
+/**
+ * Ͷ
+ */
+
+/*
+ * ָ
+ */
+typedef struct EpsUdpRecoveryEntryTag
+{
+    StepMessageT    msg;                    /* ָỰյϢ */
+    uint64          recvTime;               /* ʱ() */
+} EpsUdpRecoveryEntryT;
+
+/*
+ * ָỰ
+ */
+typedef struct EpsUdpRecoveryConfigTag
+{
+    char            address[EPS_UDP_RECOVERY_ADDRESS_MAX_LEN+1];/* ַָ */
+    char            username[EPS_USERNAME_MAX_LEN+1];           /* û˺ */
+    char            password[EPS_PASSWORD_MAX_LEN+1];           /* û */
+    uint32          gapThreshold;           /* ָȱֵ */
+} EpsUdpRecoveryConfigT;
+
+/*
+ * ָͳ
+ */
+typedef struct EpsUdpRecoveryStatTag
+{
+    uint64          recoveryCount;          /* ָĴ */
+    uint64          recoveredSeqNums;       /* ָỰ */
+    uint64          unrecoveredSeqNums;     /* ָʱδ */
+    uint64          droppedPackets;         /* ָ */
+} EpsUdpRecoveryStatT;
+
+/*
+ * ָỰṹ
+ *
+ * ָỰTCPͨ߳аָУUDPͨ߳ȡźϲ
+ * û߳õĲpPendingConfigUDP̣ͨ߳
+ */
+typedef struct EpsUdpRecoveryTag
+{
+    EpsTcpDriverT   tcpDriver;              /* ָỰTCP */
+
+    EpsUdpRecoveryConfigT  config;          /* ǰЧĲUDP̷ͨ߳ */
+    EpsUdpRecoveryConfigT* pPendingConfig;  /* ЧĲԭӽȡ */
+
+    volatile BOOL   isPending[EPS_MKTTYPE_NUM+1];   /* гָ */
+    uint64          beginTime[EPS_MKTTYPE_NUM+1];   /* гָʼʱ() */
+    BOOL            isCaughtUp[EPS_MKTTYPE_NUM+1];  /* ָѳUDPѽűǣUDP̷ͨ߳ */
+    uint64          popTime;                /* һȡָʱ() */
+    BOOL            isSubscribed[EPS_MKTTYPE_NUM+1];/* ε½Ѷı */
+    BOOL            isConnectIssued;        /* ѷӱ */
+    uint64          loginTime;              /* һη½ʱ() */
+    EpsTcpStatusT   lastStatus;             /* ϴμʱTCP״̬ */
+
+    EpsRingQueueT   queue;                  /* ָ(ߵߣָ) */
+    EpsUdpRecoveryStatT stat;               /* ָͳ */
+} EpsUdpRecoveryT;
+
+
+/**
+ * 
+ */
+
+/*
+ * ʼָỰ
+ */
+ResCodeT InitUdpRecovery(EpsUdpRecoveryT* pRecovery, uint32 hid);
+
+/*
+ * ʼָỰ
+ */
+ResCodeT UninitUdpRecovery(EpsUdpRecoveryT* pRecovery);
+
+/*
+ * ûָỰ
+ */
+ResCodeT ConfigUdpRecovery(EpsUdpRecoveryT* pRecovery, const char* address,
+        const char* username, const char* password, uint32 gapThreshold);
+
+/*
+ * ȡôЧĻָỰ
+ */
+void ApplyUdpRecoveryConfig(EpsUdpRecoveryT* pRecovery);
+
+/*
+ * гָ
+ */
+ResCodeT StartUdpRecovery(EpsUdpRecoveryT* pRecovery, EpsMktTypeT mktType);
+
+/*
+ * гָ
+ */
+ResCodeT CompleteUdpRecovery(EpsUdpRecoveryT* pRecovery, EpsMktTypeT mktType, uint64 unrecoveredSeqNums);
+
+/*
+ * ƽָỰӡ½
+ */
+void DriveUdpRecovery(EpsUdpRecoveryT* pRecovery);
+
+/*
+ * ӻָȡ
+ */
+ResCodeT PopUdpRecovery(EpsUdpRecoveryT* pRecovery, EpsUdpRecoveryEntryT** ppEntry);
+
+/*
+ * ָֹͣỰ
+ */
+ResCodeT StopUdpRecovery(EpsUdpRecoveryT* pRecovery);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* EPS_UDP_RECOVERY_H */
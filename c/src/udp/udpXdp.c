@@ -0,0 +1,642 @@
+/*
+ * Copyright (C) 2013, 2014 Shanghai Stock Exchange (SSE), Shanghai, China
+ * All Rights Reserved.
+ */
+
+/**
+ * @file    udpXdp.c
+ *
+ * UDP鲥AF_XDPʵļ
+ *
+ * 鲥ӿϹXDP򣬽ĿĵַͶ˿붩鲥һµUDPݱض
+ * AF_XDP׽֣౨(ƬIPѡı)ԽںЭջ
+ *
+ * @version $Id
+ * @since   2026/10/18
+ */
+
+/**
+MODIFICATION HISTORY:
+<pre>
+================================================================================
+DD-MMM-YYYY INIT.    SIR    Modification Description
+----------- -------- ------ ----------------------------------------------------
+18-OCT-2026                 
+================================================================================
+</pre>
+*/
+
+/**
+ * ͷļ
+ */
+
+#include "common.h"
+#include "epsTypes.h"
+#include "errlib.h"
+#include "errcode.h"
+
+#include "udpChannel.h"
+#include "udpXdp.h"
+
+#if defined(__LINUX__)
+
+#include <ifaddrs.h>
+#include <net/if.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <linux/bpf.h>
+#include <linux/if_link.h>
+#include <linux/if_xdp.h>
+
+#ifndef AF_XDP
+#define AF_XDP                          44
+#endif
+
+#ifndef SOL_XDP
+#define SOL_XDP                         283
+#endif
+
+
+/**
+ * 궨
+ */
+
+#define EPS_XDP_ETH_HDR_LEN             14      /* ̫ͷ */
+#define EPS_XDP_IP_HDR_LEN              20      /* ѡIPͷ */
+#define EPS_XDP_UDP_HDR_LEN             8       /* UDPͷ */
+#define EPS_XDP_XSKMAP_SIZE             64      /* XSKMAP */
+#define EPS_XDP_PROG_MAX_LEN            32      /* XDPָ */
+
+/* BPFָ */
+#define EPS_BPF_INSN(_code, _dst, _src, _off, _imm)     \
+    { (_code), (_dst), (_src), (_off), (_imm) }
+
+
+/**
+ * ڲ
+ */
+
+static ResCodeT GetInterfaceIndex(const char* localAddr, uint32* pIfIndex);
+static ResCodeT SetupUmem(EpsUdpXdpT* pXdp);
+static ResCodeT MapRing(EpsUdpXdpT* pXdp, EpsUdpXdpRingT* pRing,
+        const struct xdp_ring_offset* pOffset, uint32 descSize, uint64 pgoff);
+static ResCodeT LoadXdpProgram(EpsUdpXdpT* pXdp, const char* mcAddr, uint16 mcPort);
+static ResCodeT AttachXdpProgram(EpsUdpXdpT* pXdp, uint32 ifIndex, EpsUdpXdpModeT mode);
+static void UnmapRing(EpsUdpXdpRingT* pRing);
+
+
+/**
+ * ʵ
+ */
+
+/**
+ * ʼAF_XDPն
+ *
+ * @param   pXdp                in  - AF_XDPն
+ */
+void InitUdpXdp(EpsUdpXdpT* pXdp)
+{
+    memset(pXdp, 0x00, sizeof(EpsUdpXdpT));
+    pXdp->xsk    = -1;
+    pXdp->mapFd  = -1;
+    pXdp->progFd = -1;
+    pXdp->linkFd = -1;
+}
+
+/**
+ * AF_XDP
+ *
+ * @param   pXdp                in  - AF_XDPն
+ * @param   mode                in  - AF_XDPģʽ
+ * @param   queueId             in  - 󶨵նк
+ * @param   localAddr           in  - ؽӿڵַ
+ * @param   mcAddr              in  - 鲥ַ
+ * @param   mcPort              in  - 鲥˿
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+ResCodeT OpenUdpXdp(EpsUdpXdpT* pXdp, EpsUdpXdpModeT mode, uint32 queueId,
+        const char* localAddr, const char* mcAddr, uint16 mcPort)
+{
+    TRY
+    {
+        if (queueId >= EPS_XDP_XSKMAP_SIZE)
+        {
+            THROW_ERROR(ERCD_EPS_INVALID_PARM, "queueId");
+        }
+
+        uint32 ifIndex = 0;
+        THROW_ERROR(GetInterfaceIndex(localAddr, &ifIndex));
+
+        union bpf_attr attr;
+        memset(&attr, 0x00, sizeof(attr));
+        attr.map_type    = BPF_MAP_TYPE_XSKMAP;
+        attr.key_size    = sizeof(uint32);
+        attr.value_size  = sizeof(int);
+        attr.max_entries = EPS_XDP_XSKMAP_SIZE;
+        pXdp->mapFd = (int)syscall(__NR_bpf, BPF_MAP_CREATE, &attr, sizeof(attr));
+        if (pXdp->mapFd < 0)
+        {
+            THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, EpsGetSystemError(SYS_ERRNO));
+        }
+
+        /* ȹXDP򣬹ʧʱռ */
+        THROW_ERROR(LoadXdpProgram(pXdp, mcAddr, mcPort));
+        THROW_ERROR(AttachXdpProgram(pXdp, ifIndex, mode));
+
+        pXdp->xsk = socket(AF_XDP, SOCK_RAW, 0);
+        if (pXdp->xsk < 0)
+        {
+            THROW_ERROR(ERCD_EPS_SOCKET_ERROR, EpsGetSystemError(NET_ERRNO));
+        }
+
+        THROW_ERROR(SetupUmem(pXdp));
+
+        struct sockaddr_xdp sxdp;
+        memset(&sxdp, 0x00, sizeof(sxdp));
+        sxdp.sxdp_family   = AF_XDP;
+        sxdp.sxdp_ifindex  = ifIndex;
+        sxdp.sxdp_queue_id = queueId;
+        if (bind(pXdp->xsk, (struct sockaddr*)&sxdp, sizeof(sxdp)) != 0)
+        {
+            THROW_ERROR(ERCD_EPS_SOCKET_ERROR, EpsGetSystemError(NET_ERRNO));
+        }
+
+        memset(&attr, 0x00, sizeof(attr));
+        attr.map_fd = pXdp->mapFd;
+        attr.key    = (uint64)(unsigned long)&queueId;
+        attr.value  = (uint64)(unsigned long)&pXdp->xsk;
+        attr.flags  = BPF_ANY;
+        if (syscall(__NR_bpf, BPF_MAP_UPDATE_ELEM, &attr, sizeof(attr)) != 0)
+        {
+            THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, EpsGetSystemError(SYS_ERRNO));
+        }
+    }
+    CATCH
+    {
+        CloseUdpXdp(pXdp);
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * رAF_XDPգرչӼӽӿжXDP
+ *
+ * @param   pXdp                in  - AF_XDPն
+ */
+void CloseUdpXdp(EpsUdpXdpT* pXdp)
+{
+    if (pXdp->linkFd >= 0)
+    {
+        close(pXdp->linkFd);
+    }
+
+    if (pXdp->progFd >= 0)
+    {
+        close(pXdp->progFd);
+    }
+
+    if (pXdp->mapFd >= 0)
+    {
+        close(pXdp->mapFd);
+    }
+
+    UnmapRing(&pXdp->rxRing);
+    UnmapRing(&pXdp->compRing);
+    UnmapRing(&pXdp->fillRing);
+
+    if (pXdp->xsk >= 0)
+    {
+        close(pXdp->xsk);
+    }
+
+    if (pXdp->umem != NULL)
+    {
+        munmap(pXdp->umem, (size_t)EPS_UDP_XDP_FRAME_SIZE * EPS_UDP_XDP_FRAME_COUNT);
+    }
+
+    InitUdpXdp(pXdp);
+}
+
+/**
+ * жAF_XDPǷ
+ *
+ * @param   pXdp                in  - AF_XDPն
+ *
+ * @return  Ѵ򿪷TRUE򷵻FALSE
+ */
+BOOL IsUdpXdpOpened(EpsUdpXdpT* pXdp)
+{
+    return (pXdp->linkFd >= 0);
+}
+
+/**
+ * AF_XDPݱݱֱָUMEM֡еUDPغ
+ *
+ * @param   pXdp                in  - AF_XDPն
+ * @param   pPackets            out - ݱ
+ * @param   maxCount            in  - ݱ鳤
+ * @param   pPacketCount        out - յݱ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ *
+ * memo: ݱɺReleaseUdpXdp()黹֡
+ */
+ResCodeT ReceiveUdpXdp(EpsUdpXdpT* pXdp, struct EpsUdpPacketTag* pPackets,
+        uint32 maxCount, uint32* pPacketCount)
+{
+    TRY
+    {
+        EpsUdpXdpRingT* pRing = &pXdp->rxRing;
+        struct xdp_desc* descs = (struct xdp_desc*)pRing->ring;
+
+        uint32 cons = *pRing->consumer;
+        uint32 prod = __atomic_load_n(pRing->producer, __ATOMIC_ACQUIRE);
+        uint32 count = prod - cons;
+        if (count > maxCount)
+        {
+            count = maxCount;
+        }
+        if (count > EPS_UDP_XDP_BATCH_SIZE)
+        {
+            count = EPS_UDP_XDP_BATCH_SIZE;
+        }
+
+        uint32 packetCount = 0;
+        uint32 i = 0;
+        for (i = 0; i < count; i++)
+        {
+            const struct xdp_desc* pDesc = &descs[(cons + i) & pRing->mask];
+            const uint8* frame = (const uint8*)(pXdp->umem + pDesc->addr);
+            uint32 frameLen = pDesc->len;
+
+            pXdp->frameAddrs[i] = pDesc->addr & ~((uint64)EPS_UDP_XDP_FRAME_SIZE - 1);
+
+            /* XDPɹˣ˴λUDPغ */
+            uint32 ipHdrLen = (frame[EPS_XDP_ETH_HDR_LEN] & 0x0F) * 4;
+            uint32 udpOffset = EPS_XDP_ETH_HDR_LEN + ipHdrLen;
+            if (udpOffset + EPS_XDP_UDP_HDR_LEN > frameLen)
+            {
+                continue;
+            }
+
+            uint32 udpLen = ((uint32)frame[udpOffset+4] << 8) | frame[udpOffset+5];
+            if (udpLen <= EPS_XDP_UDP_HDR_LEN || udpOffset + udpLen > frameLen)
+            {
+                continue;
+            }
+
+            pPackets[packetCount].data = (const char*)(frame + udpOffset + EPS_XDP_UDP_HDR_LEN);
+            pPackets[packetCount].dataLen = udpLen - EPS_XDP_UDP_HDR_LEN;
+            packetCount++;
+        }
+
+        pXdp->rxPending = count;
+        *pPacketCount = packetCount;
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * 黹ѽյAF_XDP֡价
+ *
+ * @param   pXdp                in  - AF_XDPն
+ */
+void ReleaseUdpXdp(EpsUdpXdpT* pXdp)
+{
+    if (pXdp->rxPending == 0)
+    {
+        return;
+    }
+
+    EpsUdpXdpRingT* pFill = &pXdp->fillRing;
+    uint64* addrs = (uint64*)pFill->ring;
+    uint32 prod = *pFill->producer;
+
+    /* 价ջȳ֡黹ʱ */
+    uint32 i = 0;
+    for (i = 0; i < pXdp->rxPending; i++)
+    {
+        addrs[(prod + i) & pFill->mask] = pXdp->frameAddrs[i];
+    }
+    __atomic_store_n(pFill->producer, prod + pXdp->rxPending, __ATOMIC_RELEASE);
+    __atomic_store_n(pXdp->rxRing.consumer, *pXdp->rxRing.consumer + pXdp->rxPending, __ATOMIC_RELEASE);
+
+    pXdp->rxPending = 0;
+}
+
+/**
+ * ݱصַȡӿ
+ *
+ * @param   localAddr           in  - ؽӿڵַ
+ * @param   pIfIndex            out - ӿ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+static ResCodeT GetInterfaceIndex(const char* localAddr, uint32* pIfIndex)
+{
+    struct ifaddrs* pIfList = NULL;
+
+    TRY
+    {
+        if (getifaddrs(&pIfList) != 0)
+        {
+            THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, EpsGetSystemError(SYS_ERRNO));
+        }
+
+        in_addr_t addr = inet_addr(localAddr);
+        struct ifaddrs* pIf = NULL;
+        for (pIf = pIfList; pIf != NULL; pIf = pIf->ifa_next)
+        {
+            if (pIf->ifa_addr == NULL || pIf->ifa_addr->sa_family != AF_INET)
+            {
+                continue;
+            }
+
+            if (((struct sockaddr_in*)pIf->ifa_addr)->sin_addr.s_addr == addr)
+            {
+                *pIfIndex = if_nametoindex(pIf->ifa_name);
+                THROW_RESCODE(NO_ERR);
+            }
+        }
+
+        THROW_ERROR(ERCD_EPS_INVALID_ADDRESS);
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        if (pIfList != NULL)
+        {
+            freeifaddrs(pIfList);
+        }
+
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * עUMEMӳ价ɻͽջ֡Ԥȷ价
+ *
+ * @param   pXdp                in  - AF_XDPն
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+static ResCodeT SetupUmem(EpsUdpXdpT* pXdp)
+{
+    TRY
+    {
+        size_t umemLen = (size_t)EPS_UDP_XDP_FRAME_SIZE * EPS_UDP_XDP_FRAME_COUNT;
+        void* ptr = mmap(NULL, umemLen, PROT_READ | PROT_WRITE,
+                MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (ptr == MAP_FAILED)
+        {
+            THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, EpsGetSystemError(SYS_ERRNO));
+        }
+        pXdp->umem = (char*)ptr;
+
+        struct xdp_umem_reg reg;
+        memset(&reg, 0x00, sizeof(reg));
+        reg.addr       = (uint64)(unsigned long)ptr;
+        reg.len        = umemLen;
+        reg.chunk_size = EPS_UDP_XDP_FRAME_SIZE;
+        if (setsockopt(pXdp->xsk, SOL_XDP, XDP_UMEM_REG, &reg, sizeof(reg)) != 0)
+        {
+            THROW_ERROR(ERCD_EPS_SOCKET_ERROR, EpsGetSystemError(NET_ERRNO));
+        }
+
+        int ringSize = EPS_UDP_XDP_FRAME_COUNT;
+        if (setsockopt(pXdp->xsk, SOL_XDP, XDP_UMEM_FILL_RING, &ringSize, sizeof(ringSize)) != 0 ||
+            setsockopt(pXdp->xsk, SOL_XDP, XDP_UMEM_COMPLETION_RING, &ringSize, sizeof(ringSize)) != 0 ||
+            setsockopt(pXdp->xsk, SOL_XDP, XDP_RX_RING, &ringSize, sizeof(ringSize)) != 0)
+        {
+            THROW_ERROR(ERCD_EPS_SOCKET_ERROR, EpsGetSystemError(NET_ERRNO));
+        }
+
+        struct xdp_mmap_offsets offsets;
+        socklen_t optLen = sizeof(offsets);
+        if (getsockopt(pXdp->xsk, SOL_XDP, XDP_MMAP_OFFSETS, &offsets, &optLen) != 0)
+        {
+            THROW_ERROR(ERCD_EPS_SOCKET_ERROR, EpsGetSystemError(NET_ERRNO));
+        }
+
+        THROW_ERROR(MapRing(pXdp, &pXdp->fillRing, &offsets.fr, sizeof(uint64), XDP_UMEM_PGOFF_FILL_RING));
+        THROW_ERROR(MapRing(pXdp, &pXdp->compRing, &offsets.cr, sizeof(uint64), XDP_UMEM_PGOFF_COMPLETION_RING));
+        THROW_ERROR(MapRing(pXdp, &pXdp->rxRing, &offsets.rx, sizeof(struct xdp_desc), XDP_PGOFF_RX_RING));
+
+        uint64* addrs = (uint64*)pXdp->fillRing.ring;
+        uint32 i = 0;
+        for (i = 0; i < EPS_UDP_XDP_FRAME_COUNT; i++)
+        {
+            addrs[i] = (uint64)i * EPS_UDP_XDP_FRAME_SIZE;
+        }
+        __atomic_store_n(pXdp->fillRing.producer, EPS_UDP_XDP_FRAME_COUNT, __ATOMIC_RELEASE);
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * ӳAF_XDP
+ *
+ * @param   pXdp                in  - AF_XDPն
+ * @param   pRing               out - ṹ
+ * @param   pOffset             in  - ƫ
+ * @param   descSize            in  - 
+ * @param   pgoff               in  - ӳƫ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+static ResCodeT MapRing(EpsUdpXdpT* pXdp, EpsUdpXdpRingT* pRing,
+        const struct xdp_ring_offset* pOffset, uint32 descSize, uint64 pgoff)
+{
+    TRY
+    {
+        size_t mapLen = pOffset->desc + (size_t)EPS_UDP_XDP_FRAME_COUNT * descSize;
+        void* ptr = mmap(NULL, mapLen, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                pXdp->xsk, pgoff);
+        if (ptr == MAP_FAILED)
+        {
+            THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, EpsGetSystemError(SYS_ERRNO));
+        }
+
+        pRing->map      = ptr;
+        pRing->mapLen   = mapLen;
+        pRing->producer = (uint32*)((char*)ptr + pOffset->producer);
+        pRing->consumer = (uint32*)((char*)ptr + pOffset->consumer);
+        pRing->ring     = (char*)ptr + pOffset->desc;
+        pRing->mask     = EPS_UDP_XDP_FRAME_COUNT - 1;
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * AF_XDPӳ
+ *
+ * @param   pRing               in  - ṹ
+ */
+static void UnmapRing(EpsUdpXdpRingT* pRing)
+{
+    if (pRing->map != NULL)
+    {
+        munmap(pRing->map, pRing->mapLen);
+    }
+    memset(pRing, 0x00, sizeof(EpsUdpXdpRingT));
+}
+
+/**
+ * XDP˳
+ *
+ * ƥ IPv4(ѡδƬ)/UDP ĿĵַͶ˿鲥һµıģ
+ * նкضXSKMAPеAF_XDP׽֣౨ĽںЭջ
+ *
+ * @param   pXdp                in  - AF_XDPն
+ * @param   mcAddr              in  - 鲥ַ
+ * @param   mcPort              in  - 鲥˿
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+static ResCodeT LoadXdpProgram(EpsUdpXdpT* pXdp, const char* mcAddr, uint16 mcPort)
+{
+    TRY
+    {
+        /* ȽֵֽڴеĲȡֵֽ޹ */
+        int32 ethTypeIp = htons(0x0800);
+        int32 fragMask  = htons(0x3FFF);
+        int32 dstAddr   = (int32)inet_addr(mcAddr);
+        int32 dstPort   = htons(mcPort);
+
+        struct bpf_insn prog[EPS_XDP_PROG_MAX_LEN] =
+        {
+            /* 0: r6 = ctx */
+            EPS_BPF_INSN(BPF_ALU64 | BPF_MOV | BPF_X, 6, 1, 0, 0),
+            /* 1-2: r2 = data, r3 = data_end */
+            EPS_BPF_INSN(BPF_LDX | BPF_MEM | BPF_W, 2, 1, 0, 0),
+            EPS_BPF_INSN(BPF_LDX | BPF_MEM | BPF_W, 3, 1, 4, 0),
+            /* 3-5: if (data + eth + ip + udp > data_end) goto pass */
+            EPS_BPF_INSN(BPF_ALU64 | BPF_MOV | BPF_X, 4, 2, 0, 0),
+            EPS_BPF_INSN(BPF_ALU64 | BPF_ADD | BPF_K, 4, 0, 0,
+                    EPS_XDP_ETH_HDR_LEN + EPS_XDP_IP_HDR_LEN + EPS_XDP_UDP_HDR_LEN),
+            EPS_BPF_INSN(BPF_JMP | BPF_JGT | BPF_X, 4, 3, 19, 0),
+            /* 6-7: eth type == IPv4 */
+            EPS_BPF_INSN(BPF_LDX | BPF_MEM | BPF_H, 5, 2, 12, 0),
+            EPS_BPF_INSN(BPF_JMP | BPF_JNE | BPF_K, 5, 0, 17, ethTypeIp),
+            /* 8-9: version 4, IPѡ */
+            EPS_BPF_INSN(BPF_LDX | BPF_MEM | BPF_B, 5, 2, 14, 0),
+            EPS_BPF_INSN(BPF_JMP | BPF_JNE | BPF_K, 5, 0, 15, 0x45),
+            /* 10-11: protocol == UDP */
+            EPS_BPF_INSN(BPF_LDX | BPF_MEM | BPF_B, 5, 2, 23, 0),
+            EPS_BPF_INSN(BPF_JMP | BPF_JNE | BPF_K, 5, 0, 13, 17),
+            /* 12-14: δƬ */
+            EPS_BPF_INSN(BPF_LDX | BPF_MEM | BPF_H, 5, 2, 20, 0),
+            EPS_BPF_INSN(BPF_ALU64 | BPF_AND | BPF_K, 5, 0, 0, fragMask),
+            EPS_BPF_INSN(BPF_JMP | BPF_JNE | BPF_K, 5, 0, 10, 0),
+            /* 15-16: Ŀĵַ == 鲥ַ */
+            EPS_BPF_INSN(BPF_LDX | BPF_MEM | BPF_W, 5, 2, 30, 0),
+            EPS_BPF_INSN(BPF_JMP32 | BPF_JNE | BPF_K, 5, 0, 8, dstAddr),
+            /* 17-18: ĿĶ˿ == 鲥˿ */
+            EPS_BPF_INSN(BPF_LDX | BPF_MEM | BPF_H, 5, 2, 36, 0),
+            EPS_BPF_INSN(BPF_JMP | BPF_JNE | BPF_K, 5, 0, 6, dstPort),
+            /* 19: r2 = rx_queue_index */
+            EPS_BPF_INSN(BPF_LDX | BPF_MEM | BPF_W, 2, 6, 16, 0),
+            /* 20-21: r1 = xskmap */
+            EPS_BPF_INSN(BPF_LD | BPF_DW | BPF_IMM, 1, BPF_PSEUDO_MAP_FD, 0, pXdp->mapFd),
+            EPS_BPF_INSN(0, 0, 0, 0, 0),
+            /* 22-24: return bpf_redirect_map(xskmap, queue, XDP_PASS) */
+            EPS_BPF_INSN(BPF_ALU64 | BPF_MOV | BPF_K, 3, 0, 0, XDP_PASS),
+            EPS_BPF_INSN(BPF_JMP | BPF_CALL, 0, 0, 0, BPF_FUNC_redirect_map),
+            EPS_BPF_INSN(BPF_JMP | BPF_EXIT, 0, 0, 0, 0),
+            /* 25-26: pass: return XDP_PASS */
+            EPS_BPF_INSN(BPF_ALU64 | BPF_MOV | BPF_K, 0, 0, 0, XDP_PASS),
+            EPS_BPF_INSN(BPF_JMP | BPF_EXIT, 0, 0, 0, 0),
+        };
+
+        union bpf_attr attr;
+        memset(&attr, 0x00, sizeof(attr));
+        attr.prog_type = BPF_PROG_TYPE_XDP;
+        attr.insns     = (uint64)(unsigned long)prog;
+        attr.insn_cnt  = 27;
+        attr.license   = (uint64)(unsigned long)"Dual BSD/GPL";
+
+        pXdp->progFd = (int)syscall(__NR_bpf, BPF_PROG_LOAD, &attr, sizeof(attr));
+        if (pXdp->progFd < 0)
+        {
+            THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, EpsGetSystemError(SYS_ERRNO));
+        }
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+/**
+ * XDPӿ
+ *
+ * @param   pXdp                in  - AF_XDPն
+ * @param   ifIndex             in  - ӿ
+ * @param   mode                in  - AF_XDPģʽ
+ *
+ * @return  ɹNO_ERR򷵻ش
+ */
+static ResCodeT AttachXdpProgram(EpsUdpXdpT* pXdp, uint32 ifIndex, EpsUdpXdpModeT mode)
+{
+    TRY
+    {
+        union bpf_attr attr;
+        memset(&attr, 0x00, sizeof(attr));
+        attr.link_create.prog_fd        = pXdp->progFd;
+        attr.link_create.target_ifindex = ifIndex;
+        attr.link_create.attach_type    = BPF_XDP;
+
+        if (mode == EPS_UDP_XDP_MODE_AUTO || mode == EPS_UDP_XDP_MODE_NATIVE)
+        {
+            attr.link_create.flags = XDP_FLAGS_DRV_MODE;
+            pXdp->linkFd = (int)syscall(__NR_bpf, BPF_LINK_CREATE, &attr, sizeof(attr));
+        }
+
+        if (pXdp->linkFd < 0 && mode != EPS_UDP_XDP_MODE_NATIVE)
+        {
+            attr.link_create.flags = XDP_FLAGS_SKB_MODE;
+            pXdp->linkFd = (int)syscall(__NR_bpf, BPF_LINK_CREATE, &attr, sizeof(attr));
+        }
+
+        if (pXdp->linkFd < 0)
+        {
+            THROW_ERROR(ERCD_EPS_OPERSYSTEM_ERROR, EpsGetSystemError(SYS_ERRNO));
+        }
+    }
+    CATCH
+    {
+    }
+    FINALLY
+    {
+        RETURN_RESCODE;
+    }
+}
+
+#endif /* __LINUX__ */
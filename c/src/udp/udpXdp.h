@@ -0,0 +1,142 @@
+/*
+ * Copyright (C) 2013, 2014 Shanghai Stock Exchange (SSE), Shanghai, China
+ * All Rights Reserved.
+ */
+
+/**
+ * @file    udpXdp.h
+ *
+ * UDP鲥AF_XDPնͷļ
+ *
+ * @version $Id
+ * @since   2026/10/18
+ */
+
+/**
+MODIFICATION HISTORY:
+<pre>
+================================================================================
+DD-MMM-YYYY INIT.    SIR    Modification Description
+----------- -------- ------ ----------------------------------------------------
+18-OCT-2026                 
+================================================================================
+</pre>
+*/
+
+#ifndef EPS_UDP_XDP_H
+#define EPS_UDP_XDP_H
+
+/**
+ * ͷļ
+ */
+
+#include "common.h"
+#include "epsTypes.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**
+ * 궨
+ */
+
+#define EPS_UDP_XDP_FRAME_SIZE      4096    /* UMEM֡ */
+#define EPS_UDP_XDP_FRAME_COUNT     1024    /* UMEM֡ͬʱΪ */
+#define EPS_UDP_XDP_BATCH_SIZE      64      /* νݱ */
+
+
+/**
+ * Ͷ
+ */
+
+/*
+ * AF_XDPģʽö
+ */
+typedef enum EpsUdpXdpModeTag
+{
+    EPS_UDP_XDP_MODE_NONE       = 0,    /* ãʹںUDPЭջ */
+    EPS_UDP_XDP_MODE_AUTO       = 1,    /* ģʽ֧ʱ˻Ϊͨģʽ */
+    EPS_UDP_XDP_MODE_NATIVE     = 2,    /* ģʽҪ֧XDP */
+    EPS_UDP_XDP_MODE_GENERIC    = 3,    /* ͨģʽveth/loopback */
+} EpsUdpXdpModeT;
+
+struct EpsUdpPacketTag;
+
+#if defined(__LINUX__)
+
+/*
+ * AF_XDPṹ
+ */
+typedef struct EpsUdpXdpRingTag
+{
+    uint32*     producer;                   /* ָ */
+    uint32*     consumer;                   /* ָ */
+    void*       ring;                       /*  */
+    uint32      mask;                       /*  */
+    void*       map;                        /* ӳַ */
+    size_t      mapLen;                     /* ӳ䳤 */
+} EpsUdpXdpRingT;
+
+/*
+ * AF_XDPն
+ */
+typedef struct EpsUdpXdpTag
+{
+    int         xsk;                        /* AF_XDP׽ */
+    int         mapFd;                      /* XSKMAPļ */
+    int         progFd;                     /* XDPļ */
+    int         linkFd;                     /* XDP */
+    char*       umem;                       /* UMEM */
+    EpsUdpXdpRingT fillRing;                /* 价 */
+    EpsUdpXdpRingT compRing;                /* ɻ */
+    EpsUdpXdpRingT rxRing;                  /* ջ */
+    uint32      rxPending;                  /* ѽմ黹 */
+    uint64      frameAddrs[EPS_UDP_XDP_BATCH_SIZE];/* ѽմ黹ַ֡ */
+} EpsUdpXdpT;
+
+
+/**
+ * 
+ */
+
+/*
+ * ʼAF_XDPն
+ */
+void InitUdpXdp(EpsUdpXdpT* pXdp);
+
+/*
+ * AF_XDP
+ */
+ResCodeT OpenUdpXdp(EpsUdpXdpT* pXdp, EpsUdpXdpModeT mode, uint32 queueId,
+        const char* localAddr, const char* mcAddr, uint16 mcPort);
+
+/*
+ * رAF_XDP
+ */
+void CloseUdpXdp(EpsUdpXdpT* pXdp);
+
+/*
+ * жAF_XDPǷ
+ */
+BOOL IsUdpXdpOpened(EpsUdpXdpT* pXdp);
+
+/*
+ * AF_XDPݱ
+ */
+ResCodeT ReceiveUdpXdp(EpsUdpXdpT* pXdp, struct EpsUdpPacketTag* pPackets,
+        uint32 maxCount, uint32* pPacketCount);
+
+/*
+ * 黹ѽյAF_XDP֡
+ */
+void ReleaseUdpXdp(EpsUdpXdpT* pXdp);
+
+#endif /* __LINUX__ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* EPS_UDP_XDP_H */